@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/abc.dir/src/base/main/main.c.o"
+  "CMakeFiles/abc.dir/src/base/main/main.c.o.d"
+  "abc"
+  "abc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/abc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,2231 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigCanon.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigCanon.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigCheck.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigCheck.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigCuts.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigCuts.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigDfs.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigDfs.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigDup.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigDup.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigFanout.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigFanout.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigFrames.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigFrames.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigInter.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigInter.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigJust.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigJust.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigMan.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigMan.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigMem.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigMem.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigMffc.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigMffc.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigObj.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigObj.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigOper.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigOper.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigOrder.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigOrder.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigPack.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigPack.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigPart.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigPart.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigPartReg.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigPartReg.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigPartSat.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigPartSat.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigRepr.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigRepr.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigRet.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigRet.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigRetF.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigRetF.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigScl.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigScl.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigShow.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigShow.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigSplit.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigSplit.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigTable.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigTable.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigTiming.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigTiming.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigTruth.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigTruth.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigTsim.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigTsim.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigUtil.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigUtil.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigWin.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/aig/aigWin.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaAgi.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaAgi.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaAig.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaAig.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaAiger.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaAiger.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaAigerExt.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaAigerExt.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaBalAig.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaBalAig.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaBalLut.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaBalLut.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaBalMap.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaBalMap.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaBidec.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaBidec.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaCCof.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaCCof.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaCSat.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaCSat.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaCSat2.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaCSat2.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaCSatOld.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaCSatOld.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaCTas.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaCTas.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaCex.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaCex.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaClp.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaClp.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaCof.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaCof.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaCone.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaCone.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaCut.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaCut.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaDfs.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaDfs.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaDup.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaDup.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaEdge.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaEdge.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaEmbed.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaEmbed.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaEnable.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaEnable.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaEquiv.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaEquiv.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaEra.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaEra.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaEra2.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaEra2.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaEsop.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaEsop.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaExist.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaExist.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaFalse.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaFalse.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaFanout.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaFanout.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaForce.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaForce.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaFrames.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaFrames.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaFront.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaFront.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaFx.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaFx.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaGig.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaGig.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaGlitch.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaGlitch.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaHash.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaHash.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaHashPar.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaHashPar.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaIf.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaIf.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaIff.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaIff.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaIiff.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaIiff.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaIso.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaIso.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaIso2.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaIso2.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaIso3.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaIso3.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaJf.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaJf.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaKf.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaKf.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaLevPar.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaLevPar.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaLf.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaLf.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaMan.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaMan.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaMem.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaMem.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaMf.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaMf.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaMfs.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaMfs.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaMini.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaMini.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaMuxes.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaMuxes.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaNf.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaNf.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaOf.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaOf.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaPack.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaPack.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaPat.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaPat.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaPf.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaPf.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaQbf.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaQbf.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaResub.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaResub.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaRetime.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaRetime.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaRex.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaRex.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaSat3.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaSat3.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaSatEdge.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaSatEdge.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaSatLE.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaSatLE.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaSatLut.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaSatLut.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaSatMap.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaSatMap.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaSatoko.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaSatoko.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaScl.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaScl.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaScript.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaScript.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaShow.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaShow.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaShrink.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaShrink.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaShrink6.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaShrink6.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaShrink7.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaShrink7.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaSim.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaSim.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaSim2.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaSim2.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaSimPar.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaSimPar.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaSort.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaSort.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaSpeedup.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaSpeedup.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaSplit.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaSplit.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaStg.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaStg.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaStr.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaStr.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaSupMin.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaSupMin.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaSupp.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaSupp.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaSweep.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaSweep.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaSweeper.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaSweeper.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaSwitch.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaSwitch.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaTim.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaTim.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaTis.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaTis.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaTruth.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaTruth.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaTsim.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaTsim.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaUnate.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaUnate.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaUtil.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/gia/giaUtil.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/hop/hopBalance.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/hop/hopBalance.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/hop/hopCheck.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/hop/hopCheck.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/hop/hopDfs.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/hop/hopDfs.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/hop/hopMan.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/hop/hopMan.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/hop/hopMem.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/hop/hopMem.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/hop/hopObj.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/hop/hopObj.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/hop/hopOper.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/hop/hopOper.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/hop/hopTable.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/hop/hopTable.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/hop/hopTruth.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/hop/hopTruth.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/hop/hopUtil.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/hop/hopUtil.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/ioa/ioaReadAig.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/ioa/ioaReadAig.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/ioa/ioaUtil.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/ioa/ioaUtil.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/ioa/ioaWriteAig.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/ioa/ioaWriteAig.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/ivy/ivyBalance.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/ivy/ivyBalance.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/ivy/ivyCanon.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/ivy/ivyCanon.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/ivy/ivyCheck.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/ivy/ivyCheck.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/ivy/ivyCut.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/ivy/ivyCut.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/ivy/ivyCutTrav.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/ivy/ivyCutTrav.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/ivy/ivyDfs.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/ivy/ivyDfs.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/ivy/ivyDsd.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/ivy/ivyDsd.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/ivy/ivyFanout.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/ivy/ivyFanout.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/ivy/ivyFastMap.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/ivy/ivyFastMap.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/ivy/ivyFraig.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/ivy/ivyFraig.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/ivy/ivyHaig.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/ivy/ivyHaig.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/ivy/ivyMan.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/ivy/ivyMan.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/ivy/ivyMem.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/ivy/ivyMem.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/ivy/ivyMulti.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/ivy/ivyMulti.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/ivy/ivyObj.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/ivy/ivyObj.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/ivy/ivyOper.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/ivy/ivyOper.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/ivy/ivyResyn.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/ivy/ivyResyn.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/ivy/ivyRwr.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/ivy/ivyRwr.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/ivy/ivySeq.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/ivy/ivySeq.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/ivy/ivyShow.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/ivy/ivyShow.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/ivy/ivyTable.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/ivy/ivyTable.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/ivy/ivyUtil.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/ivy/ivyUtil.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/saig/saigCkpt.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/saig/saigCkpt.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/saig/saigCone.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/saig/saigCone.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/saig/saigConstr.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/saig/saigConstr.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/saig/saigConstr2.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/saig/saigConstr2.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/saig/saigDual.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/saig/saigDual.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/saig/saigDup.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/saig/saigDup.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/saig/saigInd.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/saig/saigInd.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/saig/saigIoa.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/saig/saigIoa.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/saig/saigIso.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/saig/saigIso.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/saig/saigIsoFast.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/saig/saigIsoFast.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/saig/saigIsoSlow.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/saig/saigIsoSlow.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/saig/saigMiter.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/saig/saigMiter.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/saig/saigOutDec.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/saig/saigOutDec.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/saig/saigPhase.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/saig/saigPhase.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/saig/saigRetFwd.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/saig/saigRetFwd.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/saig/saigRetMin.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/saig/saigRetMin.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/saig/saigRetStep.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/saig/saigRetStep.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/saig/saigScl.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/saig/saigScl.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/saig/saigSimFast.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/saig/saigSimFast.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/saig/saigSimMv.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/saig/saigSimMv.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/saig/saigSimSeq.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/saig/saigSimSeq.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/saig/saigStrSim.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/saig/saigStrSim.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/saig/saigSwitch.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/saig/saigSwitch.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/saig/saigSynch.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/saig/saigSynch.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/saig/saigTempor.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/saig/saigTempor.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/saig/saigTrans.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/saig/saigTrans.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/aig/saig/saigWnd.c.o"
+  "CMakeFiles/libabc-pic.dir/src/aig/saig/saigWnd.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abc/abcAig.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abc/abcAig.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abc/abcBarBuf.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abc/abcBarBuf.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abc/abcBlifMv.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abc/abcBlifMv.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abc/abcCheck.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abc/abcCheck.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abc/abcDfs.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abc/abcDfs.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abc/abcFanOrder.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abc/abcFanOrder.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abc/abcFanio.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abc/abcFanio.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abc/abcFunc.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abc/abcFunc.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abc/abcHie.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abc/abcHie.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abc/abcHieCec.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abc/abcHieCec.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abc/abcHieGia.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abc/abcHieGia.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abc/abcHieNew.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abc/abcHieNew.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abc/abcLatch.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abc/abcLatch.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abc/abcLib.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abc/abcLib.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abc/abcMinBase.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abc/abcMinBase.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abc/abcNames.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abc/abcNames.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abc/abcNetlist.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abc/abcNetlist.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abc/abcNtk.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abc/abcNtk.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abc/abcObj.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abc/abcObj.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abc/abcRefs.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abc/abcRefs.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abc/abcShow.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abc/abcShow.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abc/abcSop.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abc/abcSop.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abc/abcUtil.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abc/abcUtil.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abc.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abc.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcAttach.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcAttach.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcAuto.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcAuto.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcBalance.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcBalance.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcBidec.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcBidec.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcBm.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcBm.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcBmc.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcBmc.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcCas.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcCas.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcCascade.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcCascade.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcCollapse.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcCollapse.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcCut.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcCut.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcDar.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcDar.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcDebug.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcDebug.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcDec.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcDec.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcDetect.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcDetect.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcDress.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcDress.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcDress2.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcDress2.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcDress3.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcDress3.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcDsd.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcDsd.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcEco.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcEco.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcExact.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcExact.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcExtract.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcExtract.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcFraig.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcFraig.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcFx.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcFx.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcFxu.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcFxu.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcGen.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcGen.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcHaig.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcHaig.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcIf.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcIf.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcIfMux.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcIfMux.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcIfif.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcIfif.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcIvy.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcIvy.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcLog.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcLog.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcLut.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcLut.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcLutmin.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcLutmin.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcMap.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcMap.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcMerge.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcMerge.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcMfs.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcMfs.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcMini.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcMini.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcMiter.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcMiter.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcMulti.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcMulti.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcNpn.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcNpn.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcNpnSave.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcNpnSave.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcNtbdd.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcNtbdd.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcOdc.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcOdc.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcOrder.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcOrder.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcPart.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcPart.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcPrint.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcPrint.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcProve.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcProve.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcQbf.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcQbf.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcQuant.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcQuant.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcReach.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcReach.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcRec3.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcRec3.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcReconv.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcReconv.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcRefactor.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcRefactor.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcRenode.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcRenode.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcReorder.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcReorder.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcRestruct.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcRestruct.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcResub.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcResub.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcRewrite.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcRewrite.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcRpo.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcRpo.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcRr.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcRr.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcRunGen.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcRunGen.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcSat.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcSat.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcSaucy.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcSaucy.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcScorr.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcScorr.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcSense.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcSense.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcSpeedup.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcSpeedup.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcStrash.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcStrash.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcSweep.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcSweep.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcSymm.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcSymm.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcTim.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcTim.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcTiming.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcTiming.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcUnate.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcUnate.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcUnreach.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcUnreach.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcVerify.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcVerify.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcXsim.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/abci/abcXsim.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/acb/acbAbc.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/acb/acbAbc.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/acb/acbAig.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/acb/acbAig.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/acb/acbCom.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/acb/acbCom.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/acb/acbFunc.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/acb/acbFunc.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/acb/acbMfs.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/acb/acbMfs.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/acb/acbPush.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/acb/acbPush.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/acb/acbSets.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/acb/acbSets.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/acb/acbUtil.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/acb/acbUtil.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/bac/bacBac.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/bac/bacBac.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/bac/bacBlast.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/bac/bacBlast.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/bac/bacCom.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/bac/bacCom.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/bac/bacLib.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/bac/bacLib.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/bac/bacNtk.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/bac/bacNtk.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/bac/bacPrsBuild.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/bac/bacPrsBuild.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/bac/bacPrsTrans.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/bac/bacPrsTrans.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/bac/bacPtr.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/bac/bacPtr.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/bac/bacPtrAbc.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/bac/bacPtrAbc.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/bac/bacReadBlif.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/bac/bacReadBlif.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/bac/bacReadSmt.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/bac/bacReadSmt.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/bac/bacReadVer.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/bac/bacReadVer.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/bac/bacWriteBlif.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/bac/bacWriteBlif.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/bac/bacWriteSmt.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/bac/bacWriteSmt.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/bac/bacWriteVer.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/bac/bacWriteVer.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/cba/cbaBlast.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/cba/cbaBlast.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/cba/cbaCba.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/cba/cbaCba.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/cba/cbaCom.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/cba/cbaCom.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/cba/cbaNtk.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/cba/cbaNtk.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/cba/cbaReadBlif.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/cba/cbaReadBlif.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/cba/cbaReadVer.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/cba/cbaReadVer.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/cba/cbaWriteBlif.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/cba/cbaWriteBlif.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/cba/cbaWriteVer.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/cba/cbaWriteVer.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/cmd/cmd.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/cmd/cmd.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/cmd/cmdAlias.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/cmd/cmdAlias.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/cmd/cmdApi.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/cmd/cmdApi.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/cmd/cmdAuto.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/cmd/cmdAuto.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/cmd/cmdFlag.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/cmd/cmdFlag.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/cmd/cmdHist.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/cmd/cmdHist.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/cmd/cmdLoad.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/cmd/cmdLoad.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/cmd/cmdPlugin.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/cmd/cmdPlugin.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/cmd/cmdStarter.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/cmd/cmdStarter.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/cmd/cmdUtils.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/cmd/cmdUtils.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/exor/exor.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/exor/exor.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/exor/exorBits.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/exor/exorBits.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/exor/exorCubes.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/exor/exorCubes.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/exor/exorLink.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/exor/exorLink.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/exor/exorList.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/exor/exorList.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/exor/exorUtil.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/exor/exorUtil.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/io/io.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/io/io.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioJson.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioJson.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioReadAiger.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioReadAiger.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioReadBaf.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioReadBaf.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioReadBblif.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioReadBblif.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioReadBench.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioReadBench.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioReadBlif.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioReadBlif.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioReadBlifAig.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioReadBlifAig.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioReadBlifMv.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioReadBlifMv.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioReadDsd.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioReadDsd.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioReadEdif.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioReadEdif.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioReadEqn.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioReadEqn.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioReadPla.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioReadPla.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioReadPlaMo.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioReadPlaMo.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioReadVerilog.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioReadVerilog.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioUtil.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioUtil.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioWriteAiger.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioWriteAiger.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioWriteBaf.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioWriteBaf.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioWriteBblif.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioWriteBblif.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioWriteBench.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioWriteBench.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioWriteBlif.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioWriteBlif.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioWriteBlifMv.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioWriteBlifMv.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioWriteBook.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioWriteBook.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioWriteCnf.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioWriteCnf.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioWriteDot.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioWriteDot.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioWriteEqn.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioWriteEqn.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioWriteGml.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioWriteGml.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioWriteList.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioWriteList.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioWritePla.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioWritePla.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioWriteSmv.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioWriteSmv.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioWriteVerilog.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/io/ioWriteVerilog.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/main/libSupport.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/main/libSupport.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/main/mainFrame.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/main/mainFrame.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/main/mainInit.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/main/mainInit.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/main/mainLib.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/main/mainLib.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/main/mainReal.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/main/mainReal.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/main/mainUtils.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/main/mainUtils.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/pla/plaCom.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/pla/plaCom.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/pla/plaHash.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/pla/plaHash.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/pla/plaMan.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/pla/plaMan.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/pla/plaMerge.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/pla/plaMerge.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/pla/plaRead.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/pla/plaRead.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/pla/plaSimple.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/pla/plaSimple.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/pla/plaWrite.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/pla/plaWrite.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/test/test.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/test/test.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/ver/verCore.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/ver/verCore.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/ver/verFormula.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/ver/verFormula.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/ver/verParse.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/ver/verParse.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/ver/verStream.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/ver/verStream.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/wlc/wlcAbc.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/wlc/wlcAbc.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/wlc/wlcAbs.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/wlc/wlcAbs.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/wlc/wlcAbs2.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/wlc/wlcAbs2.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/wlc/wlcBlast.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/wlc/wlcBlast.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/wlc/wlcCom.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/wlc/wlcCom.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/wlc/wlcGraft.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/wlc/wlcGraft.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/wlc/wlcJson.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/wlc/wlcJson.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/wlc/wlcMem.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/wlc/wlcMem.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/wlc/wlcNdr.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/wlc/wlcNdr.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/wlc/wlcNtk.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/wlc/wlcNtk.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/wlc/wlcPth.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/wlc/wlcPth.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/wlc/wlcReadSmt.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/wlc/wlcReadSmt.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/wlc/wlcReadVer.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/wlc/wlcReadVer.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/wlc/wlcShow.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/wlc/wlcShow.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/wlc/wlcSim.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/wlc/wlcSim.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/wlc/wlcStdin.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/wlc/wlcStdin.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/wlc/wlcUif.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/wlc/wlcUif.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/wlc/wlcWin.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/wlc/wlcWin.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/wlc/wlcWriteVer.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/wlc/wlcWriteVer.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/wln/wln.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/wln/wln.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/wln/wlnMem.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/wln/wlnMem.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/wln/wlnNdr.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/wln/wlnNdr.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/wln/wlnNtk.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/wln/wlnNtk.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/wln/wlnObj.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/wln/wlnObj.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/wln/wlnRetime.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/wln/wlnRetime.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/wln/wlnWlc.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/wln/wlnWlc.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/base/wln/wlnWriteVer.c.o"
+  "CMakeFiles/libabc-pic.dir/src/base/wln/wlnWriteVer.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/bbr/bbrCex.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/bbr/bbrCex.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/bbr/bbrImage.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/bbr/bbrImage.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/bbr/bbrNtbdd.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/bbr/bbrNtbdd.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/bbr/bbrReach.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/bbr/bbrReach.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cas/casCore.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cas/casCore.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cas/casDec.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cas/casDec.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddAPI.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddAPI.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddAddAbs.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddAddAbs.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddAddApply.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddAddApply.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddAddFind.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddAddFind.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddAddInv.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddAddInv.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddAddIte.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddAddIte.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddAddNeg.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddAddNeg.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddAddWalsh.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddAddWalsh.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddAndAbs.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddAndAbs.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddAnneal.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddAnneal.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddApa.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddApa.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddApprox.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddApprox.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddBddAbs.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddBddAbs.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddBddCorr.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddBddCorr.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddBddIte.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddBddIte.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddBridge.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddBridge.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddCache.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddCache.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddCheck.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddCheck.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddClip.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddClip.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddCof.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddCof.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddCompose.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddCompose.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddDecomp.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddDecomp.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddEssent.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddEssent.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddExact.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddExact.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddExport.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddExport.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddGenCof.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddGenCof.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddGenetic.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddGenetic.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddGroup.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddGroup.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddHarwell.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddHarwell.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddInit.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddInit.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddInteract.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddInteract.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddLCache.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddLCache.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddLevelQ.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddLevelQ.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddLinear.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddLinear.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddLiteral.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddLiteral.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddMatMult.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddMatMult.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddPriority.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddPriority.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddRead.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddRead.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddRef.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddRef.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddReorder.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddReorder.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddSat.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddSat.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddSign.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddSign.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddSolve.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddSolve.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddSplit.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddSplit.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddSubsetHB.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddSubsetHB.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddSubsetSP.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddSubsetSP.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddSymmetry.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddSymmetry.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddTable.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddTable.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddUtil.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddUtil.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddWindow.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddWindow.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddZddCount.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddZddCount.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddZddFuncs.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddZddFuncs.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddZddGroup.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddZddGroup.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddZddIsop.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddZddIsop.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddZddLin.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddZddLin.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddZddMisc.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddZddMisc.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddZddPort.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddZddPort.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddZddReord.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddZddReord.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddZddSetop.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddZddSetop.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddZddSymm.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddZddSymm.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddZddUtil.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/cudd/cuddZddUtil.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/dsd/dsdApi.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/dsd/dsdApi.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/dsd/dsdCheck.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/dsd/dsdCheck.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/dsd/dsdLocal.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/dsd/dsdLocal.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/dsd/dsdMan.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/dsd/dsdMan.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/dsd/dsdProc.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/dsd/dsdProc.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/dsd/dsdTree.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/dsd/dsdTree.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/epd/epd.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/epd/epd.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/extrab/extraBddAuto.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/extrab/extraBddAuto.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/extrab/extraBddCas.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/extrab/extraBddCas.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/extrab/extraBddImage.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/extrab/extraBddImage.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/extrab/extraBddKmap.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/extrab/extraBddKmap.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/extrab/extraBddMaxMin.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/extrab/extraBddMaxMin.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/extrab/extraBddMisc.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/extrab/extraBddMisc.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/extrab/extraBddSet.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/extrab/extraBddSet.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/extrab/extraBddSymm.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/extrab/extraBddSymm.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/extrab/extraBddThresh.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/extrab/extraBddThresh.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/extrab/extraBddTime.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/extrab/extraBddTime.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/extrab/extraBddUnate.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/extrab/extraBddUnate.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/llb/llb1Cluster.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/llb/llb1Cluster.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/llb/llb1Constr.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/llb/llb1Constr.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/llb/llb1Core.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/llb/llb1Core.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/llb/llb1Group.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/llb/llb1Group.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/llb/llb1Hint.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/llb/llb1Hint.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/llb/llb1Man.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/llb/llb1Man.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/llb/llb1Matrix.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/llb/llb1Matrix.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/llb/llb1Pivot.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/llb/llb1Pivot.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/llb/llb1Reach.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/llb/llb1Reach.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/llb/llb1Sched.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/llb/llb1Sched.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/llb/llb2Bad.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/llb/llb2Bad.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/llb/llb2Core.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/llb/llb2Core.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/llb/llb2Driver.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/llb/llb2Driver.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/llb/llb2Dump.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/llb/llb2Dump.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/llb/llb2Flow.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/llb/llb2Flow.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/llb/llb2Image.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/llb/llb2Image.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/llb/llb3Image.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/llb/llb3Image.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/llb/llb3Nonlin.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/llb/llb3Nonlin.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/llb/llb4Cex.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/llb/llb4Cex.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/llb/llb4Image.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/llb/llb4Image.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/llb/llb4Nonlin.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/llb/llb4Nonlin.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/llb/llb4Sweep.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/llb/llb4Sweep.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/mtr/mtrBasic.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/mtr/mtrBasic.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/mtr/mtrGroup.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/mtr/mtrGroup.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/reo/reoApi.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/reo/reoApi.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/reo/reoCore.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/reo/reoCore.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/reo/reoProfile.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/reo/reoProfile.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/reo/reoShuffle.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/reo/reoShuffle.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/reo/reoSift.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/reo/reoSift.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/reo/reoSwap.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/reo/reoSwap.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/reo/reoTransfer.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/reo/reoTransfer.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bdd/reo/reoUnits.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bdd/reo/reoUnits.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bool/bdc/bdcCore.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bool/bdc/bdcCore.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bool/bdc/bdcDec.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bool/bdc/bdcDec.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bool/bdc/bdcSpfd.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bool/bdc/bdcSpfd.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bool/bdc/bdcTable.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bool/bdc/bdcTable.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bool/dec/decAbc.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bool/dec/decAbc.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bool/dec/decFactor.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bool/dec/decFactor.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bool/dec/decMan.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bool/dec/decMan.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bool/dec/decPrint.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bool/dec/decPrint.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bool/dec/decUtil.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bool/dec/decUtil.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bool/kit/cloud.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bool/kit/cloud.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bool/kit/kitAig.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bool/kit/kitAig.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bool/kit/kitBdd.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bool/kit/kitBdd.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bool/kit/kitCloud.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bool/kit/kitCloud.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bool/kit/kitDsd.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bool/kit/kitDsd.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bool/kit/kitFactor.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bool/kit/kitFactor.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bool/kit/kitGraph.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bool/kit/kitGraph.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bool/kit/kitHop.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bool/kit/kitHop.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bool/kit/kitIsop.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bool/kit/kitIsop.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bool/kit/kitPla.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bool/kit/kitPla.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bool/kit/kitSop.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bool/kit/kitSop.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bool/kit/kitTruth.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bool/kit/kitTruth.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bool/lucky/lucky.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bool/lucky/lucky.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bool/lucky/luckyFast16.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bool/lucky/luckyFast16.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bool/lucky/luckyFast6.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bool/lucky/luckyFast6.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bool/lucky/luckyRead.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bool/lucky/luckyRead.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bool/lucky/luckySimple.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bool/lucky/luckySimple.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bool/lucky/luckySwap.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bool/lucky/luckySwap.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bool/lucky/luckySwapIJ.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bool/lucky/luckySwapIJ.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bool/rpo/rpo.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bool/rpo/rpo.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bool/rsb/rsbDec6.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bool/rsb/rsbDec6.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/bool/rsb/rsbMan.c.o"
+  "CMakeFiles/libabc-pic.dir/src/bool/rsb/rsbMan.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/amap/amapCore.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/amap/amapCore.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/amap/amapGraph.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/amap/amapGraph.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/amap/amapLib.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/amap/amapLib.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/amap/amapLiberty.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/amap/amapLiberty.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/amap/amapMan.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/amap/amapMan.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/amap/amapMatch.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/amap/amapMatch.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/amap/amapMerge.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/amap/amapMerge.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/amap/amapOutput.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/amap/amapOutput.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/amap/amapParse.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/amap/amapParse.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/amap/amapPerm.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/amap/amapPerm.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/amap/amapRead.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/amap/amapRead.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/amap/amapRule.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/amap/amapRule.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/amap/amapUniq.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/amap/amapUniq.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/cov/covBuild.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/cov/covBuild.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/cov/covCore.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/cov/covCore.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/cov/covMan.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/cov/covMan.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/cov/covMinEsop.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/cov/covMinEsop.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/cov/covMinMan.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/cov/covMinMan.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/cov/covMinSop.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/cov/covMinSop.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/cov/covMinUtil.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/cov/covMinUtil.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/if/ifCache.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/if/ifCache.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/if/ifCom.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/if/ifCom.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/if/ifCore.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/if/ifCore.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/if/ifCut.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/if/ifCut.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/if/ifData2.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/if/ifData2.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/if/ifDec07.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/if/ifDec07.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/if/ifDec08.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/if/ifDec08.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/if/ifDec10.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/if/ifDec10.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/if/ifDec16.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/if/ifDec16.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/if/ifDec75.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/if/ifDec75.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/if/ifDelay.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/if/ifDelay.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/if/ifDsd.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/if/ifDsd.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/if/ifLibBox.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/if/ifLibBox.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/if/ifLibLut.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/if/ifLibLut.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/if/ifMan.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/if/ifMan.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/if/ifMap.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/if/ifMap.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/if/ifMatch2.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/if/ifMatch2.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/if/ifReduce.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/if/ifReduce.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/if/ifSat.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/if/ifSat.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/if/ifSelect.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/if/ifSelect.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/if/ifSeq.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/if/ifSeq.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/if/ifTest.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/if/ifTest.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/if/ifTime.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/if/ifTime.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/if/ifTruth.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/if/ifTruth.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/if/ifTune.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/if/ifTune.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/if/ifUtil.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/if/ifUtil.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/mapper/mapper.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/mapper/mapper.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/mapper/mapperCanon.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/mapper/mapperCanon.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/mapper/mapperCore.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/mapper/mapperCore.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/mapper/mapperCreate.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/mapper/mapperCreate.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/mapper/mapperCut.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/mapper/mapperCut.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/mapper/mapperCutUtils.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/mapper/mapperCutUtils.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/mapper/mapperLib.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/mapper/mapperLib.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/mapper/mapperMatch.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/mapper/mapperMatch.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/mapper/mapperRefs.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/mapper/mapperRefs.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/mapper/mapperSuper.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/mapper/mapperSuper.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/mapper/mapperSwitch.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/mapper/mapperSwitch.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/mapper/mapperTable.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/mapper/mapperTable.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/mapper/mapperTime.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/mapper/mapperTime.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/mapper/mapperTree.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/mapper/mapperTree.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/mapper/mapperTruth.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/mapper/mapperTruth.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/mapper/mapperUtils.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/mapper/mapperUtils.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/mapper/mapperVec.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/mapper/mapperVec.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/mio/mio.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/mio/mio.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/mio/mioApi.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/mio/mioApi.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/mio/mioFunc.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/mio/mioFunc.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/mio/mioParse.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/mio/mioParse.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/mio/mioRead.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/mio/mioRead.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/mio/mioSop.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/mio/mioSop.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/mio/mioUtils.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/mio/mioUtils.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/mpm/mpmAbc.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/mpm/mpmAbc.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/mpm/mpmCore.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/mpm/mpmCore.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/mpm/mpmDsd.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/mpm/mpmDsd.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/mpm/mpmGates.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/mpm/mpmGates.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/mpm/mpmLib.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/mpm/mpmLib.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/mpm/mpmMan.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/mpm/mpmMan.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/mpm/mpmMap.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/mpm/mpmMap.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/mpm/mpmMig.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/mpm/mpmMig.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/mpm/mpmPre.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/mpm/mpmPre.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/mpm/mpmTruth.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/mpm/mpmTruth.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/mpm/mpmUtil.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/mpm/mpmUtil.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/scl/scl.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/scl/scl.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/scl/sclBufSize.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/scl/sclBufSize.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/scl/sclBuffer.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/scl/sclBuffer.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/scl/sclDnsize.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/scl/sclDnsize.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/scl/sclLibImage.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/scl/sclLibImage.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/scl/sclLibScl.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/scl/sclLibScl.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/scl/sclLibUtil.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/scl/sclLibUtil.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/scl/sclLiberty.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/scl/sclLiberty.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/scl/sclLoad.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/scl/sclLoad.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/scl/sclSize.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/scl/sclSize.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/scl/sclTimePar.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/scl/sclTimePar.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/scl/sclUpsize.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/scl/sclUpsize.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/scl/sclUpsizePar.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/scl/sclUpsizePar.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/scl/sclUtil.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/scl/sclUtil.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/super/super.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/super/super.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/super/superAnd.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/super/superAnd.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/map/super/superGate.c.o"
+  "CMakeFiles/libabc-pic.dir/src/map/super/superGate.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/bar/bar.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/bar/bar.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/bbl/bblif.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/bbl/bblif.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/bzlib/blocksort.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/bzlib/blocksort.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/bzlib/bzlib.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/bzlib/bzlib.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/bzlib/compress.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/bzlib/compress.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/bzlib/crctable.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/bzlib/crctable.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/bzlib/decompress.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/bzlib/decompress.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/bzlib/huffman.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/bzlib/huffman.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/bzlib/randtable.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/bzlib/randtable.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/extra/extraUtilBitMatrix.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/extra/extraUtilBitMatrix.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/extra/extraUtilCanon.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/extra/extraUtilCanon.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/extra/extraUtilCfs.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/extra/extraUtilCfs.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/extra/extraUtilCube.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/extra/extraUtilCube.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/extra/extraUtilDsd.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/extra/extraUtilDsd.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/extra/extraUtilEnum.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/extra/extraUtilEnum.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/extra/extraUtilFile.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/extra/extraUtilFile.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/extra/extraUtilGen.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/extra/extraUtilGen.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/extra/extraUtilMacc.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/extra/extraUtilMacc.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/extra/extraUtilMaj.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/extra/extraUtilMaj.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/extra/extraUtilMemory.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/extra/extraUtilMemory.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/extra/extraUtilMisc.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/extra/extraUtilMisc.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/extra/extraUtilMult.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/extra/extraUtilMult.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/extra/extraUtilPath.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/extra/extraUtilPath.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/extra/extraUtilPerm.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/extra/extraUtilPerm.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/extra/extraUtilProgress.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/extra/extraUtilProgress.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/extra/extraUtilReader.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/extra/extraUtilReader.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/extra/extraUtilSupp.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/extra/extraUtilSupp.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/extra/extraUtilTruth.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/extra/extraUtilTruth.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/extra/extraUtilUtil.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/extra/extraUtilUtil.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/mem/mem.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/mem/mem.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/mvc/mvcApi.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/mvc/mvcApi.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/mvc/mvcCompare.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/mvc/mvcCompare.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/mvc/mvcContain.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/mvc/mvcContain.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/mvc/mvcCover.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/mvc/mvcCover.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/mvc/mvcCube.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/mvc/mvcCube.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/mvc/mvcDivide.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/mvc/mvcDivide.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/mvc/mvcDivisor.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/mvc/mvcDivisor.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/mvc/mvcList.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/mvc/mvcList.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/mvc/mvcLits.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/mvc/mvcLits.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/mvc/mvcMan.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/mvc/mvcMan.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/mvc/mvcOpAlg.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/mvc/mvcOpAlg.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/mvc/mvcOpBool.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/mvc/mvcOpBool.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/mvc/mvcPrint.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/mvc/mvcPrint.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/mvc/mvcSort.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/mvc/mvcSort.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/mvc/mvcUtils.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/mvc/mvcUtils.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/nm/nmApi.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/nm/nmApi.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/nm/nmTable.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/nm/nmTable.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/parse/parseEqn.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/parse/parseEqn.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/parse/parseStack.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/parse/parseStack.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/st/st.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/st/st.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/st/stmm.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/st/stmm.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/tim/timBox.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/tim/timBox.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/tim/timDump.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/tim/timDump.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/tim/timMan.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/tim/timMan.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/tim/timTime.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/tim/timTime.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/tim/timTrav.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/tim/timTrav.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/util/utilBridge.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/util/utilBridge.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/util/utilCex.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/util/utilCex.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/util/utilColor.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/util/utilColor.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/util/utilFile.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/util/utilFile.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/util/utilIsop.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/util/utilIsop.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/util/utilNam.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/util/utilNam.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/util/utilSignal.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/util/utilSignal.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/util/utilSort.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/util/utilSort.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/zlib/adler32.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/zlib/adler32.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/zlib/compress_.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/zlib/compress_.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/zlib/crc32.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/zlib/crc32.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/zlib/deflate.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/zlib/deflate.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/zlib/gzclose.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/zlib/gzclose.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/zlib/gzlib.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/zlib/gzlib.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/zlib/gzread.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/zlib/gzread.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/zlib/gzwrite.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/zlib/gzwrite.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/zlib/infback.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/zlib/infback.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/zlib/inffast.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/zlib/inffast.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/zlib/inflate.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/zlib/inflate.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/zlib/inftrees.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/zlib/inftrees.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/zlib/trees.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/zlib/trees.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/zlib/uncompr.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/zlib/uncompr.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/misc/zlib/zutil.c.o"
+  "CMakeFiles/libabc-pic.dir/src/misc/zlib/zutil.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/cgt/cgtAig.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/cgt/cgtAig.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/cgt/cgtCore.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/cgt/cgtCore.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/cgt/cgtDecide.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/cgt/cgtDecide.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/cgt/cgtMan.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/cgt/cgtMan.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/cgt/cgtSat.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/cgt/cgtSat.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/csw/cswCore.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/csw/cswCore.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/csw/cswCut.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/csw/cswCut.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/csw/cswMan.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/csw/cswMan.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/csw/cswTable.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/csw/cswTable.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/cut/cutApi.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/cut/cutApi.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/cut/cutCut.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/cut/cutCut.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/cut/cutMan.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/cut/cutMan.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/cut/cutMerge.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/cut/cutMerge.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/cut/cutNode.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/cut/cutNode.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/cut/cutOracle.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/cut/cutOracle.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/cut/cutPre22.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/cut/cutPre22.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/cut/cutSeq.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/cut/cutSeq.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/cut/cutTruth.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/cut/cutTruth.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/dar/darBalance.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/dar/darBalance.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/dar/darCore.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/dar/darCore.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/dar/darCut.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/dar/darCut.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/dar/darData.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/dar/darData.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/dar/darLib.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/dar/darLib.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/dar/darMan.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/dar/darMan.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/dar/darPrec.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/dar/darPrec.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/dar/darRefact.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/dar/darRefact.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/dar/darScript.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/dar/darScript.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/dau/dauCache.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/dau/dauCache.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/dau/dauCanon.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/dau/dauCanon.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/dau/dauCore.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/dau/dauCore.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/dau/dauCount.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/dau/dauCount.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/dau/dauDivs.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/dau/dauDivs.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/dau/dauDsd.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/dau/dauDsd.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/dau/dauEnum.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/dau/dauEnum.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/dau/dauGia.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/dau/dauGia.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/dau/dauMerge.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/dau/dauMerge.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/dau/dauNonDsd.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/dau/dauNonDsd.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/dau/dauNpn.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/dau/dauNpn.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/dau/dauNpn2.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/dau/dauNpn2.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/dau/dauTree.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/dau/dauTree.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/dsc/dsc.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/dsc/dsc.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/fret/fretFlow.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/fret/fretFlow.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/fret/fretInit.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/fret/fretInit.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/fret/fretMain.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/fret/fretMain.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/fret/fretTime.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/fret/fretTime.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/fxch/Fxch.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/fxch/Fxch.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/fxch/FxchDiv.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/fxch/FxchDiv.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/fxch/FxchMan.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/fxch/FxchMan.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/fxch/FxchSCHashTable.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/fxch/FxchSCHashTable.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/fxu/fxu.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/fxu/fxu.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/fxu/fxuCreate.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/fxu/fxuCreate.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/fxu/fxuHeapD.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/fxu/fxuHeapD.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/fxu/fxuHeapS.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/fxu/fxuHeapS.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/fxu/fxuList.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/fxu/fxuList.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/fxu/fxuMatrix.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/fxu/fxuMatrix.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/fxu/fxuPair.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/fxu/fxuPair.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/fxu/fxuPrint.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/fxu/fxuPrint.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/fxu/fxuReduce.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/fxu/fxuReduce.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/fxu/fxuSelect.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/fxu/fxuSelect.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/fxu/fxuSingle.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/fxu/fxuSingle.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/fxu/fxuUpdate.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/fxu/fxuUpdate.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/lpk/lpkAbcDec.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/lpk/lpkAbcDec.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/lpk/lpkAbcDsd.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/lpk/lpkAbcDsd.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/lpk/lpkAbcMux.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/lpk/lpkAbcMux.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/lpk/lpkAbcUtil.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/lpk/lpkAbcUtil.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/lpk/lpkCore.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/lpk/lpkCore.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/lpk/lpkCut.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/lpk/lpkCut.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/lpk/lpkMan.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/lpk/lpkMan.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/lpk/lpkMap.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/lpk/lpkMap.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/lpk/lpkMulti.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/lpk/lpkMulti.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/lpk/lpkMux.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/lpk/lpkMux.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/lpk/lpkSets.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/lpk/lpkSets.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/mfs/mfsCore.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/mfs/mfsCore.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/mfs/mfsDiv.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/mfs/mfsDiv.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/mfs/mfsInter.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/mfs/mfsInter.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/mfs/mfsMan.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/mfs/mfsMan.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/mfs/mfsResub.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/mfs/mfsResub.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/mfs/mfsSat.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/mfs/mfsSat.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/mfs/mfsStrash.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/mfs/mfsStrash.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/mfs/mfsWin.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/mfs/mfsWin.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/nwk/nwkAig.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/nwk/nwkAig.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/nwk/nwkBidec.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/nwk/nwkBidec.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/nwk/nwkCheck.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/nwk/nwkCheck.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/nwk/nwkDfs.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/nwk/nwkDfs.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/nwk/nwkFanio.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/nwk/nwkFanio.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/nwk/nwkFlow.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/nwk/nwkFlow.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/nwk/nwkMan.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/nwk/nwkMan.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/nwk/nwkMap.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/nwk/nwkMap.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/nwk/nwkMerge.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/nwk/nwkMerge.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/nwk/nwkObj.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/nwk/nwkObj.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/nwk/nwkSpeedup.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/nwk/nwkSpeedup.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/nwk/nwkStrash.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/nwk/nwkStrash.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/nwk/nwkTiming.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/nwk/nwkTiming.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/nwk/nwkUtil.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/nwk/nwkUtil.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/res/resCore.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/res/resCore.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/res/resDivs.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/res/resDivs.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/res/resFilter.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/res/resFilter.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/res/resSat.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/res/resSat.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/res/resSim.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/res/resSim.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/res/resStrash.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/res/resStrash.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/res/resWin.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/res/resWin.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/ret/retArea.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/ret/retArea.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/ret/retCore.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/ret/retCore.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/ret/retDelay.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/ret/retDelay.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/ret/retFlow.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/ret/retFlow.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/ret/retIncrem.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/ret/retIncrem.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/ret/retInit.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/ret/retInit.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/ret/retLvalue.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/ret/retLvalue.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/rwr/rwrDec.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/rwr/rwrDec.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/rwr/rwrEva.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/rwr/rwrEva.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/rwr/rwrExp.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/rwr/rwrExp.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/rwr/rwrLib.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/rwr/rwrLib.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/rwr/rwrMan.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/rwr/rwrMan.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/rwr/rwrPrint.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/rwr/rwrPrint.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/rwr/rwrUtil.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/rwr/rwrUtil.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/rwt/rwtDec.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/rwt/rwtDec.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/rwt/rwtMan.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/rwt/rwtMan.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/rwt/rwtUtil.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/rwt/rwtUtil.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/sbd/sbd.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/sbd/sbd.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/sbd/sbdCnf.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/sbd/sbdCnf.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/sbd/sbdCore.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/sbd/sbdCore.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/sbd/sbdCut.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/sbd/sbdCut.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/sbd/sbdCut2.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/sbd/sbdCut2.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/sbd/sbdLut.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/sbd/sbdLut.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/sbd/sbdPath.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/sbd/sbdPath.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/sbd/sbdSat.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/sbd/sbdSat.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/sbd/sbdWin.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/sbd/sbdWin.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/sfm/sfmArea.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/sfm/sfmArea.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/sfm/sfmCnf.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/sfm/sfmCnf.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/sfm/sfmCore.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/sfm/sfmCore.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/sfm/sfmDec.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/sfm/sfmDec.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/sfm/sfmLib.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/sfm/sfmLib.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/sfm/sfmMit.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/sfm/sfmMit.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/sfm/sfmNtk.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/sfm/sfmNtk.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/sfm/sfmSat.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/sfm/sfmSat.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/sfm/sfmTim.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/sfm/sfmTim.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/sfm/sfmWin.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/sfm/sfmWin.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/sim/simMan.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/sim/simMan.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/sim/simSeq.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/sim/simSeq.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/sim/simSupp.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/sim/simSupp.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/sim/simSwitch.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/sim/simSwitch.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/sim/simSym.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/sim/simSym.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/sim/simSymSat.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/sim/simSymSat.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/sim/simSymSim.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/sim/simSymSim.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/sim/simSymStr.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/sim/simSymStr.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/opt/sim/simUtils.c.o"
+  "CMakeFiles/libabc-pic.dir/src/opt/sim/simUtils.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/abs/absDup.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/abs/absDup.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/abs/absGla.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/abs/absGla.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/abs/absGlaOld.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/abs/absGlaOld.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/abs/absIter.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/abs/absIter.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/abs/absOldCex.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/abs/absOldCex.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/abs/absOldRef.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/abs/absOldRef.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/abs/absOldSat.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/abs/absOldSat.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/abs/absOldSim.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/abs/absOldSim.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/abs/absOut.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/abs/absOut.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/abs/absPth.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/abs/absPth.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/abs/absRef.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/abs/absRef.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/abs/absRefSelect.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/abs/absRefSelect.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/abs/absRpm.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/abs/absRpm.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/abs/absRpmOld.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/abs/absRpmOld.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/abs/absUtil.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/abs/absUtil.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/abs/absVta.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/abs/absVta.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/acec/acec2Mult.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/acec/acec2Mult.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/acec/acecBo.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/acec/acecBo.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/acec/acecCl.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/acec/acecCl.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/acec/acecCo.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/acec/acecCo.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/acec/acecCore.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/acec/acecCore.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/acec/acecCover.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/acec/acecCover.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/acec/acecFadds.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/acec/acecFadds.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/acec/acecMult.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/acec/acecMult.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/acec/acecNorm.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/acec/acecNorm.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/acec/acecOrder.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/acec/acecOrder.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/acec/acecPa.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/acec/acecPa.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/acec/acecPo.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/acec/acecPo.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/acec/acecPolyn.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/acec/acecPolyn.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/acec/acecPool.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/acec/acecPool.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/acec/acecRe.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/acec/acecRe.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/acec/acecSt.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/acec/acecSt.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/acec/acecTree.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/acec/acecTree.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/acec/acecUtil.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/acec/acecUtil.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/acec/acecXor.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/acec/acecXor.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/cec/cecCec.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/cec/cecCec.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/cec/cecChoice.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/cec/cecChoice.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/cec/cecClass.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/cec/cecClass.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/cec/cecCore.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/cec/cecCore.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/cec/cecCorr.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/cec/cecCorr.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/cec/cecIso.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/cec/cecIso.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/cec/cecMan.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/cec/cecMan.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/cec/cecPat.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/cec/cecPat.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/cec/cecSat.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/cec/cecSat.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/cec/cecSatG.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/cec/cecSatG.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/cec/cecSeq.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/cec/cecSeq.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/cec/cecSolve.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/cec/cecSolve.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/cec/cecSplit.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/cec/cecSplit.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/cec/cecSweep.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/cec/cecSweep.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/cec/cecSynth.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/cec/cecSynth.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/dch/dchAig.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/dch/dchAig.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/dch/dchChoice.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/dch/dchChoice.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/dch/dchClass.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/dch/dchClass.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/dch/dchCnf.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/dch/dchCnf.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/dch/dchCore.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/dch/dchCore.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/dch/dchMan.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/dch/dchMan.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/dch/dchSat.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/dch/dchSat.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/dch/dchSim.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/dch/dchSim.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/dch/dchSimSat.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/dch/dchSimSat.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/dch/dchSweep.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/dch/dchSweep.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/fra/fraBmc.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/fra/fraBmc.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/fra/fraCec.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/fra/fraCec.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/fra/fraClass.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/fra/fraClass.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/fra/fraClau.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/fra/fraClau.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/fra/fraClaus.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/fra/fraClaus.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/fra/fraCnf.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/fra/fraCnf.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/fra/fraCore.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/fra/fraCore.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/fra/fraHot.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/fra/fraHot.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/fra/fraImp.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/fra/fraImp.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/fra/fraInd.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/fra/fraInd.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/fra/fraIndVer.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/fra/fraIndVer.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/fra/fraLcr.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/fra/fraLcr.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/fra/fraMan.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/fra/fraMan.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/fra/fraPart.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/fra/fraPart.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/fra/fraSat.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/fra/fraSat.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/fra/fraSec.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/fra/fraSec.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/fra/fraSim.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/fra/fraSim.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/fraig/fraigApi.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/fraig/fraigApi.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/fraig/fraigCanon.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/fraig/fraigCanon.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/fraig/fraigFanout.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/fraig/fraigFanout.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/fraig/fraigFeed.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/fraig/fraigFeed.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/fraig/fraigMan.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/fraig/fraigMan.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/fraig/fraigMem.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/fraig/fraigMem.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/fraig/fraigNode.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/fraig/fraigNode.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/fraig/fraigPrime.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/fraig/fraigPrime.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/fraig/fraigSat.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/fraig/fraigSat.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/fraig/fraigTable.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/fraig/fraigTable.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/fraig/fraigUtil.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/fraig/fraigUtil.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/fraig/fraigVec.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/fraig/fraigVec.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/int/intCheck.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/int/intCheck.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/int/intContain.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/int/intContain.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/int/intCore.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/int/intCore.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/int/intCtrex.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/int/intCtrex.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/int/intDup.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/int/intDup.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/int/intFrames.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/int/intFrames.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/int/intInter.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/int/intInter.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/int/intM114.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/int/intM114.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/int/intMan.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/int/intMan.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/int/intUtil.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/int/intUtil.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/live/arenaViolation.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/live/arenaViolation.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/live/combination.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/live/combination.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/live/disjunctiveMonotone.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/live/disjunctiveMonotone.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/live/kLiveConstraints.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/live/kLiveConstraints.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/live/kliveness.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/live/kliveness.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/live/liveness.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/live/liveness.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/live/liveness_sim.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/live/liveness_sim.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/live/ltl_parser.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/live/ltl_parser.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/live/monotone.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/live/monotone.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/pdr/pdrCnf.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/pdr/pdrCnf.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/pdr/pdrCore.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/pdr/pdrCore.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/pdr/pdrIncr.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/pdr/pdrIncr.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/pdr/pdrInv.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/pdr/pdrInv.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/pdr/pdrMan.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/pdr/pdrMan.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/pdr/pdrPar.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/pdr/pdrPar.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/pdr/pdrSat.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/pdr/pdrSat.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/pdr/pdrTsim.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/pdr/pdrTsim.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/pdr/pdrTsim2.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/pdr/pdrTsim2.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/pdr/pdrTsim3.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/pdr/pdrTsim3.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/pdr/pdrTsim4.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/pdr/pdrTsim4.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/pdr/pdrUtil.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/pdr/pdrUtil.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/ssc/sscClass.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/ssc/sscClass.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/ssc/sscCore.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/ssc/sscCore.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/ssc/sscSat.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/ssc/sscSat.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/ssc/sscSim.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/ssc/sscSim.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/ssc/sscUtil.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/ssc/sscUtil.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/ssw/sswAig.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/ssw/sswAig.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/ssw/sswBmc.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/ssw/sswBmc.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/ssw/sswClass.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/ssw/sswClass.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/ssw/sswCnf.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/ssw/sswCnf.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/ssw/sswConstr.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/ssw/sswConstr.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/ssw/sswCore.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/ssw/sswCore.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/ssw/sswDyn.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/ssw/sswDyn.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/ssw/sswFilter.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/ssw/sswFilter.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/ssw/sswIslands.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/ssw/sswIslands.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/ssw/sswLcorr.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/ssw/sswLcorr.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/ssw/sswMan.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/ssw/sswMan.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/ssw/sswPairs.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/ssw/sswPairs.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/ssw/sswPart.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/ssw/sswPart.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/ssw/sswRarity.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/ssw/sswRarity.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/ssw/sswSat.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/ssw/sswSat.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/ssw/sswSemi.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/ssw/sswSemi.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/ssw/sswSim.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/ssw/sswSim.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/ssw/sswSimSat.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/ssw/sswSimSat.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/ssw/sswSweep.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/ssw/sswSweep.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/proof/ssw/sswUnique.c.o"
+  "CMakeFiles/libabc-pic.dir/src/proof/ssw/sswUnique.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcBCore.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcBCore.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcBmc.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcBmc.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcBmc2.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcBmc2.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcBmc3.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcBmc3.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcBmcAnd.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcBmcAnd.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcBmcG.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcBmcG.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcBmcS.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcBmcS.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcBmci.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcBmci.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcCexCare.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcCexCare.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcCexCut.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcCexCut.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcCexDepth.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcCexDepth.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcCexMin1.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcCexMin1.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcCexMin2.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcCexMin2.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcCexTools.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcCexTools.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcChain.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcChain.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcClp.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcClp.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcEco.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcEco.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcExpand.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcExpand.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcFault.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcFault.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcFx.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcFx.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcGen.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcGen.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcICheck.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcICheck.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcInse.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcInse.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcLoad.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcLoad.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcMaj.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcMaj.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcMaj2.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcMaj2.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcMaj3.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcMaj3.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcMaxi.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcMaxi.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcMesh.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcMesh.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcMesh2.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcMesh2.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcMulti.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcMulti.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcSat.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcSat.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcSat3.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcSat3.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcSatPort.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcSatPort.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcUnroll.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/bmc/bmcUnroll.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/bsat/satInter.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/bsat/satInter.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/bsat/satInterA.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/bsat/satInterA.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/bsat/satInterB.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/bsat/satInterB.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/bsat/satInterP.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/bsat/satInterP.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/bsat/satMem.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/bsat/satMem.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/bsat/satProof.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/bsat/satProof.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/bsat/satSolver.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/bsat/satSolver.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/bsat/satSolver2.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/bsat/satSolver2.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/bsat/satSolver2i.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/bsat/satSolver2i.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/bsat/satSolver3.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/bsat/satSolver3.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/bsat/satStore.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/bsat/satStore.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/bsat/satTrace.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/bsat/satTrace.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/bsat/satTruth.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/bsat/satTruth.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/bsat/satUtil.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/bsat/satUtil.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/cnf/cnfCore.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/cnf/cnfCore.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/cnf/cnfCut.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/cnf/cnfCut.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/cnf/cnfData.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/cnf/cnfData.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/cnf/cnfFast.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/cnf/cnfFast.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/cnf/cnfMan.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/cnf/cnfMan.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/cnf/cnfMap.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/cnf/cnfMap.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/cnf/cnfPost.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/cnf/cnfPost.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/cnf/cnfStream.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/cnf/cnfStream.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/cnf/cnfUtil.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/cnf/cnfUtil.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/cnf/cnfWrite.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/cnf/cnfWrite.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/csat/csat_apis.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/csat/csat_apis.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/glucose/AbcGlucose.cpp.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/glucose/AbcGlucose.cpp.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/glucose/AbcGlucoseCmd.cpp.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/glucose/AbcGlucoseCmd.cpp.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/glucose/Glucose.cpp.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/glucose/Glucose.cpp.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/glucose/Options.cpp.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/glucose/Options.cpp.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/glucose/SimpSolver.cpp.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/glucose/SimpSolver.cpp.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/glucose/System.cpp.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/glucose/System.cpp.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/msat/msatActivity.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/msat/msatActivity.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/msat/msatClause.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/msat/msatClause.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/msat/msatClauseVec.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/msat/msatClauseVec.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/msat/msatMem.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/msat/msatMem.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/msat/msatOrderH.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/msat/msatOrderH.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/msat/msatQueue.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/msat/msatQueue.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/msat/msatRead.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/msat/msatRead.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/msat/msatSolverApi.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/msat/msatSolverApi.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/msat/msatSolverCore.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/msat/msatSolverCore.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/msat/msatSolverIo.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/msat/msatSolverIo.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/msat/msatSolverSearch.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/msat/msatSolverSearch.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/msat/msatSort.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/msat/msatSort.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/msat/msatVec.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/msat/msatVec.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/satoko/cnf_reader.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/satoko/cnf_reader.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/satoko/inproc.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/satoko/inproc.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/satoko/solver.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/satoko/solver.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/satoko/solver_api.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/satoko/solver_api.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/xsat/xsatCnfReader.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/xsat/xsatCnfReader.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/xsat/xsatSolver.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/xsat/xsatSolver.c.o.d"
+  "CMakeFiles/libabc-pic.dir/src/sat/xsat/xsatSolverAPI.c.o"
+  "CMakeFiles/libabc-pic.dir/src/sat/xsat/xsatSolverAPI.c.o.d"
+  "libabc-pic.a"
+  "libabc-pic.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/libabc-pic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
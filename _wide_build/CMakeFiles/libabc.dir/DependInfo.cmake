@@ -0,0 +1,1129 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/aig/aig/aigCanon.c" "CMakeFiles/libabc.dir/src/aig/aig/aigCanon.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/aig/aigCanon.c.o.d"
+  "/root/repo/src/aig/aig/aigCheck.c" "CMakeFiles/libabc.dir/src/aig/aig/aigCheck.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/aig/aigCheck.c.o.d"
+  "/root/repo/src/aig/aig/aigCuts.c" "CMakeFiles/libabc.dir/src/aig/aig/aigCuts.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/aig/aigCuts.c.o.d"
+  "/root/repo/src/aig/aig/aigDfs.c" "CMakeFiles/libabc.dir/src/aig/aig/aigDfs.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/aig/aigDfs.c.o.d"
+  "/root/repo/src/aig/aig/aigDup.c" "CMakeFiles/libabc.dir/src/aig/aig/aigDup.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/aig/aigDup.c.o.d"
+  "/root/repo/src/aig/aig/aigFanout.c" "CMakeFiles/libabc.dir/src/aig/aig/aigFanout.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/aig/aigFanout.c.o.d"
+  "/root/repo/src/aig/aig/aigFrames.c" "CMakeFiles/libabc.dir/src/aig/aig/aigFrames.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/aig/aigFrames.c.o.d"
+  "/root/repo/src/aig/aig/aigInter.c" "CMakeFiles/libabc.dir/src/aig/aig/aigInter.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/aig/aigInter.c.o.d"
+  "/root/repo/src/aig/aig/aigJust.c" "CMakeFiles/libabc.dir/src/aig/aig/aigJust.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/aig/aigJust.c.o.d"
+  "/root/repo/src/aig/aig/aigMan.c" "CMakeFiles/libabc.dir/src/aig/aig/aigMan.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/aig/aigMan.c.o.d"
+  "/root/repo/src/aig/aig/aigMem.c" "CMakeFiles/libabc.dir/src/aig/aig/aigMem.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/aig/aigMem.c.o.d"
+  "/root/repo/src/aig/aig/aigMffc.c" "CMakeFiles/libabc.dir/src/aig/aig/aigMffc.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/aig/aigMffc.c.o.d"
+  "/root/repo/src/aig/aig/aigObj.c" "CMakeFiles/libabc.dir/src/aig/aig/aigObj.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/aig/aigObj.c.o.d"
+  "/root/repo/src/aig/aig/aigOper.c" "CMakeFiles/libabc.dir/src/aig/aig/aigOper.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/aig/aigOper.c.o.d"
+  "/root/repo/src/aig/aig/aigOrder.c" "CMakeFiles/libabc.dir/src/aig/aig/aigOrder.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/aig/aigOrder.c.o.d"
+  "/root/repo/src/aig/aig/aigPack.c" "CMakeFiles/libabc.dir/src/aig/aig/aigPack.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/aig/aigPack.c.o.d"
+  "/root/repo/src/aig/aig/aigPart.c" "CMakeFiles/libabc.dir/src/aig/aig/aigPart.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/aig/aigPart.c.o.d"
+  "/root/repo/src/aig/aig/aigPartReg.c" "CMakeFiles/libabc.dir/src/aig/aig/aigPartReg.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/aig/aigPartReg.c.o.d"
+  "/root/repo/src/aig/aig/aigPartSat.c" "CMakeFiles/libabc.dir/src/aig/aig/aigPartSat.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/aig/aigPartSat.c.o.d"
+  "/root/repo/src/aig/aig/aigRepr.c" "CMakeFiles/libabc.dir/src/aig/aig/aigRepr.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/aig/aigRepr.c.o.d"
+  "/root/repo/src/aig/aig/aigRet.c" "CMakeFiles/libabc.dir/src/aig/aig/aigRet.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/aig/aigRet.c.o.d"
+  "/root/repo/src/aig/aig/aigRetF.c" "CMakeFiles/libabc.dir/src/aig/aig/aigRetF.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/aig/aigRetF.c.o.d"
+  "/root/repo/src/aig/aig/aigScl.c" "CMakeFiles/libabc.dir/src/aig/aig/aigScl.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/aig/aigScl.c.o.d"
+  "/root/repo/src/aig/aig/aigShow.c" "CMakeFiles/libabc.dir/src/aig/aig/aigShow.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/aig/aigShow.c.o.d"
+  "/root/repo/src/aig/aig/aigSplit.c" "CMakeFiles/libabc.dir/src/aig/aig/aigSplit.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/aig/aigSplit.c.o.d"
+  "/root/repo/src/aig/aig/aigTable.c" "CMakeFiles/libabc.dir/src/aig/aig/aigTable.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/aig/aigTable.c.o.d"
+  "/root/repo/src/aig/aig/aigTiming.c" "CMakeFiles/libabc.dir/src/aig/aig/aigTiming.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/aig/aigTiming.c.o.d"
+  "/root/repo/src/aig/aig/aigTruth.c" "CMakeFiles/libabc.dir/src/aig/aig/aigTruth.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/aig/aigTruth.c.o.d"
+  "/root/repo/src/aig/aig/aigTsim.c" "CMakeFiles/libabc.dir/src/aig/aig/aigTsim.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/aig/aigTsim.c.o.d"
+  "/root/repo/src/aig/aig/aigUtil.c" "CMakeFiles/libabc.dir/src/aig/aig/aigUtil.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/aig/aigUtil.c.o.d"
+  "/root/repo/src/aig/aig/aigWin.c" "CMakeFiles/libabc.dir/src/aig/aig/aigWin.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/aig/aigWin.c.o.d"
+  "/root/repo/src/aig/gia/giaAgi.c" "CMakeFiles/libabc.dir/src/aig/gia/giaAgi.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaAgi.c.o.d"
+  "/root/repo/src/aig/gia/giaAig.c" "CMakeFiles/libabc.dir/src/aig/gia/giaAig.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaAig.c.o.d"
+  "/root/repo/src/aig/gia/giaAiger.c" "CMakeFiles/libabc.dir/src/aig/gia/giaAiger.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaAiger.c.o.d"
+  "/root/repo/src/aig/gia/giaAigerExt.c" "CMakeFiles/libabc.dir/src/aig/gia/giaAigerExt.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaAigerExt.c.o.d"
+  "/root/repo/src/aig/gia/giaBalAig.c" "CMakeFiles/libabc.dir/src/aig/gia/giaBalAig.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaBalAig.c.o.d"
+  "/root/repo/src/aig/gia/giaBalLut.c" "CMakeFiles/libabc.dir/src/aig/gia/giaBalLut.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaBalLut.c.o.d"
+  "/root/repo/src/aig/gia/giaBalMap.c" "CMakeFiles/libabc.dir/src/aig/gia/giaBalMap.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaBalMap.c.o.d"
+  "/root/repo/src/aig/gia/giaBidec.c" "CMakeFiles/libabc.dir/src/aig/gia/giaBidec.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaBidec.c.o.d"
+  "/root/repo/src/aig/gia/giaCCof.c" "CMakeFiles/libabc.dir/src/aig/gia/giaCCof.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaCCof.c.o.d"
+  "/root/repo/src/aig/gia/giaCSat.c" "CMakeFiles/libabc.dir/src/aig/gia/giaCSat.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaCSat.c.o.d"
+  "/root/repo/src/aig/gia/giaCSat2.c" "CMakeFiles/libabc.dir/src/aig/gia/giaCSat2.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaCSat2.c.o.d"
+  "/root/repo/src/aig/gia/giaCSatOld.c" "CMakeFiles/libabc.dir/src/aig/gia/giaCSatOld.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaCSatOld.c.o.d"
+  "/root/repo/src/aig/gia/giaCTas.c" "CMakeFiles/libabc.dir/src/aig/gia/giaCTas.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaCTas.c.o.d"
+  "/root/repo/src/aig/gia/giaCex.c" "CMakeFiles/libabc.dir/src/aig/gia/giaCex.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaCex.c.o.d"
+  "/root/repo/src/aig/gia/giaClp.c" "CMakeFiles/libabc.dir/src/aig/gia/giaClp.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaClp.c.o.d"
+  "/root/repo/src/aig/gia/giaCof.c" "CMakeFiles/libabc.dir/src/aig/gia/giaCof.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaCof.c.o.d"
+  "/root/repo/src/aig/gia/giaCone.c" "CMakeFiles/libabc.dir/src/aig/gia/giaCone.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaCone.c.o.d"
+  "/root/repo/src/aig/gia/giaCut.c" "CMakeFiles/libabc.dir/src/aig/gia/giaCut.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaCut.c.o.d"
+  "/root/repo/src/aig/gia/giaDfs.c" "CMakeFiles/libabc.dir/src/aig/gia/giaDfs.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaDfs.c.o.d"
+  "/root/repo/src/aig/gia/giaDup.c" "CMakeFiles/libabc.dir/src/aig/gia/giaDup.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaDup.c.o.d"
+  "/root/repo/src/aig/gia/giaEdge.c" "CMakeFiles/libabc.dir/src/aig/gia/giaEdge.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaEdge.c.o.d"
+  "/root/repo/src/aig/gia/giaEmbed.c" "CMakeFiles/libabc.dir/src/aig/gia/giaEmbed.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaEmbed.c.o.d"
+  "/root/repo/src/aig/gia/giaEnable.c" "CMakeFiles/libabc.dir/src/aig/gia/giaEnable.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaEnable.c.o.d"
+  "/root/repo/src/aig/gia/giaEquiv.c" "CMakeFiles/libabc.dir/src/aig/gia/giaEquiv.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaEquiv.c.o.d"
+  "/root/repo/src/aig/gia/giaEra.c" "CMakeFiles/libabc.dir/src/aig/gia/giaEra.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaEra.c.o.d"
+  "/root/repo/src/aig/gia/giaEra2.c" "CMakeFiles/libabc.dir/src/aig/gia/giaEra2.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaEra2.c.o.d"
+  "/root/repo/src/aig/gia/giaEsop.c" "CMakeFiles/libabc.dir/src/aig/gia/giaEsop.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaEsop.c.o.d"
+  "/root/repo/src/aig/gia/giaExist.c" "CMakeFiles/libabc.dir/src/aig/gia/giaExist.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaExist.c.o.d"
+  "/root/repo/src/aig/gia/giaFalse.c" "CMakeFiles/libabc.dir/src/aig/gia/giaFalse.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaFalse.c.o.d"
+  "/root/repo/src/aig/gia/giaFanout.c" "CMakeFiles/libabc.dir/src/aig/gia/giaFanout.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaFanout.c.o.d"
+  "/root/repo/src/aig/gia/giaForce.c" "CMakeFiles/libabc.dir/src/aig/gia/giaForce.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaForce.c.o.d"
+  "/root/repo/src/aig/gia/giaFrames.c" "CMakeFiles/libabc.dir/src/aig/gia/giaFrames.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaFrames.c.o.d"
+  "/root/repo/src/aig/gia/giaFront.c" "CMakeFiles/libabc.dir/src/aig/gia/giaFront.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaFront.c.o.d"
+  "/root/repo/src/aig/gia/giaFx.c" "CMakeFiles/libabc.dir/src/aig/gia/giaFx.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaFx.c.o.d"
+  "/root/repo/src/aig/gia/giaGig.c" "CMakeFiles/libabc.dir/src/aig/gia/giaGig.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaGig.c.o.d"
+  "/root/repo/src/aig/gia/giaGlitch.c" "CMakeFiles/libabc.dir/src/aig/gia/giaGlitch.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaGlitch.c.o.d"
+  "/root/repo/src/aig/gia/giaHash.c" "CMakeFiles/libabc.dir/src/aig/gia/giaHash.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaHash.c.o.d"
+  "/root/repo/src/aig/gia/giaHashPar.c" "CMakeFiles/libabc.dir/src/aig/gia/giaHashPar.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaHashPar.c.o.d"
+  "/root/repo/src/aig/gia/giaIf.c" "CMakeFiles/libabc.dir/src/aig/gia/giaIf.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaIf.c.o.d"
+  "/root/repo/src/aig/gia/giaIff.c" "CMakeFiles/libabc.dir/src/aig/gia/giaIff.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaIff.c.o.d"
+  "/root/repo/src/aig/gia/giaIiff.c" "CMakeFiles/libabc.dir/src/aig/gia/giaIiff.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaIiff.c.o.d"
+  "/root/repo/src/aig/gia/giaIso.c" "CMakeFiles/libabc.dir/src/aig/gia/giaIso.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaIso.c.o.d"
+  "/root/repo/src/aig/gia/giaIso2.c" "CMakeFiles/libabc.dir/src/aig/gia/giaIso2.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaIso2.c.o.d"
+  "/root/repo/src/aig/gia/giaIso3.c" "CMakeFiles/libabc.dir/src/aig/gia/giaIso3.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaIso3.c.o.d"
+  "/root/repo/src/aig/gia/giaJf.c" "CMakeFiles/libabc.dir/src/aig/gia/giaJf.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaJf.c.o.d"
+  "/root/repo/src/aig/gia/giaKf.c" "CMakeFiles/libabc.dir/src/aig/gia/giaKf.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaKf.c.o.d"
+  "/root/repo/src/aig/gia/giaLevPar.c" "CMakeFiles/libabc.dir/src/aig/gia/giaLevPar.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaLevPar.c.o.d"
+  "/root/repo/src/aig/gia/giaLf.c" "CMakeFiles/libabc.dir/src/aig/gia/giaLf.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaLf.c.o.d"
+  "/root/repo/src/aig/gia/giaMan.c" "CMakeFiles/libabc.dir/src/aig/gia/giaMan.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaMan.c.o.d"
+  "/root/repo/src/aig/gia/giaMem.c" "CMakeFiles/libabc.dir/src/aig/gia/giaMem.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaMem.c.o.d"
+  "/root/repo/src/aig/gia/giaMf.c" "CMakeFiles/libabc.dir/src/aig/gia/giaMf.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaMf.c.o.d"
+  "/root/repo/src/aig/gia/giaMfs.c" "CMakeFiles/libabc.dir/src/aig/gia/giaMfs.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaMfs.c.o.d"
+  "/root/repo/src/aig/gia/giaMini.c" "CMakeFiles/libabc.dir/src/aig/gia/giaMini.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaMini.c.o.d"
+  "/root/repo/src/aig/gia/giaMuxes.c" "CMakeFiles/libabc.dir/src/aig/gia/giaMuxes.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaMuxes.c.o.d"
+  "/root/repo/src/aig/gia/giaNf.c" "CMakeFiles/libabc.dir/src/aig/gia/giaNf.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaNf.c.o.d"
+  "/root/repo/src/aig/gia/giaOf.c" "CMakeFiles/libabc.dir/src/aig/gia/giaOf.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaOf.c.o.d"
+  "/root/repo/src/aig/gia/giaPack.c" "CMakeFiles/libabc.dir/src/aig/gia/giaPack.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaPack.c.o.d"
+  "/root/repo/src/aig/gia/giaPat.c" "CMakeFiles/libabc.dir/src/aig/gia/giaPat.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaPat.c.o.d"
+  "/root/repo/src/aig/gia/giaPf.c" "CMakeFiles/libabc.dir/src/aig/gia/giaPf.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaPf.c.o.d"
+  "/root/repo/src/aig/gia/giaQbf.c" "CMakeFiles/libabc.dir/src/aig/gia/giaQbf.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaQbf.c.o.d"
+  "/root/repo/src/aig/gia/giaResub.c" "CMakeFiles/libabc.dir/src/aig/gia/giaResub.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaResub.c.o.d"
+  "/root/repo/src/aig/gia/giaRetime.c" "CMakeFiles/libabc.dir/src/aig/gia/giaRetime.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaRetime.c.o.d"
+  "/root/repo/src/aig/gia/giaRex.c" "CMakeFiles/libabc.dir/src/aig/gia/giaRex.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaRex.c.o.d"
+  "/root/repo/src/aig/gia/giaSat3.c" "CMakeFiles/libabc.dir/src/aig/gia/giaSat3.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaSat3.c.o.d"
+  "/root/repo/src/aig/gia/giaSatEdge.c" "CMakeFiles/libabc.dir/src/aig/gia/giaSatEdge.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaSatEdge.c.o.d"
+  "/root/repo/src/aig/gia/giaSatLE.c" "CMakeFiles/libabc.dir/src/aig/gia/giaSatLE.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaSatLE.c.o.d"
+  "/root/repo/src/aig/gia/giaSatLut.c" "CMakeFiles/libabc.dir/src/aig/gia/giaSatLut.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaSatLut.c.o.d"
+  "/root/repo/src/aig/gia/giaSatMap.c" "CMakeFiles/libabc.dir/src/aig/gia/giaSatMap.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaSatMap.c.o.d"
+  "/root/repo/src/aig/gia/giaSatoko.c" "CMakeFiles/libabc.dir/src/aig/gia/giaSatoko.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaSatoko.c.o.d"
+  "/root/repo/src/aig/gia/giaScl.c" "CMakeFiles/libabc.dir/src/aig/gia/giaScl.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaScl.c.o.d"
+  "/root/repo/src/aig/gia/giaScript.c" "CMakeFiles/libabc.dir/src/aig/gia/giaScript.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaScript.c.o.d"
+  "/root/repo/src/aig/gia/giaShow.c" "CMakeFiles/libabc.dir/src/aig/gia/giaShow.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaShow.c.o.d"
+  "/root/repo/src/aig/gia/giaShrink.c" "CMakeFiles/libabc.dir/src/aig/gia/giaShrink.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaShrink.c.o.d"
+  "/root/repo/src/aig/gia/giaShrink6.c" "CMakeFiles/libabc.dir/src/aig/gia/giaShrink6.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaShrink6.c.o.d"
+  "/root/repo/src/aig/gia/giaShrink7.c" "CMakeFiles/libabc.dir/src/aig/gia/giaShrink7.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaShrink7.c.o.d"
+  "/root/repo/src/aig/gia/giaSim.c" "CMakeFiles/libabc.dir/src/aig/gia/giaSim.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaSim.c.o.d"
+  "/root/repo/src/aig/gia/giaSim2.c" "CMakeFiles/libabc.dir/src/aig/gia/giaSim2.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaSim2.c.o.d"
+  "/root/repo/src/aig/gia/giaSimPar.c" "CMakeFiles/libabc.dir/src/aig/gia/giaSimPar.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaSimPar.c.o.d"
+  "/root/repo/src/aig/gia/giaSort.c" "CMakeFiles/libabc.dir/src/aig/gia/giaSort.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaSort.c.o.d"
+  "/root/repo/src/aig/gia/giaSpeedup.c" "CMakeFiles/libabc.dir/src/aig/gia/giaSpeedup.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaSpeedup.c.o.d"
+  "/root/repo/src/aig/gia/giaSplit.c" "CMakeFiles/libabc.dir/src/aig/gia/giaSplit.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaSplit.c.o.d"
+  "/root/repo/src/aig/gia/giaStg.c" "CMakeFiles/libabc.dir/src/aig/gia/giaStg.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaStg.c.o.d"
+  "/root/repo/src/aig/gia/giaStr.c" "CMakeFiles/libabc.dir/src/aig/gia/giaStr.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaStr.c.o.d"
+  "/root/repo/src/aig/gia/giaSupMin.c" "CMakeFiles/libabc.dir/src/aig/gia/giaSupMin.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaSupMin.c.o.d"
+  "/root/repo/src/aig/gia/giaSupp.c" "CMakeFiles/libabc.dir/src/aig/gia/giaSupp.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaSupp.c.o.d"
+  "/root/repo/src/aig/gia/giaSweep.c" "CMakeFiles/libabc.dir/src/aig/gia/giaSweep.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaSweep.c.o.d"
+  "/root/repo/src/aig/gia/giaSweeper.c" "CMakeFiles/libabc.dir/src/aig/gia/giaSweeper.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaSweeper.c.o.d"
+  "/root/repo/src/aig/gia/giaSwitch.c" "CMakeFiles/libabc.dir/src/aig/gia/giaSwitch.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaSwitch.c.o.d"
+  "/root/repo/src/aig/gia/giaTim.c" "CMakeFiles/libabc.dir/src/aig/gia/giaTim.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaTim.c.o.d"
+  "/root/repo/src/aig/gia/giaTis.c" "CMakeFiles/libabc.dir/src/aig/gia/giaTis.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaTis.c.o.d"
+  "/root/repo/src/aig/gia/giaTruth.c" "CMakeFiles/libabc.dir/src/aig/gia/giaTruth.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaTruth.c.o.d"
+  "/root/repo/src/aig/gia/giaTsim.c" "CMakeFiles/libabc.dir/src/aig/gia/giaTsim.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaTsim.c.o.d"
+  "/root/repo/src/aig/gia/giaUnate.c" "CMakeFiles/libabc.dir/src/aig/gia/giaUnate.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaUnate.c.o.d"
+  "/root/repo/src/aig/gia/giaUtil.c" "CMakeFiles/libabc.dir/src/aig/gia/giaUtil.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/gia/giaUtil.c.o.d"
+  "/root/repo/src/aig/hop/hopBalance.c" "CMakeFiles/libabc.dir/src/aig/hop/hopBalance.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/hop/hopBalance.c.o.d"
+  "/root/repo/src/aig/hop/hopCheck.c" "CMakeFiles/libabc.dir/src/aig/hop/hopCheck.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/hop/hopCheck.c.o.d"
+  "/root/repo/src/aig/hop/hopDfs.c" "CMakeFiles/libabc.dir/src/aig/hop/hopDfs.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/hop/hopDfs.c.o.d"
+  "/root/repo/src/aig/hop/hopMan.c" "CMakeFiles/libabc.dir/src/aig/hop/hopMan.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/hop/hopMan.c.o.d"
+  "/root/repo/src/aig/hop/hopMem.c" "CMakeFiles/libabc.dir/src/aig/hop/hopMem.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/hop/hopMem.c.o.d"
+  "/root/repo/src/aig/hop/hopObj.c" "CMakeFiles/libabc.dir/src/aig/hop/hopObj.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/hop/hopObj.c.o.d"
+  "/root/repo/src/aig/hop/hopOper.c" "CMakeFiles/libabc.dir/src/aig/hop/hopOper.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/hop/hopOper.c.o.d"
+  "/root/repo/src/aig/hop/hopTable.c" "CMakeFiles/libabc.dir/src/aig/hop/hopTable.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/hop/hopTable.c.o.d"
+  "/root/repo/src/aig/hop/hopTruth.c" "CMakeFiles/libabc.dir/src/aig/hop/hopTruth.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/hop/hopTruth.c.o.d"
+  "/root/repo/src/aig/hop/hopUtil.c" "CMakeFiles/libabc.dir/src/aig/hop/hopUtil.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/hop/hopUtil.c.o.d"
+  "/root/repo/src/aig/ioa/ioaReadAig.c" "CMakeFiles/libabc.dir/src/aig/ioa/ioaReadAig.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/ioa/ioaReadAig.c.o.d"
+  "/root/repo/src/aig/ioa/ioaUtil.c" "CMakeFiles/libabc.dir/src/aig/ioa/ioaUtil.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/ioa/ioaUtil.c.o.d"
+  "/root/repo/src/aig/ioa/ioaWriteAig.c" "CMakeFiles/libabc.dir/src/aig/ioa/ioaWriteAig.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/ioa/ioaWriteAig.c.o.d"
+  "/root/repo/src/aig/ivy/ivyBalance.c" "CMakeFiles/libabc.dir/src/aig/ivy/ivyBalance.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/ivy/ivyBalance.c.o.d"
+  "/root/repo/src/aig/ivy/ivyCanon.c" "CMakeFiles/libabc.dir/src/aig/ivy/ivyCanon.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/ivy/ivyCanon.c.o.d"
+  "/root/repo/src/aig/ivy/ivyCheck.c" "CMakeFiles/libabc.dir/src/aig/ivy/ivyCheck.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/ivy/ivyCheck.c.o.d"
+  "/root/repo/src/aig/ivy/ivyCut.c" "CMakeFiles/libabc.dir/src/aig/ivy/ivyCut.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/ivy/ivyCut.c.o.d"
+  "/root/repo/src/aig/ivy/ivyCutTrav.c" "CMakeFiles/libabc.dir/src/aig/ivy/ivyCutTrav.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/ivy/ivyCutTrav.c.o.d"
+  "/root/repo/src/aig/ivy/ivyDfs.c" "CMakeFiles/libabc.dir/src/aig/ivy/ivyDfs.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/ivy/ivyDfs.c.o.d"
+  "/root/repo/src/aig/ivy/ivyDsd.c" "CMakeFiles/libabc.dir/src/aig/ivy/ivyDsd.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/ivy/ivyDsd.c.o.d"
+  "/root/repo/src/aig/ivy/ivyFanout.c" "CMakeFiles/libabc.dir/src/aig/ivy/ivyFanout.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/ivy/ivyFanout.c.o.d"
+  "/root/repo/src/aig/ivy/ivyFastMap.c" "CMakeFiles/libabc.dir/src/aig/ivy/ivyFastMap.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/ivy/ivyFastMap.c.o.d"
+  "/root/repo/src/aig/ivy/ivyFraig.c" "CMakeFiles/libabc.dir/src/aig/ivy/ivyFraig.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/ivy/ivyFraig.c.o.d"
+  "/root/repo/src/aig/ivy/ivyHaig.c" "CMakeFiles/libabc.dir/src/aig/ivy/ivyHaig.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/ivy/ivyHaig.c.o.d"
+  "/root/repo/src/aig/ivy/ivyMan.c" "CMakeFiles/libabc.dir/src/aig/ivy/ivyMan.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/ivy/ivyMan.c.o.d"
+  "/root/repo/src/aig/ivy/ivyMem.c" "CMakeFiles/libabc.dir/src/aig/ivy/ivyMem.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/ivy/ivyMem.c.o.d"
+  "/root/repo/src/aig/ivy/ivyMulti.c" "CMakeFiles/libabc.dir/src/aig/ivy/ivyMulti.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/ivy/ivyMulti.c.o.d"
+  "/root/repo/src/aig/ivy/ivyObj.c" "CMakeFiles/libabc.dir/src/aig/ivy/ivyObj.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/ivy/ivyObj.c.o.d"
+  "/root/repo/src/aig/ivy/ivyOper.c" "CMakeFiles/libabc.dir/src/aig/ivy/ivyOper.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/ivy/ivyOper.c.o.d"
+  "/root/repo/src/aig/ivy/ivyResyn.c" "CMakeFiles/libabc.dir/src/aig/ivy/ivyResyn.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/ivy/ivyResyn.c.o.d"
+  "/root/repo/src/aig/ivy/ivyRwr.c" "CMakeFiles/libabc.dir/src/aig/ivy/ivyRwr.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/ivy/ivyRwr.c.o.d"
+  "/root/repo/src/aig/ivy/ivySeq.c" "CMakeFiles/libabc.dir/src/aig/ivy/ivySeq.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/ivy/ivySeq.c.o.d"
+  "/root/repo/src/aig/ivy/ivyShow.c" "CMakeFiles/libabc.dir/src/aig/ivy/ivyShow.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/ivy/ivyShow.c.o.d"
+  "/root/repo/src/aig/ivy/ivyTable.c" "CMakeFiles/libabc.dir/src/aig/ivy/ivyTable.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/ivy/ivyTable.c.o.d"
+  "/root/repo/src/aig/ivy/ivyUtil.c" "CMakeFiles/libabc.dir/src/aig/ivy/ivyUtil.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/ivy/ivyUtil.c.o.d"
+  "/root/repo/src/aig/saig/saigCkpt.c" "CMakeFiles/libabc.dir/src/aig/saig/saigCkpt.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/saig/saigCkpt.c.o.d"
+  "/root/repo/src/aig/saig/saigCone.c" "CMakeFiles/libabc.dir/src/aig/saig/saigCone.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/saig/saigCone.c.o.d"
+  "/root/repo/src/aig/saig/saigConstr.c" "CMakeFiles/libabc.dir/src/aig/saig/saigConstr.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/saig/saigConstr.c.o.d"
+  "/root/repo/src/aig/saig/saigConstr2.c" "CMakeFiles/libabc.dir/src/aig/saig/saigConstr2.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/saig/saigConstr2.c.o.d"
+  "/root/repo/src/aig/saig/saigDual.c" "CMakeFiles/libabc.dir/src/aig/saig/saigDual.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/saig/saigDual.c.o.d"
+  "/root/repo/src/aig/saig/saigDup.c" "CMakeFiles/libabc.dir/src/aig/saig/saigDup.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/saig/saigDup.c.o.d"
+  "/root/repo/src/aig/saig/saigInd.c" "CMakeFiles/libabc.dir/src/aig/saig/saigInd.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/saig/saigInd.c.o.d"
+  "/root/repo/src/aig/saig/saigIoa.c" "CMakeFiles/libabc.dir/src/aig/saig/saigIoa.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/saig/saigIoa.c.o.d"
+  "/root/repo/src/aig/saig/saigIso.c" "CMakeFiles/libabc.dir/src/aig/saig/saigIso.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/saig/saigIso.c.o.d"
+  "/root/repo/src/aig/saig/saigIsoFast.c" "CMakeFiles/libabc.dir/src/aig/saig/saigIsoFast.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/saig/saigIsoFast.c.o.d"
+  "/root/repo/src/aig/saig/saigIsoSlow.c" "CMakeFiles/libabc.dir/src/aig/saig/saigIsoSlow.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/saig/saigIsoSlow.c.o.d"
+  "/root/repo/src/aig/saig/saigMiter.c" "CMakeFiles/libabc.dir/src/aig/saig/saigMiter.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/saig/saigMiter.c.o.d"
+  "/root/repo/src/aig/saig/saigOutDec.c" "CMakeFiles/libabc.dir/src/aig/saig/saigOutDec.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/saig/saigOutDec.c.o.d"
+  "/root/repo/src/aig/saig/saigPhase.c" "CMakeFiles/libabc.dir/src/aig/saig/saigPhase.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/saig/saigPhase.c.o.d"
+  "/root/repo/src/aig/saig/saigRetFwd.c" "CMakeFiles/libabc.dir/src/aig/saig/saigRetFwd.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/saig/saigRetFwd.c.o.d"
+  "/root/repo/src/aig/saig/saigRetMin.c" "CMakeFiles/libabc.dir/src/aig/saig/saigRetMin.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/saig/saigRetMin.c.o.d"
+  "/root/repo/src/aig/saig/saigRetStep.c" "CMakeFiles/libabc.dir/src/aig/saig/saigRetStep.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/saig/saigRetStep.c.o.d"
+  "/root/repo/src/aig/saig/saigScl.c" "CMakeFiles/libabc.dir/src/aig/saig/saigScl.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/saig/saigScl.c.o.d"
+  "/root/repo/src/aig/saig/saigSimFast.c" "CMakeFiles/libabc.dir/src/aig/saig/saigSimFast.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/saig/saigSimFast.c.o.d"
+  "/root/repo/src/aig/saig/saigSimMv.c" "CMakeFiles/libabc.dir/src/aig/saig/saigSimMv.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/saig/saigSimMv.c.o.d"
+  "/root/repo/src/aig/saig/saigSimSeq.c" "CMakeFiles/libabc.dir/src/aig/saig/saigSimSeq.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/saig/saigSimSeq.c.o.d"
+  "/root/repo/src/aig/saig/saigStrSim.c" "CMakeFiles/libabc.dir/src/aig/saig/saigStrSim.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/saig/saigStrSim.c.o.d"
+  "/root/repo/src/aig/saig/saigSwitch.c" "CMakeFiles/libabc.dir/src/aig/saig/saigSwitch.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/saig/saigSwitch.c.o.d"
+  "/root/repo/src/aig/saig/saigSynch.c" "CMakeFiles/libabc.dir/src/aig/saig/saigSynch.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/saig/saigSynch.c.o.d"
+  "/root/repo/src/aig/saig/saigTempor.c" "CMakeFiles/libabc.dir/src/aig/saig/saigTempor.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/saig/saigTempor.c.o.d"
+  "/root/repo/src/aig/saig/saigTrans.c" "CMakeFiles/libabc.dir/src/aig/saig/saigTrans.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/saig/saigTrans.c.o.d"
+  "/root/repo/src/aig/saig/saigWnd.c" "CMakeFiles/libabc.dir/src/aig/saig/saigWnd.c.o" "gcc" "CMakeFiles/libabc.dir/src/aig/saig/saigWnd.c.o.d"
+  "/root/repo/src/base/abc/abcAig.c" "CMakeFiles/libabc.dir/src/base/abc/abcAig.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abc/abcAig.c.o.d"
+  "/root/repo/src/base/abc/abcBarBuf.c" "CMakeFiles/libabc.dir/src/base/abc/abcBarBuf.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abc/abcBarBuf.c.o.d"
+  "/root/repo/src/base/abc/abcBlifMv.c" "CMakeFiles/libabc.dir/src/base/abc/abcBlifMv.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abc/abcBlifMv.c.o.d"
+  "/root/repo/src/base/abc/abcCheck.c" "CMakeFiles/libabc.dir/src/base/abc/abcCheck.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abc/abcCheck.c.o.d"
+  "/root/repo/src/base/abc/abcDfs.c" "CMakeFiles/libabc.dir/src/base/abc/abcDfs.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abc/abcDfs.c.o.d"
+  "/root/repo/src/base/abc/abcFanOrder.c" "CMakeFiles/libabc.dir/src/base/abc/abcFanOrder.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abc/abcFanOrder.c.o.d"
+  "/root/repo/src/base/abc/abcFanio.c" "CMakeFiles/libabc.dir/src/base/abc/abcFanio.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abc/abcFanio.c.o.d"
+  "/root/repo/src/base/abc/abcFunc.c" "CMakeFiles/libabc.dir/src/base/abc/abcFunc.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abc/abcFunc.c.o.d"
+  "/root/repo/src/base/abc/abcHie.c" "CMakeFiles/libabc.dir/src/base/abc/abcHie.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abc/abcHie.c.o.d"
+  "/root/repo/src/base/abc/abcHieCec.c" "CMakeFiles/libabc.dir/src/base/abc/abcHieCec.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abc/abcHieCec.c.o.d"
+  "/root/repo/src/base/abc/abcHieGia.c" "CMakeFiles/libabc.dir/src/base/abc/abcHieGia.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abc/abcHieGia.c.o.d"
+  "/root/repo/src/base/abc/abcHieNew.c" "CMakeFiles/libabc.dir/src/base/abc/abcHieNew.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abc/abcHieNew.c.o.d"
+  "/root/repo/src/base/abc/abcLatch.c" "CMakeFiles/libabc.dir/src/base/abc/abcLatch.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abc/abcLatch.c.o.d"
+  "/root/repo/src/base/abc/abcLib.c" "CMakeFiles/libabc.dir/src/base/abc/abcLib.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abc/abcLib.c.o.d"
+  "/root/repo/src/base/abc/abcMinBase.c" "CMakeFiles/libabc.dir/src/base/abc/abcMinBase.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abc/abcMinBase.c.o.d"
+  "/root/repo/src/base/abc/abcNames.c" "CMakeFiles/libabc.dir/src/base/abc/abcNames.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abc/abcNames.c.o.d"
+  "/root/repo/src/base/abc/abcNetlist.c" "CMakeFiles/libabc.dir/src/base/abc/abcNetlist.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abc/abcNetlist.c.o.d"
+  "/root/repo/src/base/abc/abcNtk.c" "CMakeFiles/libabc.dir/src/base/abc/abcNtk.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abc/abcNtk.c.o.d"
+  "/root/repo/src/base/abc/abcObj.c" "CMakeFiles/libabc.dir/src/base/abc/abcObj.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abc/abcObj.c.o.d"
+  "/root/repo/src/base/abc/abcRefs.c" "CMakeFiles/libabc.dir/src/base/abc/abcRefs.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abc/abcRefs.c.o.d"
+  "/root/repo/src/base/abc/abcShow.c" "CMakeFiles/libabc.dir/src/base/abc/abcShow.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abc/abcShow.c.o.d"
+  "/root/repo/src/base/abc/abcSop.c" "CMakeFiles/libabc.dir/src/base/abc/abcSop.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abc/abcSop.c.o.d"
+  "/root/repo/src/base/abc/abcUtil.c" "CMakeFiles/libabc.dir/src/base/abc/abcUtil.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abc/abcUtil.c.o.d"
+  "/root/repo/src/base/abci/abc.c" "CMakeFiles/libabc.dir/src/base/abci/abc.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abc.c.o.d"
+  "/root/repo/src/base/abci/abcAttach.c" "CMakeFiles/libabc.dir/src/base/abci/abcAttach.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcAttach.c.o.d"
+  "/root/repo/src/base/abci/abcAuto.c" "CMakeFiles/libabc.dir/src/base/abci/abcAuto.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcAuto.c.o.d"
+  "/root/repo/src/base/abci/abcBalance.c" "CMakeFiles/libabc.dir/src/base/abci/abcBalance.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcBalance.c.o.d"
+  "/root/repo/src/base/abci/abcBidec.c" "CMakeFiles/libabc.dir/src/base/abci/abcBidec.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcBidec.c.o.d"
+  "/root/repo/src/base/abci/abcBm.c" "CMakeFiles/libabc.dir/src/base/abci/abcBm.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcBm.c.o.d"
+  "/root/repo/src/base/abci/abcBmc.c" "CMakeFiles/libabc.dir/src/base/abci/abcBmc.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcBmc.c.o.d"
+  "/root/repo/src/base/abci/abcCas.c" "CMakeFiles/libabc.dir/src/base/abci/abcCas.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcCas.c.o.d"
+  "/root/repo/src/base/abci/abcCascade.c" "CMakeFiles/libabc.dir/src/base/abci/abcCascade.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcCascade.c.o.d"
+  "/root/repo/src/base/abci/abcCollapse.c" "CMakeFiles/libabc.dir/src/base/abci/abcCollapse.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcCollapse.c.o.d"
+  "/root/repo/src/base/abci/abcCut.c" "CMakeFiles/libabc.dir/src/base/abci/abcCut.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcCut.c.o.d"
+  "/root/repo/src/base/abci/abcDar.c" "CMakeFiles/libabc.dir/src/base/abci/abcDar.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcDar.c.o.d"
+  "/root/repo/src/base/abci/abcDebug.c" "CMakeFiles/libabc.dir/src/base/abci/abcDebug.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcDebug.c.o.d"
+  "/root/repo/src/base/abci/abcDec.c" "CMakeFiles/libabc.dir/src/base/abci/abcDec.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcDec.c.o.d"
+  "/root/repo/src/base/abci/abcDetect.c" "CMakeFiles/libabc.dir/src/base/abci/abcDetect.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcDetect.c.o.d"
+  "/root/repo/src/base/abci/abcDress.c" "CMakeFiles/libabc.dir/src/base/abci/abcDress.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcDress.c.o.d"
+  "/root/repo/src/base/abci/abcDress2.c" "CMakeFiles/libabc.dir/src/base/abci/abcDress2.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcDress2.c.o.d"
+  "/root/repo/src/base/abci/abcDress3.c" "CMakeFiles/libabc.dir/src/base/abci/abcDress3.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcDress3.c.o.d"
+  "/root/repo/src/base/abci/abcDsd.c" "CMakeFiles/libabc.dir/src/base/abci/abcDsd.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcDsd.c.o.d"
+  "/root/repo/src/base/abci/abcEco.c" "CMakeFiles/libabc.dir/src/base/abci/abcEco.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcEco.c.o.d"
+  "/root/repo/src/base/abci/abcExact.c" "CMakeFiles/libabc.dir/src/base/abci/abcExact.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcExact.c.o.d"
+  "/root/repo/src/base/abci/abcExtract.c" "CMakeFiles/libabc.dir/src/base/abci/abcExtract.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcExtract.c.o.d"
+  "/root/repo/src/base/abci/abcFraig.c" "CMakeFiles/libabc.dir/src/base/abci/abcFraig.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcFraig.c.o.d"
+  "/root/repo/src/base/abci/abcFx.c" "CMakeFiles/libabc.dir/src/base/abci/abcFx.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcFx.c.o.d"
+  "/root/repo/src/base/abci/abcFxu.c" "CMakeFiles/libabc.dir/src/base/abci/abcFxu.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcFxu.c.o.d"
+  "/root/repo/src/base/abci/abcGen.c" "CMakeFiles/libabc.dir/src/base/abci/abcGen.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcGen.c.o.d"
+  "/root/repo/src/base/abci/abcHaig.c" "CMakeFiles/libabc.dir/src/base/abci/abcHaig.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcHaig.c.o.d"
+  "/root/repo/src/base/abci/abcIf.c" "CMakeFiles/libabc.dir/src/base/abci/abcIf.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcIf.c.o.d"
+  "/root/repo/src/base/abci/abcIfMux.c" "CMakeFiles/libabc.dir/src/base/abci/abcIfMux.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcIfMux.c.o.d"
+  "/root/repo/src/base/abci/abcIfif.c" "CMakeFiles/libabc.dir/src/base/abci/abcIfif.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcIfif.c.o.d"
+  "/root/repo/src/base/abci/abcIvy.c" "CMakeFiles/libabc.dir/src/base/abci/abcIvy.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcIvy.c.o.d"
+  "/root/repo/src/base/abci/abcLog.c" "CMakeFiles/libabc.dir/src/base/abci/abcLog.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcLog.c.o.d"
+  "/root/repo/src/base/abci/abcLut.c" "CMakeFiles/libabc.dir/src/base/abci/abcLut.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcLut.c.o.d"
+  "/root/repo/src/base/abci/abcLutmin.c" "CMakeFiles/libabc.dir/src/base/abci/abcLutmin.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcLutmin.c.o.d"
+  "/root/repo/src/base/abci/abcMap.c" "CMakeFiles/libabc.dir/src/base/abci/abcMap.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcMap.c.o.d"
+  "/root/repo/src/base/abci/abcMerge.c" "CMakeFiles/libabc.dir/src/base/abci/abcMerge.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcMerge.c.o.d"
+  "/root/repo/src/base/abci/abcMfs.c" "CMakeFiles/libabc.dir/src/base/abci/abcMfs.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcMfs.c.o.d"
+  "/root/repo/src/base/abci/abcMini.c" "CMakeFiles/libabc.dir/src/base/abci/abcMini.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcMini.c.o.d"
+  "/root/repo/src/base/abci/abcMiter.c" "CMakeFiles/libabc.dir/src/base/abci/abcMiter.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcMiter.c.o.d"
+  "/root/repo/src/base/abci/abcMulti.c" "CMakeFiles/libabc.dir/src/base/abci/abcMulti.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcMulti.c.o.d"
+  "/root/repo/src/base/abci/abcNpn.c" "CMakeFiles/libabc.dir/src/base/abci/abcNpn.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcNpn.c.o.d"
+  "/root/repo/src/base/abci/abcNpnSave.c" "CMakeFiles/libabc.dir/src/base/abci/abcNpnSave.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcNpnSave.c.o.d"
+  "/root/repo/src/base/abci/abcNtbdd.c" "CMakeFiles/libabc.dir/src/base/abci/abcNtbdd.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcNtbdd.c.o.d"
+  "/root/repo/src/base/abci/abcOdc.c" "CMakeFiles/libabc.dir/src/base/abci/abcOdc.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcOdc.c.o.d"
+  "/root/repo/src/base/abci/abcOrder.c" "CMakeFiles/libabc.dir/src/base/abci/abcOrder.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcOrder.c.o.d"
+  "/root/repo/src/base/abci/abcPart.c" "CMakeFiles/libabc.dir/src/base/abci/abcPart.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcPart.c.o.d"
+  "/root/repo/src/base/abci/abcPrint.c" "CMakeFiles/libabc.dir/src/base/abci/abcPrint.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcPrint.c.o.d"
+  "/root/repo/src/base/abci/abcProve.c" "CMakeFiles/libabc.dir/src/base/abci/abcProve.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcProve.c.o.d"
+  "/root/repo/src/base/abci/abcQbf.c" "CMakeFiles/libabc.dir/src/base/abci/abcQbf.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcQbf.c.o.d"
+  "/root/repo/src/base/abci/abcQuant.c" "CMakeFiles/libabc.dir/src/base/abci/abcQuant.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcQuant.c.o.d"
+  "/root/repo/src/base/abci/abcReach.c" "CMakeFiles/libabc.dir/src/base/abci/abcReach.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcReach.c.o.d"
+  "/root/repo/src/base/abci/abcRec3.c" "CMakeFiles/libabc.dir/src/base/abci/abcRec3.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcRec3.c.o.d"
+  "/root/repo/src/base/abci/abcReconv.c" "CMakeFiles/libabc.dir/src/base/abci/abcReconv.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcReconv.c.o.d"
+  "/root/repo/src/base/abci/abcRefactor.c" "CMakeFiles/libabc.dir/src/base/abci/abcRefactor.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcRefactor.c.o.d"
+  "/root/repo/src/base/abci/abcRenode.c" "CMakeFiles/libabc.dir/src/base/abci/abcRenode.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcRenode.c.o.d"
+  "/root/repo/src/base/abci/abcReorder.c" "CMakeFiles/libabc.dir/src/base/abci/abcReorder.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcReorder.c.o.d"
+  "/root/repo/src/base/abci/abcRestruct.c" "CMakeFiles/libabc.dir/src/base/abci/abcRestruct.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcRestruct.c.o.d"
+  "/root/repo/src/base/abci/abcResub.c" "CMakeFiles/libabc.dir/src/base/abci/abcResub.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcResub.c.o.d"
+  "/root/repo/src/base/abci/abcRewrite.c" "CMakeFiles/libabc.dir/src/base/abci/abcRewrite.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcRewrite.c.o.d"
+  "/root/repo/src/base/abci/abcRpo.c" "CMakeFiles/libabc.dir/src/base/abci/abcRpo.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcRpo.c.o.d"
+  "/root/repo/src/base/abci/abcRr.c" "CMakeFiles/libabc.dir/src/base/abci/abcRr.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcRr.c.o.d"
+  "/root/repo/src/base/abci/abcRunGen.c" "CMakeFiles/libabc.dir/src/base/abci/abcRunGen.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcRunGen.c.o.d"
+  "/root/repo/src/base/abci/abcSat.c" "CMakeFiles/libabc.dir/src/base/abci/abcSat.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcSat.c.o.d"
+  "/root/repo/src/base/abci/abcSaucy.c" "CMakeFiles/libabc.dir/src/base/abci/abcSaucy.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcSaucy.c.o.d"
+  "/root/repo/src/base/abci/abcScorr.c" "CMakeFiles/libabc.dir/src/base/abci/abcScorr.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcScorr.c.o.d"
+  "/root/repo/src/base/abci/abcSense.c" "CMakeFiles/libabc.dir/src/base/abci/abcSense.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcSense.c.o.d"
+  "/root/repo/src/base/abci/abcSpeedup.c" "CMakeFiles/libabc.dir/src/base/abci/abcSpeedup.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcSpeedup.c.o.d"
+  "/root/repo/src/base/abci/abcStrash.c" "CMakeFiles/libabc.dir/src/base/abci/abcStrash.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcStrash.c.o.d"
+  "/root/repo/src/base/abci/abcSweep.c" "CMakeFiles/libabc.dir/src/base/abci/abcSweep.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcSweep.c.o.d"
+  "/root/repo/src/base/abci/abcSymm.c" "CMakeFiles/libabc.dir/src/base/abci/abcSymm.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcSymm.c.o.d"
+  "/root/repo/src/base/abci/abcTim.c" "CMakeFiles/libabc.dir/src/base/abci/abcTim.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcTim.c.o.d"
+  "/root/repo/src/base/abci/abcTiming.c" "CMakeFiles/libabc.dir/src/base/abci/abcTiming.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcTiming.c.o.d"
+  "/root/repo/src/base/abci/abcUnate.c" "CMakeFiles/libabc.dir/src/base/abci/abcUnate.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcUnate.c.o.d"
+  "/root/repo/src/base/abci/abcUnreach.c" "CMakeFiles/libabc.dir/src/base/abci/abcUnreach.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcUnreach.c.o.d"
+  "/root/repo/src/base/abci/abcVerify.c" "CMakeFiles/libabc.dir/src/base/abci/abcVerify.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcVerify.c.o.d"
+  "/root/repo/src/base/abci/abcXsim.c" "CMakeFiles/libabc.dir/src/base/abci/abcXsim.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/abci/abcXsim.c.o.d"
+  "/root/repo/src/base/acb/acbAbc.c" "CMakeFiles/libabc.dir/src/base/acb/acbAbc.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/acb/acbAbc.c.o.d"
+  "/root/repo/src/base/acb/acbAig.c" "CMakeFiles/libabc.dir/src/base/acb/acbAig.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/acb/acbAig.c.o.d"
+  "/root/repo/src/base/acb/acbCom.c" "CMakeFiles/libabc.dir/src/base/acb/acbCom.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/acb/acbCom.c.o.d"
+  "/root/repo/src/base/acb/acbFunc.c" "CMakeFiles/libabc.dir/src/base/acb/acbFunc.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/acb/acbFunc.c.o.d"
+  "/root/repo/src/base/acb/acbMfs.c" "CMakeFiles/libabc.dir/src/base/acb/acbMfs.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/acb/acbMfs.c.o.d"
+  "/root/repo/src/base/acb/acbPush.c" "CMakeFiles/libabc.dir/src/base/acb/acbPush.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/acb/acbPush.c.o.d"
+  "/root/repo/src/base/acb/acbSets.c" "CMakeFiles/libabc.dir/src/base/acb/acbSets.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/acb/acbSets.c.o.d"
+  "/root/repo/src/base/acb/acbUtil.c" "CMakeFiles/libabc.dir/src/base/acb/acbUtil.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/acb/acbUtil.c.o.d"
+  "/root/repo/src/base/bac/bacBac.c" "CMakeFiles/libabc.dir/src/base/bac/bacBac.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/bac/bacBac.c.o.d"
+  "/root/repo/src/base/bac/bacBlast.c" "CMakeFiles/libabc.dir/src/base/bac/bacBlast.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/bac/bacBlast.c.o.d"
+  "/root/repo/src/base/bac/bacCom.c" "CMakeFiles/libabc.dir/src/base/bac/bacCom.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/bac/bacCom.c.o.d"
+  "/root/repo/src/base/bac/bacLib.c" "CMakeFiles/libabc.dir/src/base/bac/bacLib.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/bac/bacLib.c.o.d"
+  "/root/repo/src/base/bac/bacNtk.c" "CMakeFiles/libabc.dir/src/base/bac/bacNtk.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/bac/bacNtk.c.o.d"
+  "/root/repo/src/base/bac/bacPrsBuild.c" "CMakeFiles/libabc.dir/src/base/bac/bacPrsBuild.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/bac/bacPrsBuild.c.o.d"
+  "/root/repo/src/base/bac/bacPrsTrans.c" "CMakeFiles/libabc.dir/src/base/bac/bacPrsTrans.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/bac/bacPrsTrans.c.o.d"
+  "/root/repo/src/base/bac/bacPtr.c" "CMakeFiles/libabc.dir/src/base/bac/bacPtr.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/bac/bacPtr.c.o.d"
+  "/root/repo/src/base/bac/bacPtrAbc.c" "CMakeFiles/libabc.dir/src/base/bac/bacPtrAbc.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/bac/bacPtrAbc.c.o.d"
+  "/root/repo/src/base/bac/bacReadBlif.c" "CMakeFiles/libabc.dir/src/base/bac/bacReadBlif.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/bac/bacReadBlif.c.o.d"
+  "/root/repo/src/base/bac/bacReadSmt.c" "CMakeFiles/libabc.dir/src/base/bac/bacReadSmt.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/bac/bacReadSmt.c.o.d"
+  "/root/repo/src/base/bac/bacReadVer.c" "CMakeFiles/libabc.dir/src/base/bac/bacReadVer.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/bac/bacReadVer.c.o.d"
+  "/root/repo/src/base/bac/bacWriteBlif.c" "CMakeFiles/libabc.dir/src/base/bac/bacWriteBlif.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/bac/bacWriteBlif.c.o.d"
+  "/root/repo/src/base/bac/bacWriteSmt.c" "CMakeFiles/libabc.dir/src/base/bac/bacWriteSmt.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/bac/bacWriteSmt.c.o.d"
+  "/root/repo/src/base/bac/bacWriteVer.c" "CMakeFiles/libabc.dir/src/base/bac/bacWriteVer.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/bac/bacWriteVer.c.o.d"
+  "/root/repo/src/base/cba/cbaBlast.c" "CMakeFiles/libabc.dir/src/base/cba/cbaBlast.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/cba/cbaBlast.c.o.d"
+  "/root/repo/src/base/cba/cbaCba.c" "CMakeFiles/libabc.dir/src/base/cba/cbaCba.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/cba/cbaCba.c.o.d"
+  "/root/repo/src/base/cba/cbaCom.c" "CMakeFiles/libabc.dir/src/base/cba/cbaCom.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/cba/cbaCom.c.o.d"
+  "/root/repo/src/base/cba/cbaNtk.c" "CMakeFiles/libabc.dir/src/base/cba/cbaNtk.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/cba/cbaNtk.c.o.d"
+  "/root/repo/src/base/cba/cbaReadBlif.c" "CMakeFiles/libabc.dir/src/base/cba/cbaReadBlif.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/cba/cbaReadBlif.c.o.d"
+  "/root/repo/src/base/cba/cbaReadVer.c" "CMakeFiles/libabc.dir/src/base/cba/cbaReadVer.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/cba/cbaReadVer.c.o.d"
+  "/root/repo/src/base/cba/cbaWriteBlif.c" "CMakeFiles/libabc.dir/src/base/cba/cbaWriteBlif.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/cba/cbaWriteBlif.c.o.d"
+  "/root/repo/src/base/cba/cbaWriteVer.c" "CMakeFiles/libabc.dir/src/base/cba/cbaWriteVer.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/cba/cbaWriteVer.c.o.d"
+  "/root/repo/src/base/cmd/cmd.c" "CMakeFiles/libabc.dir/src/base/cmd/cmd.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/cmd/cmd.c.o.d"
+  "/root/repo/src/base/cmd/cmdAlias.c" "CMakeFiles/libabc.dir/src/base/cmd/cmdAlias.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/cmd/cmdAlias.c.o.d"
+  "/root/repo/src/base/cmd/cmdApi.c" "CMakeFiles/libabc.dir/src/base/cmd/cmdApi.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/cmd/cmdApi.c.o.d"
+  "/root/repo/src/base/cmd/cmdAuto.c" "CMakeFiles/libabc.dir/src/base/cmd/cmdAuto.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/cmd/cmdAuto.c.o.d"
+  "/root/repo/src/base/cmd/cmdFlag.c" "CMakeFiles/libabc.dir/src/base/cmd/cmdFlag.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/cmd/cmdFlag.c.o.d"
+  "/root/repo/src/base/cmd/cmdHist.c" "CMakeFiles/libabc.dir/src/base/cmd/cmdHist.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/cmd/cmdHist.c.o.d"
+  "/root/repo/src/base/cmd/cmdLoad.c" "CMakeFiles/libabc.dir/src/base/cmd/cmdLoad.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/cmd/cmdLoad.c.o.d"
+  "/root/repo/src/base/cmd/cmdPlugin.c" "CMakeFiles/libabc.dir/src/base/cmd/cmdPlugin.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/cmd/cmdPlugin.c.o.d"
+  "/root/repo/src/base/cmd/cmdStarter.c" "CMakeFiles/libabc.dir/src/base/cmd/cmdStarter.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/cmd/cmdStarter.c.o.d"
+  "/root/repo/src/base/cmd/cmdUtils.c" "CMakeFiles/libabc.dir/src/base/cmd/cmdUtils.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/cmd/cmdUtils.c.o.d"
+  "/root/repo/src/base/exor/exor.c" "CMakeFiles/libabc.dir/src/base/exor/exor.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/exor/exor.c.o.d"
+  "/root/repo/src/base/exor/exorBits.c" "CMakeFiles/libabc.dir/src/base/exor/exorBits.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/exor/exorBits.c.o.d"
+  "/root/repo/src/base/exor/exorCubes.c" "CMakeFiles/libabc.dir/src/base/exor/exorCubes.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/exor/exorCubes.c.o.d"
+  "/root/repo/src/base/exor/exorLink.c" "CMakeFiles/libabc.dir/src/base/exor/exorLink.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/exor/exorLink.c.o.d"
+  "/root/repo/src/base/exor/exorList.c" "CMakeFiles/libabc.dir/src/base/exor/exorList.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/exor/exorList.c.o.d"
+  "/root/repo/src/base/exor/exorUtil.c" "CMakeFiles/libabc.dir/src/base/exor/exorUtil.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/exor/exorUtil.c.o.d"
+  "/root/repo/src/base/io/io.c" "CMakeFiles/libabc.dir/src/base/io/io.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/io/io.c.o.d"
+  "/root/repo/src/base/io/ioJson.c" "CMakeFiles/libabc.dir/src/base/io/ioJson.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/io/ioJson.c.o.d"
+  "/root/repo/src/base/io/ioReadAiger.c" "CMakeFiles/libabc.dir/src/base/io/ioReadAiger.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/io/ioReadAiger.c.o.d"
+  "/root/repo/src/base/io/ioReadBaf.c" "CMakeFiles/libabc.dir/src/base/io/ioReadBaf.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/io/ioReadBaf.c.o.d"
+  "/root/repo/src/base/io/ioReadBblif.c" "CMakeFiles/libabc.dir/src/base/io/ioReadBblif.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/io/ioReadBblif.c.o.d"
+  "/root/repo/src/base/io/ioReadBench.c" "CMakeFiles/libabc.dir/src/base/io/ioReadBench.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/io/ioReadBench.c.o.d"
+  "/root/repo/src/base/io/ioReadBlif.c" "CMakeFiles/libabc.dir/src/base/io/ioReadBlif.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/io/ioReadBlif.c.o.d"
+  "/root/repo/src/base/io/ioReadBlifAig.c" "CMakeFiles/libabc.dir/src/base/io/ioReadBlifAig.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/io/ioReadBlifAig.c.o.d"
+  "/root/repo/src/base/io/ioReadBlifMv.c" "CMakeFiles/libabc.dir/src/base/io/ioReadBlifMv.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/io/ioReadBlifMv.c.o.d"
+  "/root/repo/src/base/io/ioReadDsd.c" "CMakeFiles/libabc.dir/src/base/io/ioReadDsd.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/io/ioReadDsd.c.o.d"
+  "/root/repo/src/base/io/ioReadEdif.c" "CMakeFiles/libabc.dir/src/base/io/ioReadEdif.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/io/ioReadEdif.c.o.d"
+  "/root/repo/src/base/io/ioReadEqn.c" "CMakeFiles/libabc.dir/src/base/io/ioReadEqn.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/io/ioReadEqn.c.o.d"
+  "/root/repo/src/base/io/ioReadPla.c" "CMakeFiles/libabc.dir/src/base/io/ioReadPla.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/io/ioReadPla.c.o.d"
+  "/root/repo/src/base/io/ioReadPlaMo.c" "CMakeFiles/libabc.dir/src/base/io/ioReadPlaMo.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/io/ioReadPlaMo.c.o.d"
+  "/root/repo/src/base/io/ioReadVerilog.c" "CMakeFiles/libabc.dir/src/base/io/ioReadVerilog.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/io/ioReadVerilog.c.o.d"
+  "/root/repo/src/base/io/ioUtil.c" "CMakeFiles/libabc.dir/src/base/io/ioUtil.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/io/ioUtil.c.o.d"
+  "/root/repo/src/base/io/ioWriteAiger.c" "CMakeFiles/libabc.dir/src/base/io/ioWriteAiger.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/io/ioWriteAiger.c.o.d"
+  "/root/repo/src/base/io/ioWriteBaf.c" "CMakeFiles/libabc.dir/src/base/io/ioWriteBaf.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/io/ioWriteBaf.c.o.d"
+  "/root/repo/src/base/io/ioWriteBblif.c" "CMakeFiles/libabc.dir/src/base/io/ioWriteBblif.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/io/ioWriteBblif.c.o.d"
+  "/root/repo/src/base/io/ioWriteBench.c" "CMakeFiles/libabc.dir/src/base/io/ioWriteBench.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/io/ioWriteBench.c.o.d"
+  "/root/repo/src/base/io/ioWriteBlif.c" "CMakeFiles/libabc.dir/src/base/io/ioWriteBlif.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/io/ioWriteBlif.c.o.d"
+  "/root/repo/src/base/io/ioWriteBlifMv.c" "CMakeFiles/libabc.dir/src/base/io/ioWriteBlifMv.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/io/ioWriteBlifMv.c.o.d"
+  "/root/repo/src/base/io/ioWriteBook.c" "CMakeFiles/libabc.dir/src/base/io/ioWriteBook.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/io/ioWriteBook.c.o.d"
+  "/root/repo/src/base/io/ioWriteCnf.c" "CMakeFiles/libabc.dir/src/base/io/ioWriteCnf.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/io/ioWriteCnf.c.o.d"
+  "/root/repo/src/base/io/ioWriteDot.c" "CMakeFiles/libabc.dir/src/base/io/ioWriteDot.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/io/ioWriteDot.c.o.d"
+  "/root/repo/src/base/io/ioWriteEqn.c" "CMakeFiles/libabc.dir/src/base/io/ioWriteEqn.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/io/ioWriteEqn.c.o.d"
+  "/root/repo/src/base/io/ioWriteGml.c" "CMakeFiles/libabc.dir/src/base/io/ioWriteGml.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/io/ioWriteGml.c.o.d"
+  "/root/repo/src/base/io/ioWriteList.c" "CMakeFiles/libabc.dir/src/base/io/ioWriteList.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/io/ioWriteList.c.o.d"
+  "/root/repo/src/base/io/ioWritePla.c" "CMakeFiles/libabc.dir/src/base/io/ioWritePla.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/io/ioWritePla.c.o.d"
+  "/root/repo/src/base/io/ioWriteSmv.c" "CMakeFiles/libabc.dir/src/base/io/ioWriteSmv.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/io/ioWriteSmv.c.o.d"
+  "/root/repo/src/base/io/ioWriteVerilog.c" "CMakeFiles/libabc.dir/src/base/io/ioWriteVerilog.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/io/ioWriteVerilog.c.o.d"
+  "/root/repo/src/base/main/libSupport.c" "CMakeFiles/libabc.dir/src/base/main/libSupport.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/main/libSupport.c.o.d"
+  "/root/repo/src/base/main/mainFrame.c" "CMakeFiles/libabc.dir/src/base/main/mainFrame.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/main/mainFrame.c.o.d"
+  "/root/repo/src/base/main/mainInit.c" "CMakeFiles/libabc.dir/src/base/main/mainInit.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/main/mainInit.c.o.d"
+  "/root/repo/src/base/main/mainLib.c" "CMakeFiles/libabc.dir/src/base/main/mainLib.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/main/mainLib.c.o.d"
+  "/root/repo/src/base/main/mainReal.c" "CMakeFiles/libabc.dir/src/base/main/mainReal.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/main/mainReal.c.o.d"
+  "/root/repo/src/base/main/mainUtils.c" "CMakeFiles/libabc.dir/src/base/main/mainUtils.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/main/mainUtils.c.o.d"
+  "/root/repo/src/base/pla/plaCom.c" "CMakeFiles/libabc.dir/src/base/pla/plaCom.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/pla/plaCom.c.o.d"
+  "/root/repo/src/base/pla/plaHash.c" "CMakeFiles/libabc.dir/src/base/pla/plaHash.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/pla/plaHash.c.o.d"
+  "/root/repo/src/base/pla/plaMan.c" "CMakeFiles/libabc.dir/src/base/pla/plaMan.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/pla/plaMan.c.o.d"
+  "/root/repo/src/base/pla/plaMerge.c" "CMakeFiles/libabc.dir/src/base/pla/plaMerge.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/pla/plaMerge.c.o.d"
+  "/root/repo/src/base/pla/plaRead.c" "CMakeFiles/libabc.dir/src/base/pla/plaRead.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/pla/plaRead.c.o.d"
+  "/root/repo/src/base/pla/plaSimple.c" "CMakeFiles/libabc.dir/src/base/pla/plaSimple.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/pla/plaSimple.c.o.d"
+  "/root/repo/src/base/pla/plaWrite.c" "CMakeFiles/libabc.dir/src/base/pla/plaWrite.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/pla/plaWrite.c.o.d"
+  "/root/repo/src/base/test/test.c" "CMakeFiles/libabc.dir/src/base/test/test.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/test/test.c.o.d"
+  "/root/repo/src/base/ver/verCore.c" "CMakeFiles/libabc.dir/src/base/ver/verCore.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/ver/verCore.c.o.d"
+  "/root/repo/src/base/ver/verFormula.c" "CMakeFiles/libabc.dir/src/base/ver/verFormula.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/ver/verFormula.c.o.d"
+  "/root/repo/src/base/ver/verParse.c" "CMakeFiles/libabc.dir/src/base/ver/verParse.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/ver/verParse.c.o.d"
+  "/root/repo/src/base/ver/verStream.c" "CMakeFiles/libabc.dir/src/base/ver/verStream.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/ver/verStream.c.o.d"
+  "/root/repo/src/base/wlc/wlcAbc.c" "CMakeFiles/libabc.dir/src/base/wlc/wlcAbc.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/wlc/wlcAbc.c.o.d"
+  "/root/repo/src/base/wlc/wlcAbs.c" "CMakeFiles/libabc.dir/src/base/wlc/wlcAbs.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/wlc/wlcAbs.c.o.d"
+  "/root/repo/src/base/wlc/wlcAbs2.c" "CMakeFiles/libabc.dir/src/base/wlc/wlcAbs2.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/wlc/wlcAbs2.c.o.d"
+  "/root/repo/src/base/wlc/wlcBlast.c" "CMakeFiles/libabc.dir/src/base/wlc/wlcBlast.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/wlc/wlcBlast.c.o.d"
+  "/root/repo/src/base/wlc/wlcCom.c" "CMakeFiles/libabc.dir/src/base/wlc/wlcCom.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/wlc/wlcCom.c.o.d"
+  "/root/repo/src/base/wlc/wlcGraft.c" "CMakeFiles/libabc.dir/src/base/wlc/wlcGraft.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/wlc/wlcGraft.c.o.d"
+  "/root/repo/src/base/wlc/wlcJson.c" "CMakeFiles/libabc.dir/src/base/wlc/wlcJson.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/wlc/wlcJson.c.o.d"
+  "/root/repo/src/base/wlc/wlcMem.c" "CMakeFiles/libabc.dir/src/base/wlc/wlcMem.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/wlc/wlcMem.c.o.d"
+  "/root/repo/src/base/wlc/wlcNdr.c" "CMakeFiles/libabc.dir/src/base/wlc/wlcNdr.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/wlc/wlcNdr.c.o.d"
+  "/root/repo/src/base/wlc/wlcNtk.c" "CMakeFiles/libabc.dir/src/base/wlc/wlcNtk.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/wlc/wlcNtk.c.o.d"
+  "/root/repo/src/base/wlc/wlcPth.c" "CMakeFiles/libabc.dir/src/base/wlc/wlcPth.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/wlc/wlcPth.c.o.d"
+  "/root/repo/src/base/wlc/wlcReadSmt.c" "CMakeFiles/libabc.dir/src/base/wlc/wlcReadSmt.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/wlc/wlcReadSmt.c.o.d"
+  "/root/repo/src/base/wlc/wlcReadVer.c" "CMakeFiles/libabc.dir/src/base/wlc/wlcReadVer.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/wlc/wlcReadVer.c.o.d"
+  "/root/repo/src/base/wlc/wlcShow.c" "CMakeFiles/libabc.dir/src/base/wlc/wlcShow.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/wlc/wlcShow.c.o.d"
+  "/root/repo/src/base/wlc/wlcSim.c" "CMakeFiles/libabc.dir/src/base/wlc/wlcSim.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/wlc/wlcSim.c.o.d"
+  "/root/repo/src/base/wlc/wlcStdin.c" "CMakeFiles/libabc.dir/src/base/wlc/wlcStdin.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/wlc/wlcStdin.c.o.d"
+  "/root/repo/src/base/wlc/wlcUif.c" "CMakeFiles/libabc.dir/src/base/wlc/wlcUif.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/wlc/wlcUif.c.o.d"
+  "/root/repo/src/base/wlc/wlcWin.c" "CMakeFiles/libabc.dir/src/base/wlc/wlcWin.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/wlc/wlcWin.c.o.d"
+  "/root/repo/src/base/wlc/wlcWriteVer.c" "CMakeFiles/libabc.dir/src/base/wlc/wlcWriteVer.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/wlc/wlcWriteVer.c.o.d"
+  "/root/repo/src/base/wln/wln.c" "CMakeFiles/libabc.dir/src/base/wln/wln.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/wln/wln.c.o.d"
+  "/root/repo/src/base/wln/wlnMem.c" "CMakeFiles/libabc.dir/src/base/wln/wlnMem.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/wln/wlnMem.c.o.d"
+  "/root/repo/src/base/wln/wlnNdr.c" "CMakeFiles/libabc.dir/src/base/wln/wlnNdr.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/wln/wlnNdr.c.o.d"
+  "/root/repo/src/base/wln/wlnNtk.c" "CMakeFiles/libabc.dir/src/base/wln/wlnNtk.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/wln/wlnNtk.c.o.d"
+  "/root/repo/src/base/wln/wlnObj.c" "CMakeFiles/libabc.dir/src/base/wln/wlnObj.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/wln/wlnObj.c.o.d"
+  "/root/repo/src/base/wln/wlnRetime.c" "CMakeFiles/libabc.dir/src/base/wln/wlnRetime.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/wln/wlnRetime.c.o.d"
+  "/root/repo/src/base/wln/wlnWlc.c" "CMakeFiles/libabc.dir/src/base/wln/wlnWlc.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/wln/wlnWlc.c.o.d"
+  "/root/repo/src/base/wln/wlnWriteVer.c" "CMakeFiles/libabc.dir/src/base/wln/wlnWriteVer.c.o" "gcc" "CMakeFiles/libabc.dir/src/base/wln/wlnWriteVer.c.o.d"
+  "/root/repo/src/bdd/bbr/bbrCex.c" "CMakeFiles/libabc.dir/src/bdd/bbr/bbrCex.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/bbr/bbrCex.c.o.d"
+  "/root/repo/src/bdd/bbr/bbrImage.c" "CMakeFiles/libabc.dir/src/bdd/bbr/bbrImage.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/bbr/bbrImage.c.o.d"
+  "/root/repo/src/bdd/bbr/bbrNtbdd.c" "CMakeFiles/libabc.dir/src/bdd/bbr/bbrNtbdd.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/bbr/bbrNtbdd.c.o.d"
+  "/root/repo/src/bdd/bbr/bbrReach.c" "CMakeFiles/libabc.dir/src/bdd/bbr/bbrReach.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/bbr/bbrReach.c.o.d"
+  "/root/repo/src/bdd/cas/casCore.c" "CMakeFiles/libabc.dir/src/bdd/cas/casCore.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cas/casCore.c.o.d"
+  "/root/repo/src/bdd/cas/casDec.c" "CMakeFiles/libabc.dir/src/bdd/cas/casDec.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cas/casDec.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddAPI.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddAPI.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddAPI.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddAddAbs.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddAddAbs.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddAddAbs.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddAddApply.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddAddApply.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddAddApply.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddAddFind.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddAddFind.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddAddFind.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddAddInv.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddAddInv.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddAddInv.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddAddIte.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddAddIte.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddAddIte.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddAddNeg.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddAddNeg.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddAddNeg.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddAddWalsh.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddAddWalsh.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddAddWalsh.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddAndAbs.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddAndAbs.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddAndAbs.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddAnneal.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddAnneal.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddAnneal.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddApa.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddApa.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddApa.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddApprox.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddApprox.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddApprox.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddBddAbs.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddBddAbs.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddBddAbs.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddBddCorr.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddBddCorr.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddBddCorr.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddBddIte.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddBddIte.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddBddIte.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddBridge.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddBridge.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddBridge.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddCache.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddCache.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddCache.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddCheck.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddCheck.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddCheck.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddClip.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddClip.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddClip.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddCof.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddCof.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddCof.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddCompose.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddCompose.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddCompose.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddDecomp.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddDecomp.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddDecomp.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddEssent.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddEssent.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddEssent.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddExact.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddExact.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddExact.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddExport.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddExport.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddExport.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddGenCof.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddGenCof.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddGenCof.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddGenetic.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddGenetic.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddGenetic.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddGroup.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddGroup.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddGroup.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddHarwell.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddHarwell.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddHarwell.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddInit.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddInit.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddInit.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddInteract.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddInteract.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddInteract.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddLCache.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddLCache.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddLCache.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddLevelQ.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddLevelQ.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddLevelQ.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddLinear.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddLinear.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddLinear.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddLiteral.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddLiteral.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddLiteral.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddMatMult.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddMatMult.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddMatMult.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddPriority.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddPriority.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddPriority.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddRead.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddRead.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddRead.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddRef.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddRef.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddRef.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddReorder.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddReorder.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddReorder.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddSat.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddSat.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddSat.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddSign.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddSign.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddSign.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddSolve.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddSolve.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddSolve.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddSplit.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddSplit.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddSplit.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddSubsetHB.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddSubsetHB.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddSubsetHB.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddSubsetSP.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddSubsetSP.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddSubsetSP.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddSymmetry.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddSymmetry.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddSymmetry.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddTable.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddTable.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddTable.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddUtil.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddUtil.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddUtil.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddWindow.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddWindow.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddWindow.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddZddCount.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddZddCount.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddZddCount.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddZddFuncs.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddZddFuncs.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddZddFuncs.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddZddGroup.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddZddGroup.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddZddGroup.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddZddIsop.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddZddIsop.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddZddIsop.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddZddLin.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddZddLin.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddZddLin.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddZddMisc.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddZddMisc.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddZddMisc.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddZddPort.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddZddPort.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddZddPort.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddZddReord.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddZddReord.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddZddReord.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddZddSetop.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddZddSetop.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddZddSetop.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddZddSymm.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddZddSymm.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddZddSymm.c.o.d"
+  "/root/repo/src/bdd/cudd/cuddZddUtil.c" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddZddUtil.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/cudd/cuddZddUtil.c.o.d"
+  "/root/repo/src/bdd/dsd/dsdApi.c" "CMakeFiles/libabc.dir/src/bdd/dsd/dsdApi.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/dsd/dsdApi.c.o.d"
+  "/root/repo/src/bdd/dsd/dsdCheck.c" "CMakeFiles/libabc.dir/src/bdd/dsd/dsdCheck.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/dsd/dsdCheck.c.o.d"
+  "/root/repo/src/bdd/dsd/dsdLocal.c" "CMakeFiles/libabc.dir/src/bdd/dsd/dsdLocal.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/dsd/dsdLocal.c.o.d"
+  "/root/repo/src/bdd/dsd/dsdMan.c" "CMakeFiles/libabc.dir/src/bdd/dsd/dsdMan.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/dsd/dsdMan.c.o.d"
+  "/root/repo/src/bdd/dsd/dsdProc.c" "CMakeFiles/libabc.dir/src/bdd/dsd/dsdProc.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/dsd/dsdProc.c.o.d"
+  "/root/repo/src/bdd/dsd/dsdTree.c" "CMakeFiles/libabc.dir/src/bdd/dsd/dsdTree.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/dsd/dsdTree.c.o.d"
+  "/root/repo/src/bdd/epd/epd.c" "CMakeFiles/libabc.dir/src/bdd/epd/epd.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/epd/epd.c.o.d"
+  "/root/repo/src/bdd/extrab/extraBddAuto.c" "CMakeFiles/libabc.dir/src/bdd/extrab/extraBddAuto.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/extrab/extraBddAuto.c.o.d"
+  "/root/repo/src/bdd/extrab/extraBddCas.c" "CMakeFiles/libabc.dir/src/bdd/extrab/extraBddCas.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/extrab/extraBddCas.c.o.d"
+  "/root/repo/src/bdd/extrab/extraBddImage.c" "CMakeFiles/libabc.dir/src/bdd/extrab/extraBddImage.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/extrab/extraBddImage.c.o.d"
+  "/root/repo/src/bdd/extrab/extraBddKmap.c" "CMakeFiles/libabc.dir/src/bdd/extrab/extraBddKmap.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/extrab/extraBddKmap.c.o.d"
+  "/root/repo/src/bdd/extrab/extraBddMaxMin.c" "CMakeFiles/libabc.dir/src/bdd/extrab/extraBddMaxMin.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/extrab/extraBddMaxMin.c.o.d"
+  "/root/repo/src/bdd/extrab/extraBddMisc.c" "CMakeFiles/libabc.dir/src/bdd/extrab/extraBddMisc.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/extrab/extraBddMisc.c.o.d"
+  "/root/repo/src/bdd/extrab/extraBddSet.c" "CMakeFiles/libabc.dir/src/bdd/extrab/extraBddSet.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/extrab/extraBddSet.c.o.d"
+  "/root/repo/src/bdd/extrab/extraBddSymm.c" "CMakeFiles/libabc.dir/src/bdd/extrab/extraBddSymm.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/extrab/extraBddSymm.c.o.d"
+  "/root/repo/src/bdd/extrab/extraBddThresh.c" "CMakeFiles/libabc.dir/src/bdd/extrab/extraBddThresh.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/extrab/extraBddThresh.c.o.d"
+  "/root/repo/src/bdd/extrab/extraBddTime.c" "CMakeFiles/libabc.dir/src/bdd/extrab/extraBddTime.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/extrab/extraBddTime.c.o.d"
+  "/root/repo/src/bdd/extrab/extraBddUnate.c" "CMakeFiles/libabc.dir/src/bdd/extrab/extraBddUnate.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/extrab/extraBddUnate.c.o.d"
+  "/root/repo/src/bdd/llb/llb1Cluster.c" "CMakeFiles/libabc.dir/src/bdd/llb/llb1Cluster.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/llb/llb1Cluster.c.o.d"
+  "/root/repo/src/bdd/llb/llb1Constr.c" "CMakeFiles/libabc.dir/src/bdd/llb/llb1Constr.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/llb/llb1Constr.c.o.d"
+  "/root/repo/src/bdd/llb/llb1Core.c" "CMakeFiles/libabc.dir/src/bdd/llb/llb1Core.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/llb/llb1Core.c.o.d"
+  "/root/repo/src/bdd/llb/llb1Group.c" "CMakeFiles/libabc.dir/src/bdd/llb/llb1Group.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/llb/llb1Group.c.o.d"
+  "/root/repo/src/bdd/llb/llb1Hint.c" "CMakeFiles/libabc.dir/src/bdd/llb/llb1Hint.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/llb/llb1Hint.c.o.d"
+  "/root/repo/src/bdd/llb/llb1Man.c" "CMakeFiles/libabc.dir/src/bdd/llb/llb1Man.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/llb/llb1Man.c.o.d"
+  "/root/repo/src/bdd/llb/llb1Matrix.c" "CMakeFiles/libabc.dir/src/bdd/llb/llb1Matrix.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/llb/llb1Matrix.c.o.d"
+  "/root/repo/src/bdd/llb/llb1Pivot.c" "CMakeFiles/libabc.dir/src/bdd/llb/llb1Pivot.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/llb/llb1Pivot.c.o.d"
+  "/root/repo/src/bdd/llb/llb1Reach.c" "CMakeFiles/libabc.dir/src/bdd/llb/llb1Reach.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/llb/llb1Reach.c.o.d"
+  "/root/repo/src/bdd/llb/llb1Sched.c" "CMakeFiles/libabc.dir/src/bdd/llb/llb1Sched.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/llb/llb1Sched.c.o.d"
+  "/root/repo/src/bdd/llb/llb2Bad.c" "CMakeFiles/libabc.dir/src/bdd/llb/llb2Bad.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/llb/llb2Bad.c.o.d"
+  "/root/repo/src/bdd/llb/llb2Core.c" "CMakeFiles/libabc.dir/src/bdd/llb/llb2Core.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/llb/llb2Core.c.o.d"
+  "/root/repo/src/bdd/llb/llb2Driver.c" "CMakeFiles/libabc.dir/src/bdd/llb/llb2Driver.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/llb/llb2Driver.c.o.d"
+  "/root/repo/src/bdd/llb/llb2Dump.c" "CMakeFiles/libabc.dir/src/bdd/llb/llb2Dump.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/llb/llb2Dump.c.o.d"
+  "/root/repo/src/bdd/llb/llb2Flow.c" "CMakeFiles/libabc.dir/src/bdd/llb/llb2Flow.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/llb/llb2Flow.c.o.d"
+  "/root/repo/src/bdd/llb/llb2Image.c" "CMakeFiles/libabc.dir/src/bdd/llb/llb2Image.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/llb/llb2Image.c.o.d"
+  "/root/repo/src/bdd/llb/llb3Image.c" "CMakeFiles/libabc.dir/src/bdd/llb/llb3Image.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/llb/llb3Image.c.o.d"
+  "/root/repo/src/bdd/llb/llb3Nonlin.c" "CMakeFiles/libabc.dir/src/bdd/llb/llb3Nonlin.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/llb/llb3Nonlin.c.o.d"
+  "/root/repo/src/bdd/llb/llb4Cex.c" "CMakeFiles/libabc.dir/src/bdd/llb/llb4Cex.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/llb/llb4Cex.c.o.d"
+  "/root/repo/src/bdd/llb/llb4Image.c" "CMakeFiles/libabc.dir/src/bdd/llb/llb4Image.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/llb/llb4Image.c.o.d"
+  "/root/repo/src/bdd/llb/llb4Nonlin.c" "CMakeFiles/libabc.dir/src/bdd/llb/llb4Nonlin.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/llb/llb4Nonlin.c.o.d"
+  "/root/repo/src/bdd/llb/llb4Sweep.c" "CMakeFiles/libabc.dir/src/bdd/llb/llb4Sweep.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/llb/llb4Sweep.c.o.d"
+  "/root/repo/src/bdd/mtr/mtrBasic.c" "CMakeFiles/libabc.dir/src/bdd/mtr/mtrBasic.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/mtr/mtrBasic.c.o.d"
+  "/root/repo/src/bdd/mtr/mtrGroup.c" "CMakeFiles/libabc.dir/src/bdd/mtr/mtrGroup.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/mtr/mtrGroup.c.o.d"
+  "/root/repo/src/bdd/reo/reoApi.c" "CMakeFiles/libabc.dir/src/bdd/reo/reoApi.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/reo/reoApi.c.o.d"
+  "/root/repo/src/bdd/reo/reoCore.c" "CMakeFiles/libabc.dir/src/bdd/reo/reoCore.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/reo/reoCore.c.o.d"
+  "/root/repo/src/bdd/reo/reoProfile.c" "CMakeFiles/libabc.dir/src/bdd/reo/reoProfile.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/reo/reoProfile.c.o.d"
+  "/root/repo/src/bdd/reo/reoShuffle.c" "CMakeFiles/libabc.dir/src/bdd/reo/reoShuffle.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/reo/reoShuffle.c.o.d"
+  "/root/repo/src/bdd/reo/reoSift.c" "CMakeFiles/libabc.dir/src/bdd/reo/reoSift.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/reo/reoSift.c.o.d"
+  "/root/repo/src/bdd/reo/reoSwap.c" "CMakeFiles/libabc.dir/src/bdd/reo/reoSwap.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/reo/reoSwap.c.o.d"
+  "/root/repo/src/bdd/reo/reoTransfer.c" "CMakeFiles/libabc.dir/src/bdd/reo/reoTransfer.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/reo/reoTransfer.c.o.d"
+  "/root/repo/src/bdd/reo/reoUnits.c" "CMakeFiles/libabc.dir/src/bdd/reo/reoUnits.c.o" "gcc" "CMakeFiles/libabc.dir/src/bdd/reo/reoUnits.c.o.d"
+  "/root/repo/src/bool/bdc/bdcCore.c" "CMakeFiles/libabc.dir/src/bool/bdc/bdcCore.c.o" "gcc" "CMakeFiles/libabc.dir/src/bool/bdc/bdcCore.c.o.d"
+  "/root/repo/src/bool/bdc/bdcDec.c" "CMakeFiles/libabc.dir/src/bool/bdc/bdcDec.c.o" "gcc" "CMakeFiles/libabc.dir/src/bool/bdc/bdcDec.c.o.d"
+  "/root/repo/src/bool/bdc/bdcSpfd.c" "CMakeFiles/libabc.dir/src/bool/bdc/bdcSpfd.c.o" "gcc" "CMakeFiles/libabc.dir/src/bool/bdc/bdcSpfd.c.o.d"
+  "/root/repo/src/bool/bdc/bdcTable.c" "CMakeFiles/libabc.dir/src/bool/bdc/bdcTable.c.o" "gcc" "CMakeFiles/libabc.dir/src/bool/bdc/bdcTable.c.o.d"
+  "/root/repo/src/bool/dec/decAbc.c" "CMakeFiles/libabc.dir/src/bool/dec/decAbc.c.o" "gcc" "CMakeFiles/libabc.dir/src/bool/dec/decAbc.c.o.d"
+  "/root/repo/src/bool/dec/decFactor.c" "CMakeFiles/libabc.dir/src/bool/dec/decFactor.c.o" "gcc" "CMakeFiles/libabc.dir/src/bool/dec/decFactor.c.o.d"
+  "/root/repo/src/bool/dec/decMan.c" "CMakeFiles/libabc.dir/src/bool/dec/decMan.c.o" "gcc" "CMakeFiles/libabc.dir/src/bool/dec/decMan.c.o.d"
+  "/root/repo/src/bool/dec/decPrint.c" "CMakeFiles/libabc.dir/src/bool/dec/decPrint.c.o" "gcc" "CMakeFiles/libabc.dir/src/bool/dec/decPrint.c.o.d"
+  "/root/repo/src/bool/dec/decUtil.c" "CMakeFiles/libabc.dir/src/bool/dec/decUtil.c.o" "gcc" "CMakeFiles/libabc.dir/src/bool/dec/decUtil.c.o.d"
+  "/root/repo/src/bool/kit/cloud.c" "CMakeFiles/libabc.dir/src/bool/kit/cloud.c.o" "gcc" "CMakeFiles/libabc.dir/src/bool/kit/cloud.c.o.d"
+  "/root/repo/src/bool/kit/kitAig.c" "CMakeFiles/libabc.dir/src/bool/kit/kitAig.c.o" "gcc" "CMakeFiles/libabc.dir/src/bool/kit/kitAig.c.o.d"
+  "/root/repo/src/bool/kit/kitBdd.c" "CMakeFiles/libabc.dir/src/bool/kit/kitBdd.c.o" "gcc" "CMakeFiles/libabc.dir/src/bool/kit/kitBdd.c.o.d"
+  "/root/repo/src/bool/kit/kitCloud.c" "CMakeFiles/libabc.dir/src/bool/kit/kitCloud.c.o" "gcc" "CMakeFiles/libabc.dir/src/bool/kit/kitCloud.c.o.d"
+  "/root/repo/src/bool/kit/kitDsd.c" "CMakeFiles/libabc.dir/src/bool/kit/kitDsd.c.o" "gcc" "CMakeFiles/libabc.dir/src/bool/kit/kitDsd.c.o.d"
+  "/root/repo/src/bool/kit/kitFactor.c" "CMakeFiles/libabc.dir/src/bool/kit/kitFactor.c.o" "gcc" "CMakeFiles/libabc.dir/src/bool/kit/kitFactor.c.o.d"
+  "/root/repo/src/bool/kit/kitGraph.c" "CMakeFiles/libabc.dir/src/bool/kit/kitGraph.c.o" "gcc" "CMakeFiles/libabc.dir/src/bool/kit/kitGraph.c.o.d"
+  "/root/repo/src/bool/kit/kitHop.c" "CMakeFiles/libabc.dir/src/bool/kit/kitHop.c.o" "gcc" "CMakeFiles/libabc.dir/src/bool/kit/kitHop.c.o.d"
+  "/root/repo/src/bool/kit/kitIsop.c" "CMakeFiles/libabc.dir/src/bool/kit/kitIsop.c.o" "gcc" "CMakeFiles/libabc.dir/src/bool/kit/kitIsop.c.o.d"
+  "/root/repo/src/bool/kit/kitPla.c" "CMakeFiles/libabc.dir/src/bool/kit/kitPla.c.o" "gcc" "CMakeFiles/libabc.dir/src/bool/kit/kitPla.c.o.d"
+  "/root/repo/src/bool/kit/kitSop.c" "CMakeFiles/libabc.dir/src/bool/kit/kitSop.c.o" "gcc" "CMakeFiles/libabc.dir/src/bool/kit/kitSop.c.o.d"
+  "/root/repo/src/bool/kit/kitTruth.c" "CMakeFiles/libabc.dir/src/bool/kit/kitTruth.c.o" "gcc" "CMakeFiles/libabc.dir/src/bool/kit/kitTruth.c.o.d"
+  "/root/repo/src/bool/lucky/lucky.c" "CMakeFiles/libabc.dir/src/bool/lucky/lucky.c.o" "gcc" "CMakeFiles/libabc.dir/src/bool/lucky/lucky.c.o.d"
+  "/root/repo/src/bool/lucky/luckyFast16.c" "CMakeFiles/libabc.dir/src/bool/lucky/luckyFast16.c.o" "gcc" "CMakeFiles/libabc.dir/src/bool/lucky/luckyFast16.c.o.d"
+  "/root/repo/src/bool/lucky/luckyFast6.c" "CMakeFiles/libabc.dir/src/bool/lucky/luckyFast6.c.o" "gcc" "CMakeFiles/libabc.dir/src/bool/lucky/luckyFast6.c.o.d"
+  "/root/repo/src/bool/lucky/luckyRead.c" "CMakeFiles/libabc.dir/src/bool/lucky/luckyRead.c.o" "gcc" "CMakeFiles/libabc.dir/src/bool/lucky/luckyRead.c.o.d"
+  "/root/repo/src/bool/lucky/luckySimple.c" "CMakeFiles/libabc.dir/src/bool/lucky/luckySimple.c.o" "gcc" "CMakeFiles/libabc.dir/src/bool/lucky/luckySimple.c.o.d"
+  "/root/repo/src/bool/lucky/luckySwap.c" "CMakeFiles/libabc.dir/src/bool/lucky/luckySwap.c.o" "gcc" "CMakeFiles/libabc.dir/src/bool/lucky/luckySwap.c.o.d"
+  "/root/repo/src/bool/lucky/luckySwapIJ.c" "CMakeFiles/libabc.dir/src/bool/lucky/luckySwapIJ.c.o" "gcc" "CMakeFiles/libabc.dir/src/bool/lucky/luckySwapIJ.c.o.d"
+  "/root/repo/src/bool/rpo/rpo.c" "CMakeFiles/libabc.dir/src/bool/rpo/rpo.c.o" "gcc" "CMakeFiles/libabc.dir/src/bool/rpo/rpo.c.o.d"
+  "/root/repo/src/bool/rsb/rsbDec6.c" "CMakeFiles/libabc.dir/src/bool/rsb/rsbDec6.c.o" "gcc" "CMakeFiles/libabc.dir/src/bool/rsb/rsbDec6.c.o.d"
+  "/root/repo/src/bool/rsb/rsbMan.c" "CMakeFiles/libabc.dir/src/bool/rsb/rsbMan.c.o" "gcc" "CMakeFiles/libabc.dir/src/bool/rsb/rsbMan.c.o.d"
+  "/root/repo/src/map/amap/amapCore.c" "CMakeFiles/libabc.dir/src/map/amap/amapCore.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/amap/amapCore.c.o.d"
+  "/root/repo/src/map/amap/amapGraph.c" "CMakeFiles/libabc.dir/src/map/amap/amapGraph.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/amap/amapGraph.c.o.d"
+  "/root/repo/src/map/amap/amapLib.c" "CMakeFiles/libabc.dir/src/map/amap/amapLib.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/amap/amapLib.c.o.d"
+  "/root/repo/src/map/amap/amapLiberty.c" "CMakeFiles/libabc.dir/src/map/amap/amapLiberty.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/amap/amapLiberty.c.o.d"
+  "/root/repo/src/map/amap/amapMan.c" "CMakeFiles/libabc.dir/src/map/amap/amapMan.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/amap/amapMan.c.o.d"
+  "/root/repo/src/map/amap/amapMatch.c" "CMakeFiles/libabc.dir/src/map/amap/amapMatch.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/amap/amapMatch.c.o.d"
+  "/root/repo/src/map/amap/amapMerge.c" "CMakeFiles/libabc.dir/src/map/amap/amapMerge.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/amap/amapMerge.c.o.d"
+  "/root/repo/src/map/amap/amapOutput.c" "CMakeFiles/libabc.dir/src/map/amap/amapOutput.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/amap/amapOutput.c.o.d"
+  "/root/repo/src/map/amap/amapParse.c" "CMakeFiles/libabc.dir/src/map/amap/amapParse.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/amap/amapParse.c.o.d"
+  "/root/repo/src/map/amap/amapPerm.c" "CMakeFiles/libabc.dir/src/map/amap/amapPerm.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/amap/amapPerm.c.o.d"
+  "/root/repo/src/map/amap/amapRead.c" "CMakeFiles/libabc.dir/src/map/amap/amapRead.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/amap/amapRead.c.o.d"
+  "/root/repo/src/map/amap/amapRule.c" "CMakeFiles/libabc.dir/src/map/amap/amapRule.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/amap/amapRule.c.o.d"
+  "/root/repo/src/map/amap/amapUniq.c" "CMakeFiles/libabc.dir/src/map/amap/amapUniq.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/amap/amapUniq.c.o.d"
+  "/root/repo/src/map/cov/covBuild.c" "CMakeFiles/libabc.dir/src/map/cov/covBuild.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/cov/covBuild.c.o.d"
+  "/root/repo/src/map/cov/covCore.c" "CMakeFiles/libabc.dir/src/map/cov/covCore.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/cov/covCore.c.o.d"
+  "/root/repo/src/map/cov/covMan.c" "CMakeFiles/libabc.dir/src/map/cov/covMan.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/cov/covMan.c.o.d"
+  "/root/repo/src/map/cov/covMinEsop.c" "CMakeFiles/libabc.dir/src/map/cov/covMinEsop.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/cov/covMinEsop.c.o.d"
+  "/root/repo/src/map/cov/covMinMan.c" "CMakeFiles/libabc.dir/src/map/cov/covMinMan.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/cov/covMinMan.c.o.d"
+  "/root/repo/src/map/cov/covMinSop.c" "CMakeFiles/libabc.dir/src/map/cov/covMinSop.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/cov/covMinSop.c.o.d"
+  "/root/repo/src/map/cov/covMinUtil.c" "CMakeFiles/libabc.dir/src/map/cov/covMinUtil.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/cov/covMinUtil.c.o.d"
+  "/root/repo/src/map/if/ifCache.c" "CMakeFiles/libabc.dir/src/map/if/ifCache.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/if/ifCache.c.o.d"
+  "/root/repo/src/map/if/ifCom.c" "CMakeFiles/libabc.dir/src/map/if/ifCom.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/if/ifCom.c.o.d"
+  "/root/repo/src/map/if/ifCore.c" "CMakeFiles/libabc.dir/src/map/if/ifCore.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/if/ifCore.c.o.d"
+  "/root/repo/src/map/if/ifCut.c" "CMakeFiles/libabc.dir/src/map/if/ifCut.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/if/ifCut.c.o.d"
+  "/root/repo/src/map/if/ifData2.c" "CMakeFiles/libabc.dir/src/map/if/ifData2.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/if/ifData2.c.o.d"
+  "/root/repo/src/map/if/ifDec07.c" "CMakeFiles/libabc.dir/src/map/if/ifDec07.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/if/ifDec07.c.o.d"
+  "/root/repo/src/map/if/ifDec08.c" "CMakeFiles/libabc.dir/src/map/if/ifDec08.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/if/ifDec08.c.o.d"
+  "/root/repo/src/map/if/ifDec10.c" "CMakeFiles/libabc.dir/src/map/if/ifDec10.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/if/ifDec10.c.o.d"
+  "/root/repo/src/map/if/ifDec16.c" "CMakeFiles/libabc.dir/src/map/if/ifDec16.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/if/ifDec16.c.o.d"
+  "/root/repo/src/map/if/ifDec75.c" "CMakeFiles/libabc.dir/src/map/if/ifDec75.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/if/ifDec75.c.o.d"
+  "/root/repo/src/map/if/ifDelay.c" "CMakeFiles/libabc.dir/src/map/if/ifDelay.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/if/ifDelay.c.o.d"
+  "/root/repo/src/map/if/ifDsd.c" "CMakeFiles/libabc.dir/src/map/if/ifDsd.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/if/ifDsd.c.o.d"
+  "/root/repo/src/map/if/ifLibBox.c" "CMakeFiles/libabc.dir/src/map/if/ifLibBox.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/if/ifLibBox.c.o.d"
+  "/root/repo/src/map/if/ifLibLut.c" "CMakeFiles/libabc.dir/src/map/if/ifLibLut.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/if/ifLibLut.c.o.d"
+  "/root/repo/src/map/if/ifMan.c" "CMakeFiles/libabc.dir/src/map/if/ifMan.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/if/ifMan.c.o.d"
+  "/root/repo/src/map/if/ifMap.c" "CMakeFiles/libabc.dir/src/map/if/ifMap.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/if/ifMap.c.o.d"
+  "/root/repo/src/map/if/ifMatch2.c" "CMakeFiles/libabc.dir/src/map/if/ifMatch2.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/if/ifMatch2.c.o.d"
+  "/root/repo/src/map/if/ifReduce.c" "CMakeFiles/libabc.dir/src/map/if/ifReduce.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/if/ifReduce.c.o.d"
+  "/root/repo/src/map/if/ifSat.c" "CMakeFiles/libabc.dir/src/map/if/ifSat.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/if/ifSat.c.o.d"
+  "/root/repo/src/map/if/ifSelect.c" "CMakeFiles/libabc.dir/src/map/if/ifSelect.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/if/ifSelect.c.o.d"
+  "/root/repo/src/map/if/ifSeq.c" "CMakeFiles/libabc.dir/src/map/if/ifSeq.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/if/ifSeq.c.o.d"
+  "/root/repo/src/map/if/ifTest.c" "CMakeFiles/libabc.dir/src/map/if/ifTest.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/if/ifTest.c.o.d"
+  "/root/repo/src/map/if/ifTime.c" "CMakeFiles/libabc.dir/src/map/if/ifTime.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/if/ifTime.c.o.d"
+  "/root/repo/src/map/if/ifTruth.c" "CMakeFiles/libabc.dir/src/map/if/ifTruth.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/if/ifTruth.c.o.d"
+  "/root/repo/src/map/if/ifTune.c" "CMakeFiles/libabc.dir/src/map/if/ifTune.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/if/ifTune.c.o.d"
+  "/root/repo/src/map/if/ifUtil.c" "CMakeFiles/libabc.dir/src/map/if/ifUtil.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/if/ifUtil.c.o.d"
+  "/root/repo/src/map/mapper/mapper.c" "CMakeFiles/libabc.dir/src/map/mapper/mapper.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/mapper/mapper.c.o.d"
+  "/root/repo/src/map/mapper/mapperCanon.c" "CMakeFiles/libabc.dir/src/map/mapper/mapperCanon.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/mapper/mapperCanon.c.o.d"
+  "/root/repo/src/map/mapper/mapperCore.c" "CMakeFiles/libabc.dir/src/map/mapper/mapperCore.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/mapper/mapperCore.c.o.d"
+  "/root/repo/src/map/mapper/mapperCreate.c" "CMakeFiles/libabc.dir/src/map/mapper/mapperCreate.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/mapper/mapperCreate.c.o.d"
+  "/root/repo/src/map/mapper/mapperCut.c" "CMakeFiles/libabc.dir/src/map/mapper/mapperCut.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/mapper/mapperCut.c.o.d"
+  "/root/repo/src/map/mapper/mapperCutUtils.c" "CMakeFiles/libabc.dir/src/map/mapper/mapperCutUtils.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/mapper/mapperCutUtils.c.o.d"
+  "/root/repo/src/map/mapper/mapperLib.c" "CMakeFiles/libabc.dir/src/map/mapper/mapperLib.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/mapper/mapperLib.c.o.d"
+  "/root/repo/src/map/mapper/mapperMatch.c" "CMakeFiles/libabc.dir/src/map/mapper/mapperMatch.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/mapper/mapperMatch.c.o.d"
+  "/root/repo/src/map/mapper/mapperRefs.c" "CMakeFiles/libabc.dir/src/map/mapper/mapperRefs.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/mapper/mapperRefs.c.o.d"
+  "/root/repo/src/map/mapper/mapperSuper.c" "CMakeFiles/libabc.dir/src/map/mapper/mapperSuper.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/mapper/mapperSuper.c.o.d"
+  "/root/repo/src/map/mapper/mapperSwitch.c" "CMakeFiles/libabc.dir/src/map/mapper/mapperSwitch.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/mapper/mapperSwitch.c.o.d"
+  "/root/repo/src/map/mapper/mapperTable.c" "CMakeFiles/libabc.dir/src/map/mapper/mapperTable.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/mapper/mapperTable.c.o.d"
+  "/root/repo/src/map/mapper/mapperTime.c" "CMakeFiles/libabc.dir/src/map/mapper/mapperTime.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/mapper/mapperTime.c.o.d"
+  "/root/repo/src/map/mapper/mapperTree.c" "CMakeFiles/libabc.dir/src/map/mapper/mapperTree.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/mapper/mapperTree.c.o.d"
+  "/root/repo/src/map/mapper/mapperTruth.c" "CMakeFiles/libabc.dir/src/map/mapper/mapperTruth.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/mapper/mapperTruth.c.o.d"
+  "/root/repo/src/map/mapper/mapperUtils.c" "CMakeFiles/libabc.dir/src/map/mapper/mapperUtils.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/mapper/mapperUtils.c.o.d"
+  "/root/repo/src/map/mapper/mapperVec.c" "CMakeFiles/libabc.dir/src/map/mapper/mapperVec.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/mapper/mapperVec.c.o.d"
+  "/root/repo/src/map/mio/mio.c" "CMakeFiles/libabc.dir/src/map/mio/mio.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/mio/mio.c.o.d"
+  "/root/repo/src/map/mio/mioApi.c" "CMakeFiles/libabc.dir/src/map/mio/mioApi.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/mio/mioApi.c.o.d"
+  "/root/repo/src/map/mio/mioFunc.c" "CMakeFiles/libabc.dir/src/map/mio/mioFunc.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/mio/mioFunc.c.o.d"
+  "/root/repo/src/map/mio/mioParse.c" "CMakeFiles/libabc.dir/src/map/mio/mioParse.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/mio/mioParse.c.o.d"
+  "/root/repo/src/map/mio/mioRead.c" "CMakeFiles/libabc.dir/src/map/mio/mioRead.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/mio/mioRead.c.o.d"
+  "/root/repo/src/map/mio/mioSop.c" "CMakeFiles/libabc.dir/src/map/mio/mioSop.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/mio/mioSop.c.o.d"
+  "/root/repo/src/map/mio/mioUtils.c" "CMakeFiles/libabc.dir/src/map/mio/mioUtils.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/mio/mioUtils.c.o.d"
+  "/root/repo/src/map/mpm/mpmAbc.c" "CMakeFiles/libabc.dir/src/map/mpm/mpmAbc.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/mpm/mpmAbc.c.o.d"
+  "/root/repo/src/map/mpm/mpmCore.c" "CMakeFiles/libabc.dir/src/map/mpm/mpmCore.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/mpm/mpmCore.c.o.d"
+  "/root/repo/src/map/mpm/mpmDsd.c" "CMakeFiles/libabc.dir/src/map/mpm/mpmDsd.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/mpm/mpmDsd.c.o.d"
+  "/root/repo/src/map/mpm/mpmGates.c" "CMakeFiles/libabc.dir/src/map/mpm/mpmGates.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/mpm/mpmGates.c.o.d"
+  "/root/repo/src/map/mpm/mpmLib.c" "CMakeFiles/libabc.dir/src/map/mpm/mpmLib.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/mpm/mpmLib.c.o.d"
+  "/root/repo/src/map/mpm/mpmMan.c" "CMakeFiles/libabc.dir/src/map/mpm/mpmMan.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/mpm/mpmMan.c.o.d"
+  "/root/repo/src/map/mpm/mpmMap.c" "CMakeFiles/libabc.dir/src/map/mpm/mpmMap.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/mpm/mpmMap.c.o.d"
+  "/root/repo/src/map/mpm/mpmMig.c" "CMakeFiles/libabc.dir/src/map/mpm/mpmMig.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/mpm/mpmMig.c.o.d"
+  "/root/repo/src/map/mpm/mpmPre.c" "CMakeFiles/libabc.dir/src/map/mpm/mpmPre.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/mpm/mpmPre.c.o.d"
+  "/root/repo/src/map/mpm/mpmTruth.c" "CMakeFiles/libabc.dir/src/map/mpm/mpmTruth.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/mpm/mpmTruth.c.o.d"
+  "/root/repo/src/map/mpm/mpmUtil.c" "CMakeFiles/libabc.dir/src/map/mpm/mpmUtil.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/mpm/mpmUtil.c.o.d"
+  "/root/repo/src/map/scl/scl.c" "CMakeFiles/libabc.dir/src/map/scl/scl.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/scl/scl.c.o.d"
+  "/root/repo/src/map/scl/sclBufSize.c" "CMakeFiles/libabc.dir/src/map/scl/sclBufSize.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/scl/sclBufSize.c.o.d"
+  "/root/repo/src/map/scl/sclBuffer.c" "CMakeFiles/libabc.dir/src/map/scl/sclBuffer.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/scl/sclBuffer.c.o.d"
+  "/root/repo/src/map/scl/sclDnsize.c" "CMakeFiles/libabc.dir/src/map/scl/sclDnsize.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/scl/sclDnsize.c.o.d"
+  "/root/repo/src/map/scl/sclLibImage.c" "CMakeFiles/libabc.dir/src/map/scl/sclLibImage.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/scl/sclLibImage.c.o.d"
+  "/root/repo/src/map/scl/sclLibScl.c" "CMakeFiles/libabc.dir/src/map/scl/sclLibScl.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/scl/sclLibScl.c.o.d"
+  "/root/repo/src/map/scl/sclLibUtil.c" "CMakeFiles/libabc.dir/src/map/scl/sclLibUtil.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/scl/sclLibUtil.c.o.d"
+  "/root/repo/src/map/scl/sclLiberty.c" "CMakeFiles/libabc.dir/src/map/scl/sclLiberty.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/scl/sclLiberty.c.o.d"
+  "/root/repo/src/map/scl/sclLoad.c" "CMakeFiles/libabc.dir/src/map/scl/sclLoad.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/scl/sclLoad.c.o.d"
+  "/root/repo/src/map/scl/sclSize.c" "CMakeFiles/libabc.dir/src/map/scl/sclSize.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/scl/sclSize.c.o.d"
+  "/root/repo/src/map/scl/sclTimePar.c" "CMakeFiles/libabc.dir/src/map/scl/sclTimePar.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/scl/sclTimePar.c.o.d"
+  "/root/repo/src/map/scl/sclUpsize.c" "CMakeFiles/libabc.dir/src/map/scl/sclUpsize.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/scl/sclUpsize.c.o.d"
+  "/root/repo/src/map/scl/sclUpsizePar.c" "CMakeFiles/libabc.dir/src/map/scl/sclUpsizePar.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/scl/sclUpsizePar.c.o.d"
+  "/root/repo/src/map/scl/sclUtil.c" "CMakeFiles/libabc.dir/src/map/scl/sclUtil.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/scl/sclUtil.c.o.d"
+  "/root/repo/src/map/super/super.c" "CMakeFiles/libabc.dir/src/map/super/super.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/super/super.c.o.d"
+  "/root/repo/src/map/super/superAnd.c" "CMakeFiles/libabc.dir/src/map/super/superAnd.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/super/superAnd.c.o.d"
+  "/root/repo/src/map/super/superGate.c" "CMakeFiles/libabc.dir/src/map/super/superGate.c.o" "gcc" "CMakeFiles/libabc.dir/src/map/super/superGate.c.o.d"
+  "/root/repo/src/misc/bar/bar.c" "CMakeFiles/libabc.dir/src/misc/bar/bar.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/bar/bar.c.o.d"
+  "/root/repo/src/misc/bbl/bblif.c" "CMakeFiles/libabc.dir/src/misc/bbl/bblif.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/bbl/bblif.c.o.d"
+  "/root/repo/src/misc/bzlib/blocksort.c" "CMakeFiles/libabc.dir/src/misc/bzlib/blocksort.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/bzlib/blocksort.c.o.d"
+  "/root/repo/src/misc/bzlib/bzlib.c" "CMakeFiles/libabc.dir/src/misc/bzlib/bzlib.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/bzlib/bzlib.c.o.d"
+  "/root/repo/src/misc/bzlib/compress.c" "CMakeFiles/libabc.dir/src/misc/bzlib/compress.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/bzlib/compress.c.o.d"
+  "/root/repo/src/misc/bzlib/crctable.c" "CMakeFiles/libabc.dir/src/misc/bzlib/crctable.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/bzlib/crctable.c.o.d"
+  "/root/repo/src/misc/bzlib/decompress.c" "CMakeFiles/libabc.dir/src/misc/bzlib/decompress.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/bzlib/decompress.c.o.d"
+  "/root/repo/src/misc/bzlib/huffman.c" "CMakeFiles/libabc.dir/src/misc/bzlib/huffman.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/bzlib/huffman.c.o.d"
+  "/root/repo/src/misc/bzlib/randtable.c" "CMakeFiles/libabc.dir/src/misc/bzlib/randtable.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/bzlib/randtable.c.o.d"
+  "/root/repo/src/misc/extra/extraUtilBitMatrix.c" "CMakeFiles/libabc.dir/src/misc/extra/extraUtilBitMatrix.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/extra/extraUtilBitMatrix.c.o.d"
+  "/root/repo/src/misc/extra/extraUtilCanon.c" "CMakeFiles/libabc.dir/src/misc/extra/extraUtilCanon.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/extra/extraUtilCanon.c.o.d"
+  "/root/repo/src/misc/extra/extraUtilCfs.c" "CMakeFiles/libabc.dir/src/misc/extra/extraUtilCfs.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/extra/extraUtilCfs.c.o.d"
+  "/root/repo/src/misc/extra/extraUtilCube.c" "CMakeFiles/libabc.dir/src/misc/extra/extraUtilCube.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/extra/extraUtilCube.c.o.d"
+  "/root/repo/src/misc/extra/extraUtilDsd.c" "CMakeFiles/libabc.dir/src/misc/extra/extraUtilDsd.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/extra/extraUtilDsd.c.o.d"
+  "/root/repo/src/misc/extra/extraUtilEnum.c" "CMakeFiles/libabc.dir/src/misc/extra/extraUtilEnum.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/extra/extraUtilEnum.c.o.d"
+  "/root/repo/src/misc/extra/extraUtilFile.c" "CMakeFiles/libabc.dir/src/misc/extra/extraUtilFile.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/extra/extraUtilFile.c.o.d"
+  "/root/repo/src/misc/extra/extraUtilGen.c" "CMakeFiles/libabc.dir/src/misc/extra/extraUtilGen.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/extra/extraUtilGen.c.o.d"
+  "/root/repo/src/misc/extra/extraUtilMacc.c" "CMakeFiles/libabc.dir/src/misc/extra/extraUtilMacc.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/extra/extraUtilMacc.c.o.d"
+  "/root/repo/src/misc/extra/extraUtilMaj.c" "CMakeFiles/libabc.dir/src/misc/extra/extraUtilMaj.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/extra/extraUtilMaj.c.o.d"
+  "/root/repo/src/misc/extra/extraUtilMemory.c" "CMakeFiles/libabc.dir/src/misc/extra/extraUtilMemory.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/extra/extraUtilMemory.c.o.d"
+  "/root/repo/src/misc/extra/extraUtilMisc.c" "CMakeFiles/libabc.dir/src/misc/extra/extraUtilMisc.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/extra/extraUtilMisc.c.o.d"
+  "/root/repo/src/misc/extra/extraUtilMult.c" "CMakeFiles/libabc.dir/src/misc/extra/extraUtilMult.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/extra/extraUtilMult.c.o.d"
+  "/root/repo/src/misc/extra/extraUtilPath.c" "CMakeFiles/libabc.dir/src/misc/extra/extraUtilPath.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/extra/extraUtilPath.c.o.d"
+  "/root/repo/src/misc/extra/extraUtilPerm.c" "CMakeFiles/libabc.dir/src/misc/extra/extraUtilPerm.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/extra/extraUtilPerm.c.o.d"
+  "/root/repo/src/misc/extra/extraUtilProgress.c" "CMakeFiles/libabc.dir/src/misc/extra/extraUtilProgress.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/extra/extraUtilProgress.c.o.d"
+  "/root/repo/src/misc/extra/extraUtilReader.c" "CMakeFiles/libabc.dir/src/misc/extra/extraUtilReader.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/extra/extraUtilReader.c.o.d"
+  "/root/repo/src/misc/extra/extraUtilSupp.c" "CMakeFiles/libabc.dir/src/misc/extra/extraUtilSupp.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/extra/extraUtilSupp.c.o.d"
+  "/root/repo/src/misc/extra/extraUtilTruth.c" "CMakeFiles/libabc.dir/src/misc/extra/extraUtilTruth.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/extra/extraUtilTruth.c.o.d"
+  "/root/repo/src/misc/extra/extraUtilUtil.c" "CMakeFiles/libabc.dir/src/misc/extra/extraUtilUtil.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/extra/extraUtilUtil.c.o.d"
+  "/root/repo/src/misc/mem/mem.c" "CMakeFiles/libabc.dir/src/misc/mem/mem.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/mem/mem.c.o.d"
+  "/root/repo/src/misc/mvc/mvcApi.c" "CMakeFiles/libabc.dir/src/misc/mvc/mvcApi.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/mvc/mvcApi.c.o.d"
+  "/root/repo/src/misc/mvc/mvcCompare.c" "CMakeFiles/libabc.dir/src/misc/mvc/mvcCompare.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/mvc/mvcCompare.c.o.d"
+  "/root/repo/src/misc/mvc/mvcContain.c" "CMakeFiles/libabc.dir/src/misc/mvc/mvcContain.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/mvc/mvcContain.c.o.d"
+  "/root/repo/src/misc/mvc/mvcCover.c" "CMakeFiles/libabc.dir/src/misc/mvc/mvcCover.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/mvc/mvcCover.c.o.d"
+  "/root/repo/src/misc/mvc/mvcCube.c" "CMakeFiles/libabc.dir/src/misc/mvc/mvcCube.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/mvc/mvcCube.c.o.d"
+  "/root/repo/src/misc/mvc/mvcDivide.c" "CMakeFiles/libabc.dir/src/misc/mvc/mvcDivide.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/mvc/mvcDivide.c.o.d"
+  "/root/repo/src/misc/mvc/mvcDivisor.c" "CMakeFiles/libabc.dir/src/misc/mvc/mvcDivisor.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/mvc/mvcDivisor.c.o.d"
+  "/root/repo/src/misc/mvc/mvcList.c" "CMakeFiles/libabc.dir/src/misc/mvc/mvcList.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/mvc/mvcList.c.o.d"
+  "/root/repo/src/misc/mvc/mvcLits.c" "CMakeFiles/libabc.dir/src/misc/mvc/mvcLits.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/mvc/mvcLits.c.o.d"
+  "/root/repo/src/misc/mvc/mvcMan.c" "CMakeFiles/libabc.dir/src/misc/mvc/mvcMan.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/mvc/mvcMan.c.o.d"
+  "/root/repo/src/misc/mvc/mvcOpAlg.c" "CMakeFiles/libabc.dir/src/misc/mvc/mvcOpAlg.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/mvc/mvcOpAlg.c.o.d"
+  "/root/repo/src/misc/mvc/mvcOpBool.c" "CMakeFiles/libabc.dir/src/misc/mvc/mvcOpBool.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/mvc/mvcOpBool.c.o.d"
+  "/root/repo/src/misc/mvc/mvcPrint.c" "CMakeFiles/libabc.dir/src/misc/mvc/mvcPrint.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/mvc/mvcPrint.c.o.d"
+  "/root/repo/src/misc/mvc/mvcSort.c" "CMakeFiles/libabc.dir/src/misc/mvc/mvcSort.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/mvc/mvcSort.c.o.d"
+  "/root/repo/src/misc/mvc/mvcUtils.c" "CMakeFiles/libabc.dir/src/misc/mvc/mvcUtils.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/mvc/mvcUtils.c.o.d"
+  "/root/repo/src/misc/nm/nmApi.c" "CMakeFiles/libabc.dir/src/misc/nm/nmApi.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/nm/nmApi.c.o.d"
+  "/root/repo/src/misc/nm/nmTable.c" "CMakeFiles/libabc.dir/src/misc/nm/nmTable.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/nm/nmTable.c.o.d"
+  "/root/repo/src/misc/parse/parseEqn.c" "CMakeFiles/libabc.dir/src/misc/parse/parseEqn.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/parse/parseEqn.c.o.d"
+  "/root/repo/src/misc/parse/parseStack.c" "CMakeFiles/libabc.dir/src/misc/parse/parseStack.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/parse/parseStack.c.o.d"
+  "/root/repo/src/misc/st/st.c" "CMakeFiles/libabc.dir/src/misc/st/st.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/st/st.c.o.d"
+  "/root/repo/src/misc/st/stmm.c" "CMakeFiles/libabc.dir/src/misc/st/stmm.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/st/stmm.c.o.d"
+  "/root/repo/src/misc/tim/timBox.c" "CMakeFiles/libabc.dir/src/misc/tim/timBox.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/tim/timBox.c.o.d"
+  "/root/repo/src/misc/tim/timDump.c" "CMakeFiles/libabc.dir/src/misc/tim/timDump.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/tim/timDump.c.o.d"
+  "/root/repo/src/misc/tim/timMan.c" "CMakeFiles/libabc.dir/src/misc/tim/timMan.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/tim/timMan.c.o.d"
+  "/root/repo/src/misc/tim/timTime.c" "CMakeFiles/libabc.dir/src/misc/tim/timTime.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/tim/timTime.c.o.d"
+  "/root/repo/src/misc/tim/timTrav.c" "CMakeFiles/libabc.dir/src/misc/tim/timTrav.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/tim/timTrav.c.o.d"
+  "/root/repo/src/misc/util/utilBridge.c" "CMakeFiles/libabc.dir/src/misc/util/utilBridge.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/util/utilBridge.c.o.d"
+  "/root/repo/src/misc/util/utilCex.c" "CMakeFiles/libabc.dir/src/misc/util/utilCex.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/util/utilCex.c.o.d"
+  "/root/repo/src/misc/util/utilColor.c" "CMakeFiles/libabc.dir/src/misc/util/utilColor.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/util/utilColor.c.o.d"
+  "/root/repo/src/misc/util/utilFile.c" "CMakeFiles/libabc.dir/src/misc/util/utilFile.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/util/utilFile.c.o.d"
+  "/root/repo/src/misc/util/utilIsop.c" "CMakeFiles/libabc.dir/src/misc/util/utilIsop.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/util/utilIsop.c.o.d"
+  "/root/repo/src/misc/util/utilNam.c" "CMakeFiles/libabc.dir/src/misc/util/utilNam.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/util/utilNam.c.o.d"
+  "/root/repo/src/misc/util/utilSignal.c" "CMakeFiles/libabc.dir/src/misc/util/utilSignal.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/util/utilSignal.c.o.d"
+  "/root/repo/src/misc/util/utilSort.c" "CMakeFiles/libabc.dir/src/misc/util/utilSort.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/util/utilSort.c.o.d"
+  "/root/repo/src/misc/zlib/adler32.c" "CMakeFiles/libabc.dir/src/misc/zlib/adler32.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/zlib/adler32.c.o.d"
+  "/root/repo/src/misc/zlib/compress_.c" "CMakeFiles/libabc.dir/src/misc/zlib/compress_.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/zlib/compress_.c.o.d"
+  "/root/repo/src/misc/zlib/crc32.c" "CMakeFiles/libabc.dir/src/misc/zlib/crc32.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/zlib/crc32.c.o.d"
+  "/root/repo/src/misc/zlib/deflate.c" "CMakeFiles/libabc.dir/src/misc/zlib/deflate.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/zlib/deflate.c.o.d"
+  "/root/repo/src/misc/zlib/gzclose.c" "CMakeFiles/libabc.dir/src/misc/zlib/gzclose.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/zlib/gzclose.c.o.d"
+  "/root/repo/src/misc/zlib/gzlib.c" "CMakeFiles/libabc.dir/src/misc/zlib/gzlib.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/zlib/gzlib.c.o.d"
+  "/root/repo/src/misc/zlib/gzread.c" "CMakeFiles/libabc.dir/src/misc/zlib/gzread.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/zlib/gzread.c.o.d"
+  "/root/repo/src/misc/zlib/gzwrite.c" "CMakeFiles/libabc.dir/src/misc/zlib/gzwrite.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/zlib/gzwrite.c.o.d"
+  "/root/repo/src/misc/zlib/infback.c" "CMakeFiles/libabc.dir/src/misc/zlib/infback.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/zlib/infback.c.o.d"
+  "/root/repo/src/misc/zlib/inffast.c" "CMakeFiles/libabc.dir/src/misc/zlib/inffast.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/zlib/inffast.c.o.d"
+  "/root/repo/src/misc/zlib/inflate.c" "CMakeFiles/libabc.dir/src/misc/zlib/inflate.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/zlib/inflate.c.o.d"
+  "/root/repo/src/misc/zlib/inftrees.c" "CMakeFiles/libabc.dir/src/misc/zlib/inftrees.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/zlib/inftrees.c.o.d"
+  "/root/repo/src/misc/zlib/trees.c" "CMakeFiles/libabc.dir/src/misc/zlib/trees.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/zlib/trees.c.o.d"
+  "/root/repo/src/misc/zlib/uncompr.c" "CMakeFiles/libabc.dir/src/misc/zlib/uncompr.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/zlib/uncompr.c.o.d"
+  "/root/repo/src/misc/zlib/zutil.c" "CMakeFiles/libabc.dir/src/misc/zlib/zutil.c.o" "gcc" "CMakeFiles/libabc.dir/src/misc/zlib/zutil.c.o.d"
+  "/root/repo/src/opt/cgt/cgtAig.c" "CMakeFiles/libabc.dir/src/opt/cgt/cgtAig.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/cgt/cgtAig.c.o.d"
+  "/root/repo/src/opt/cgt/cgtCore.c" "CMakeFiles/libabc.dir/src/opt/cgt/cgtCore.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/cgt/cgtCore.c.o.d"
+  "/root/repo/src/opt/cgt/cgtDecide.c" "CMakeFiles/libabc.dir/src/opt/cgt/cgtDecide.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/cgt/cgtDecide.c.o.d"
+  "/root/repo/src/opt/cgt/cgtMan.c" "CMakeFiles/libabc.dir/src/opt/cgt/cgtMan.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/cgt/cgtMan.c.o.d"
+  "/root/repo/src/opt/cgt/cgtSat.c" "CMakeFiles/libabc.dir/src/opt/cgt/cgtSat.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/cgt/cgtSat.c.o.d"
+  "/root/repo/src/opt/csw/cswCore.c" "CMakeFiles/libabc.dir/src/opt/csw/cswCore.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/csw/cswCore.c.o.d"
+  "/root/repo/src/opt/csw/cswCut.c" "CMakeFiles/libabc.dir/src/opt/csw/cswCut.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/csw/cswCut.c.o.d"
+  "/root/repo/src/opt/csw/cswMan.c" "CMakeFiles/libabc.dir/src/opt/csw/cswMan.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/csw/cswMan.c.o.d"
+  "/root/repo/src/opt/csw/cswTable.c" "CMakeFiles/libabc.dir/src/opt/csw/cswTable.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/csw/cswTable.c.o.d"
+  "/root/repo/src/opt/cut/cutApi.c" "CMakeFiles/libabc.dir/src/opt/cut/cutApi.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/cut/cutApi.c.o.d"
+  "/root/repo/src/opt/cut/cutCut.c" "CMakeFiles/libabc.dir/src/opt/cut/cutCut.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/cut/cutCut.c.o.d"
+  "/root/repo/src/opt/cut/cutMan.c" "CMakeFiles/libabc.dir/src/opt/cut/cutMan.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/cut/cutMan.c.o.d"
+  "/root/repo/src/opt/cut/cutMerge.c" "CMakeFiles/libabc.dir/src/opt/cut/cutMerge.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/cut/cutMerge.c.o.d"
+  "/root/repo/src/opt/cut/cutNode.c" "CMakeFiles/libabc.dir/src/opt/cut/cutNode.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/cut/cutNode.c.o.d"
+  "/root/repo/src/opt/cut/cutOracle.c" "CMakeFiles/libabc.dir/src/opt/cut/cutOracle.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/cut/cutOracle.c.o.d"
+  "/root/repo/src/opt/cut/cutPre22.c" "CMakeFiles/libabc.dir/src/opt/cut/cutPre22.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/cut/cutPre22.c.o.d"
+  "/root/repo/src/opt/cut/cutSeq.c" "CMakeFiles/libabc.dir/src/opt/cut/cutSeq.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/cut/cutSeq.c.o.d"
+  "/root/repo/src/opt/cut/cutTruth.c" "CMakeFiles/libabc.dir/src/opt/cut/cutTruth.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/cut/cutTruth.c.o.d"
+  "/root/repo/src/opt/dar/darBalance.c" "CMakeFiles/libabc.dir/src/opt/dar/darBalance.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/dar/darBalance.c.o.d"
+  "/root/repo/src/opt/dar/darCore.c" "CMakeFiles/libabc.dir/src/opt/dar/darCore.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/dar/darCore.c.o.d"
+  "/root/repo/src/opt/dar/darCut.c" "CMakeFiles/libabc.dir/src/opt/dar/darCut.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/dar/darCut.c.o.d"
+  "/root/repo/src/opt/dar/darData.c" "CMakeFiles/libabc.dir/src/opt/dar/darData.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/dar/darData.c.o.d"
+  "/root/repo/src/opt/dar/darLib.c" "CMakeFiles/libabc.dir/src/opt/dar/darLib.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/dar/darLib.c.o.d"
+  "/root/repo/src/opt/dar/darMan.c" "CMakeFiles/libabc.dir/src/opt/dar/darMan.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/dar/darMan.c.o.d"
+  "/root/repo/src/opt/dar/darPrec.c" "CMakeFiles/libabc.dir/src/opt/dar/darPrec.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/dar/darPrec.c.o.d"
+  "/root/repo/src/opt/dar/darRefact.c" "CMakeFiles/libabc.dir/src/opt/dar/darRefact.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/dar/darRefact.c.o.d"
+  "/root/repo/src/opt/dar/darScript.c" "CMakeFiles/libabc.dir/src/opt/dar/darScript.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/dar/darScript.c.o.d"
+  "/root/repo/src/opt/dau/dauCache.c" "CMakeFiles/libabc.dir/src/opt/dau/dauCache.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/dau/dauCache.c.o.d"
+  "/root/repo/src/opt/dau/dauCanon.c" "CMakeFiles/libabc.dir/src/opt/dau/dauCanon.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/dau/dauCanon.c.o.d"
+  "/root/repo/src/opt/dau/dauCore.c" "CMakeFiles/libabc.dir/src/opt/dau/dauCore.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/dau/dauCore.c.o.d"
+  "/root/repo/src/opt/dau/dauCount.c" "CMakeFiles/libabc.dir/src/opt/dau/dauCount.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/dau/dauCount.c.o.d"
+  "/root/repo/src/opt/dau/dauDivs.c" "CMakeFiles/libabc.dir/src/opt/dau/dauDivs.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/dau/dauDivs.c.o.d"
+  "/root/repo/src/opt/dau/dauDsd.c" "CMakeFiles/libabc.dir/src/opt/dau/dauDsd.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/dau/dauDsd.c.o.d"
+  "/root/repo/src/opt/dau/dauEnum.c" "CMakeFiles/libabc.dir/src/opt/dau/dauEnum.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/dau/dauEnum.c.o.d"
+  "/root/repo/src/opt/dau/dauGia.c" "CMakeFiles/libabc.dir/src/opt/dau/dauGia.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/dau/dauGia.c.o.d"
+  "/root/repo/src/opt/dau/dauMerge.c" "CMakeFiles/libabc.dir/src/opt/dau/dauMerge.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/dau/dauMerge.c.o.d"
+  "/root/repo/src/opt/dau/dauNonDsd.c" "CMakeFiles/libabc.dir/src/opt/dau/dauNonDsd.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/dau/dauNonDsd.c.o.d"
+  "/root/repo/src/opt/dau/dauNpn.c" "CMakeFiles/libabc.dir/src/opt/dau/dauNpn.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/dau/dauNpn.c.o.d"
+  "/root/repo/src/opt/dau/dauNpn2.c" "CMakeFiles/libabc.dir/src/opt/dau/dauNpn2.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/dau/dauNpn2.c.o.d"
+  "/root/repo/src/opt/dau/dauTree.c" "CMakeFiles/libabc.dir/src/opt/dau/dauTree.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/dau/dauTree.c.o.d"
+  "/root/repo/src/opt/dsc/dsc.c" "CMakeFiles/libabc.dir/src/opt/dsc/dsc.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/dsc/dsc.c.o.d"
+  "/root/repo/src/opt/fret/fretFlow.c" "CMakeFiles/libabc.dir/src/opt/fret/fretFlow.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/fret/fretFlow.c.o.d"
+  "/root/repo/src/opt/fret/fretInit.c" "CMakeFiles/libabc.dir/src/opt/fret/fretInit.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/fret/fretInit.c.o.d"
+  "/root/repo/src/opt/fret/fretMain.c" "CMakeFiles/libabc.dir/src/opt/fret/fretMain.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/fret/fretMain.c.o.d"
+  "/root/repo/src/opt/fret/fretTime.c" "CMakeFiles/libabc.dir/src/opt/fret/fretTime.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/fret/fretTime.c.o.d"
+  "/root/repo/src/opt/fxch/Fxch.c" "CMakeFiles/libabc.dir/src/opt/fxch/Fxch.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/fxch/Fxch.c.o.d"
+  "/root/repo/src/opt/fxch/FxchDiv.c" "CMakeFiles/libabc.dir/src/opt/fxch/FxchDiv.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/fxch/FxchDiv.c.o.d"
+  "/root/repo/src/opt/fxch/FxchMan.c" "CMakeFiles/libabc.dir/src/opt/fxch/FxchMan.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/fxch/FxchMan.c.o.d"
+  "/root/repo/src/opt/fxch/FxchSCHashTable.c" "CMakeFiles/libabc.dir/src/opt/fxch/FxchSCHashTable.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/fxch/FxchSCHashTable.c.o.d"
+  "/root/repo/src/opt/fxu/fxu.c" "CMakeFiles/libabc.dir/src/opt/fxu/fxu.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/fxu/fxu.c.o.d"
+  "/root/repo/src/opt/fxu/fxuCreate.c" "CMakeFiles/libabc.dir/src/opt/fxu/fxuCreate.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/fxu/fxuCreate.c.o.d"
+  "/root/repo/src/opt/fxu/fxuHeapD.c" "CMakeFiles/libabc.dir/src/opt/fxu/fxuHeapD.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/fxu/fxuHeapD.c.o.d"
+  "/root/repo/src/opt/fxu/fxuHeapS.c" "CMakeFiles/libabc.dir/src/opt/fxu/fxuHeapS.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/fxu/fxuHeapS.c.o.d"
+  "/root/repo/src/opt/fxu/fxuList.c" "CMakeFiles/libabc.dir/src/opt/fxu/fxuList.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/fxu/fxuList.c.o.d"
+  "/root/repo/src/opt/fxu/fxuMatrix.c" "CMakeFiles/libabc.dir/src/opt/fxu/fxuMatrix.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/fxu/fxuMatrix.c.o.d"
+  "/root/repo/src/opt/fxu/fxuPair.c" "CMakeFiles/libabc.dir/src/opt/fxu/fxuPair.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/fxu/fxuPair.c.o.d"
+  "/root/repo/src/opt/fxu/fxuPrint.c" "CMakeFiles/libabc.dir/src/opt/fxu/fxuPrint.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/fxu/fxuPrint.c.o.d"
+  "/root/repo/src/opt/fxu/fxuReduce.c" "CMakeFiles/libabc.dir/src/opt/fxu/fxuReduce.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/fxu/fxuReduce.c.o.d"
+  "/root/repo/src/opt/fxu/fxuSelect.c" "CMakeFiles/libabc.dir/src/opt/fxu/fxuSelect.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/fxu/fxuSelect.c.o.d"
+  "/root/repo/src/opt/fxu/fxuSingle.c" "CMakeFiles/libabc.dir/src/opt/fxu/fxuSingle.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/fxu/fxuSingle.c.o.d"
+  "/root/repo/src/opt/fxu/fxuUpdate.c" "CMakeFiles/libabc.dir/src/opt/fxu/fxuUpdate.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/fxu/fxuUpdate.c.o.d"
+  "/root/repo/src/opt/lpk/lpkAbcDec.c" "CMakeFiles/libabc.dir/src/opt/lpk/lpkAbcDec.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/lpk/lpkAbcDec.c.o.d"
+  "/root/repo/src/opt/lpk/lpkAbcDsd.c" "CMakeFiles/libabc.dir/src/opt/lpk/lpkAbcDsd.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/lpk/lpkAbcDsd.c.o.d"
+  "/root/repo/src/opt/lpk/lpkAbcMux.c" "CMakeFiles/libabc.dir/src/opt/lpk/lpkAbcMux.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/lpk/lpkAbcMux.c.o.d"
+  "/root/repo/src/opt/lpk/lpkAbcUtil.c" "CMakeFiles/libabc.dir/src/opt/lpk/lpkAbcUtil.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/lpk/lpkAbcUtil.c.o.d"
+  "/root/repo/src/opt/lpk/lpkCore.c" "CMakeFiles/libabc.dir/src/opt/lpk/lpkCore.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/lpk/lpkCore.c.o.d"
+  "/root/repo/src/opt/lpk/lpkCut.c" "CMakeFiles/libabc.dir/src/opt/lpk/lpkCut.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/lpk/lpkCut.c.o.d"
+  "/root/repo/src/opt/lpk/lpkMan.c" "CMakeFiles/libabc.dir/src/opt/lpk/lpkMan.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/lpk/lpkMan.c.o.d"
+  "/root/repo/src/opt/lpk/lpkMap.c" "CMakeFiles/libabc.dir/src/opt/lpk/lpkMap.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/lpk/lpkMap.c.o.d"
+  "/root/repo/src/opt/lpk/lpkMulti.c" "CMakeFiles/libabc.dir/src/opt/lpk/lpkMulti.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/lpk/lpkMulti.c.o.d"
+  "/root/repo/src/opt/lpk/lpkMux.c" "CMakeFiles/libabc.dir/src/opt/lpk/lpkMux.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/lpk/lpkMux.c.o.d"
+  "/root/repo/src/opt/lpk/lpkSets.c" "CMakeFiles/libabc.dir/src/opt/lpk/lpkSets.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/lpk/lpkSets.c.o.d"
+  "/root/repo/src/opt/mfs/mfsCore.c" "CMakeFiles/libabc.dir/src/opt/mfs/mfsCore.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/mfs/mfsCore.c.o.d"
+  "/root/repo/src/opt/mfs/mfsDiv.c" "CMakeFiles/libabc.dir/src/opt/mfs/mfsDiv.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/mfs/mfsDiv.c.o.d"
+  "/root/repo/src/opt/mfs/mfsInter.c" "CMakeFiles/libabc.dir/src/opt/mfs/mfsInter.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/mfs/mfsInter.c.o.d"
+  "/root/repo/src/opt/mfs/mfsMan.c" "CMakeFiles/libabc.dir/src/opt/mfs/mfsMan.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/mfs/mfsMan.c.o.d"
+  "/root/repo/src/opt/mfs/mfsResub.c" "CMakeFiles/libabc.dir/src/opt/mfs/mfsResub.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/mfs/mfsResub.c.o.d"
+  "/root/repo/src/opt/mfs/mfsSat.c" "CMakeFiles/libabc.dir/src/opt/mfs/mfsSat.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/mfs/mfsSat.c.o.d"
+  "/root/repo/src/opt/mfs/mfsStrash.c" "CMakeFiles/libabc.dir/src/opt/mfs/mfsStrash.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/mfs/mfsStrash.c.o.d"
+  "/root/repo/src/opt/mfs/mfsWin.c" "CMakeFiles/libabc.dir/src/opt/mfs/mfsWin.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/mfs/mfsWin.c.o.d"
+  "/root/repo/src/opt/nwk/nwkAig.c" "CMakeFiles/libabc.dir/src/opt/nwk/nwkAig.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/nwk/nwkAig.c.o.d"
+  "/root/repo/src/opt/nwk/nwkBidec.c" "CMakeFiles/libabc.dir/src/opt/nwk/nwkBidec.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/nwk/nwkBidec.c.o.d"
+  "/root/repo/src/opt/nwk/nwkCheck.c" "CMakeFiles/libabc.dir/src/opt/nwk/nwkCheck.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/nwk/nwkCheck.c.o.d"
+  "/root/repo/src/opt/nwk/nwkDfs.c" "CMakeFiles/libabc.dir/src/opt/nwk/nwkDfs.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/nwk/nwkDfs.c.o.d"
+  "/root/repo/src/opt/nwk/nwkFanio.c" "CMakeFiles/libabc.dir/src/opt/nwk/nwkFanio.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/nwk/nwkFanio.c.o.d"
+  "/root/repo/src/opt/nwk/nwkFlow.c" "CMakeFiles/libabc.dir/src/opt/nwk/nwkFlow.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/nwk/nwkFlow.c.o.d"
+  "/root/repo/src/opt/nwk/nwkMan.c" "CMakeFiles/libabc.dir/src/opt/nwk/nwkMan.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/nwk/nwkMan.c.o.d"
+  "/root/repo/src/opt/nwk/nwkMap.c" "CMakeFiles/libabc.dir/src/opt/nwk/nwkMap.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/nwk/nwkMap.c.o.d"
+  "/root/repo/src/opt/nwk/nwkMerge.c" "CMakeFiles/libabc.dir/src/opt/nwk/nwkMerge.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/nwk/nwkMerge.c.o.d"
+  "/root/repo/src/opt/nwk/nwkObj.c" "CMakeFiles/libabc.dir/src/opt/nwk/nwkObj.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/nwk/nwkObj.c.o.d"
+  "/root/repo/src/opt/nwk/nwkSpeedup.c" "CMakeFiles/libabc.dir/src/opt/nwk/nwkSpeedup.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/nwk/nwkSpeedup.c.o.d"
+  "/root/repo/src/opt/nwk/nwkStrash.c" "CMakeFiles/libabc.dir/src/opt/nwk/nwkStrash.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/nwk/nwkStrash.c.o.d"
+  "/root/repo/src/opt/nwk/nwkTiming.c" "CMakeFiles/libabc.dir/src/opt/nwk/nwkTiming.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/nwk/nwkTiming.c.o.d"
+  "/root/repo/src/opt/nwk/nwkUtil.c" "CMakeFiles/libabc.dir/src/opt/nwk/nwkUtil.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/nwk/nwkUtil.c.o.d"
+  "/root/repo/src/opt/res/resCore.c" "CMakeFiles/libabc.dir/src/opt/res/resCore.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/res/resCore.c.o.d"
+  "/root/repo/src/opt/res/resDivs.c" "CMakeFiles/libabc.dir/src/opt/res/resDivs.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/res/resDivs.c.o.d"
+  "/root/repo/src/opt/res/resFilter.c" "CMakeFiles/libabc.dir/src/opt/res/resFilter.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/res/resFilter.c.o.d"
+  "/root/repo/src/opt/res/resSat.c" "CMakeFiles/libabc.dir/src/opt/res/resSat.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/res/resSat.c.o.d"
+  "/root/repo/src/opt/res/resSim.c" "CMakeFiles/libabc.dir/src/opt/res/resSim.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/res/resSim.c.o.d"
+  "/root/repo/src/opt/res/resStrash.c" "CMakeFiles/libabc.dir/src/opt/res/resStrash.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/res/resStrash.c.o.d"
+  "/root/repo/src/opt/res/resWin.c" "CMakeFiles/libabc.dir/src/opt/res/resWin.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/res/resWin.c.o.d"
+  "/root/repo/src/opt/ret/retArea.c" "CMakeFiles/libabc.dir/src/opt/ret/retArea.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/ret/retArea.c.o.d"
+  "/root/repo/src/opt/ret/retCore.c" "CMakeFiles/libabc.dir/src/opt/ret/retCore.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/ret/retCore.c.o.d"
+  "/root/repo/src/opt/ret/retDelay.c" "CMakeFiles/libabc.dir/src/opt/ret/retDelay.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/ret/retDelay.c.o.d"
+  "/root/repo/src/opt/ret/retFlow.c" "CMakeFiles/libabc.dir/src/opt/ret/retFlow.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/ret/retFlow.c.o.d"
+  "/root/repo/src/opt/ret/retIncrem.c" "CMakeFiles/libabc.dir/src/opt/ret/retIncrem.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/ret/retIncrem.c.o.d"
+  "/root/repo/src/opt/ret/retInit.c" "CMakeFiles/libabc.dir/src/opt/ret/retInit.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/ret/retInit.c.o.d"
+  "/root/repo/src/opt/ret/retLvalue.c" "CMakeFiles/libabc.dir/src/opt/ret/retLvalue.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/ret/retLvalue.c.o.d"
+  "/root/repo/src/opt/rwr/rwrDec.c" "CMakeFiles/libabc.dir/src/opt/rwr/rwrDec.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/rwr/rwrDec.c.o.d"
+  "/root/repo/src/opt/rwr/rwrEva.c" "CMakeFiles/libabc.dir/src/opt/rwr/rwrEva.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/rwr/rwrEva.c.o.d"
+  "/root/repo/src/opt/rwr/rwrExp.c" "CMakeFiles/libabc.dir/src/opt/rwr/rwrExp.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/rwr/rwrExp.c.o.d"
+  "/root/repo/src/opt/rwr/rwrLib.c" "CMakeFiles/libabc.dir/src/opt/rwr/rwrLib.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/rwr/rwrLib.c.o.d"
+  "/root/repo/src/opt/rwr/rwrMan.c" "CMakeFiles/libabc.dir/src/opt/rwr/rwrMan.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/rwr/rwrMan.c.o.d"
+  "/root/repo/src/opt/rwr/rwrPrint.c" "CMakeFiles/libabc.dir/src/opt/rwr/rwrPrint.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/rwr/rwrPrint.c.o.d"
+  "/root/repo/src/opt/rwr/rwrUtil.c" "CMakeFiles/libabc.dir/src/opt/rwr/rwrUtil.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/rwr/rwrUtil.c.o.d"
+  "/root/repo/src/opt/rwt/rwtDec.c" "CMakeFiles/libabc.dir/src/opt/rwt/rwtDec.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/rwt/rwtDec.c.o.d"
+  "/root/repo/src/opt/rwt/rwtMan.c" "CMakeFiles/libabc.dir/src/opt/rwt/rwtMan.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/rwt/rwtMan.c.o.d"
+  "/root/repo/src/opt/rwt/rwtUtil.c" "CMakeFiles/libabc.dir/src/opt/rwt/rwtUtil.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/rwt/rwtUtil.c.o.d"
+  "/root/repo/src/opt/sbd/sbd.c" "CMakeFiles/libabc.dir/src/opt/sbd/sbd.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/sbd/sbd.c.o.d"
+  "/root/repo/src/opt/sbd/sbdCnf.c" "CMakeFiles/libabc.dir/src/opt/sbd/sbdCnf.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/sbd/sbdCnf.c.o.d"
+  "/root/repo/src/opt/sbd/sbdCore.c" "CMakeFiles/libabc.dir/src/opt/sbd/sbdCore.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/sbd/sbdCore.c.o.d"
+  "/root/repo/src/opt/sbd/sbdCut.c" "CMakeFiles/libabc.dir/src/opt/sbd/sbdCut.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/sbd/sbdCut.c.o.d"
+  "/root/repo/src/opt/sbd/sbdCut2.c" "CMakeFiles/libabc.dir/src/opt/sbd/sbdCut2.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/sbd/sbdCut2.c.o.d"
+  "/root/repo/src/opt/sbd/sbdLut.c" "CMakeFiles/libabc.dir/src/opt/sbd/sbdLut.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/sbd/sbdLut.c.o.d"
+  "/root/repo/src/opt/sbd/sbdPath.c" "CMakeFiles/libabc.dir/src/opt/sbd/sbdPath.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/sbd/sbdPath.c.o.d"
+  "/root/repo/src/opt/sbd/sbdSat.c" "CMakeFiles/libabc.dir/src/opt/sbd/sbdSat.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/sbd/sbdSat.c.o.d"
+  "/root/repo/src/opt/sbd/sbdWin.c" "CMakeFiles/libabc.dir/src/opt/sbd/sbdWin.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/sbd/sbdWin.c.o.d"
+  "/root/repo/src/opt/sfm/sfmArea.c" "CMakeFiles/libabc.dir/src/opt/sfm/sfmArea.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/sfm/sfmArea.c.o.d"
+  "/root/repo/src/opt/sfm/sfmCnf.c" "CMakeFiles/libabc.dir/src/opt/sfm/sfmCnf.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/sfm/sfmCnf.c.o.d"
+  "/root/repo/src/opt/sfm/sfmCore.c" "CMakeFiles/libabc.dir/src/opt/sfm/sfmCore.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/sfm/sfmCore.c.o.d"
+  "/root/repo/src/opt/sfm/sfmDec.c" "CMakeFiles/libabc.dir/src/opt/sfm/sfmDec.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/sfm/sfmDec.c.o.d"
+  "/root/repo/src/opt/sfm/sfmLib.c" "CMakeFiles/libabc.dir/src/opt/sfm/sfmLib.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/sfm/sfmLib.c.o.d"
+  "/root/repo/src/opt/sfm/sfmMit.c" "CMakeFiles/libabc.dir/src/opt/sfm/sfmMit.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/sfm/sfmMit.c.o.d"
+  "/root/repo/src/opt/sfm/sfmNtk.c" "CMakeFiles/libabc.dir/src/opt/sfm/sfmNtk.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/sfm/sfmNtk.c.o.d"
+  "/root/repo/src/opt/sfm/sfmSat.c" "CMakeFiles/libabc.dir/src/opt/sfm/sfmSat.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/sfm/sfmSat.c.o.d"
+  "/root/repo/src/opt/sfm/sfmTim.c" "CMakeFiles/libabc.dir/src/opt/sfm/sfmTim.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/sfm/sfmTim.c.o.d"
+  "/root/repo/src/opt/sfm/sfmWin.c" "CMakeFiles/libabc.dir/src/opt/sfm/sfmWin.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/sfm/sfmWin.c.o.d"
+  "/root/repo/src/opt/sim/simMan.c" "CMakeFiles/libabc.dir/src/opt/sim/simMan.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/sim/simMan.c.o.d"
+  "/root/repo/src/opt/sim/simSeq.c" "CMakeFiles/libabc.dir/src/opt/sim/simSeq.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/sim/simSeq.c.o.d"
+  "/root/repo/src/opt/sim/simSupp.c" "CMakeFiles/libabc.dir/src/opt/sim/simSupp.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/sim/simSupp.c.o.d"
+  "/root/repo/src/opt/sim/simSwitch.c" "CMakeFiles/libabc.dir/src/opt/sim/simSwitch.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/sim/simSwitch.c.o.d"
+  "/root/repo/src/opt/sim/simSym.c" "CMakeFiles/libabc.dir/src/opt/sim/simSym.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/sim/simSym.c.o.d"
+  "/root/repo/src/opt/sim/simSymSat.c" "CMakeFiles/libabc.dir/src/opt/sim/simSymSat.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/sim/simSymSat.c.o.d"
+  "/root/repo/src/opt/sim/simSymSim.c" "CMakeFiles/libabc.dir/src/opt/sim/simSymSim.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/sim/simSymSim.c.o.d"
+  "/root/repo/src/opt/sim/simSymStr.c" "CMakeFiles/libabc.dir/src/opt/sim/simSymStr.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/sim/simSymStr.c.o.d"
+  "/root/repo/src/opt/sim/simUtils.c" "CMakeFiles/libabc.dir/src/opt/sim/simUtils.c.o" "gcc" "CMakeFiles/libabc.dir/src/opt/sim/simUtils.c.o.d"
+  "/root/repo/src/proof/abs/absDup.c" "CMakeFiles/libabc.dir/src/proof/abs/absDup.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/abs/absDup.c.o.d"
+  "/root/repo/src/proof/abs/absGla.c" "CMakeFiles/libabc.dir/src/proof/abs/absGla.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/abs/absGla.c.o.d"
+  "/root/repo/src/proof/abs/absGlaOld.c" "CMakeFiles/libabc.dir/src/proof/abs/absGlaOld.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/abs/absGlaOld.c.o.d"
+  "/root/repo/src/proof/abs/absIter.c" "CMakeFiles/libabc.dir/src/proof/abs/absIter.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/abs/absIter.c.o.d"
+  "/root/repo/src/proof/abs/absOldCex.c" "CMakeFiles/libabc.dir/src/proof/abs/absOldCex.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/abs/absOldCex.c.o.d"
+  "/root/repo/src/proof/abs/absOldRef.c" "CMakeFiles/libabc.dir/src/proof/abs/absOldRef.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/abs/absOldRef.c.o.d"
+  "/root/repo/src/proof/abs/absOldSat.c" "CMakeFiles/libabc.dir/src/proof/abs/absOldSat.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/abs/absOldSat.c.o.d"
+  "/root/repo/src/proof/abs/absOldSim.c" "CMakeFiles/libabc.dir/src/proof/abs/absOldSim.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/abs/absOldSim.c.o.d"
+  "/root/repo/src/proof/abs/absOut.c" "CMakeFiles/libabc.dir/src/proof/abs/absOut.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/abs/absOut.c.o.d"
+  "/root/repo/src/proof/abs/absPth.c" "CMakeFiles/libabc.dir/src/proof/abs/absPth.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/abs/absPth.c.o.d"
+  "/root/repo/src/proof/abs/absRef.c" "CMakeFiles/libabc.dir/src/proof/abs/absRef.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/abs/absRef.c.o.d"
+  "/root/repo/src/proof/abs/absRefSelect.c" "CMakeFiles/libabc.dir/src/proof/abs/absRefSelect.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/abs/absRefSelect.c.o.d"
+  "/root/repo/src/proof/abs/absRpm.c" "CMakeFiles/libabc.dir/src/proof/abs/absRpm.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/abs/absRpm.c.o.d"
+  "/root/repo/src/proof/abs/absRpmOld.c" "CMakeFiles/libabc.dir/src/proof/abs/absRpmOld.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/abs/absRpmOld.c.o.d"
+  "/root/repo/src/proof/abs/absUtil.c" "CMakeFiles/libabc.dir/src/proof/abs/absUtil.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/abs/absUtil.c.o.d"
+  "/root/repo/src/proof/abs/absVta.c" "CMakeFiles/libabc.dir/src/proof/abs/absVta.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/abs/absVta.c.o.d"
+  "/root/repo/src/proof/acec/acec2Mult.c" "CMakeFiles/libabc.dir/src/proof/acec/acec2Mult.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/acec/acec2Mult.c.o.d"
+  "/root/repo/src/proof/acec/acecBo.c" "CMakeFiles/libabc.dir/src/proof/acec/acecBo.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/acec/acecBo.c.o.d"
+  "/root/repo/src/proof/acec/acecCl.c" "CMakeFiles/libabc.dir/src/proof/acec/acecCl.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/acec/acecCl.c.o.d"
+  "/root/repo/src/proof/acec/acecCo.c" "CMakeFiles/libabc.dir/src/proof/acec/acecCo.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/acec/acecCo.c.o.d"
+  "/root/repo/src/proof/acec/acecCore.c" "CMakeFiles/libabc.dir/src/proof/acec/acecCore.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/acec/acecCore.c.o.d"
+  "/root/repo/src/proof/acec/acecCover.c" "CMakeFiles/libabc.dir/src/proof/acec/acecCover.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/acec/acecCover.c.o.d"
+  "/root/repo/src/proof/acec/acecFadds.c" "CMakeFiles/libabc.dir/src/proof/acec/acecFadds.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/acec/acecFadds.c.o.d"
+  "/root/repo/src/proof/acec/acecMult.c" "CMakeFiles/libabc.dir/src/proof/acec/acecMult.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/acec/acecMult.c.o.d"
+  "/root/repo/src/proof/acec/acecNorm.c" "CMakeFiles/libabc.dir/src/proof/acec/acecNorm.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/acec/acecNorm.c.o.d"
+  "/root/repo/src/proof/acec/acecOrder.c" "CMakeFiles/libabc.dir/src/proof/acec/acecOrder.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/acec/acecOrder.c.o.d"
+  "/root/repo/src/proof/acec/acecPa.c" "CMakeFiles/libabc.dir/src/proof/acec/acecPa.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/acec/acecPa.c.o.d"
+  "/root/repo/src/proof/acec/acecPo.c" "CMakeFiles/libabc.dir/src/proof/acec/acecPo.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/acec/acecPo.c.o.d"
+  "/root/repo/src/proof/acec/acecPolyn.c" "CMakeFiles/libabc.dir/src/proof/acec/acecPolyn.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/acec/acecPolyn.c.o.d"
+  "/root/repo/src/proof/acec/acecPool.c" "CMakeFiles/libabc.dir/src/proof/acec/acecPool.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/acec/acecPool.c.o.d"
+  "/root/repo/src/proof/acec/acecRe.c" "CMakeFiles/libabc.dir/src/proof/acec/acecRe.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/acec/acecRe.c.o.d"
+  "/root/repo/src/proof/acec/acecSt.c" "CMakeFiles/libabc.dir/src/proof/acec/acecSt.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/acec/acecSt.c.o.d"
+  "/root/repo/src/proof/acec/acecTree.c" "CMakeFiles/libabc.dir/src/proof/acec/acecTree.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/acec/acecTree.c.o.d"
+  "/root/repo/src/proof/acec/acecUtil.c" "CMakeFiles/libabc.dir/src/proof/acec/acecUtil.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/acec/acecUtil.c.o.d"
+  "/root/repo/src/proof/acec/acecXor.c" "CMakeFiles/libabc.dir/src/proof/acec/acecXor.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/acec/acecXor.c.o.d"
+  "/root/repo/src/proof/cec/cecCec.c" "CMakeFiles/libabc.dir/src/proof/cec/cecCec.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/cec/cecCec.c.o.d"
+  "/root/repo/src/proof/cec/cecChoice.c" "CMakeFiles/libabc.dir/src/proof/cec/cecChoice.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/cec/cecChoice.c.o.d"
+  "/root/repo/src/proof/cec/cecClass.c" "CMakeFiles/libabc.dir/src/proof/cec/cecClass.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/cec/cecClass.c.o.d"
+  "/root/repo/src/proof/cec/cecCore.c" "CMakeFiles/libabc.dir/src/proof/cec/cecCore.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/cec/cecCore.c.o.d"
+  "/root/repo/src/proof/cec/cecCorr.c" "CMakeFiles/libabc.dir/src/proof/cec/cecCorr.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/cec/cecCorr.c.o.d"
+  "/root/repo/src/proof/cec/cecIso.c" "CMakeFiles/libabc.dir/src/proof/cec/cecIso.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/cec/cecIso.c.o.d"
+  "/root/repo/src/proof/cec/cecMan.c" "CMakeFiles/libabc.dir/src/proof/cec/cecMan.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/cec/cecMan.c.o.d"
+  "/root/repo/src/proof/cec/cecPat.c" "CMakeFiles/libabc.dir/src/proof/cec/cecPat.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/cec/cecPat.c.o.d"
+  "/root/repo/src/proof/cec/cecSat.c" "CMakeFiles/libabc.dir/src/proof/cec/cecSat.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/cec/cecSat.c.o.d"
+  "/root/repo/src/proof/cec/cecSatG.c" "CMakeFiles/libabc.dir/src/proof/cec/cecSatG.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/cec/cecSatG.c.o.d"
+  "/root/repo/src/proof/cec/cecSeq.c" "CMakeFiles/libabc.dir/src/proof/cec/cecSeq.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/cec/cecSeq.c.o.d"
+  "/root/repo/src/proof/cec/cecSolve.c" "CMakeFiles/libabc.dir/src/proof/cec/cecSolve.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/cec/cecSolve.c.o.d"
+  "/root/repo/src/proof/cec/cecSplit.c" "CMakeFiles/libabc.dir/src/proof/cec/cecSplit.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/cec/cecSplit.c.o.d"
+  "/root/repo/src/proof/cec/cecSweep.c" "CMakeFiles/libabc.dir/src/proof/cec/cecSweep.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/cec/cecSweep.c.o.d"
+  "/root/repo/src/proof/cec/cecSynth.c" "CMakeFiles/libabc.dir/src/proof/cec/cecSynth.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/cec/cecSynth.c.o.d"
+  "/root/repo/src/proof/dch/dchAig.c" "CMakeFiles/libabc.dir/src/proof/dch/dchAig.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/dch/dchAig.c.o.d"
+  "/root/repo/src/proof/dch/dchChoice.c" "CMakeFiles/libabc.dir/src/proof/dch/dchChoice.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/dch/dchChoice.c.o.d"
+  "/root/repo/src/proof/dch/dchClass.c" "CMakeFiles/libabc.dir/src/proof/dch/dchClass.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/dch/dchClass.c.o.d"
+  "/root/repo/src/proof/dch/dchCnf.c" "CMakeFiles/libabc.dir/src/proof/dch/dchCnf.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/dch/dchCnf.c.o.d"
+  "/root/repo/src/proof/dch/dchCore.c" "CMakeFiles/libabc.dir/src/proof/dch/dchCore.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/dch/dchCore.c.o.d"
+  "/root/repo/src/proof/dch/dchMan.c" "CMakeFiles/libabc.dir/src/proof/dch/dchMan.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/dch/dchMan.c.o.d"
+  "/root/repo/src/proof/dch/dchSat.c" "CMakeFiles/libabc.dir/src/proof/dch/dchSat.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/dch/dchSat.c.o.d"
+  "/root/repo/src/proof/dch/dchSim.c" "CMakeFiles/libabc.dir/src/proof/dch/dchSim.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/dch/dchSim.c.o.d"
+  "/root/repo/src/proof/dch/dchSimSat.c" "CMakeFiles/libabc.dir/src/proof/dch/dchSimSat.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/dch/dchSimSat.c.o.d"
+  "/root/repo/src/proof/dch/dchSweep.c" "CMakeFiles/libabc.dir/src/proof/dch/dchSweep.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/dch/dchSweep.c.o.d"
+  "/root/repo/src/proof/fra/fraBmc.c" "CMakeFiles/libabc.dir/src/proof/fra/fraBmc.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/fra/fraBmc.c.o.d"
+  "/root/repo/src/proof/fra/fraCec.c" "CMakeFiles/libabc.dir/src/proof/fra/fraCec.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/fra/fraCec.c.o.d"
+  "/root/repo/src/proof/fra/fraClass.c" "CMakeFiles/libabc.dir/src/proof/fra/fraClass.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/fra/fraClass.c.o.d"
+  "/root/repo/src/proof/fra/fraClau.c" "CMakeFiles/libabc.dir/src/proof/fra/fraClau.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/fra/fraClau.c.o.d"
+  "/root/repo/src/proof/fra/fraClaus.c" "CMakeFiles/libabc.dir/src/proof/fra/fraClaus.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/fra/fraClaus.c.o.d"
+  "/root/repo/src/proof/fra/fraCnf.c" "CMakeFiles/libabc.dir/src/proof/fra/fraCnf.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/fra/fraCnf.c.o.d"
+  "/root/repo/src/proof/fra/fraCore.c" "CMakeFiles/libabc.dir/src/proof/fra/fraCore.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/fra/fraCore.c.o.d"
+  "/root/repo/src/proof/fra/fraHot.c" "CMakeFiles/libabc.dir/src/proof/fra/fraHot.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/fra/fraHot.c.o.d"
+  "/root/repo/src/proof/fra/fraImp.c" "CMakeFiles/libabc.dir/src/proof/fra/fraImp.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/fra/fraImp.c.o.d"
+  "/root/repo/src/proof/fra/fraInd.c" "CMakeFiles/libabc.dir/src/proof/fra/fraInd.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/fra/fraInd.c.o.d"
+  "/root/repo/src/proof/fra/fraIndVer.c" "CMakeFiles/libabc.dir/src/proof/fra/fraIndVer.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/fra/fraIndVer.c.o.d"
+  "/root/repo/src/proof/fra/fraLcr.c" "CMakeFiles/libabc.dir/src/proof/fra/fraLcr.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/fra/fraLcr.c.o.d"
+  "/root/repo/src/proof/fra/fraMan.c" "CMakeFiles/libabc.dir/src/proof/fra/fraMan.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/fra/fraMan.c.o.d"
+  "/root/repo/src/proof/fra/fraPart.c" "CMakeFiles/libabc.dir/src/proof/fra/fraPart.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/fra/fraPart.c.o.d"
+  "/root/repo/src/proof/fra/fraSat.c" "CMakeFiles/libabc.dir/src/proof/fra/fraSat.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/fra/fraSat.c.o.d"
+  "/root/repo/src/proof/fra/fraSec.c" "CMakeFiles/libabc.dir/src/proof/fra/fraSec.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/fra/fraSec.c.o.d"
+  "/root/repo/src/proof/fra/fraSim.c" "CMakeFiles/libabc.dir/src/proof/fra/fraSim.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/fra/fraSim.c.o.d"
+  "/root/repo/src/proof/fraig/fraigApi.c" "CMakeFiles/libabc.dir/src/proof/fraig/fraigApi.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/fraig/fraigApi.c.o.d"
+  "/root/repo/src/proof/fraig/fraigCanon.c" "CMakeFiles/libabc.dir/src/proof/fraig/fraigCanon.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/fraig/fraigCanon.c.o.d"
+  "/root/repo/src/proof/fraig/fraigFanout.c" "CMakeFiles/libabc.dir/src/proof/fraig/fraigFanout.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/fraig/fraigFanout.c.o.d"
+  "/root/repo/src/proof/fraig/fraigFeed.c" "CMakeFiles/libabc.dir/src/proof/fraig/fraigFeed.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/fraig/fraigFeed.c.o.d"
+  "/root/repo/src/proof/fraig/fraigMan.c" "CMakeFiles/libabc.dir/src/proof/fraig/fraigMan.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/fraig/fraigMan.c.o.d"
+  "/root/repo/src/proof/fraig/fraigMem.c" "CMakeFiles/libabc.dir/src/proof/fraig/fraigMem.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/fraig/fraigMem.c.o.d"
+  "/root/repo/src/proof/fraig/fraigNode.c" "CMakeFiles/libabc.dir/src/proof/fraig/fraigNode.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/fraig/fraigNode.c.o.d"
+  "/root/repo/src/proof/fraig/fraigPrime.c" "CMakeFiles/libabc.dir/src/proof/fraig/fraigPrime.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/fraig/fraigPrime.c.o.d"
+  "/root/repo/src/proof/fraig/fraigSat.c" "CMakeFiles/libabc.dir/src/proof/fraig/fraigSat.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/fraig/fraigSat.c.o.d"
+  "/root/repo/src/proof/fraig/fraigTable.c" "CMakeFiles/libabc.dir/src/proof/fraig/fraigTable.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/fraig/fraigTable.c.o.d"
+  "/root/repo/src/proof/fraig/fraigUtil.c" "CMakeFiles/libabc.dir/src/proof/fraig/fraigUtil.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/fraig/fraigUtil.c.o.d"
+  "/root/repo/src/proof/fraig/fraigVec.c" "CMakeFiles/libabc.dir/src/proof/fraig/fraigVec.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/fraig/fraigVec.c.o.d"
+  "/root/repo/src/proof/int/intCheck.c" "CMakeFiles/libabc.dir/src/proof/int/intCheck.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/int/intCheck.c.o.d"
+  "/root/repo/src/proof/int/intContain.c" "CMakeFiles/libabc.dir/src/proof/int/intContain.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/int/intContain.c.o.d"
+  "/root/repo/src/proof/int/intCore.c" "CMakeFiles/libabc.dir/src/proof/int/intCore.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/int/intCore.c.o.d"
+  "/root/repo/src/proof/int/intCtrex.c" "CMakeFiles/libabc.dir/src/proof/int/intCtrex.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/int/intCtrex.c.o.d"
+  "/root/repo/src/proof/int/intDup.c" "CMakeFiles/libabc.dir/src/proof/int/intDup.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/int/intDup.c.o.d"
+  "/root/repo/src/proof/int/intFrames.c" "CMakeFiles/libabc.dir/src/proof/int/intFrames.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/int/intFrames.c.o.d"
+  "/root/repo/src/proof/int/intInter.c" "CMakeFiles/libabc.dir/src/proof/int/intInter.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/int/intInter.c.o.d"
+  "/root/repo/src/proof/int/intM114.c" "CMakeFiles/libabc.dir/src/proof/int/intM114.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/int/intM114.c.o.d"
+  "/root/repo/src/proof/int/intMan.c" "CMakeFiles/libabc.dir/src/proof/int/intMan.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/int/intMan.c.o.d"
+  "/root/repo/src/proof/int/intUtil.c" "CMakeFiles/libabc.dir/src/proof/int/intUtil.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/int/intUtil.c.o.d"
+  "/root/repo/src/proof/live/arenaViolation.c" "CMakeFiles/libabc.dir/src/proof/live/arenaViolation.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/live/arenaViolation.c.o.d"
+  "/root/repo/src/proof/live/combination.c" "CMakeFiles/libabc.dir/src/proof/live/combination.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/live/combination.c.o.d"
+  "/root/repo/src/proof/live/disjunctiveMonotone.c" "CMakeFiles/libabc.dir/src/proof/live/disjunctiveMonotone.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/live/disjunctiveMonotone.c.o.d"
+  "/root/repo/src/proof/live/kLiveConstraints.c" "CMakeFiles/libabc.dir/src/proof/live/kLiveConstraints.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/live/kLiveConstraints.c.o.d"
+  "/root/repo/src/proof/live/kliveness.c" "CMakeFiles/libabc.dir/src/proof/live/kliveness.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/live/kliveness.c.o.d"
+  "/root/repo/src/proof/live/liveness.c" "CMakeFiles/libabc.dir/src/proof/live/liveness.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/live/liveness.c.o.d"
+  "/root/repo/src/proof/live/liveness_sim.c" "CMakeFiles/libabc.dir/src/proof/live/liveness_sim.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/live/liveness_sim.c.o.d"
+  "/root/repo/src/proof/live/ltl_parser.c" "CMakeFiles/libabc.dir/src/proof/live/ltl_parser.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/live/ltl_parser.c.o.d"
+  "/root/repo/src/proof/live/monotone.c" "CMakeFiles/libabc.dir/src/proof/live/monotone.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/live/monotone.c.o.d"
+  "/root/repo/src/proof/pdr/pdrCnf.c" "CMakeFiles/libabc.dir/src/proof/pdr/pdrCnf.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/pdr/pdrCnf.c.o.d"
+  "/root/repo/src/proof/pdr/pdrCore.c" "CMakeFiles/libabc.dir/src/proof/pdr/pdrCore.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/pdr/pdrCore.c.o.d"
+  "/root/repo/src/proof/pdr/pdrIncr.c" "CMakeFiles/libabc.dir/src/proof/pdr/pdrIncr.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/pdr/pdrIncr.c.o.d"
+  "/root/repo/src/proof/pdr/pdrInv.c" "CMakeFiles/libabc.dir/src/proof/pdr/pdrInv.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/pdr/pdrInv.c.o.d"
+  "/root/repo/src/proof/pdr/pdrMan.c" "CMakeFiles/libabc.dir/src/proof/pdr/pdrMan.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/pdr/pdrMan.c.o.d"
+  "/root/repo/src/proof/pdr/pdrPar.c" "CMakeFiles/libabc.dir/src/proof/pdr/pdrPar.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/pdr/pdrPar.c.o.d"
+  "/root/repo/src/proof/pdr/pdrSat.c" "CMakeFiles/libabc.dir/src/proof/pdr/pdrSat.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/pdr/pdrSat.c.o.d"
+  "/root/repo/src/proof/pdr/pdrTsim.c" "CMakeFiles/libabc.dir/src/proof/pdr/pdrTsim.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/pdr/pdrTsim.c.o.d"
+  "/root/repo/src/proof/pdr/pdrTsim2.c" "CMakeFiles/libabc.dir/src/proof/pdr/pdrTsim2.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/pdr/pdrTsim2.c.o.d"
+  "/root/repo/src/proof/pdr/pdrTsim3.c" "CMakeFiles/libabc.dir/src/proof/pdr/pdrTsim3.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/pdr/pdrTsim3.c.o.d"
+  "/root/repo/src/proof/pdr/pdrTsim4.c" "CMakeFiles/libabc.dir/src/proof/pdr/pdrTsim4.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/pdr/pdrTsim4.c.o.d"
+  "/root/repo/src/proof/pdr/pdrUtil.c" "CMakeFiles/libabc.dir/src/proof/pdr/pdrUtil.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/pdr/pdrUtil.c.o.d"
+  "/root/repo/src/proof/ssc/sscClass.c" "CMakeFiles/libabc.dir/src/proof/ssc/sscClass.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/ssc/sscClass.c.o.d"
+  "/root/repo/src/proof/ssc/sscCore.c" "CMakeFiles/libabc.dir/src/proof/ssc/sscCore.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/ssc/sscCore.c.o.d"
+  "/root/repo/src/proof/ssc/sscSat.c" "CMakeFiles/libabc.dir/src/proof/ssc/sscSat.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/ssc/sscSat.c.o.d"
+  "/root/repo/src/proof/ssc/sscSim.c" "CMakeFiles/libabc.dir/src/proof/ssc/sscSim.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/ssc/sscSim.c.o.d"
+  "/root/repo/src/proof/ssc/sscUtil.c" "CMakeFiles/libabc.dir/src/proof/ssc/sscUtil.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/ssc/sscUtil.c.o.d"
+  "/root/repo/src/proof/ssw/sswAig.c" "CMakeFiles/libabc.dir/src/proof/ssw/sswAig.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/ssw/sswAig.c.o.d"
+  "/root/repo/src/proof/ssw/sswBmc.c" "CMakeFiles/libabc.dir/src/proof/ssw/sswBmc.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/ssw/sswBmc.c.o.d"
+  "/root/repo/src/proof/ssw/sswClass.c" "CMakeFiles/libabc.dir/src/proof/ssw/sswClass.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/ssw/sswClass.c.o.d"
+  "/root/repo/src/proof/ssw/sswCnf.c" "CMakeFiles/libabc.dir/src/proof/ssw/sswCnf.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/ssw/sswCnf.c.o.d"
+  "/root/repo/src/proof/ssw/sswConstr.c" "CMakeFiles/libabc.dir/src/proof/ssw/sswConstr.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/ssw/sswConstr.c.o.d"
+  "/root/repo/src/proof/ssw/sswCore.c" "CMakeFiles/libabc.dir/src/proof/ssw/sswCore.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/ssw/sswCore.c.o.d"
+  "/root/repo/src/proof/ssw/sswDyn.c" "CMakeFiles/libabc.dir/src/proof/ssw/sswDyn.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/ssw/sswDyn.c.o.d"
+  "/root/repo/src/proof/ssw/sswFilter.c" "CMakeFiles/libabc.dir/src/proof/ssw/sswFilter.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/ssw/sswFilter.c.o.d"
+  "/root/repo/src/proof/ssw/sswIslands.c" "CMakeFiles/libabc.dir/src/proof/ssw/sswIslands.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/ssw/sswIslands.c.o.d"
+  "/root/repo/src/proof/ssw/sswLcorr.c" "CMakeFiles/libabc.dir/src/proof/ssw/sswLcorr.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/ssw/sswLcorr.c.o.d"
+  "/root/repo/src/proof/ssw/sswMan.c" "CMakeFiles/libabc.dir/src/proof/ssw/sswMan.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/ssw/sswMan.c.o.d"
+  "/root/repo/src/proof/ssw/sswPairs.c" "CMakeFiles/libabc.dir/src/proof/ssw/sswPairs.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/ssw/sswPairs.c.o.d"
+  "/root/repo/src/proof/ssw/sswPart.c" "CMakeFiles/libabc.dir/src/proof/ssw/sswPart.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/ssw/sswPart.c.o.d"
+  "/root/repo/src/proof/ssw/sswRarity.c" "CMakeFiles/libabc.dir/src/proof/ssw/sswRarity.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/ssw/sswRarity.c.o.d"
+  "/root/repo/src/proof/ssw/sswSat.c" "CMakeFiles/libabc.dir/src/proof/ssw/sswSat.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/ssw/sswSat.c.o.d"
+  "/root/repo/src/proof/ssw/sswSemi.c" "CMakeFiles/libabc.dir/src/proof/ssw/sswSemi.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/ssw/sswSemi.c.o.d"
+  "/root/repo/src/proof/ssw/sswSim.c" "CMakeFiles/libabc.dir/src/proof/ssw/sswSim.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/ssw/sswSim.c.o.d"
+  "/root/repo/src/proof/ssw/sswSimSat.c" "CMakeFiles/libabc.dir/src/proof/ssw/sswSimSat.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/ssw/sswSimSat.c.o.d"
+  "/root/repo/src/proof/ssw/sswSweep.c" "CMakeFiles/libabc.dir/src/proof/ssw/sswSweep.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/ssw/sswSweep.c.o.d"
+  "/root/repo/src/proof/ssw/sswUnique.c" "CMakeFiles/libabc.dir/src/proof/ssw/sswUnique.c.o" "gcc" "CMakeFiles/libabc.dir/src/proof/ssw/sswUnique.c.o.d"
+  "/root/repo/src/sat/bmc/bmcBCore.c" "CMakeFiles/libabc.dir/src/sat/bmc/bmcBCore.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/bmc/bmcBCore.c.o.d"
+  "/root/repo/src/sat/bmc/bmcBmc.c" "CMakeFiles/libabc.dir/src/sat/bmc/bmcBmc.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/bmc/bmcBmc.c.o.d"
+  "/root/repo/src/sat/bmc/bmcBmc2.c" "CMakeFiles/libabc.dir/src/sat/bmc/bmcBmc2.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/bmc/bmcBmc2.c.o.d"
+  "/root/repo/src/sat/bmc/bmcBmc3.c" "CMakeFiles/libabc.dir/src/sat/bmc/bmcBmc3.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/bmc/bmcBmc3.c.o.d"
+  "/root/repo/src/sat/bmc/bmcBmcAnd.c" "CMakeFiles/libabc.dir/src/sat/bmc/bmcBmcAnd.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/bmc/bmcBmcAnd.c.o.d"
+  "/root/repo/src/sat/bmc/bmcBmcG.c" "CMakeFiles/libabc.dir/src/sat/bmc/bmcBmcG.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/bmc/bmcBmcG.c.o.d"
+  "/root/repo/src/sat/bmc/bmcBmcS.c" "CMakeFiles/libabc.dir/src/sat/bmc/bmcBmcS.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/bmc/bmcBmcS.c.o.d"
+  "/root/repo/src/sat/bmc/bmcBmci.c" "CMakeFiles/libabc.dir/src/sat/bmc/bmcBmci.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/bmc/bmcBmci.c.o.d"
+  "/root/repo/src/sat/bmc/bmcCexCare.c" "CMakeFiles/libabc.dir/src/sat/bmc/bmcCexCare.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/bmc/bmcCexCare.c.o.d"
+  "/root/repo/src/sat/bmc/bmcCexCut.c" "CMakeFiles/libabc.dir/src/sat/bmc/bmcCexCut.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/bmc/bmcCexCut.c.o.d"
+  "/root/repo/src/sat/bmc/bmcCexDepth.c" "CMakeFiles/libabc.dir/src/sat/bmc/bmcCexDepth.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/bmc/bmcCexDepth.c.o.d"
+  "/root/repo/src/sat/bmc/bmcCexMin1.c" "CMakeFiles/libabc.dir/src/sat/bmc/bmcCexMin1.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/bmc/bmcCexMin1.c.o.d"
+  "/root/repo/src/sat/bmc/bmcCexMin2.c" "CMakeFiles/libabc.dir/src/sat/bmc/bmcCexMin2.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/bmc/bmcCexMin2.c.o.d"
+  "/root/repo/src/sat/bmc/bmcCexTools.c" "CMakeFiles/libabc.dir/src/sat/bmc/bmcCexTools.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/bmc/bmcCexTools.c.o.d"
+  "/root/repo/src/sat/bmc/bmcChain.c" "CMakeFiles/libabc.dir/src/sat/bmc/bmcChain.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/bmc/bmcChain.c.o.d"
+  "/root/repo/src/sat/bmc/bmcClp.c" "CMakeFiles/libabc.dir/src/sat/bmc/bmcClp.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/bmc/bmcClp.c.o.d"
+  "/root/repo/src/sat/bmc/bmcEco.c" "CMakeFiles/libabc.dir/src/sat/bmc/bmcEco.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/bmc/bmcEco.c.o.d"
+  "/root/repo/src/sat/bmc/bmcExpand.c" "CMakeFiles/libabc.dir/src/sat/bmc/bmcExpand.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/bmc/bmcExpand.c.o.d"
+  "/root/repo/src/sat/bmc/bmcFault.c" "CMakeFiles/libabc.dir/src/sat/bmc/bmcFault.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/bmc/bmcFault.c.o.d"
+  "/root/repo/src/sat/bmc/bmcFx.c" "CMakeFiles/libabc.dir/src/sat/bmc/bmcFx.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/bmc/bmcFx.c.o.d"
+  "/root/repo/src/sat/bmc/bmcGen.c" "CMakeFiles/libabc.dir/src/sat/bmc/bmcGen.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/bmc/bmcGen.c.o.d"
+  "/root/repo/src/sat/bmc/bmcICheck.c" "CMakeFiles/libabc.dir/src/sat/bmc/bmcICheck.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/bmc/bmcICheck.c.o.d"
+  "/root/repo/src/sat/bmc/bmcInse.c" "CMakeFiles/libabc.dir/src/sat/bmc/bmcInse.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/bmc/bmcInse.c.o.d"
+  "/root/repo/src/sat/bmc/bmcLoad.c" "CMakeFiles/libabc.dir/src/sat/bmc/bmcLoad.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/bmc/bmcLoad.c.o.d"
+  "/root/repo/src/sat/bmc/bmcMaj.c" "CMakeFiles/libabc.dir/src/sat/bmc/bmcMaj.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/bmc/bmcMaj.c.o.d"
+  "/root/repo/src/sat/bmc/bmcMaj2.c" "CMakeFiles/libabc.dir/src/sat/bmc/bmcMaj2.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/bmc/bmcMaj2.c.o.d"
+  "/root/repo/src/sat/bmc/bmcMaj3.c" "CMakeFiles/libabc.dir/src/sat/bmc/bmcMaj3.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/bmc/bmcMaj3.c.o.d"
+  "/root/repo/src/sat/bmc/bmcMaxi.c" "CMakeFiles/libabc.dir/src/sat/bmc/bmcMaxi.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/bmc/bmcMaxi.c.o.d"
+  "/root/repo/src/sat/bmc/bmcMesh.c" "CMakeFiles/libabc.dir/src/sat/bmc/bmcMesh.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/bmc/bmcMesh.c.o.d"
+  "/root/repo/src/sat/bmc/bmcMesh2.c" "CMakeFiles/libabc.dir/src/sat/bmc/bmcMesh2.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/bmc/bmcMesh2.c.o.d"
+  "/root/repo/src/sat/bmc/bmcMulti.c" "CMakeFiles/libabc.dir/src/sat/bmc/bmcMulti.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/bmc/bmcMulti.c.o.d"
+  "/root/repo/src/sat/bmc/bmcSat.c" "CMakeFiles/libabc.dir/src/sat/bmc/bmcSat.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/bmc/bmcSat.c.o.d"
+  "/root/repo/src/sat/bmc/bmcSat3.c" "CMakeFiles/libabc.dir/src/sat/bmc/bmcSat3.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/bmc/bmcSat3.c.o.d"
+  "/root/repo/src/sat/bmc/bmcSatPort.c" "CMakeFiles/libabc.dir/src/sat/bmc/bmcSatPort.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/bmc/bmcSatPort.c.o.d"
+  "/root/repo/src/sat/bmc/bmcUnroll.c" "CMakeFiles/libabc.dir/src/sat/bmc/bmcUnroll.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/bmc/bmcUnroll.c.o.d"
+  "/root/repo/src/sat/bsat/satInter.c" "CMakeFiles/libabc.dir/src/sat/bsat/satInter.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/bsat/satInter.c.o.d"
+  "/root/repo/src/sat/bsat/satInterA.c" "CMakeFiles/libabc.dir/src/sat/bsat/satInterA.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/bsat/satInterA.c.o.d"
+  "/root/repo/src/sat/bsat/satInterB.c" "CMakeFiles/libabc.dir/src/sat/bsat/satInterB.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/bsat/satInterB.c.o.d"
+  "/root/repo/src/sat/bsat/satInterP.c" "CMakeFiles/libabc.dir/src/sat/bsat/satInterP.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/bsat/satInterP.c.o.d"
+  "/root/repo/src/sat/bsat/satMem.c" "CMakeFiles/libabc.dir/src/sat/bsat/satMem.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/bsat/satMem.c.o.d"
+  "/root/repo/src/sat/bsat/satProof.c" "CMakeFiles/libabc.dir/src/sat/bsat/satProof.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/bsat/satProof.c.o.d"
+  "/root/repo/src/sat/bsat/satSolver.c" "CMakeFiles/libabc.dir/src/sat/bsat/satSolver.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/bsat/satSolver.c.o.d"
+  "/root/repo/src/sat/bsat/satSolver2.c" "CMakeFiles/libabc.dir/src/sat/bsat/satSolver2.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/bsat/satSolver2.c.o.d"
+  "/root/repo/src/sat/bsat/satSolver2i.c" "CMakeFiles/libabc.dir/src/sat/bsat/satSolver2i.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/bsat/satSolver2i.c.o.d"
+  "/root/repo/src/sat/bsat/satSolver3.c" "CMakeFiles/libabc.dir/src/sat/bsat/satSolver3.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/bsat/satSolver3.c.o.d"
+  "/root/repo/src/sat/bsat/satStore.c" "CMakeFiles/libabc.dir/src/sat/bsat/satStore.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/bsat/satStore.c.o.d"
+  "/root/repo/src/sat/bsat/satTrace.c" "CMakeFiles/libabc.dir/src/sat/bsat/satTrace.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/bsat/satTrace.c.o.d"
+  "/root/repo/src/sat/bsat/satTruth.c" "CMakeFiles/libabc.dir/src/sat/bsat/satTruth.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/bsat/satTruth.c.o.d"
+  "/root/repo/src/sat/bsat/satUtil.c" "CMakeFiles/libabc.dir/src/sat/bsat/satUtil.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/bsat/satUtil.c.o.d"
+  "/root/repo/src/sat/cnf/cnfCore.c" "CMakeFiles/libabc.dir/src/sat/cnf/cnfCore.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/cnf/cnfCore.c.o.d"
+  "/root/repo/src/sat/cnf/cnfCut.c" "CMakeFiles/libabc.dir/src/sat/cnf/cnfCut.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/cnf/cnfCut.c.o.d"
+  "/root/repo/src/sat/cnf/cnfData.c" "CMakeFiles/libabc.dir/src/sat/cnf/cnfData.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/cnf/cnfData.c.o.d"
+  "/root/repo/src/sat/cnf/cnfFast.c" "CMakeFiles/libabc.dir/src/sat/cnf/cnfFast.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/cnf/cnfFast.c.o.d"
+  "/root/repo/src/sat/cnf/cnfMan.c" "CMakeFiles/libabc.dir/src/sat/cnf/cnfMan.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/cnf/cnfMan.c.o.d"
+  "/root/repo/src/sat/cnf/cnfMap.c" "CMakeFiles/libabc.dir/src/sat/cnf/cnfMap.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/cnf/cnfMap.c.o.d"
+  "/root/repo/src/sat/cnf/cnfPost.c" "CMakeFiles/libabc.dir/src/sat/cnf/cnfPost.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/cnf/cnfPost.c.o.d"
+  "/root/repo/src/sat/cnf/cnfStream.c" "CMakeFiles/libabc.dir/src/sat/cnf/cnfStream.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/cnf/cnfStream.c.o.d"
+  "/root/repo/src/sat/cnf/cnfUtil.c" "CMakeFiles/libabc.dir/src/sat/cnf/cnfUtil.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/cnf/cnfUtil.c.o.d"
+  "/root/repo/src/sat/cnf/cnfWrite.c" "CMakeFiles/libabc.dir/src/sat/cnf/cnfWrite.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/cnf/cnfWrite.c.o.d"
+  "/root/repo/src/sat/csat/csat_apis.c" "CMakeFiles/libabc.dir/src/sat/csat/csat_apis.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/csat/csat_apis.c.o.d"
+  "/root/repo/src/sat/msat/msatActivity.c" "CMakeFiles/libabc.dir/src/sat/msat/msatActivity.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/msat/msatActivity.c.o.d"
+  "/root/repo/src/sat/msat/msatClause.c" "CMakeFiles/libabc.dir/src/sat/msat/msatClause.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/msat/msatClause.c.o.d"
+  "/root/repo/src/sat/msat/msatClauseVec.c" "CMakeFiles/libabc.dir/src/sat/msat/msatClauseVec.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/msat/msatClauseVec.c.o.d"
+  "/root/repo/src/sat/msat/msatMem.c" "CMakeFiles/libabc.dir/src/sat/msat/msatMem.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/msat/msatMem.c.o.d"
+  "/root/repo/src/sat/msat/msatOrderH.c" "CMakeFiles/libabc.dir/src/sat/msat/msatOrderH.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/msat/msatOrderH.c.o.d"
+  "/root/repo/src/sat/msat/msatQueue.c" "CMakeFiles/libabc.dir/src/sat/msat/msatQueue.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/msat/msatQueue.c.o.d"
+  "/root/repo/src/sat/msat/msatRead.c" "CMakeFiles/libabc.dir/src/sat/msat/msatRead.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/msat/msatRead.c.o.d"
+  "/root/repo/src/sat/msat/msatSolverApi.c" "CMakeFiles/libabc.dir/src/sat/msat/msatSolverApi.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/msat/msatSolverApi.c.o.d"
+  "/root/repo/src/sat/msat/msatSolverCore.c" "CMakeFiles/libabc.dir/src/sat/msat/msatSolverCore.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/msat/msatSolverCore.c.o.d"
+  "/root/repo/src/sat/msat/msatSolverIo.c" "CMakeFiles/libabc.dir/src/sat/msat/msatSolverIo.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/msat/msatSolverIo.c.o.d"
+  "/root/repo/src/sat/msat/msatSolverSearch.c" "CMakeFiles/libabc.dir/src/sat/msat/msatSolverSearch.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/msat/msatSolverSearch.c.o.d"
+  "/root/repo/src/sat/msat/msatSort.c" "CMakeFiles/libabc.dir/src/sat/msat/msatSort.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/msat/msatSort.c.o.d"
+  "/root/repo/src/sat/msat/msatVec.c" "CMakeFiles/libabc.dir/src/sat/msat/msatVec.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/msat/msatVec.c.o.d"
+  "/root/repo/src/sat/satoko/cnf_reader.c" "CMakeFiles/libabc.dir/src/sat/satoko/cnf_reader.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/satoko/cnf_reader.c.o.d"
+  "/root/repo/src/sat/satoko/inproc.c" "CMakeFiles/libabc.dir/src/sat/satoko/inproc.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/satoko/inproc.c.o.d"
+  "/root/repo/src/sat/satoko/solver.c" "CMakeFiles/libabc.dir/src/sat/satoko/solver.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/satoko/solver.c.o.d"
+  "/root/repo/src/sat/satoko/solver_api.c" "CMakeFiles/libabc.dir/src/sat/satoko/solver_api.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/satoko/solver_api.c.o.d"
+  "/root/repo/src/sat/xsat/xsatCnfReader.c" "CMakeFiles/libabc.dir/src/sat/xsat/xsatCnfReader.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/xsat/xsatCnfReader.c.o.d"
+  "/root/repo/src/sat/xsat/xsatSolver.c" "CMakeFiles/libabc.dir/src/sat/xsat/xsatSolver.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/xsat/xsatSolver.c.o.d"
+  "/root/repo/src/sat/xsat/xsatSolverAPI.c" "CMakeFiles/libabc.dir/src/sat/xsat/xsatSolverAPI.c.o" "gcc" "CMakeFiles/libabc.dir/src/sat/xsat/xsatSolverAPI.c.o.d"
+  "/root/repo/src/sat/glucose/AbcGlucose.cpp" "CMakeFiles/libabc.dir/src/sat/glucose/AbcGlucose.cpp.o" "gcc" "CMakeFiles/libabc.dir/src/sat/glucose/AbcGlucose.cpp.o.d"
+  "/root/repo/src/sat/glucose/AbcGlucoseCmd.cpp" "CMakeFiles/libabc.dir/src/sat/glucose/AbcGlucoseCmd.cpp.o" "gcc" "CMakeFiles/libabc.dir/src/sat/glucose/AbcGlucoseCmd.cpp.o.d"
+  "/root/repo/src/sat/glucose/Glucose.cpp" "CMakeFiles/libabc.dir/src/sat/glucose/Glucose.cpp.o" "gcc" "CMakeFiles/libabc.dir/src/sat/glucose/Glucose.cpp.o.d"
+  "/root/repo/src/sat/glucose/Options.cpp" "CMakeFiles/libabc.dir/src/sat/glucose/Options.cpp.o" "gcc" "CMakeFiles/libabc.dir/src/sat/glucose/Options.cpp.o.d"
+  "/root/repo/src/sat/glucose/SimpSolver.cpp" "CMakeFiles/libabc.dir/src/sat/glucose/SimpSolver.cpp.o" "gcc" "CMakeFiles/libabc.dir/src/sat/glucose/SimpSolver.cpp.o.d"
+  "/root/repo/src/sat/glucose/System.cpp" "CMakeFiles/libabc.dir/src/sat/glucose/System.cpp.o" "gcc" "CMakeFiles/libabc.dir/src/sat/glucose/System.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -1967,6 +1967,10 @@ SOURCE=.\src\sat\cnf\cnfPost.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\sat\cnf\cnfStream.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\sat\cnf\cnfUtil.c
 # End Source File
 # Begin Source File
@@ -2111,6 +2115,18 @@ SOURCE=.\src\sat\bmc\bmcMulti.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\sat\bmc\bmcSat.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\src\sat\bmc\bmcSat3.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\src\sat\bmc\bmcSatPort.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\sat\bmc\bmcUnroll.c
 # End Source File
 # End Group
@@ -2147,6 +2163,10 @@ SOURCE=.\src\sat\satoko\cnf_reader.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\sat\satoko\inproc.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\sat\satoko\utils\heap.h
 # End Source File
 # Begin Source File
@@ -2963,6 +2983,10 @@ SOURCE=.\src\opt\dau\dau.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\opt\dau\dauCache.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\opt\dau\dauCanon.c
 # End Source File
 # Begin Source File
@@ -3587,6 +3611,10 @@ SOURCE=.\src\map\scl\sclLiberty.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\map\scl\sclLibImage.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\map\scl\sclLibScl.c
 # End Source File
 # Begin Source File
@@ -3603,6 +3631,10 @@ SOURCE=.\src\map\scl\sclSize.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\map\scl\sclTimePar.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\map\scl\sclSize.h
 # End Source File
 # Begin Source File
@@ -3615,6 +3647,10 @@ SOURCE=.\src\map\scl\sclUpsize.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\map\scl\sclUpsizePar.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\map\scl\sclUtil.c
 # End Source File
 # End Group
@@ -4607,6 +4643,10 @@ SOURCE=.\src\aig\saig\saig.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\aig\saig\saigCkpt.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\aig\saig\saigCone.c
 # End Source File
 # Begin Source File
@@ -4871,6 +4911,10 @@ SOURCE=.\src\aig\gia\giaHash.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\aig\gia\giaHashPar.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\aig\gia\giaIf.c
 # End Source File
 # Begin Source File
@@ -4907,6 +4951,10 @@ SOURCE=.\src\aig\gia\giaKf.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\aig\gia\giaLevPar.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\aig\gia\giaLf.c
 # End Source File
 # Begin Source File
@@ -5027,6 +5075,10 @@ SOURCE=.\src\aig\gia\giaSim2.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\aig\gia\giaSimPar.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\aig\gia\giaSort.c
 # End Source File
 # Begin Source File
@@ -5731,6 +5783,10 @@ SOURCE=.\src\proof\pdr\pdrMan.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\proof\pdr\pdrPar.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\proof\pdr\pdrSat.c
 # End Source File
 # Begin Source File
@@ -5747,6 +5803,10 @@ SOURCE=.\src\proof\pdr\pdrTsim3.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\proof\pdr\pdrTsim4.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\proof\pdr\pdrUtil.c
 # End Source File
 # End Group
@@ -42,9 +42,22 @@
 
 ABC_NAMESPACE_HEADER_START
 
+// the limit on the number of objects keeps 2*Gia_ManObjNum() within int,
+// which is assumed by the code allocating arrays indexed by literals;
+// the wide mode (ABC_USE_GIA_WIDE) uses 31-bit fanin diffs, which raises
+// the limit from 2^29 to 2^30-1 objects at the cost of 16 bytes per object
+#ifdef ABC_USE_GIA_WIDE
+#define GIA_NONE 0x7FFFFFFF
+#define GIA_OBJ_MAX 0x3FFFFFFF
+#else
 #define GIA_NONE 0x1FFFFFFF
+#define GIA_OBJ_MAX (1 << 29)
+#endif
 #define GIA_VOID 0x0FFFFFFF
 
+// the managers with at least this many objects keep them in the arena
+#define GIA_ARENA_MIN (1 << 24)
+
 ////////////////////////////////////////////////////////////////////////
 ///                         BASIC TYPES                              ///
 ////////////////////////////////////////////////////////////////////////
@@ -73,6 +86,24 @@ struct Gia_Plc_t_
 };
 
 typedef struct Gia_Obj_t_ Gia_Obj_t;
+#ifdef ABC_USE_GIA_WIDE
+struct Gia_Obj_t_
+{
+    unsigned       iDiff0 :  31;  // the diff of the first fanin
+    unsigned       fCompl0:   1;  // the complemented attribute
+
+    unsigned       iDiff1 :  31;  // the diff of the second fanin
+    unsigned       fCompl1:   1;  // the complemented attribute
+
+    unsigned       fMark0 :   1;  // first user-controlled mark
+    unsigned       fTerm  :   1;  // terminal node (CI/CO)
+    unsigned       fMark1 :   1;  // second user-controlled mark
+    unsigned       fPhase :   1;  // value under 000 pattern
+    unsigned       fUnused:  28;  // unused
+
+    unsigned       Value;         // application-specific value
+};
+#else
 struct Gia_Obj_t_
 {
     unsigned       iDiff0 :  29;  // the diff of the first fanin
@@ -87,6 +118,7 @@ struct Gia_Obj_t_
 
     unsigned       Value;         // application-specific value
 };
+#endif
 // Value is currently used to store several types of information
 // - pointer to the next node in the hash table during structural hashing
 // - pointer to the node copy during duplication 
@@ -102,6 +134,7 @@ struct Gia_Man_t_
     int            nObjs;         // number of objects
     int            nObjsAlloc;    // number of allocated objects
     Gia_Obj_t *    pObjs;         // the array of objects
+    int            nObjsArena;    // the number of objects reserved in the arena (0 if not used)
     unsigned *     pMuxes;        // control signals of MUXes
     int            nXors;         // the number of XORs
     int            nMuxes;        // the number of MUXes 
@@ -632,19 +665,26 @@ static inline word *       Gia_ObjSimObj( Gia_Man_t * p, Gia_Obj_t * pObj )    {
 
 // AIG construction
 extern void Gia_ObjAddFanout( Gia_Man_t * p, Gia_Obj_t * pObj, Gia_Obj_t * pFanout );
+extern int Gia_ManObjArenaStart( Gia_Man_t * p, int nObjsMax );
+
 static inline Gia_Obj_t * Gia_ManAppendObj( Gia_Man_t * p )  
 { 
     if ( p->nObjs == p->nObjsAlloc )
     {
-        int nObjNew = Abc_MinInt( 2 * p->nObjsAlloc, (1 << 29) );
-        if ( p->nObjs == (1 << 29) )
-            printf( "Hard limit on the number of nodes (2^29) is reached. Quitting...\n" ), exit(1);
+        int nObjNew = p->nObjsAlloc < GIA_OBJ_MAX / 2 ? 2 * p->nObjsAlloc : GIA_OBJ_MAX;
+        if ( p->nObjs == GIA_OBJ_MAX )
+            printf( "Hard limit on the number of nodes (%d) is reached. Quitting...\n", GIA_OBJ_MAX ), exit(1);
         assert( p->nObjs < nObjNew );
         if ( p->fVerbose )
             printf("Extending GIA object storage: %d -> %d.\n", p->nObjsAlloc, nObjNew );
         assert( p->nObjsAlloc > 0 );
-        p->pObjs = ABC_REALLOC( Gia_Obj_t, p->pObjs, nObjNew );
-        memset( p->pObjs + p->nObjsAlloc, 0, sizeof(Gia_Obj_t) * (nObjNew - p->nObjsAlloc) );
+        if ( nObjNew >= GIA_ARENA_MIN && p->nObjsArena < nObjNew )
+            Gia_ManObjArenaStart( p, nObjNew );
+        if ( !p->nObjsArena ) // the arena grows in place and its new pages are zero
+        {
+            p->pObjs = ABC_REALLOC( Gia_Obj_t, p->pObjs, nObjNew );
+            memset( p->pObjs + p->nObjsAlloc, 0, sizeof(Gia_Obj_t) * (nObjNew - p->nObjsAlloc) );
+        }
         if ( p->pMuxes )
         {
             p->pMuxes = ABC_REALLOC( unsigned, p->pMuxes, nObjNew );
@@ -1208,8 +1248,12 @@ static inline int         Gia_ObjCellId( Gia_Man_t * p, int iLit )          { re
 
 /*=== giaAiger.c ===========================================================*/
 extern int                 Gia_FileSize( char * pFileName );
+extern char *              Gia_AigerMapFile( char * pFileName, int * pnFileSize );
+extern void                Gia_AigerUnmapFile( char * pContents, int nFileSize );
 extern Gia_Man_t *         Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck );
+extern Gia_Man_t *         Gia_AigerReadFromMemoryPar( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck, int nThreads );
 extern Gia_Man_t *         Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck );
+extern Gia_Man_t *         Gia_AigerReadPar( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck, int nThreads );
 extern void                Gia_AigerWrite( Gia_Man_t * p, char * pFileName, int fWriteSymbols, int fCompact, int fWriteNewLine );
 extern void                Gia_DumpAiger( Gia_Man_t * p, char * pFilePrefix, int iFileNum, int nFileNumDigits );
 extern Vec_Str_t *         Gia_AigerWriteIntoMemoryStr( Gia_Man_t * p );
@@ -1427,6 +1471,11 @@ extern int                 Gia_ManHashLookup( Gia_Man_t * p, Gia_Obj_t * p0, Gia
 extern int                 Gia_ManHashAndMulti( Gia_Man_t * p, Vec_Int_t * vLits );
 extern int                 Gia_ManHashAndMulti2( Gia_Man_t * p, Vec_Int_t * vLits );
 extern int                 Gia_ManHashDualMiter( Gia_Man_t * p, Vec_Int_t * vOuts );
+/*=== giaHashPar.c ========================================================*/
+typedef struct Gia_HashPar_t_ Gia_HashPar_t;
+extern Gia_HashPar_t *     Gia_ManHashParStart( Gia_Man_t * pGia, int nObjsMax );
+extern void                Gia_ManHashParStop( Gia_HashPar_t * p );
+extern Gia_Man_t *         Gia_ManRehashPar( Gia_Man_t * p, int nThreads );
 /*=== giaIf.c ===========================================================*/
 extern void                Gia_ManPrintMappingStats( Gia_Man_t * p, char * pDumpFile );
 extern void                Gia_ManPrintPackingStats( Gia_Man_t * p );
@@ -1455,6 +1504,16 @@ extern Gia_Man_t *         Jf_ManDeriveCnf( Gia_Man_t * p, int fCnfObjIds );
 extern Gia_Man_t *         Gia_ManIsoCanonicize( Gia_Man_t * p, int fVerbose );
 extern Gia_Man_t *         Gia_ManIsoReduce( Gia_Man_t * p, Vec_Ptr_t ** pvPosEquivs, Vec_Ptr_t ** pvPiPerms, int fEstimate, int fDualOut, int fVerbose, int fVeryVerbose );
 extern Gia_Man_t *         Gia_ManIsoReduce2( Gia_Man_t * p, Vec_Ptr_t ** pvPosEquivs, Vec_Ptr_t ** pvPiPerms, int fEstimate, int fBetterQual, int fDualOut, int fVerbose, int fVeryVerbose );
+/*=== giaLevPar.c ============================================================*/
+typedef struct Gia_LevPar_t_ Gia_LevPar_t;
+typedef void (*Gia_LevParFunc_t)( void * pMan, int iThread, int iObj );
+typedef void (*Gia_LevParSync_t)( void * pMan, int nNodes );
+extern Gia_LevPar_t *      Gia_LevParStart( Gia_Man_t * pGia, int nThreads, int nWideMin );
+extern void                Gia_LevParStop( Gia_LevPar_t * p );
+extern int                 Gia_LevParThreadNum( Gia_LevPar_t * p );
+extern void                Gia_LevParLock( Gia_LevPar_t * p );
+extern void                Gia_LevParUnlock( Gia_LevPar_t * p );
+extern void                Gia_LevParRun( Gia_LevPar_t * p, Gia_LevParFunc_t pFunc, Gia_LevParSync_t pSync, void * pMan );
 /*=== giaLf.c ===========================================================*/
 extern void                Lf_ManSetDefaultPars( Jf_Par_t * pPars );
 extern Gia_Man_t *         Lf_ManPerformMapping( Gia_Man_t * pGia, Jf_Par_t * pPars );
@@ -1551,6 +1610,12 @@ extern void                Gia_ManIncrSimStart( Gia_Man_t * p, int nWords, int n
 extern void                Gia_ManIncrSimSet( Gia_Man_t * p, Vec_Int_t * vObjLits );
 extern int                 Gia_ManIncrSimCheckOver( Gia_Man_t * p, int iLit0, int iLit1 );
 extern int                 Gia_ManIncrSimCheckEqual( Gia_Man_t * p, int iLit0, int iLit1 );
+/*=== giaSimPar.c ============================================================*/
+typedef struct Gia_SimPar_t_ Gia_SimPar_t;
+extern Gia_SimPar_t *      Gia_SimParStart( Gia_Man_t * pGia, int nThreads );
+extern void                Gia_SimParStop( Gia_SimPar_t * p );
+extern void                Gia_SimParSimulate( Gia_SimPar_t * p, word * pSims, int nWords );
+extern int                 Gia_ManSimSimulatePar( Gia_Man_t * pAig, Gia_ParSim_t * pPars, int nThreads );
 /*=== giaSpeedup.c ============================================================*/
 extern float               Gia_ManDelayTraceLut( Gia_Man_t * p );
 extern float               Gia_ManDelayTraceLutPrint( Gia_Man_t * p, int fVerbose );
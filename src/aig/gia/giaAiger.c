@@ -23,6 +23,23 @@
 #include "misc/tim/tim.h"
 #include "base/main/main.h"
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 #define XAIG_VERBOSE 0
@@ -31,6 +48,15 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+// the offset index (extension "x") is written for AIGs with at least this many AND gates
+#define GIA_AIGER_INDEX_MIN   (1 << 20)
+// the number of AND gates between two consecutive entries of the offset index
+#define GIA_AIGER_INDEX_STEP  (1 << 16)
+// the footer terminating the file with the offset index
+#define GIA_AIGER_INDEX_MAGIC "aidx"
+
+#define GIA_AIGER_THR_MAX     64
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -162,6 +188,181 @@ Vec_Str_t * Gia_AigerWriteLiterals( Vec_Int_t * vLits )
     return vBinary;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Reads the offset index of the AND gate section.]
+
+  Description [The index is located using the footer at the end of the file, 
+  which contains the position of extension "x" followed by the magic string. 
+  The extension stores the number of AND gates per chunk, the total number 
+  of AND gates, the size of the AND gate section in bytes, followed by the 
+  start offsets of the chunks relative to the beginning of the AND gate 
+  section, delta-encoded as variable-length unsigned integers. Returns NULL
+  if the file has no index or the index does not match the header, or if
+  the chunks do not fit into the nBytesMax bytes following the beginning 
+  of the AND gate section.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Int_t * Gia_AigerReadIndex( char * pContents, int nFileSize, int nAnds, int nBytesMax, int * pnStep, int * pnBytes )
+{
+    Vec_Int_t * vOffsets;
+    unsigned char * pCur, * pStop;
+    unsigned Delta, Offset = 0;
+    int i, iPos, nChunks;
+    if ( nFileSize < 8 || strncmp( pContents + nFileSize - 4, GIA_AIGER_INDEX_MAGIC, 4 ) )
+        return NULL;
+    iPos = Gia_AigerReadInt( (unsigned char *)pContents + nFileSize - 8 );
+    if ( iPos <= 0 || iPos + 17 > nFileSize - 8 || pContents[iPos] != 'x' )
+        return NULL;
+    pCur  = (unsigned char *)pContents + iPos + 1;
+    pStop = pCur + 4 + Gia_AigerReadInt(pCur);                  pCur += 4;
+    if ( pStop > (unsigned char *)pContents + nFileSize - 8 )
+        return NULL;
+    *pnStep  = Gia_AigerReadInt(pCur);                          pCur += 4;
+    if ( Gia_AigerReadInt(pCur) != nAnds || *pnStep <= 0 )
+        return NULL;
+    pCur += 4;
+    *pnBytes = Gia_AigerReadInt(pCur);                          pCur += 4;
+    // each AND gate takes at least two bytes
+    if ( *pnBytes > nBytesMax || *pnBytes / 2 < nAnds )
+        return NULL;
+    nChunks  = nAnds / *pnStep + (nAnds % *pnStep > 0);
+    vOffsets = Vec_IntAlloc( nChunks );
+    for ( i = 0; i < nChunks && pCur < pStop; i++ )
+    {
+        Delta = Gia_AigerReadUnsigned( &pCur );
+        // the first chunk starts the section; the other ones follow the previous chunk
+        if ( i == 0 ? Delta != 0 : (Delta / 2 < (unsigned)*pnStep || Delta > (unsigned)*pnBytes - Offset) )
+            break;
+        Offset += Delta;
+        Vec_IntPush( vOffsets, (int)Offset );
+    }
+    if ( Vec_IntSize(vOffsets) != nChunks || pCur != pStop || 
+         ((unsigned)*pnBytes - Offset) / 2 < (unsigned)(nAnds - (nChunks - 1) * *pnStep) )
+        Vec_IntFreeP( &vOffsets );
+    return vOffsets;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Decodes the literals of AND gates in parallel.]
+
+  Description [Each thread decodes every nThreads-th chunk of the AND gate
+  section starting at the offset recorded in the index and writes the 
+  fanin literals of the AND gates into the shared array. Returns NULL if
+  a chunk does not end where the next one starts or contains a fanin
+  literal that does not precede the AND gate.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Gia_AigerThData_t_
+{
+    unsigned char * pStart;    // the beginning of the AND gate section
+    Vec_Int_t *     vOffsets;  // the chunk offsets
+    int *           pLits;     // the decoded literals (two per AND gate)
+    int             nCis;      // the number of combinational inputs
+    int             nAnds;     // the number of AND gates
+    int             nStep;     // the number of AND gates per chunk
+    int             nBytes;    // the size of the AND gate section
+    int             iThread;   // the thread number
+    int             nThreads;  // the number of threads
+    int             fError;    // the chunks do not match the index
+} Gia_AigerThData_t;
+static inline int Gia_AigerReadUnsignedChunk( unsigned char ** ppPos, unsigned char * pStop, unsigned * pNum )
+{
+    unsigned x = 0, i = 0;
+    unsigned char ch;
+    do {
+        if ( *ppPos == pStop || i == 5 )
+            return 0;
+        ch = *(*ppPos)++;
+        x |= (unsigned)(ch & 0x7f) << (7 * i++);
+    } while ( ch & 0x80 );
+    *pNum = x;
+    return 1;
+}
+static void Gia_AigerDecodeChunks( Gia_AigerThData_t * p )
+{
+    unsigned char * pCur, * pStop;
+    unsigned uLit, uDelta0, uDelta1;
+    int c, i, iStop;
+    for ( c = p->iThread; c < Vec_IntSize(p->vOffsets); c += p->nThreads )
+    {
+        pCur  = p->pStart + Vec_IntEntry( p->vOffsets, c );
+        pStop = p->pStart + (c + 1 < Vec_IntSize(p->vOffsets) ? Vec_IntEntry( p->vOffsets, c + 1 ) : p->nBytes);
+        iStop = Abc_MinInt( (c + 1) * p->nStep, p->nAnds );
+        for ( i = c * p->nStep; i < iStop; i++ )
+        {
+            uLit = ((i + 1 + p->nCis) << 1);
+            if ( !Gia_AigerReadUnsignedChunk( &pCur, pStop, &uDelta1 ) || !Gia_AigerReadUnsignedChunk( &pCur, pStop, &uDelta0 ) ||
+                 uDelta1 == 0 || uDelta1 > uLit || uDelta0 > uLit - uDelta1 )
+                break;
+            p->pLits[2*i+1] = uLit - uDelta1;
+            p->pLits[2*i+0] = uLit - uDelta1 - uDelta0;
+        }
+        if ( i < iStop || pCur != pStop )
+        {
+            p->fError = 1;
+            return;
+        }
+    }
+}
+#ifdef ABC_USE_PTHREADS
+static void * Gia_AigerDecodeThread( void * pArg )
+{
+    Gia_AigerDecodeChunks( (Gia_AigerThData_t *)pArg );
+    return NULL;
+}
+#endif
+Vec_Int_t * Gia_AigerDecodeAnds( unsigned char * pStart, Vec_Int_t * vOffsets, int nCis, int nAnds, int nStep, int nBytes, int nThreads )
+{
+    Gia_AigerThData_t ThData[GIA_AIGER_THR_MAX];
+    Vec_Int_t * vLits = Vec_IntStart( 2 * nAnds );
+    int i;
+    nThreads = Abc_MaxInt( 1, Abc_MinInt(nThreads, Abc_MinInt(GIA_AIGER_THR_MAX, Vec_IntSize(vOffsets))) );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        ThData[i].pStart   = pStart;
+        ThData[i].vOffsets = vOffsets;
+        ThData[i].pLits    = Vec_IntArray( vLits );
+        ThData[i].nCis     = nCis;
+        ThData[i].nAnds    = nAnds;
+        ThData[i].nStep    = nStep;
+        ThData[i].nBytes   = nBytes;
+        ThData[i].iThread  = i;
+        ThData[i].nThreads = nThreads;
+        ThData[i].fError   = 0;
+    }
+#ifdef ABC_USE_PTHREADS
+    if ( nThreads > 1 )
+    {
+        pthread_t WorkerThread[GIA_AIGER_THR_MAX];
+        int status;
+        for ( i = 0; i < nThreads; i++ )
+        {
+            status = pthread_create( WorkerThread + i, NULL, Gia_AigerDecodeThread, (void *)(ThData + i) );  
+            assert( status == 0 );
+        }
+        for ( i = 0; i < nThreads; i++ )
+            pthread_join( WorkerThread[i], NULL );
+    }
+    else
+#endif
+    for ( i = 0; i < nThreads; i++ )
+        Gia_AigerDecodeChunks( ThData + i );
+    for ( i = 0; i < nThreads; i++ )
+        if ( ThData[i].fError )
+            Vec_IntFreeP( &vLits );
+    return vLits;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Reads the AIG in the binary AIGER format.]
@@ -174,10 +375,28 @@ Vec_Str_t * Gia_AigerWriteLiterals( Vec_Int_t * vLits )
 
 ***********************************************************************/
 Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck )
+{
+    return Gia_AigerReadFromMemoryPar( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck, 1 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the AIG in the binary AIGER format.]
+
+  Description [If the file contains the offset index (extension "x") and
+  more than one thread is requested, the AND gate section is decoded on 
+  several threads and the resulting literals are stitched into the AIG.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Gia_AigerReadFromMemoryPar( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck, int nThreads )
 {
     Gia_Man_t * pNew, * pTemp;
     Vec_Int_t * vLits = NULL, * vPoTypes = NULL;
-    Vec_Int_t * vNodes, * vDrivers, * vInits = NULL;
+    Vec_Int_t * vNodes, * vDrivers, * vInits = NULL, * vAndLits = NULL;
     int iObj, iNode0, iNode1, fHieOnly = 0;
     int nTotal, nInputs, nOutputs, nLatches, nAnds, i;
     int nBad = 0, nConstr = 0, nJust = 0, nFair = 0;
@@ -252,10 +471,13 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
             fprintf( stdout, "Warning: The last %d outputs are interpreted as constraints.\n", nConstr );
     }
 
-    // allocate the empty AIG
+    // allocate the empty AIG (the header gives the exact number of objects, 
+    // so the object array, CI/CO arrays, and the hash table never grow while reading)
     pNew = Gia_ManStart( nTotal + nLatches + nOutputs + 1 );
     pNew->nConstrs = nConstr;
     pNew->fGiaSimple = fGiaSimple;
+    Vec_IntGrow( pNew->vCis, nInputs + nLatches );
+    Vec_IntGrow( pNew->vCos, nLatches + nOutputs );
 
     // prepare the array of nodes
     vNodes = Vec_IntAlloc( 1 + nTotal );
@@ -282,14 +504,37 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
         vLits = Gia_AigerReadLiterals( &pCur, nLatches + nOutputs );
     }
 
+    // decode the AND gates in parallel using the offset index
+    if ( nThreads > 1 && nAnds > 0 )
+    {
+        int nStep, nBytes;
+        int nBytesMax = (int)((unsigned char *)pContents + nFileSize - pCur);
+        Vec_Int_t * vOffsets = Gia_AigerReadIndex( pContents, nFileSize, nAnds, nBytesMax, &nStep, &nBytes );
+        if ( vOffsets )
+            vAndLits = Gia_AigerDecodeAnds( pCur, vOffsets, nInputs + nLatches, nAnds, nStep, nBytes, nThreads );
+        if ( vAndLits )
+            pCur += nBytes;
+        else if ( vOffsets )
+            printf( "Warning: The AIGER offset index does not match the AND gates and is ignored.\n" );
+        Vec_IntFreeP( &vOffsets );
+    }
+
     // create the AND gates
     if ( !fGiaSimple && !fSkipStrash )
         Gia_ManHashAlloc( pNew );
     for ( i = 0; i < nAnds; i++ )
     {
-        uLit = ((i + 1 + nInputs + nLatches) << 1);
-        uLit1 = uLit  - Gia_AigerReadUnsigned( &pCur );
-        uLit0 = uLit1 - Gia_AigerReadUnsigned( &pCur );
+        if ( vAndLits )
+        {
+            uLit0 = Vec_IntEntry( vAndLits, 2*i+0 );
+            uLit1 = Vec_IntEntry( vAndLits, 2*i+1 );
+        }
+        else
+        {
+            uLit = ((i + 1 + nInputs + nLatches) << 1);
+            uLit1 = uLit  - Gia_AigerReadUnsigned( &pCur );
+            uLit0 = uLit1 - Gia_AigerReadUnsigned( &pCur );
+        }
 //        assert( uLit1 > uLit0 );
         iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), uLit0 & 1 );
         iNode1 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit1 >> 1), uLit1 & 1 );
@@ -306,6 +551,7 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
     }
     if ( !fGiaSimple && !fSkipStrash )
         Gia_ManHashStop( pNew );
+    Vec_IntFreeP( &vAndLits );
 
     // remember the place where symbols begin
     pSymbols = pCur;
@@ -752,6 +998,13 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
                 if ( fVerbose ) printf( "Finished reading extension \"v\".\n" );
             }
             // read edge information
+            // skip the offset index of the AND gate section
+            else if ( *pCur == 'x' )
+            {
+                pCur++;
+                pCur += Gia_AigerReadInt(pCur) + 4;
+                if ( fVerbose ) printf( "Finished reading extension \"x\".\n" );
+            }
             else if ( *pCur == 'w' )
             {
                 Vec_Int_t * vPairs;
@@ -862,11 +1115,60 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
     return pNew;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Maps the file into memory.]
+
+  Description [Returns the private copy-on-write mapping of the file, which 
+  is decoded in place without copying it into a heap buffer. The reader may 
+  modify the symbol table, which only duplicates the touched pages. Returns 
+  NULL if mapping is not available; in this case, the caller falls back on 
+  reading the file into memory.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+char * Gia_AigerMapFile( char * pFileName, int * pnFileSize )
+{
+#ifndef _WIN32
+    struct stat Stat;
+    void * pMap;
+    int fd = open( pFileName, O_RDONLY );
+    if ( fd == -1 )
+        return NULL;
+    if ( fstat( fd, &Stat ) == -1 || Stat.st_size == 0 || Stat.st_size > 0x7FFFFFFF )
+    {
+        close( fd );
+        return NULL;
+    }
+    pMap = mmap( NULL, (size_t)Stat.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0 );
+    close( fd );
+    if ( pMap == MAP_FAILED )
+        return NULL;
+#ifdef MADV_SEQUENTIAL
+    madvise( pMap, (size_t)Stat.st_size, MADV_SEQUENTIAL );
+#endif
+    *pnFileSize = (int)Stat.st_size;
+    return (char *)pMap;
+#else
+    return NULL;
+#endif
+}
+void Gia_AigerUnmapFile( char * pContents, int nFileSize )
+{
+#ifndef _WIN32
+    munmap( pContents, (size_t)nFileSize );
+#endif
+}
+
 /**Function*************************************************************
 
   Synopsis    [Reads the AIG in the binary AIGER format.]
 
-  Description []
+  Description [The file is memory-mapped when possible, so that the binary 
+  data is decoded directly from the mapping rather than from a heap copy.]
   
   SideEffects []
 
@@ -874,6 +1176,10 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
 
 ***********************************************************************/
 Gia_Man_t * Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck )
+{
+    return Gia_AigerReadPar( pFileName, fGiaSimple, fSkipStrash, fCheck, 1 );
+}
+Gia_Man_t * Gia_AigerReadPar( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck, int nThreads )
 {
     FILE * pFile;
     Gia_Man_t * pNew;
@@ -881,16 +1187,26 @@ Gia_Man_t * Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, in
     int nFileSize;
     int RetValue;
 
-    // read the file into the buffer
+    // map the file into memory
     Gia_FileFixName( pFileName );
-    nFileSize = Gia_FileSize( pFileName );
-    pFile = fopen( pFileName, "rb" );
-    pContents = ABC_ALLOC( char, nFileSize );
-    RetValue = fread( pContents, nFileSize, 1, pFile );
-    fclose( pFile );
+    pContents = Gia_AigerMapFile( pFileName, &nFileSize );
+    if ( pContents )
+    {
+        pNew = Gia_AigerReadFromMemoryPar( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck, nThreads );
+        Gia_AigerUnmapFile( pContents, nFileSize );
+    }
+    else
+    {
+        // read the file into the buffer
+        nFileSize = Gia_FileSize( pFileName );
+        pFile = fopen( pFileName, "rb" );
+        pContents = ABC_ALLOC( char, nFileSize );
+        RetValue = fread( pContents, nFileSize, 1, pFile );
+        fclose( pFile );
 
-    pNew = Gia_AigerReadFromMemory( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck );
-    ABC_FREE( pContents );
+        pNew = Gia_AigerReadFromMemoryPar( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck, nThreads );
+        ABC_FREE( pContents );
+    }
     if ( pNew )
     {
         ABC_FREE( pNew->pName );
@@ -1083,7 +1399,8 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
     Gia_Man_t * p;
     Gia_Obj_t * pObj;
     Vec_Str_t * vStrExt;
-    int i, nBufferSize, Pos;
+    Vec_Int_t * vOffsets = NULL;
+    int i, nBufferSize, Pos, iIndexPos = 0;
     unsigned char * pBuffer;
     unsigned uLit0, uLit1, uLit;
     assert( pInit->nXors == 0 && pInit->nMuxes == 0 );
@@ -1152,10 +1469,14 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
 
     // write the nodes into the buffer
     Pos = 0;
-    nBufferSize = 8 * Gia_ManAndNum(p) + 100; // skeptically assuming 3 chars per one AIG edge
+    nBufferSize = (int)Abc_MinWord( 8 * (word)Gia_ManAndNum(p) + 100, 0x7FFFFFFF ); // skeptically assuming 3 chars per one AIG edge
     pBuffer = ABC_ALLOC( unsigned char, nBufferSize );
+    if ( Gia_ManAndNum(p) >= GIA_AIGER_INDEX_MIN )
+        vOffsets = Vec_IntAlloc( Gia_ManAndNum(p) / GIA_AIGER_INDEX_STEP + 1 );
     Gia_ManForEachAnd( p, pObj, i )
     {
+        if ( vOffsets && (i - 1 - Gia_ManCiNum(p)) % GIA_AIGER_INDEX_STEP == 0 )
+            Vec_IntPush( vOffsets, Pos );
         uLit  = Abc_Var2Lit( i, 0 );
         uLit0 = Gia_ObjFaninLit0( pObj, i );
         uLit1 = Gia_ObjFaninLit1( pObj, i );
@@ -1165,6 +1486,7 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
         if ( Pos > nBufferSize - 10 )
         {
             printf( "Gia_AigerWrite(): AIGER generation has failed because the allocated buffer is too small.\n" );
+            Vec_IntFreeP( &vOffsets );
             fclose( pFile );
             if ( p != pInit )
                 Gia_ManStop( p );
@@ -1399,6 +1721,27 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
         assert( Vec_IntSize(p->vObjClasses) == Gia_ManObjNum(p) );
         fwrite( Vec_IntArray(p->vObjClasses), 1, 4*Gia_ManObjNum(p), pFile );
     }
+    // write the offset index of the AND gate section
+    if ( vOffsets && ftell(pFile) < 0x7FFFFFF0 - Vec_IntSize(vOffsets) * 5 - 16 )
+    {
+        int Entry, Prev = 0;
+        vStrExt = Vec_StrAlloc( 3 * Vec_IntSize(vOffsets) + 12 );
+        Vec_IntForEachEntry( vOffsets, Entry, i )
+        {
+            Gia_AigerWriteUnsigned( vStrExt, Entry - Prev );
+            Prev = Entry;
+        }
+        iIndexPos = (int)ftell( pFile );
+        fprintf( pFile, "x" );
+        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) + 12 );
+        Gia_FileWriteBufferSize( pFile, GIA_AIGER_INDEX_STEP );
+        Gia_FileWriteBufferSize( pFile, Gia_ManAndNum(p) );
+        Gia_FileWriteBufferSize( pFile, Pos );
+        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Vec_StrFree( vStrExt );
+        if ( fVerbose ) printf( "Finished writing extension \"x\".\n" );
+    }
+    Vec_IntFreeP( &vOffsets );
     // write name
     if ( p->pName )
     {
@@ -1412,6 +1755,12 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
         fprintf( pFile, "c\n" );
     fprintf( pFile, "\nThis file was produced by the GIA package in ABC on %s\n", Gia_TimeStamp() );
     fprintf( pFile, "For information about AIGER format, refer to %s\n", "http://fmv.jku.at/aiger" );
+    // write the footer pointing to the offset index
+    if ( iIndexPos )
+    {
+        Gia_FileWriteBufferSize( pFile, iIndexPos );
+        fwrite( GIA_AIGER_INDEX_MAGIC, 1, 4, pFile );
+    }
     fclose( pFile );
     if ( p != pInit )
     {
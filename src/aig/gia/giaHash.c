@@ -478,7 +478,7 @@ int Gia_ManHashXorReal( Gia_Man_t * p, int iLit0, int iLit1 )
         return 0;
     if ( iLit0 == Abc_LitNot(iLit1) )
         return 1;
-    if ( (p->nObjs & 0xFF) == 0 && 2 * Vec_IntSize(&p->vHTable) < Gia_ManAndNum(p) )
+    if ( (p->nObjs & 0xFF) == 0 && Vec_IntSize(&p->vHTable) < Gia_ManAndNum(p) - Vec_IntSize(&p->vHTable) )
         Gia_ManHashResize( p );
     if ( iLit0 < iLit1 )
         iLit0 ^= iLit1, iLit1 ^= iLit0, iLit0 ^= iLit1;
@@ -588,7 +588,7 @@ int Gia_ManHashAnd( Gia_Man_t * p, int iLit0, int iLit1 )
         assert( Vec_IntSize(&p->vHTable) == 0 );
         return Gia_ManAppendAnd( p, iLit0, iLit1 );
     }
-    if ( (p->nObjs & 0xFF) == 0 && 2 * Vec_IntSize(&p->vHTable) < Gia_ManAndNum(p) )
+    if ( (p->nObjs & 0xFF) == 0 && Vec_IntSize(&p->vHTable) < Gia_ManAndNum(p) - Vec_IntSize(&p->vHTable) )
         Gia_ManHashResize( p );
     if ( p->fAddStrash )
     {
@@ -0,0 +1,387 @@
+/**CFile****************************************************************
+
+  FileName    [giaHashPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Concurrent structural hashing.]
+
+  Author      [agent]
+
+  Date        [Ver. 1.0. Started - October 16, 2026.]
+
+  Revision    [$Id: giaHashPar.c,v 1.00 2026/10/16 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "gia.h"
+
+#ifdef _MSC_VER
+#include <windows.h>
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The table uses open addressing with linear probing. A slot is claimed by
+// atomically replacing the empty key with the pair of fanin literals; the
+// thread that claimed the slot creates the node and publishes its ID, while
+// the threads looking up the same pair wait until the ID is published.
+// Because the ID of the node is allocated after the IDs of its fanins are
+// known, the nodes created concurrently remain in a topological order.
+
+struct Gia_HashPar_t_
+{
+    Gia_Man_t *    pGia;       // the manager
+    word *         pKeys;      // the pairs of fanin literals (0 = empty slot)
+    int *          pIds;       // the node IDs (0 = not published yet)
+    word           Mask;       // the table size minus one
+    int            nObjsMax;   // the capacity of the object array
+};
+
+#ifdef _MSC_VER
+#define GIA_CAS64( p, Old, New )  ((word)InterlockedCompareExchange64((volatile LONG64 *)(p), (LONG64)(New), (LONG64)(Old)))
+#define GIA_ADD32( p, Add )       ((int)InterlockedExchangeAdd((volatile LONG *)(p), (LONG)(Add)))
+#define GIA_BARRIER()             MemoryBarrier()
+#else
+#define GIA_CAS64( p, Old, New )  __sync_val_compare_and_swap( (p), (Old), (New) )
+#define GIA_ADD32( p, Add )       __sync_fetch_and_add( (p), (Add) )
+#define GIA_BARRIER()             __sync_synchronize()
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the first slot for the pair of literals.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline word Gia_ManHashParKey( int iLit0, int iLit1 )
+{
+    word Key = ((word)iLit0 << 32) | (word)iLit1;
+    Key ^= Key >> 29;
+    Key *= ABC_CONST(0x9E3779B97F4A7C15);
+    return Key ^ (Key >> 32);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Appends the AND node in a thread-safe way.]
+
+  Description [Assumes that iLit0 < iLit1 and that the object array
+  was allocated in advance.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Gia_ManHashParAppendAnd( Gia_HashPar_t * p, int iLit0, int iLit1 )
+{
+    int iObj = GIA_ADD32( &p->pGia->nObjs, 1 );
+    Gia_Obj_t * pObj = p->pGia->pObjs + iObj;
+    if ( iObj >= p->nObjsMax )
+        printf( "The limit on the number of nodes (%d) for concurrent hashing is reached. Quitting...\n", p->nObjsMax ), exit(1);
+    assert( iLit0 < iLit1 );
+    pObj->iDiff0  = (unsigned)(iObj - Abc_Lit2Var(iLit0));
+    pObj->fCompl0 = (unsigned)(Abc_LitIsCompl(iLit0));
+    pObj->iDiff1  = (unsigned)(iObj - Abc_Lit2Var(iLit1));
+    pObj->fCompl1 = (unsigned)(Abc_LitIsCompl(iLit1));
+    return iObj;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts concurrent hashing.]
+
+  Description [Allocates the object array for nObjsMax objects, which
+  cannot be exceeded while hashing, and adds the AND nodes already present
+  in the manager to the table. While the table is used, the manager should
+  not be modified by other means.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_HashPar_t * Gia_ManHashParStart( Gia_Man_t * pGia, int nObjsMax )
+{
+    Gia_HashPar_t * p;
+    Gia_Obj_t * pObj;
+    word i, Size;
+    int k;
+    assert( Vec_IntSize(&pGia->vHTable) == 0 );
+    assert( pGia->pMuxes == NULL && pGia->pFanData == NULL );
+    assert( !pGia->fSweeper && !pGia->fBuiltInSim );
+    nObjsMax = Abc_MinInt( Abc_MaxInt(nObjsMax, Gia_ManObjNum(pGia)), GIA_OBJ_MAX );
+    // allocate the objects
+    if ( pGia->nObjsAlloc < nObjsMax )
+    {
+        if ( nObjsMax >= GIA_ARENA_MIN )
+            Gia_ManObjArenaStart( pGia, nObjsMax );
+        if ( !pGia->nObjsArena )
+        {
+            pGia->pObjs = ABC_REALLOC( Gia_Obj_t, pGia->pObjs, nObjsMax );
+            memset( pGia->pObjs + pGia->nObjsAlloc, 0, sizeof(Gia_Obj_t) * (nObjsMax - pGia->nObjsAlloc) );
+        }
+        pGia->nObjsAlloc = nObjsMax;
+    }
+    // allocate the table with at least 50% free slots
+    for ( Size = 1024; Size < 2 * (word)nObjsMax; Size <<= 1 );
+    p = ABC_CALLOC( Gia_HashPar_t, 1 );
+    p->pGia     = pGia;
+    p->pKeys    = ABC_CALLOC( word, Size );
+    p->pIds     = ABC_CALLOC( int, Size );
+    p->Mask     = Size - 1;
+    p->nObjsMax = nObjsMax;
+    // add the existing nodes
+    Gia_ManForEachAnd( pGia, pObj, k )
+    {
+        int iLit0 = Gia_ObjFaninLit0(pObj, k);
+        int iLit1 = Gia_ObjFaninLit1(pObj, k);
+        word Key = ((word)iLit0 << 32) | (word)iLit1;
+        if ( Gia_ObjIsBuf(pObj) )
+            continue;
+        for ( i = Gia_ManHashParKey(iLit0, iLit1) & p->Mask; p->pKeys[i] && p->pKeys[i] != Key; i = (i + 1) & p->Mask );
+        if ( p->pKeys[i] )
+            continue;
+        p->pKeys[i] = Key;
+        p->pIds[i]  = k;
+    }
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops concurrent hashing.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManHashParStop( Gia_HashPar_t * p )
+{
+    ABC_FREE( p->pKeys );
+    ABC_FREE( p->pIds );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Finds or adds the pair of literals; can be called by several threads.]
+
+  Description [Assumes that 2 <= iLit0 < iLit1. If the pair is not in the
+  table, it is added with the ID iObjNew, or with the ID of a new AND node
+  appended to the manager if iObjNew is 0. Returns the ID of the pair.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Gia_ManHashParLookup( Gia_HashPar_t * p, int iLit0, int iLit1, int iObjNew )
+{
+    volatile int * pId;
+    word i, Old, Key = ((word)iLit0 << 32) | (word)iLit1;
+    int iObj;
+    assert( 2 <= iLit0 && iLit0 < iLit1 );
+    for ( i = Gia_ManHashParKey(iLit0, iLit1) & p->Mask; ; i = (i + 1) & p->Mask )
+    {
+        Old = p->pKeys[i];
+        if ( Old == 0 )
+        {
+            Old = GIA_CAS64( p->pKeys + i, (word)0, Key );
+            if ( Old == 0 ) // the slot is claimed by this thread
+            {
+                iObj = iObjNew ? iObjNew : Gia_ManHashParAppendAnd( p, iLit0, iLit1 );
+                GIA_BARRIER();
+                p->pIds[i] = iObj;
+                return iObj;
+            }
+        }
+        if ( Old != Key )
+            continue;
+        // wait till the ID is published by the thread that claimed the slot
+        pId = (volatile int *)(p->pIds + i);
+        while ( (iObj = *pId) == 0 );
+        GIA_BARRIER();
+        return iObj;
+    }
+    assert( 0 );
+    return -1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Rehashes the AIG while hashing the nodes concurrently.]
+
+  Description [The result is the same as that of Gia_ManRehash(), which
+  hashes the AND nodes in the order of their IDs and then removes the 
+  dangling nodes. The threads hash the nodes of the same level (see 
+  Gia_LevParRun()) and write only the entries of their own nodes. Instead 
+  of the IDs of the new nodes, which depend on the order of hashing, the 
+  table stores the handles of the classes of equal nodes. The class handle 
+  is derived from the ID of the first node added to the table, while the 
+  new node is created for 
+  the node with the smallest ID, which is computed using atomic minimum. 
+  After the threads are done, the main thread marks the classes reachable 
+  from the COs and creates the objects in the order of their IDs.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Gia_DupPar_t_ Gia_DupPar_t;
+struct Gia_DupPar_t_
+{
+    Gia_Man_t *     p;          // the original manager
+    Gia_HashPar_t * pHash;      // the table of node pairs
+    int             nCis;       // the number of CIs
+    int *           pProxy;     // the handle literal of each object
+    int *           pLits;      // the fanin handle literals of each AND node (-1 if no node is created)
+    int *           pMinId;     // the smallest ID in each class
+};
+
+#ifdef _MSC_VER
+#define GIA_CAS32( p, Old, New )  ((int)InterlockedCompareExchange((volatile LONG *)(p), (LONG)(New), (LONG)(Old)))
+#else
+#define GIA_CAS32( p, Old, New )  __sync_val_compare_and_swap( (p), (Old), (New) )
+#endif
+
+#define GIA_PAR_WIDE_MIN 256    // the smallest number of nodes per thread in a wide level
+
+// the class of an AND node is identified by the ID of the first node added to the table
+static inline int  Gia_DupParHandle( Gia_DupPar_t * pPar, int iObj )  { return pPar->nCis + 1 + iObj;              }
+static inline int  Gia_DupParClass( Gia_DupPar_t * pPar, int iLit )   { return Abc_Lit2Var(iLit) - pPar->nCis - 1; }
+
+static void Gia_DupParNode( void * pMan, int iThread, int iObj )
+{
+    Gia_DupPar_t * pPar = (Gia_DupPar_t *)pMan;
+    Gia_Obj_t * pObj = Gia_ManObj( pPar->p, iObj );
+    int iLit0 = Abc_LitNotCond( pPar->pProxy[Gia_ObjFaninId0(pObj, iObj)], Gia_ObjFaninC0(pObj) );
+    int iLit1 = Abc_LitNotCond( pPar->pProxy[Gia_ObjFaninId1(pObj, iObj)], Gia_ObjFaninC1(pObj) );
+    int iClass, iMinId;
+    pPar->pLits[2*iObj] = pPar->pLits[2*iObj+1] = -1;
+    // the same simplifications as in Gia_ManHashAnd()
+    if ( iLit0 < 2 )
+        pPar->pProxy[iObj] = iLit0 ? iLit1 : 0;
+    else if ( iLit1 < 2 )
+        pPar->pProxy[iObj] = iLit1 ? iLit0 : 0;
+    else if ( iLit0 == iLit1 )
+        pPar->pProxy[iObj] = iLit1;
+    else if ( iLit0 == Abc_LitNot(iLit1) )
+        pPar->pProxy[iObj] = 0;
+    else
+    {
+        if ( iLit0 > iLit1 )
+            iLit0 ^= iLit1, iLit1 ^= iLit0, iLit0 ^= iLit1;
+        iClass = Gia_ManHashParLookup( pPar->pHash, iLit0, iLit1, Gia_DupParHandle(pPar, iObj) ) - pPar->nCis - 1;
+        while ( (iMinId = pPar->pMinId[iClass]) > iObj && GIA_CAS32(pPar->pMinId + iClass, iMinId, iObj) != iMinId );
+        pPar->pLits[2*iObj]   = iLit0;
+        pPar->pLits[2*iObj+1] = iLit1;
+        pPar->pProxy[iObj]    = Abc_Var2Lit( Gia_DupParHandle(pPar, iClass), 0 );
+    }
+}
+static inline int Gia_DupParFinalLit( int * pFinal, int iLit )
+{
+    return Abc_LitNotCond( pFinal[Abc_Lit2Var(iLit)], Abc_LitIsCompl(iLit) );
+}
+static inline void Gia_DupParMarkUsed( Gia_DupPar_t * pPar, char * pUsed, int iLit )
+{
+    if ( Abc_Lit2Var(iLit) > pPar->nCis )
+        pUsed[Gia_DupParClass(pPar, iLit)] = 1;
+}
+Gia_Man_t * Gia_ManRehashPar( Gia_Man_t * p, int nThreads )
+{
+    Gia_DupPar_t * pPar;
+    Gia_LevPar_t * pLev;
+    Gia_Man_t * pNew;
+    Gia_Obj_t * pObj;
+    int i, iObj, iClass, iCi = 0, * pFinal;
+    char * pUsed;
+    pNew = Gia_ManStart( Gia_ManObjNum(p) );
+    pNew->pName = Abc_UtilStrsav( p->pName );
+    pNew->pSpec = Abc_UtilStrsav( p->pSpec );
+    // the CIs are mapped into themselves; the classes are numbered after them
+    pPar = ABC_CALLOC( Gia_DupPar_t, 1 );
+    pPar->p       = p;
+    pPar->nCis    = Gia_ManCiNum(p);
+    pPar->pProxy  = ABC_FALLOC( int, Gia_ManObjNum(p) );
+    pPar->pLits   = ABC_ALLOC( int, 2 * Gia_ManObjNum(p) );
+    pPar->pMinId  = ABC_ALLOC( int, Gia_ManObjNum(p) );
+    for ( i = 0; i < Gia_ManObjNum(p); i++ )
+        pPar->pMinId[i] = ABC_INFINITY;
+    pPar->pProxy[0] = 0;
+    Gia_ManForEachCi( p, pObj, i )
+        pPar->pProxy[Gia_ObjId(p, pObj)] = Abc_Var2Lit( 1 + i, 0 );
+    // hash the nodes using the handles of the classes
+    pPar->pHash = Gia_ManHashParStart( pNew, Gia_ManObjNum(p) );
+    pLev = Gia_LevParStart( p, nThreads, GIA_PAR_WIDE_MIN );
+    Gia_LevParRun( pLev, Gia_DupParNode, NULL, pPar );
+    Gia_LevParStop( pLev );
+    Gia_ManHashParStop( pPar->pHash );
+    // mark the classes reachable from the COs (the fanins of a class come before it)
+    pUsed = ABC_CALLOC( char, Gia_ManObjNum(p) );
+    Gia_ManForEachCo( p, pObj, i )
+        Gia_DupParMarkUsed( pPar, pUsed, pPar->pProxy[Gia_ObjFaninId0p(p, pObj)] );
+    Gia_ManForEachAndReverseId( p, iObj )
+    {
+        if ( pPar->pLits[2*iObj] == -1 )
+            continue;
+        iClass = Gia_DupParClass( pPar, pPar->pProxy[iObj] );
+        if ( pPar->pMinId[iClass] != iObj || !pUsed[iClass] )
+            continue;
+        Gia_DupParMarkUsed( pPar, pUsed, pPar->pLits[2*iObj] );
+        Gia_DupParMarkUsed( pPar, pUsed, pPar->pLits[2*iObj+1] );
+    }
+    // create the used objects in the order of IDs
+    pFinal = ABC_ALLOC( int, Gia_DupParHandle(pPar, Gia_ManObjNum(p)) );
+    pFinal[0] = 0;
+    Gia_ManForEachObj1( p, pObj, iObj )
+    {
+        if ( Gia_ObjIsCi(pObj) )
+            pFinal[1 + iCi++] = Gia_ManAppendCi( pNew );
+        else if ( Gia_ObjIsCo(pObj) )
+            Gia_ManAppendCo( pNew, Gia_DupParFinalLit(pFinal, Abc_LitNotCond(pPar->pProxy[Gia_ObjFaninId0p(p, pObj)], Gia_ObjFaninC0(pObj))) );
+        else if ( pPar->pLits[2*iObj] != -1 )
+        {
+            iClass = Gia_DupParClass( pPar, pPar->pProxy[iObj] );
+            if ( pPar->pMinId[iClass] == iObj && pUsed[iClass] )
+                pFinal[Gia_DupParHandle(pPar, iClass)] = Gia_ManAppendAnd( pNew, Gia_DupParFinalLit(pFinal, pPar->pLits[2*iObj]), Gia_DupParFinalLit(pFinal, pPar->pLits[2*iObj+1]) );
+        }
+    }
+    ABC_FREE( pFinal );
+    ABC_FREE( pUsed );
+    ABC_FREE( pPar->pProxy );
+    ABC_FREE( pPar->pLits );
+    ABC_FREE( pPar->pMinId );
+    ABC_FREE( pPar );
+    Gia_ManSetRegNum( pNew, Gia_ManRegNum(p) );
+    return pNew;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
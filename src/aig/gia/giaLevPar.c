@@ -0,0 +1,355 @@
+/**CFile****************************************************************
+
+  FileName    [giaLevPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Level-parallel traversal of the AND nodes.]
+
+  Author      [agent]
+
+  Date        [Ver. 1.0. Started - October 16, 2026.]
+
+  Revision    [$Id: giaLevPar.c,v 1.00 2026/10/16 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "gia.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
+#ifdef _MSC_VER
+#include <windows.h>
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The AND nodes are ordered by level, where the level of a node with
+// a choice is also larger than the level of its sibling, so that the
+// data of the fanins and the siblings of a node are ready when the node
+// is visited. A wide band contains one level, whose nodes are handed out
+// to the threads in small chunks. Consecutive narrow levels are merged
+// into one band visited by the first thread, because splitting them does
+// not pay off. Before each band, the last thread arriving at the barrier
+// calls the synchronization callback while the other threads wait.
+
+struct Gia_LevPar_t_
+{
+    Gia_Man_t *    pGia;       // the manager
+    int            nThreads;   // the number of threads
+    Vec_Int_t *    vOrder;     // the AND nodes ordered by level
+    Vec_Int_t *    vBands;     // the first node of each band (the last entry is the size of vOrder)
+    Vec_Int_t *    vWide;      // the flag that the band is split between the threads
+    int            nWide;      // the number of wide bands
+    // current task
+    Gia_LevParFunc_t pFunc;    // the node callback
+    Gia_LevParSync_t pSync;    // the band callback
+    void *         pMan;       // the user's manager
+    volatile int   iNext;      // the next node of the current band to visit
+    // thread synchronization
+    int            nArrived;   // the number of threads waiting at the barrier
+    int            fSense;     // the barrier phase
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t Mutex;     // the lock protecting the shared data of the user
+    pthread_mutex_t MutexBar;  // the lock of the barrier
+    pthread_cond_t  CondBar;   // the condition of the barrier
+#endif
+};
+
+typedef struct Gia_LevParThData_t_ Gia_LevParThData_t;
+struct Gia_LevParThData_t_
+{
+    Gia_LevPar_t * p;
+    int            iThread;
+};
+
+#ifdef _MSC_VER
+#define GIA_LEV_ADD32( p, Add )   ((int)InterlockedExchangeAdd((volatile LONG *)(p), (LONG)(Add)) + (Add))
+#else
+#define GIA_LEV_ADD32( p, Add )   __sync_add_and_fetch( (p), (Add) )
+#endif
+
+#define GIA_LEV_THR_MAX  64
+#define GIA_LEV_CHUNK    64       // the number of nodes handed out to a thread at a time
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Waits until all threads finish the current band.]
+
+  Description [The last thread to arrive prepares the next band.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifdef ABC_USE_PTHREADS
+static void Gia_LevParWait( Gia_LevPar_t * p, int iBandNext )
+{
+    int fSense, iStart, iStop;
+    pthread_mutex_lock( &p->MutexBar );
+    fSense = p->fSense;
+    if ( ++p->nArrived == p->nThreads )
+    {
+        iStart = Vec_IntEntry( p->vBands, iBandNext );
+        iStop  = Vec_IntEntry( p->vBands, iBandNext+1 );
+        if ( p->pSync )
+            p->pSync( p->pMan, iStop - iStart );
+        p->iNext    = iStart;
+        p->nArrived = 0;
+        p->fSense   = !fSense;
+        pthread_cond_broadcast( &p->CondBar );
+    }
+    else while ( p->fSense == fSense )
+        pthread_cond_wait( &p->CondBar, &p->MutexBar );
+    pthread_mutex_unlock( &p->MutexBar );
+}
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Visits the part of each band assigned to one thread.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifdef ABC_USE_PTHREADS
+static void * Gia_LevParThread( void * pArg )
+{
+    Gia_LevParThData_t * pData = (Gia_LevParThData_t *)pArg;
+    Gia_LevPar_t * p = pData->p;
+    int b, k, iStart, iStop, nBands = Vec_IntSize(p->vWide);
+    for ( b = 0; b < nBands; b++ )
+    {
+        iStop = Vec_IntEntry( p->vBands, b+1 );
+        if ( Vec_IntEntry(p->vWide, b) )
+        {
+            while ( (iStart = GIA_LEV_ADD32(&p->iNext, GIA_LEV_CHUNK) - GIA_LEV_CHUNK) < iStop )
+                for ( k = iStart; k < Abc_MinInt(iStart + GIA_LEV_CHUNK, iStop); k++ )
+                    p->pFunc( p->pMan, pData->iThread, Vec_IntEntry(p->vOrder, k) );
+        }
+        else if ( pData->iThread == 0 )
+        {
+            for ( k = Vec_IntEntry(p->vBands, b); k < iStop; k++ )
+                p->pFunc( p->pMan, 0, Vec_IntEntry(p->vOrder, k) );
+        }
+        if ( b < nBands - 1 )
+            Gia_LevParWait( p, b+1 );
+    }
+    return NULL;
+}
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Prepares the level order for the parallel traversal.]
+
+  Description [All AND nodes, including buffers, are visited. A level
+  is split between the threads if it has at least nWideMin nodes per 
+  thread.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_LevPar_t * Gia_LevParStart( Gia_Man_t * pGia, int nThreads, int nWideMin )
+{
+    Gia_LevPar_t * p;
+    Gia_Obj_t * pObj;
+    Vec_Int_t * vLevels, * vCounts;
+    int i, k, Level, LevelMax = 0;
+    p = ABC_CALLOC( Gia_LevPar_t, 1 );
+    p->pGia     = pGia;
+    p->nThreads = Abc_MaxInt( 1, Abc_MinInt(nThreads, GIA_LEV_THR_MAX) );
+#ifndef ABC_USE_PTHREADS
+    p->nThreads = 1;
+#else
+    pthread_mutex_init( &p->Mutex, NULL );
+    pthread_mutex_init( &p->MutexBar, NULL );
+    pthread_cond_init( &p->CondBar, NULL );
+#endif
+    // compute levels and count the nodes on each level
+    vLevels = Vec_IntStart( Gia_ManObjNum(pGia) );
+    Gia_ManForEachAnd( pGia, pObj, i )
+    {
+        Level = Abc_MaxInt( Vec_IntEntry(vLevels, Gia_ObjFaninId0(pObj, i)), Vec_IntEntry(vLevels, Gia_ObjFaninId1(pObj, i)) );
+        if ( Gia_ObjIsMuxId(pGia, i) )
+            Level = Abc_MaxInt( Level, Vec_IntEntry(vLevels, Gia_ObjFaninId2(pGia, i)) );
+        if ( Gia_ObjSibl(pGia, i) )
+        {
+            assert( Gia_ObjSibl(pGia, i) < i );
+            Level = Abc_MaxInt( Level, Vec_IntEntry(vLevels, Gia_ObjSibl(pGia, i)) );
+        }
+        Vec_IntWriteEntry( vLevels, i, ++Level );
+        LevelMax = Abc_MaxInt( LevelMax, Level );
+    }
+    vCounts = Vec_IntStart( LevelMax + 2 );
+    Gia_ManForEachAnd( pGia, pObj, i )
+        Vec_IntAddToEntry( vCounts, Vec_IntEntry(vLevels, i) + 1, 1 );
+    for ( k = 1; k <= LevelMax + 1; k++ )
+        Vec_IntAddToEntry( vCounts, k, Vec_IntEntry(vCounts, k-1) );
+    // order the nodes by level (the level of an AND node is at least 1)
+    p->vOrder = Vec_IntStart( Gia_ManAndNum(pGia) );
+    Gia_ManForEachAnd( pGia, pObj, i )
+    {
+        Level = Vec_IntEntry( vLevels, i );
+        Vec_IntWriteEntry( p->vOrder, Vec_IntEntry(vCounts, Level), i );
+        Vec_IntAddToEntry( vCounts, Level, 1 );
+    }
+    // after the loop above, entry k is the end of level k
+    p->vBands = Vec_IntAlloc( 100 );
+    p->vWide  = Vec_IntAlloc( 100 );
+    nWideMin  = p->nThreads > 1 ? p->nThreads * nWideMin : ABC_INFINITY;
+    Vec_IntPush( p->vBands, 0 );
+    for ( k = 1; k <= LevelMax; k++ )
+    {
+        int iStart = Vec_IntEntry( vCounts, k-1 );
+        int iStop  = Vec_IntEntry( vCounts, k );
+        int fWide  = iStop - iStart >= nWideMin;
+        if ( !fWide && Vec_IntSize(p->vWide) > 0 && !Vec_IntEntryLast(p->vWide) )
+        {
+            Vec_IntWriteEntry( p->vBands, Vec_IntSize(p->vBands)-1, iStop );
+            continue;
+        }
+        Vec_IntPush( p->vBands, iStop );
+        Vec_IntPush( p->vWide, fWide );
+        p->nWide += fWide;
+    }
+    assert( Vec_IntEntryLast(p->vBands) == Vec_IntSize(p->vOrder) );
+    Vec_IntFree( vLevels );
+    Vec_IntFree( vCounts );
+    return p;
+}
+void Gia_LevParStop( Gia_LevPar_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_destroy( &p->Mutex );
+    pthread_mutex_destroy( &p->MutexBar );
+    pthread_cond_destroy( &p->CondBar );
+#endif
+    Vec_IntFree( p->vOrder );
+    Vec_IntFree( p->vBands );
+    Vec_IntFree( p->vWide );
+    ABC_FREE( p );
+}
+int Gia_LevParThreadNum( Gia_LevPar_t * p )
+{
+    return p->nWide > 0 ? p->nThreads : 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Protects the shared data of the user.]
+
+  Description [Should be used sparingly, for example, when a new truth
+  table is added to the hash table, or when a new memory page is added.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_LevParLock( Gia_LevPar_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_lock( &p->Mutex );
+#endif
+}
+void Gia_LevParUnlock( Gia_LevPar_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_unlock( &p->Mutex );
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Visits the AND nodes in a topological order.]
+
+  Description [Calls pFunc for each AND node. The calls for the nodes
+  on the same wide level are made from different threads, with the thread
+  number (0 <= iThread < Gia_LevParThreadNum()) passed to the callback,
+  which is expected to keep its temporary data separately for each thread.
+  If pSync is given, it is called without concurrent node callbacks before
+  each band with the number of nodes in the band, and once at the end
+  with zero nodes.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_LevParRun( Gia_LevPar_t * p, Gia_LevParFunc_t pFunc, Gia_LevParSync_t pSync, void * pMan )
+{
+    int i, iObj;
+    assert( Gia_ManAndNum(p->pGia) == Vec_IntSize(p->vOrder) );
+    p->pFunc    = pFunc;
+    p->pSync    = pSync;
+    p->pMan     = pMan;
+    p->iNext    = 0;
+    p->nArrived = 0;
+#ifdef ABC_USE_PTHREADS
+    if ( p->nThreads > 1 && p->nWide > 0 )
+    {
+        Gia_LevParThData_t ThData[GIA_LEV_THR_MAX];
+        pthread_t WorkerThread[GIA_LEV_THR_MAX];
+        int status;
+        if ( pSync )
+            pSync( pMan, Vec_IntEntry(p->vBands, 1) );
+        for ( i = 0; i < p->nThreads; i++ )
+        {
+            ThData[i].p       = p;
+            ThData[i].iThread = i;
+        }
+        for ( i = 1; i < p->nThreads; i++ )
+        {
+            status = pthread_create( WorkerThread + i, NULL, Gia_LevParThread, (void *)(ThData + i) );
+            assert( status == 0 );
+        }
+        Gia_LevParThread( (void *)ThData );
+        for ( i = 1; i < p->nThreads; i++ )
+            pthread_join( WorkerThread[i], NULL );
+        if ( pSync )
+            pSync( pMan, 0 );
+        return;
+    }
+#endif
+    if ( pSync )
+        pSync( pMan, Vec_IntSize(p->vOrder) );
+    Vec_IntForEachEntry( p->vOrder, iObj, i )
+        pFunc( pMan, 0, iObj );
+    if ( pSync )
+        pSync( pMan, 0 );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -24,6 +24,10 @@
 #include "misc/vec/vecMem.h"
 #include "misc/util/utilTruth.h"
 
+#ifdef _MSC_VER
+#include <windows.h>
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
@@ -37,6 +41,13 @@ ABC_NAMESPACE_IMPL_START
 #define LF_CUT_WORDS (4+LF_LEAF_MAX/2)
 #define LF_TT_WORDS  ((LF_LEAF_MAX > 6) ? 1 << (LF_LEAF_MAX-6) : 1)
 #define LF_EPSILON 0.005
+#define LF_PROC_MAX   64
+
+#ifdef _MSC_VER
+#define LF_ADD32( p, Add )   ((int)InterlockedExchangeAdd((volatile LONG *)(p), (LONG)(Add)) + (Add))
+#else
+#define LF_ADD32( p, Add )   __sync_add_and_fetch( (p), (Add) )
+#endif
 
 typedef struct Lf_Cut_t_ Lf_Cut_t; 
 struct Lf_Cut_t_
@@ -74,6 +85,15 @@ struct Lf_Mem_t_
     Vec_Ptr_t       vPages;          // memory pages
     Vec_Ptr_t *     vFree;           // free pages 
 };
+typedef struct Lf_Thr_t_ Lf_Thr_t; 
+struct Lf_Thr_t_
+{
+    Vec_Int_t       vFreeSets;       // cutsets released by this thread
+    double          CutCount[4];     // cut counts
+    int             nTimeFails;      // timing fails
+    int             nCutEqual;       // equal two cuts
+    int             nCutCounts[LF_LEAF_MAX+1];
+};
 typedef struct Lf_Man_t_ Lf_Man_t; 
 struct Lf_Man_t_
 {
@@ -98,6 +118,10 @@ struct Lf_Man_t_
     Vec_Int_t       vMapRefs;        // mapping refs
     Vec_Flt_t       vSwitches;       // switching activity
     Vec_Int_t       vCiArrivals;     // arrival times of the CIs
+    // parallel cut computation
+    Gia_LevPar_t *  pPar;            // level-parallel traversal
+    Lf_Thr_t *      pThrs;           // per-thread data
+    int             fOldUnord;       // old cuts are not stored in the object order
     // statistics
     abctime         clkStart;        // starting time
     double          CutCount[4];     // cut counts
@@ -361,7 +385,7 @@ static inline int Lf_CutCreateUnit( Lf_Cut_t * p, int i )
     p->Sign = ((word)1) << (i & 0x3F);
     return 1;
 }
-static inline Lf_Cut_t * Lf_ManFetchSet( Lf_Man_t * p, int i )
+static inline Lf_Cut_t * Lf_ManFetchSet( Lf_Man_t * p, Lf_Thr_t * pThr, int i )
 {
     int uMaskPage = (1 << LF_LOG_PAGE) - 1;
     Gia_Obj_t * pObj = Gia_ManObj( p->pGia, i );
@@ -371,10 +395,13 @@ static inline Lf_Cut_t * Lf_ManFetchSet( Lf_Man_t * p, int i )
     assert( pObj->Value > 0 );
     if ( Entry == -1 ) // first visit
     {
+        if ( pThr )
+            Gia_LevParLock( p->pPar );
         if ( Vec_IntSize(&p->vFreeSets) == 0 ) // add new
         {
             Lf_Cut_t * pCut = (Lf_Cut_t *)ABC_CALLOC( word, p->nSetWords * (1 << LF_LOG_PAGE) );
             int uMaskShift = Vec_PtrSize(&p->vMemSets) << LF_LOG_PAGE;
+            assert( Vec_PtrSize(&p->vMemSets) < p->vMemSets.nCap || !pThr );
             Vec_PtrPush( &p->vMemSets, pCut );
             for ( Entry = uMaskPage; Entry >= 0; Entry-- )
             {
@@ -385,23 +412,25 @@ static inline Lf_Cut_t * Lf_ManFetchSet( Lf_Man_t * p, int i )
         Entry = Vec_IntPop( &p->vFreeSets );
         Vec_IntWriteEntry( &p->vCutSets, iOffSet, Entry );
         p->nFrontMax = Abc_MaxInt( p->nFrontMax, Entry + 1 );
+        if ( pThr )
+            Gia_LevParUnlock( p->pPar );
     }
-    else if ( --pObj->Value == 0 )
+    else if ( (pThr ? LF_ADD32(&pObj->Value, -1) : --pObj->Value) == 0 )
     {
-        Vec_IntPush( &p->vFreeSets, Entry );
+        // with several threads, the cutset is released after the current level
+        Vec_IntPush( pThr ? &pThr->vFreeSets : &p->vFreeSets, Entry );
         Vec_IntWriteEntry( &p->vCutSets, iOffSet, -1 );
     }
     return (Lf_Cut_t *)((word *)Vec_PtrEntry(&p->vMemSets, Entry >> LF_LOG_PAGE) + p->nSetWords * (Entry & uMaskPage));
 }
-static inline int Lf_ManPrepareSet( Lf_Man_t * p, int iObj, int Index, Lf_Cut_t ** ppCutSet )
+static inline int Lf_ManPrepareSet( Lf_Man_t * p, Lf_Thr_t * pThr, int iObj, word * pCutTemp, Lf_Cut_t ** ppCutSet )
 {
-    static word CutTemp[3][LF_CUT_WORDS];
     if ( Vec_IntEntry(&p->vOffsets, iObj) == -1 )
-        return Lf_CutCreateUnit( (*ppCutSet = (Lf_Cut_t *)CutTemp[Index]), iObj );
+        return Lf_CutCreateUnit( (*ppCutSet = (Lf_Cut_t *)pCutTemp), iObj );
     {
         Lf_Cut_t * pCut; 
         int i, nCutNum = p->pPars->nCutNum;
-        *ppCutSet = Lf_ManFetchSet(p, iObj);
+        *ppCutSet = Lf_ManFetchSet(p, pThr, iObj);
         Lf_CutSetForEachCut( p->nCutWords, *ppCutSet, pCut, i, nCutNum )
             if ( pCut->nLeaves == LF_NO_LEAF )
                 return i;
@@ -961,6 +990,16 @@ static inline int Lf_ManFindCofVar( word * pTruth, int nWords, int nVars )
   SeeAlso     []
 
 ***********************************************************************/
+static inline int Lf_ManInsertTruth( Lf_Man_t * p, word * pTruth )
+{
+    int truthId;
+    if ( p->pPar == NULL )
+        return Vec_MemHashInsert( p->vTtMem, pTruth );
+    Gia_LevParLock( p->pPar );
+    truthId = Vec_MemHashInsert( p->vTtMem, pTruth );
+    Gia_LevParUnlock( p->pPar );
+    return truthId;
+}
 static inline int Lf_CutComputeTruth6( Lf_Man_t * p, Lf_Cut_t * pCut0, Lf_Cut_t * pCut1, int fCompl0, int fCompl1, Lf_Cut_t * pCutR, int fIsXor )
 {
 //    extern int Mf_ManTruthCanonicize( word * t, int nVars );
@@ -975,7 +1014,7 @@ static inline int Lf_CutComputeTruth6( Lf_Man_t * p, Lf_Cut_t * pCut0, Lf_Cut_t
     if ( (fCompl = (int)(t & 1)) ) t = ~t;
     pCutR->nLeaves = Abc_Tt6MinBase( &t, pCutR->pLeaves, pCutR->nLeaves );
     assert( (int)(t & 1) == 0 );
-    truthId        = Vec_MemHashInsert(p->vTtMem, &t);
+    truthId        = Lf_ManInsertTruth(p, &t);
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
 //    p->nCutMux += Lf_ManTtIsMux( t );
     assert( (int)pCutR->nLeaves <= nOldSupp );
@@ -1004,7 +1043,7 @@ static inline int Lf_CutComputeTruth( Lf_Man_t * p, Lf_Cut_t * pCut0, Lf_Cut_t *
     pCutR->nLeaves = Abc_TtMinBase( uTruth, pCutR->pLeaves, pCutR->nLeaves, LutSize );
     assert( (uTruth[0] & 1) == 0 );
 //Kit_DsdPrintFromTruth( uTruth, pCutR->nLeaves ), printf("\n" ), printf("\n" );
-    truthId        = Vec_MemHashInsert(p->vTtMem, uTruth);
+    truthId        = Lf_ManInsertTruth(p, uTruth);
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
     assert( (int)pCutR->nLeaves <= nOldSupp );
     return (int)pCutR->nLeaves < nOldSupp;
@@ -1026,7 +1065,7 @@ static inline int Lf_CutComputeTruthMux6( Lf_Man_t * p, Lf_Cut_t * pCut0, Lf_Cut
     if ( (fCompl = (int)(t & 1)) ) t = ~t;
     pCutR->nLeaves = Abc_Tt6MinBase( &t, pCutR->pLeaves, pCutR->nLeaves );
     assert( (int)(t & 1) == 0 );
-    truthId        = Vec_MemHashInsert(p->vTtMem, &t);
+    truthId        = Lf_ManInsertTruth(p, &t);
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
     assert( (int)pCutR->nLeaves <= nOldSupp );
     return (int)pCutR->nLeaves < nOldSupp;
@@ -1054,7 +1093,7 @@ static inline int Lf_CutComputeTruthMux( Lf_Man_t * p, Lf_Cut_t * pCut0, Lf_Cut_
     if ( fCompl ) Abc_TtNot( uTruth, nWords );
     pCutR->nLeaves = Abc_TtMinBase( uTruth, pCutR->pLeaves, pCutR->nLeaves, LutSize );
     assert( (uTruth[0] & 1) == 0 );
-    truthId        = Vec_MemHashInsert(p->vTtMem, uTruth);
+    truthId        = Lf_ManInsertTruth(p, uTruth);
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
     assert( (int)pCutR->nLeaves <= nOldSupp );
     return (int)pCutR->nLeaves < nOldSupp;
@@ -1183,9 +1222,10 @@ static inline void Lf_CutParams( Lf_Man_t * p, Lf_Cut_t * pCut, int Required, fl
     }
 }
 
-void Lf_ObjMergeOrder( Lf_Man_t * p, int iObj )
+void Lf_ObjMergeOrder( Lf_Man_t * p, Lf_Thr_t * pThr, int iObj )
 {
     word CutSet[LF_CUT_MAX][LF_CUT_WORDS] = {{0}};
+    word CutTemp[3][LF_CUT_WORDS] = {{0}};
     Lf_Cut_t * pCutSet0, * pCutSet1, * pCutSet2, * pCut0, * pCut1, * pCut2;
     Lf_Cut_t * pCutSet = (Lf_Cut_t *)CutSet, * pCutsR[LF_CUT_MAX];
     Gia_Obj_t * pObj = Gia_ManObj(p->pGia, iObj);
@@ -1197,21 +1237,32 @@ void Lf_ObjMergeOrder( Lf_Man_t * p, int iObj )
     int nCutWords  = p->nCutWords;
     int fComp0     = Gia_ObjFaninC0(pObj);
     int fComp1     = Gia_ObjFaninC1(pObj);
-    int nCuts0     = Lf_ManPrepareSet( p, Gia_ObjFaninId0(pObj, iObj), 0, &pCutSet0 );
-    int nCuts1     = Lf_ManPrepareSet( p, Gia_ObjFaninId1(pObj, iObj), 1, &pCutSet1 );
+    int nCuts0     = Lf_ManPrepareSet( p, pThr, Gia_ObjFaninId0(pObj, iObj), CutTemp[0], &pCutSet0 );
+    int nCuts1     = Lf_ManPrepareSet( p, pThr, Gia_ObjFaninId1(pObj, iObj), CutTemp[1], &pCutSet1 );
     int iSibl      = Gia_ObjSibl(p->pGia, iObj);
     int i, k, n, iCutUsed, nCutsR = 0;
     float Value1 = -1, Value2 = -1;
+    double * CutCount = pThr ? pThr->CutCount : p->CutCount;
+    int * nCutCounts  = pThr ? pThr->nCutCounts : p->nCutCounts;
     assert( !Gia_ObjIsBuf(pObj) );
+    assert( !pThr || !p->fUseEla );
     Lf_CutSetForEachCut( nCutWords, pCutSet, pCut0, i, nCutNum )
         pCutsR[i] = pCut0;
     if ( p->Iter )
     {
+        // the pages are recycled after the traversal if the cuts were not saved in the object order
+        int fRecycle = pThr == NULL && !p->fOldUnord;
         assert( nCutsR == 0 );
         // load cuts
-        Lf_MemLoadCut( &p->vStoreOld, pBest->Cut[0].Handle, iObj, pCutsR[0], p->pPars->fCutMin, 1 );
+        Lf_MemLoadCut( &p->vStoreOld, pBest->Cut[0].Handle, iObj, pCutsR[0], p->pPars->fCutMin, fRecycle );
         if ( Lf_BestDiffCuts(pBest) )
-            Lf_MemLoadCut( &p->vStoreOld, pBest->Cut[1].Handle, iObj, pCutsR[1], p->pPars->fCutMin, 1 );
+            Lf_MemLoadCut( &p->vStoreOld, pBest->Cut[1].Handle, iObj, pCutsR[1], p->pPars->fCutMin, fRecycle );
+        if ( !fRecycle )
+        {
+            pCutsR[0]->Sign = Lf_CutGetSign( pCutsR[0] );
+            if ( Lf_BestDiffCuts(pBest) )
+                pCutsR[1]->Sign = Lf_CutGetSign( pCutsR[1] );
+        }
         // deref the cut
         if ( p->fUseEla && Lf_ObjMapRefNum(p, iObj) > 0 )
             Value1 = Lf_CutDeref_rec( p, pCutsR[Lf_BestIndex(pBest)] );
@@ -1227,13 +1278,13 @@ void Lf_ObjMergeOrder( Lf_Man_t * p, int iObj )
             nCutsR = Lf_SetAddCut( pCutsR, nCutsR, nCutNum );
         }
         if ( pCutsR[0]->fLate )
-            p->nTimeFails++;
+            (*(pThr ? &pThr->nTimeFails : &p->nTimeFails))++;
     }
     if ( iSibl )
     {
         Gia_Obj_t * pObjE = Gia_ObjSiblObj(p->pGia, iObj);
         int fCompE = Gia_ObjPhase(pObj) ^ Gia_ObjPhase(pObjE);
-        int nCutsE = Lf_ManPrepareSet( p, iSibl, 2, &pCutSet2 );
+        int nCutsE = Lf_ManPrepareSet( p, pThr, iSibl, CutTemp[2], &pCutSet2 );
         Lf_CutSetForEachCut( nCutWords, pCutSet2, pCut2, n, nCutsE )
         {
             if ( pCut2->pLeaves[0] == iSibl )
@@ -1249,8 +1300,8 @@ void Lf_ObjMergeOrder( Lf_Man_t * p, int iObj )
     {
         Lf_Cut_t * pCutSave = NULL;
         int fComp2 = Gia_ObjFaninC2(p->pGia, pObj);
-        int nCuts2 = Lf_ManPrepareSet( p, Gia_ObjFaninId2(p->pGia, iObj), 2, &pCutSet2 );
-        p->CutCount[0] += nCuts0 * nCuts1 * nCuts2;
+        int nCuts2 = Lf_ManPrepareSet( p, pThr, Gia_ObjFaninId2(p->pGia, iObj), CutTemp[2], &pCutSet2 );
+        CutCount[0] += nCuts0 * nCuts1 * nCuts2;
         Lf_CutSetForEachCut( nCutWords, pCutSet0, pCut0, i, nCuts0 ) if ( (int)pCut0->nLeaves <= nLutSize )
         Lf_CutSetForEachCut( nCutWords, pCutSet1, pCut1, k, nCuts1 ) if ( (int)pCut1->nLeaves <= nLutSize )
         Lf_CutSetForEachCut( nCutWords, pCutSet2, pCut2, n, nCuts2 ) if ( (int)pCut2->nLeaves <= nLutSize )
@@ -1258,12 +1309,12 @@ void Lf_ObjMergeOrder( Lf_Man_t * p, int iObj )
             pCutSave = pCut2;
             if ( Lf_CutCountBits(pCut0->Sign | pCut1->Sign | pCut2->Sign) > nLutSize )
                 continue;
-            p->CutCount[1]++; 
+            CutCount[1]++; 
             if ( !Lf_CutMergeOrderMux(pCut0, pCut1, pCut2, pCutsR[nCutsR], nLutSize) )
                 continue;
             if ( Lf_SetLastCutIsContained(pCutsR, nCutsR) )
                 continue;
-            p->CutCount[2]++;
+            CutCount[2]++;
             if ( p->pPars->fCutMin && Lf_CutComputeTruthMux(p, pCut0, pCut1, pCut2, fComp0, fComp1, fComp2, pCutsR[nCutsR]) )
                 pCutsR[nCutsR]->Sign = Lf_CutGetSign(pCutsR[nCutsR]);
             if ( p->pPars->nLutSizeMux && p->pPars->nLutSizeMux == (int)pCutsR[nCutsR]->nLeaves && 
@@ -1282,12 +1333,12 @@ void Lf_ObjMergeOrder( Lf_Man_t * p, int iObj )
                 assert( (int)pCut0->nLeaves + (int)pCut1->nLeaves + 1 <= p->pPars->nLutSize );
     //            if ( Lf_CutCountBits(pCut0->Sign | pCut1->Sign | pCutSave->Sign) > p->pPars->nLutSize )
     //                continue;
-                p->CutCount[1]++; 
+                CutCount[1]++; 
                 if ( !Lf_CutMergeOrderMux(pCut0, pCut1, pCutSave, pCutsR[nCutsR], p->pPars->nLutSize) )
                     continue;
                 if ( Lf_SetLastCutIsContained(pCutsR, nCutsR) )
                     continue;
-                p->CutCount[2]++;
+                CutCount[2]++;
                 if ( p->pPars->fCutMin && Lf_CutComputeTruthMux(p, pCut0, pCut1, pCutSave, fComp0, fComp1, fComp2, pCutsR[nCutsR]) )
                     pCutsR[nCutsR]->Sign = Lf_CutGetSign(pCutsR[nCutsR]);
     //            if ( p->pPars->nLutSizeMux && p->pPars->nLutSizeMux == (int)pCutsR[nCutsR]->nLeaves && 
@@ -1301,18 +1352,18 @@ void Lf_ObjMergeOrder( Lf_Man_t * p, int iObj )
     else
     {
         int fIsXor = Gia_ObjIsXor(pObj);
-        p->CutCount[0] += nCuts0 * nCuts1;
+        CutCount[0] += nCuts0 * nCuts1;
         Lf_CutSetForEachCut( nCutWords, pCutSet0, pCut0, i, nCuts0 ) if ( (int)pCut0->nLeaves <= nLutSize )
         Lf_CutSetForEachCut( nCutWords, pCutSet1, pCut1, k, nCuts1 ) if ( (int)pCut1->nLeaves <= nLutSize )
         {
             if ( (int)(pCut0->nLeaves + pCut1->nLeaves) > nLutSize && Lf_CutCountBits(pCut0->Sign | pCut1->Sign) > nLutSize )
                 continue;
-            p->CutCount[1]++; 
+            CutCount[1]++; 
             if ( !Lf_CutMergeOrder(pCut0, pCut1, pCutsR[nCutsR], nLutSize) )
                 continue;
             if ( Lf_SetLastCutIsContained(pCutsR, nCutsR) )
                 continue;
-            p->CutCount[2]++;
+            CutCount[2]++;
             if ( p->pPars->fCutMin && Lf_CutComputeTruth(p, pCut0, pCut1, fComp0, fComp1, pCutsR[nCutsR], fIsXor) )
                 pCutsR[nCutsR]->Sign = Lf_CutGetSign(pCutsR[nCutsR]);
             if ( p->pPars->nLutSizeMux && p->pPars->nLutSizeMux == (int)pCutsR[nCutsR]->nLeaves && 
@@ -1336,12 +1387,14 @@ void Lf_ObjMergeOrder( Lf_Man_t * p, int iObj )
     // delay cut
     assert( nCutsR == 1 || pCutsR[0]->Delay <= pCutsR[1]->Delay );
     pBest->Cut[0].fUsed = pBest->Cut[1].fUsed = 0;
+    if ( pThr )
+        Gia_LevParLock( p->pPar );
     pBest->Cut[0].Handle = pBest->Cut[1].Handle = Lf_MemSaveCut(&p->vStoreNew, pCutsR[0], iObj);
     pBest->Delay[0] = pBest->Delay[1] = pCutsR[0]->Delay;
     pBest->Flow[0] = pBest->Flow[1] = pCutsR[0]->Flow;
-    p->nCutCounts[pCutsR[0]->nLeaves]++;
-    p->CutCount[3] += nCutsR;
-    p->nCutEqual++;
+    nCutCounts[pCutsR[0]->nLeaves]++;
+    CutCount[3] += nCutsR;
+    (*(pThr ? &pThr->nCutEqual : &p->nCutEqual))++;
     // area cut
     iCutUsed = 0;
     if ( nCutsR > 1 && pCutsR[0]->Flow > pCutsR[1]->Flow + LF_EPSILON )//&& !pCutsR[1]->fLate ) // can remove !fLate
@@ -1349,15 +1402,17 @@ void Lf_ObjMergeOrder( Lf_Man_t * p, int iObj )
         pBest->Cut[1].Handle = Lf_MemSaveCut(&p->vStoreNew, pCutsR[1], iObj);
         pBest->Delay[1] = pCutsR[1]->Delay;
         pBest->Flow[1] = pCutsR[1]->Flow;
-        p->nCutCounts[pCutsR[1]->nLeaves]++;
-        p->nCutEqual--;
+        nCutCounts[pCutsR[1]->nLeaves]++;
+        (*(pThr ? &pThr->nCutEqual : &p->nCutEqual))--;
         if ( !pCutsR[1]->fLate )
             iCutUsed = 1;
     }
+    if ( pThr )
+        Gia_LevParUnlock( p->pPar );
     // mux cut
     if ( p->pPars->fUseMux7 && Gia_ObjIsMuxId(p->pGia, iObj) )
     {
-        pCut2 = Lf_ObjCutMux( p, iObj );
+        pCut2 = pThr ? Lf_MemLoadMuxCut( p, iObj, (Lf_Cut_t *)CutTemp[2] ) : Lf_ObjCutMux( p, iObj );
         Lf_CutParams( p, pCut2, Required, FlowRefs, pObj );
         pBest->Delay[2] = pCut2->Delay;
         pBest->Flow[2] = pCut2->Flow;
@@ -1380,7 +1435,7 @@ void Lf_ObjMergeOrder( Lf_Man_t * p, int iObj )
     if ( pObj->Value == 0 )
         return;
     // store the cutset
-    pCutSet = Lf_ManFetchSet(p, iObj);
+    pCutSet = Lf_ManFetchSet(p, pThr, iObj);
     Lf_CutSetForEachCut( nCutWords, pCutSet, pCut0, i, nCutNum )
     {
         assert( !pCut0->fMux7 );
@@ -1976,16 +2031,37 @@ Lf_Man_t * Lf_ManAlloc( Gia_Man_t * pGia, Jf_Par_t * pPars )
     if ( pPars->pTimesArr )
         for ( i = 0; i < Gia_ManPiNum(pGia); i++ )
             Vec_IntWriteEntry( &p->vCiArrivals, i, pPars->pTimesArr[i] );
+    if ( pPars->nProcNum > 1 && pGia->pManTime == NULL )
+    {
+        p->pPar = Gia_LevParStart( pGia, pPars->nProcNum, 64 );
+        if ( Gia_LevParThreadNum(p->pPar) > 1 )
+        {
+            // the cutset pages are not reallocated while the threads are running
+            Vec_PtrGrow( &p->vMemSets, Gia_ManAndNotBufNum(pGia) / (1 << LF_LOG_PAGE) + 2 );
+            p->pThrs = ABC_CALLOC( Lf_Thr_t, Gia_LevParThreadNum(p->pPar) );
+            for ( i = 0; i < Gia_LevParThreadNum(p->pPar); i++ )
+                Vec_IntGrow( &p->pThrs[i].vFreeSets, 256 );
+        }
+        else
+            Gia_LevParStop( p->pPar ), p->pPar = NULL;
+    }
     return p;
 }
 void Lf_ManFree( Lf_Man_t * p )
 {
+    int i;
     ABC_FREE( p->pPars->pTimesArr );
     ABC_FREE( p->pPars->pTimesReq );
     if ( p->pPars->fCutMin )
         Vec_MemHashFree( p->vTtMem );
     if ( p->pPars->fCutMin )
         Vec_MemFree( p->vTtMem );
+    if ( p->pThrs )
+        for ( i = 0; i < Gia_LevParThreadNum(p->pPar); i++ )
+            ABC_FREE( p->pThrs[i].vFreeSets.pArray );
+    if ( p->pPar )
+        Gia_LevParStop( p->pPar );
+    ABC_FREE( p->pThrs );
     Vec_PtrFreeData( &p->vMemSets );
     Vec_PtrFreeData( &p->vFreePages );
     Vec_PtrFreeData( &p->vStoreOld.vPages );
@@ -2046,6 +2122,7 @@ void Lf_ManSetDefaultPars( Jf_Par_t * pPars )
     pPars->fVeryVerbose =  0;
     pPars->nLutSizeMax  =  LF_LEAF_MAX;
     pPars->nCutNumMax   =  LF_CUT_MAX;
+    pPars->nProcNumMax  =  LF_PROC_MAX;
 }
 void Lf_ManPrintStats( Lf_Man_t * p, char * pTitle )
 {
@@ -2135,6 +2212,47 @@ void Lf_ManPrintQuit( Lf_Man_t * p, Gia_Man_t * pNew )
     Abc_PrintTime( 1, "Time",    Abc_Clock() - p->clkStart );
     fflush( stdout );
 }
+static void Lf_ObjMergeOrderPar( void * pMan, int iThread, int iObj )
+{
+    Lf_Man_t * p = (Lf_Man_t *)pMan;
+    if ( !Gia_ObjIsBuf(Gia_ManObj(p->pGia, iObj)) )
+        Lf_ObjMergeOrder( p, p->pThrs + iThread, iObj );
+}
+static void Lf_ManComputeCutsSync( void * pMan, int nNodes )
+{
+    Lf_Man_t * p = (Lf_Man_t *)pMan;
+    int i, k, Entry;
+    // return the cutsets released by the threads
+    for ( i = 0; i < Gia_LevParThreadNum(p->pPar); i++ )
+    {
+        Vec_IntForEachEntry( &p->pThrs[i].vFreeSets, Entry, k )
+            Vec_IntPush( &p->vFreeSets, Entry );
+        Vec_IntClear( &p->pThrs[i].vFreeSets );
+    }
+    if ( nNodes == 0 ) // collect statistics
+    {
+        for ( i = 0; i < Gia_LevParThreadNum(p->pPar); i++ )
+        {
+            Lf_Thr_t * pThr = p->pThrs + i;
+            for ( k = 0; k < 4; k++ )
+                p->CutCount[k] += pThr->CutCount[k];
+            for ( k = 0; k <= LF_LEAF_MAX; k++ )
+                p->nCutCounts[k] += pThr->nCutCounts[k];
+            p->nTimeFails += pThr->nTimeFails;
+            p->nCutEqual  += pThr->nCutEqual;
+            memset( pThr->CutCount, 0, sizeof(pThr->CutCount) );
+            memset( pThr->nCutCounts, 0, sizeof(pThr->nCutCounts) );
+            pThr->nTimeFails = pThr->nCutEqual = 0;
+        }
+        return;
+    }
+    // make sure reading truth tables is not affected by adding new ones
+    if ( p->vTtMem )
+    {
+        word nFuncs = (word)nNodes * p->pPars->nCutNum * p->pPars->nCutNum * (p->pGia->pMuxes ? p->pPars->nCutNum : 1);
+        Vec_MemReserve( p->vTtMem, (int)Abc_MinWord(nFuncs + Vec_MemEntryNum(p->vTtMem), 0x7FFFFFFF) );
+    }
+}
 void Lf_ManComputeMapping( Lf_Man_t * p )
 {
     Gia_Obj_t * pObj;
@@ -2150,7 +2268,7 @@ void Lf_ManComputeMapping( Lf_Man_t * p )
             if ( Gia_ObjIsBuf(pObj) )
                 continue;
             if ( Gia_ObjIsAnd(pObj) )
-                Lf_ObjMergeOrder( p, i );
+                Lf_ObjMergeOrder( p, NULL, i );
             else if ( Gia_ObjIsCi(pObj) )
             {
                 arrTime = Tim_ManGetCiArrival( (Tim_Man_t*)p->pGia->pManTime, Gia_ObjCioId(pObj) );
@@ -2165,12 +2283,15 @@ void Lf_ManComputeMapping( Lf_Man_t * p )
         }
 //        Tim_ManPrint( p->pGia->pManTime );
     }
+    else if ( p->pPar && !p->fUseEla )
+        Gia_LevParRun( p->pPar, Lf_ObjMergeOrderPar, Lf_ManComputeCutsSync, p );
     else
     {
         Gia_ManForEachAnd( p->pGia, pObj, i )
             if ( !Gia_ObjIsBuf(pObj) )
-                Lf_ObjMergeOrder( p, i );
+                Lf_ObjMergeOrder( p, NULL, i );
     }
+    p->fOldUnord = p->pPar && !p->fUseEla && p->pGia->pManTime == NULL;
     Lf_MemRecycle( &p->vStoreOld );
     ABC_SWAP( Lf_Mem_t, p->vStoreOld, p->vStoreNew );
     if ( p->fUseEla )
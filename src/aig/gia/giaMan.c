@@ -28,6 +28,10 @@
 #include <windows.h>
 #endif
 
+#ifndef _WIN32
+#include <sys/mman.h>
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -41,6 +45,95 @@ extern void Gia_ManDfsSlacksPrint( Gia_Man_t * p );
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
+/**Function*************************************************************
+
+  Synopsis    [Reserves and releases the arena for objects.]
+
+  Description [The arena is a contiguous range of virtual memory reserved 
+  for several times the requested number of objects. The physical pages are 
+  committed by the OS when they are touched for the first time. As a result, 
+  the array of objects grows in place without copying until the reservation 
+  is exhausted, and Gia_ManObj() remains simple array indexing. Returns NULL 
+  if the arena is not available on this platform. The arena is not used in 
+  32-bit builds, whose address space is too small for the reservation.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_ManObjArenaSize( int nObjsMax )
+{
+    return nObjsMax <= GIA_OBJ_MAX / 4 ? 4 * nObjsMax : GIA_OBJ_MAX;
+}
+static Gia_Obj_t * Gia_ManObjArenaAlloc( int nObjs )
+{
+#ifndef _WIN32
+    int Flags = MAP_PRIVATE | MAP_ANON;
+    void * pArena;
+    if ( sizeof(size_t) < 8 )
+        return NULL;
+#ifdef MAP_NORESERVE
+    Flags |= MAP_NORESERVE;
+#endif
+    pArena = mmap( NULL, sizeof(Gia_Obj_t) * (size_t)nObjs, PROT_READ | PROT_WRITE, Flags, -1, 0 );
+    return pArena == MAP_FAILED ? NULL : (Gia_Obj_t *)pArena;
+#else
+    return NULL;
+#endif
+}
+static void Gia_ManObjArenaFree( Gia_Obj_t * pArena, int nObjs )
+{
+#ifndef _WIN32
+    munmap( (void *)pArena, sizeof(Gia_Obj_t) * (size_t)nObjs );
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Moves the objects of the manager into the arena.]
+
+  Description [Makes sure that the arena can hold nObjsMax objects. If the 
+  manager is not in the arena, or its arena is too small, the objects are 
+  moved into a new arena. Returns 0 if the arena cannot be reserved, in 
+  which case the manager keeps (or moves) the objects in the heap.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManObjArenaStart( Gia_Man_t * p, int nObjsMax )
+{
+    Gia_Obj_t * pArena;
+    int nObjsArena;
+    if ( p->nObjsArena >= nObjsMax )
+        return 1;
+    nObjsArena = Gia_ManObjArenaSize( nObjsMax );
+    pArena = Gia_ManObjArenaAlloc( nObjsArena );
+    if ( pArena == NULL && p->nObjsArena == 0 )
+        return 0;
+    if ( pArena == NULL ) // move the objects back into the heap
+    {
+        pArena = ABC_ALLOC( Gia_Obj_t, p->nObjsAlloc );
+        memcpy( pArena, p->pObjs, sizeof(Gia_Obj_t) * p->nObjsAlloc );
+        Gia_ManObjArenaFree( p->pObjs, p->nObjsArena );
+        p->pObjs = pArena;
+        p->nObjsArena = 0;
+        return 0;
+    }
+    if ( p->fVerbose )
+        printf( "Moving GIA object storage into the arena: %d objects (%d reserved).\n", p->nObjsAlloc, nObjsArena );
+    memcpy( pArena, p->pObjs, sizeof(Gia_Obj_t) * p->nObjsAlloc );
+    if ( p->nObjsArena )
+        Gia_ManObjArenaFree( p->pObjs, p->nObjsArena );
+    else
+        ABC_FREE( p->pObjs );
+    p->pObjs = pArena;
+    p->nObjsArena = nObjsArena;
+    return 1;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Creates AIG.]
@@ -56,9 +149,15 @@ Gia_Man_t * Gia_ManStart( int nObjsMax )
 {
     Gia_Man_t * p;
     assert( nObjsMax > 0 );
+    nObjsMax = Abc_MinInt( nObjsMax, GIA_OBJ_MAX ); // Gia_ManAppendObj() checks the limit when the storage is full
     p = ABC_CALLOC( Gia_Man_t, 1 );
     p->nObjsAlloc = nObjsMax;
-    p->pObjs = ABC_CALLOC( Gia_Obj_t, nObjsMax );
+    if ( nObjsMax >= GIA_ARENA_MIN )
+        p->pObjs = Gia_ManObjArenaAlloc( Gia_ManObjArenaSize(nObjsMax) );
+    if ( p->pObjs )
+        p->nObjsArena = Gia_ManObjArenaSize( nObjsMax );
+    else
+        p->pObjs = ABC_CALLOC( Gia_Obj_t, nObjsMax );
     p->pObjs->iDiff0 = p->pObjs->iDiff1 = GIA_NONE;
     p->nObjs = 1;
     p->vCis  = Vec_IntAlloc( nObjsMax / 20 );
@@ -163,7 +262,10 @@ void Gia_ManStop( Gia_Man_t * p )
     ABC_FREE( p->pRefs );
     ABC_FREE( p->pLutRefs );
     ABC_FREE( p->pMuxes );
-    ABC_FREE( p->pObjs );
+    if ( p->nObjsArena )
+        Gia_ManObjArenaFree( p->pObjs, p->nObjsArena );
+    else
+        ABC_FREE( p->pObjs );
     ABC_FREE( p->pSpec );
     ABC_FREE( p->pName );
     ABC_FREE( p );
@@ -38,6 +38,7 @@ ABC_NAMESPACE_IMPL_START
 #define MF_TT_WORDS  ((MF_LEAF_MAX > 6) ? 1 << (MF_LEAF_MAX-6) : 1)
 #define MF_NO_FUNC    134217727     // (1<<27)-1
 #define MF_EPSILON 0.005
+#define MF_PROC_MAX   64
 
 typedef struct Mf_Cut_t_ Mf_Cut_t; 
 struct Mf_Cut_t_
@@ -58,6 +59,13 @@ struct Mf_Obj_t_
     unsigned        Delay    : 16;  // delay 
     unsigned        nMapRefs : 16;  // map references
 };
+typedef struct Mf_Thr_t_ Mf_Thr_t; 
+struct Mf_Thr_t_
+{
+    int             iCur;           // current position
+    double          CutCount[4];    // cut counts
+    int             nCutCounts[MF_LEAF_MAX+1];
+};
 typedef struct Mf_Man_t_ Mf_Man_t; 
 struct Mf_Man_t_
 {
@@ -75,6 +83,9 @@ struct Mf_Man_t_
     int             iCur;           // current position
     int             Iter;           // mapping iterations
     int             fUseEla;        // use exact area
+    // parallel cut computation
+    Gia_LevPar_t *  pPar;           // level-parallel traversal
+    Mf_Thr_t *      pThrs;          // per-thread data
     // statistics
     abctime         clkStart;       // starting time
     double          CutCount[4];    // cut counts
@@ -540,6 +551,16 @@ Cnf_Dat_t * Mf_ManDeriveCnf( Mf_Man_t * p, int fCnfObjIds, int fAddOrCla )
   SeeAlso     []
 
 ***********************************************************************/
+static inline int Mf_ManInsertTruth( Mf_Man_t * p, word * pTruth )
+{
+    int truthId;
+    if ( p->pPar == NULL )
+        return Vec_MemHashInsert( p->vTtMem, pTruth );
+    Gia_LevParLock( p->pPar );
+    truthId = Vec_MemHashInsert( p->vTtMem, pTruth );
+    Gia_LevParUnlock( p->pPar );
+    return truthId;
+}
 static inline int Mf_CutComputeTruth6( Mf_Man_t * p, Mf_Cut_t * pCut0, Mf_Cut_t * pCut1, int fCompl0, int fCompl1, Mf_Cut_t * pCutR, int fIsXor )
 {
 //    extern int Mf_ManTruthCanonicize( word * t, int nVars );
@@ -555,7 +576,7 @@ static inline int Mf_CutComputeTruth6( Mf_Man_t * p, Mf_Cut_t * pCut0, Mf_Cut_t
     if ( !p->pPars->fCnfObjIds )
     pCutR->nLeaves = Abc_Tt6MinBase( &t, pCutR->pLeaves, pCutR->nLeaves );
     assert( (int)(t & 1) == 0 );
-    truthId        = Vec_MemHashInsert(p->vTtMem, &t);
+    truthId        = Mf_ManInsertTruth(p, &t);
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
     if ( p->pPars->fGenCnf && truthId == Vec_IntSize(&p->vCnfSizes) )
         Vec_IntPush( &p->vCnfSizes, Abc_Tt6CnfSize(t, pCutR->nLeaves) );
@@ -586,7 +607,7 @@ static inline int Mf_CutComputeTruth( Mf_Man_t * p, Mf_Cut_t * pCut0, Mf_Cut_t *
     pCutR->nLeaves = Abc_TtMinBase( uTruth, pCutR->pLeaves, pCutR->nLeaves, LutSize );
     assert( (uTruth[0] & 1) == 0 );
 //Kit_DsdPrintFromTruth( uTruth, pCutR->nLeaves ), printf("\n" ), printf("\n" );
-    truthId        = Vec_MemHashInsert(p->vTtMem, uTruth);
+    truthId        = Mf_ManInsertTruth(p, uTruth);
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
     if ( p->pPars->fGenCnf && truthId == Vec_IntSize(&p->vCnfSizes) && LutSize <= 8 )
         Vec_IntPush( &p->vCnfSizes, Abc_Tt8CnfSize(uTruth, pCutR->nLeaves) );
@@ -610,7 +631,7 @@ static inline int Mf_CutComputeTruthMux6( Mf_Man_t * p, Mf_Cut_t * pCut0, Mf_Cut
     if ( (fCompl = (int)(t & 1)) ) t = ~t;
     pCutR->nLeaves = Abc_Tt6MinBase( &t, pCutR->pLeaves, pCutR->nLeaves );
     assert( (int)(t & 1) == 0 );
-    truthId        = Vec_MemHashInsert(p->vTtMem, &t);
+    truthId        = Mf_ManInsertTruth(p, &t);
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
     if ( p->pPars->fGenCnf && truthId == Vec_IntSize(&p->vCnfSizes) )
         Vec_IntPush( &p->vCnfSizes, Abc_Tt6CnfSize(t, pCutR->nLeaves) );
@@ -640,7 +661,7 @@ static inline int Mf_CutComputeTruthMux( Mf_Man_t * p, Mf_Cut_t * pCut0, Mf_Cut_
     if ( fCompl ) Abc_TtNot( uTruth, nWords );
     pCutR->nLeaves = Abc_TtMinBase( uTruth, pCutR->pLeaves, pCutR->nLeaves, LutSize );
     assert( (uTruth[0] & 1) == 0 );
-    truthId        = Vec_MemHashInsert(p->vTtMem, uTruth);
+    truthId        = Mf_ManInsertTruth(p, uTruth);
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
     if ( p->pPars->fGenCnf && truthId == Vec_IntSize(&p->vCnfSizes) && LutSize <= 8 )
         Vec_IntPush( &p->vCnfSizes, Abc_Tt8CnfSize(uTruth, pCutR->nLeaves) );
@@ -726,16 +747,35 @@ static inline int Mf_ManPrepareCuts( Mf_Cut_t * pCuts, Mf_Man_t * p, int iObj, i
     }
     return Mf_CutCreateUnit( pCuts, iObj );
 }
-static inline int Mf_ManSaveCuts( Mf_Man_t * p, Mf_Cut_t ** pCuts, int nCuts )
+static inline int Mf_ManAddPage( Mf_Man_t * p )
+{
+    // with several threads, each thread fills its own page
+    int iPage;
+    Gia_LevParLock( p->pPar );
+    iPage = Vec_PtrSize( &p->vPages );
+    assert( iPage < p->vPages.nCap );
+    Vec_PtrPush( &p->vPages, ABC_ALLOC(int, (1<<16)) );
+    Gia_LevParUnlock( p->pPar );
+    return Abc_MaxInt( 2, iPage << 16 );
+}
+static inline int Mf_ManSaveCuts( Mf_Man_t * p, int * piCur, Mf_Cut_t ** pCuts, int nCuts )
 {
     int i, * pPlace, iCur, nInts = 1;
     for ( i = 0; i < nCuts; i++ )
         nInts += pCuts[i]->nLeaves + 1;
-    if ( (p->iCur & 0xFFFF) + nInts > 0xFFFF )
-        p->iCur = ((p->iCur >> 16) + 1) << 16;
-    if ( Vec_PtrSize(&p->vPages) == (p->iCur >> 16) )
-        Vec_PtrPush( &p->vPages, ABC_ALLOC(int, (1<<16)) );
-    iCur = p->iCur; p->iCur += nInts;
+    if ( p->pPar )
+    {
+        if ( *piCur == 0 || (*piCur & 0xFFFF) + nInts > 0xFFFF )
+            *piCur = Mf_ManAddPage( p );
+    }
+    else
+    {
+        if ( (*piCur & 0xFFFF) + nInts > 0xFFFF )
+            *piCur = ((*piCur >> 16) + 1) << 16;
+        if ( Vec_PtrSize(&p->vPages) == (*piCur >> 16) )
+            Vec_PtrPush( &p->vPages, ABC_ALLOC(int, (1<<16)) );
+    }
+    iCur = *piCur; *piCur += nInts;
     pPlace = Mf_ManCutSet( p, iCur );
     *pPlace++ = nCuts;
     for ( i = 0; i < nCuts; i++ )
@@ -1020,11 +1060,13 @@ static inline void Mf_CutParams( Mf_Man_t * p, Mf_Cut_t * pCut, float FlowRefs )
     pCut->Delay += (int)(nLeaves > 1);
     pCut->Flow = (pCut->Flow + Mf_CutArea(p, nLeaves, pCut->iFunc)) / FlowRefs;
 }
-void Mf_ObjMergeOrder( Mf_Man_t * p, int iObj )
+void Mf_ObjMergeOrder( Mf_Man_t * p, Mf_Thr_t * pThr, int iObj )
 {
     Mf_Cut_t pCuts0[MF_CUT_MAX], pCuts1[MF_CUT_MAX], pCuts[MF_CUT_MAX], * pCutsR[MF_CUT_MAX];
     Gia_Obj_t * pObj = Gia_ManObj(p->pGia, iObj);
     Mf_Obj_t * pBest = Mf_ManObj(p, iObj);
+    double * CutCount = pThr ? pThr->CutCount : p->CutCount;
+    int * nCutCounts = pThr ? pThr->nCutCounts : p->nCutCounts;
     int nLutSize = p->pPars->nLutSize;
     int nCutNum  = p->pPars->nCutNum;
     int nCuts0   = Mf_ManPrepareCuts(pCuts0, p, Gia_ObjFaninId0(pObj, iObj), 1);
@@ -1058,19 +1100,19 @@ void Mf_ObjMergeOrder( Mf_Man_t * p, int iObj )
         int nCuts2  = Mf_ManPrepareCuts(pCuts2, p, Gia_ObjFaninId2(p->pGia, iObj), 1);
         int fComp2  = Gia_ObjFaninC2(p->pGia, pObj);
         Mf_Cut_t * pCut2, * pCut2Lim = pCuts2 + nCuts2;
-        p->CutCount[0] += nCuts0 * nCuts1 * nCuts2;
+        CutCount[0] += nCuts0 * nCuts1 * nCuts2;
         for ( pCut0 = pCuts0; pCut0 < pCut0Lim; pCut0++ )
         for ( pCut1 = pCuts1; pCut1 < pCut1Lim; pCut1++ )
         for ( pCut2 = pCuts2; pCut2 < pCut2Lim; pCut2++ )
         {
             if ( Mf_CutCountBits(pCut0->Sign | pCut1->Sign | pCut2->Sign) > nLutSize )
                 continue;
-            p->CutCount[1]++; 
+            CutCount[1]++; 
             if ( !Mf_CutMergeOrderMux(pCut0, pCut1, pCut2, pCutsR[nCutsR], nLutSize) )
                 continue;
             if ( Mf_SetLastCutIsContained(pCutsR, nCutsR) )
                 continue;
-            p->CutCount[2]++;
+            CutCount[2]++;
             if ( p->pPars->fCutMin && Mf_CutComputeTruthMux(p, pCut0, pCut1, pCut2, fComp0, fComp1, fComp2, pCutsR[nCutsR]) )
                 pCutsR[nCutsR]->Sign = Mf_CutGetSign(pCutsR[nCutsR]->pLeaves, pCutsR[nCutsR]->nLeaves);
             Mf_CutParams( p, pCutsR[nCutsR], pBest->nFlowRefs );
@@ -1080,18 +1122,18 @@ void Mf_ObjMergeOrder( Mf_Man_t * p, int iObj )
     else
     {
         int fIsXor = Gia_ObjIsXor(pObj);
-        p->CutCount[0] += nCuts0 * nCuts1;
+        CutCount[0] += nCuts0 * nCuts1;
         for ( pCut0 = pCuts0; pCut0 < pCut0Lim; pCut0++ )
         for ( pCut1 = pCuts1; pCut1 < pCut1Lim; pCut1++ )
         {
             if ( (int)(pCut0->nLeaves + pCut1->nLeaves) > nLutSize && Mf_CutCountBits(pCut0->Sign | pCut1->Sign) > nLutSize )
                 continue;
-            p->CutCount[1]++; 
+            CutCount[1]++; 
             if ( !Mf_CutMergeOrder(pCut0, pCut1, pCutsR[nCutsR], nLutSize) )
                 continue;
             if ( Mf_SetLastCutIsContained(pCutsR, nCutsR) )
                 continue;
-            p->CutCount[2]++;
+            CutCount[2]++;
             if ( p->pPars->fCutMin && Mf_CutComputeTruth(p, pCut0, pCut1, fComp0, fComp1, pCutsR[nCutsR], fIsXor) )
                 pCutsR[nCutsR]->Sign = Mf_CutGetSign(pCutsR[nCutsR]->pLeaves, pCutsR[nCutsR]->nLeaves);
             Mf_CutParams( p, pCutsR[nCutsR], pBest->nFlowRefs );
@@ -1111,12 +1153,12 @@ void Mf_ObjMergeOrder( Mf_Man_t * p, int iObj )
     // store the cutset
     pBest->Flow = pCutsR[0]->Flow;
     pBest->Delay = pCutsR[0]->Delay;
-    pBest->iCutSet = Mf_ManSaveCuts( p, pCutsR, nCutsR );
+    pBest->iCutSet = Mf_ManSaveCuts( p, pThr ? &pThr->iCur : &p->iCur, pCutsR, nCutsR );
     // verify
     assert( nCutsR > 0 && nCutsR < nCutNum );
 //    assert( Mf_SetCheckArray(pCutsR, nCutsR) );
-    p->nCutCounts[pCutsR[0]->nLeaves]++;
-    p->CutCount[3] += nCutsR;
+    nCutCounts[pCutsR[0]->nLeaves]++;
+    CutCount[3] += nCutsR;
 }
  
 
@@ -1401,6 +1443,20 @@ Mf_Man_t * Mf_ManAlloc( Gia_Man_t * pGia, Jf_Par_t * pPars )
         Vec_IntPush( &p->vCnfSizes, 2 );
         Vec_IntGrow( &p->vCnfMem, 10000 );
     }
+    if ( pPars->nProcNum > 1 && !pPars->fGenCnf )
+    {
+        p->pPar = Gia_LevParStart( pGia, pPars->nProcNum, 64 );
+        if ( Gia_LevParThreadNum(p->pPar) > 1 )
+        {
+            // the page array is not reallocated while the threads are running
+            int nSetMax = 1 + (pPars->nCutNum - 1) * (pPars->nLutSize + 1);
+            double nInts = (double)Gia_ManObjNum(pGia) * nSetMax;
+            Vec_PtrGrow( &p->vPages, (int)(nInts / (0xFFFF - nSetMax)) + Gia_LevParThreadNum(p->pPar) + 2 );
+            p->pThrs = ABC_CALLOC( Mf_Thr_t, Gia_LevParThreadNum(p->pPar) );
+        }
+        else
+            Gia_LevParStop( p->pPar ), p->pPar = NULL;
+    }
     vFlowRefs = Vec_IntAlloc(0);
     Mf_ManSetFlowRefs( pGia, vFlowRefs );
     Vec_IntForEachEntry( vFlowRefs, Entry, i )
@@ -1415,7 +1471,10 @@ void Mf_ManFree( Mf_Man_t * p )
         Vec_MemHashFree( p->vTtMem );
     if ( p->pPars->fCutMin )
         Vec_MemFree( p->vTtMem );
+    if ( p->pPar )
+        Gia_LevParStop( p->pPar );
     Vec_PtrFreeData( &p->vPages );
+    ABC_FREE( p->pThrs );
     ABC_FREE( p->vCnfSizes.pArray );
     ABC_FREE( p->vCnfMem.pArray );
     ABC_FREE( p->vPages.pArray );
@@ -1458,6 +1517,7 @@ void Mf_ManSetDefaultPars( Jf_Par_t * pPars )
     pPars->fVeryVerbose =  0;
     pPars->nLutSizeMax  =  MF_LEAF_MAX;
     pPars->nCutNumMax   =  MF_CUT_MAX;
+    pPars->nProcNumMax  =  MF_PROC_MAX;
 }
 void Mf_ManPrintStats( Mf_Man_t * p, char * pTitle )
 {
@@ -1521,11 +1581,41 @@ void Mf_ManPrintQuit( Mf_Man_t * p, Gia_Man_t * pNew )
     }
     fflush( stdout );
 }
+static void Mf_ObjMergeOrderPar( void * pMan, int iThread, int iObj )
+{
+    Mf_Man_t * p = (Mf_Man_t *)pMan;
+    Mf_ObjMergeOrder( p, p->pThrs + iThread, iObj );
+}
+static void Mf_ManComputeCutsSync( void * pMan, int nNodes )
+{
+    Mf_Man_t * p = (Mf_Man_t *)pMan;
+    int i, k;
+    if ( nNodes == 0 ) // collect statistics
+    {
+        for ( i = 0; i < Gia_LevParThreadNum(p->pPar); i++ )
+        {
+            for ( k = 0; k < 4; k++ )
+                p->CutCount[k] += p->pThrs[i].CutCount[k];
+            for ( k = 0; k <= MF_LEAF_MAX; k++ )
+                p->nCutCounts[k] += p->pThrs[i].nCutCounts[k];
+        }
+        return;
+    }
+    // make sure reading truth tables is not affected by adding new ones
+    if ( p->vTtMem )
+    {
+        word nFuncs = (word)nNodes * p->pPars->nCutNum * p->pPars->nCutNum * (p->pGia->pMuxes ? p->pPars->nCutNum : 1);
+        Vec_MemReserve( p->vTtMem, (int)Abc_MinWord(nFuncs + Vec_MemEntryNum(p->vTtMem), 0x7FFFFFFF) );
+    }
+}
 void Mf_ManComputeCuts( Mf_Man_t * p )
 {
     int i;
-    Gia_ManForEachAndId( p->pGia, i )
-        Mf_ObjMergeOrder( p, i );
+    if ( p->pPar )
+        Gia_LevParRun( p->pPar, Mf_ObjMergeOrderPar, Mf_ManComputeCutsSync, p );
+    else
+        Gia_ManForEachAndId( p->pGia, i )
+            Mf_ObjMergeOrder( p, NULL, i );
     Mf_ManSetMapRefs( p );
     Mf_ManPrintStats( p, (char *)(p->fUseEla ? "Ela  " : (p->Iter ? "Area " : "Delay")) );
 }
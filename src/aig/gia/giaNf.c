@@ -42,6 +42,7 @@ ABC_NAMESPACE_IMPL_START
 #define NF_NO_LEAF  31
 #define NF_NO_FUNC  0x3FFFFFF
 #define NF_EPSILON  0.001
+#define NF_PROC_MAX 64
 
 typedef struct Nf_Cut_t_ Nf_Cut_t; 
 struct Nf_Cut_t_
@@ -77,6 +78,13 @@ struct Nf_Obj_t_
 {
     Nf_Mat_t        M[2][2];         // del/area (2x)
 };
+typedef struct Nf_Thr_t_ Nf_Thr_t; 
+struct Nf_Thr_t_
+{
+    int             iCur;           // current position
+    double          CutCount[6];    // cut counts
+    int             nCutUseAll;     // objects with useful cuts
+};
 typedef struct Nf_Man_t_ Nf_Man_t; 
 struct Nf_Man_t_
 {
@@ -105,6 +113,9 @@ struct Nf_Man_t_
     int             InvDelayI;      // inverter delay
     word            InvAreaW;       // inverter delay
     float           InvAreaF;       // inverter area 
+    // parallel cut computation
+    Gia_LevPar_t *  pPar;           // level-parallel traversal
+    Nf_Thr_t *      pThrs;          // per-thread data
     // statistics
     abctime         clkStart;       // starting time
     double          CutCount[6];    // cut counts
@@ -409,11 +420,28 @@ Nf_Man_t * Nf_StoCreate( Gia_Man_t * pGia, Jf_Par_t * pPars )
     p->InvAreaF  = p->pCells[3].AreaF;
     Nf_ObjMatchD(p, 0, 0)->Gate = 0;
     Nf_ObjMatchD(p, 0, 1)->Gate = 1;
-    // prepare cuts
+    // prepare parallel cut computation
+    if ( pPars->nProcNum > 1 )
+    {
+        p->pPar = Gia_LevParStart( pGia, pPars->nProcNum, 64 );
+        if ( Gia_LevParThreadNum(p->pPar) > 1 )
+        {
+            // the page array is not reallocated while the threads are running
+            int nSetMax = 1 + (pPars->nCutNum - 1) * (pPars->nLutSize + 1);
+            double nInts = (double)Gia_ManObjNum(pGia) * nSetMax;
+            Vec_PtrGrow( &p->vPages, (int)(nInts / (0xFFFF - nSetMax)) + Gia_LevParThreadNum(p->pPar) + 2 );
+            p->pThrs = ABC_CALLOC( Nf_Thr_t, Gia_LevParThreadNum(p->pPar) );
+        }
+        else
+            Gia_LevParStop( p->pPar ), p->pPar = NULL;
+    }
     return p;
 }
 void Nf_StoDelete( Nf_Man_t * p )
 {
+    if ( p->pPar )
+        Gia_LevParStop( p->pPar );
+    ABC_FREE( p->pThrs );
     Vec_PtrFreeData( &p->vPages );
     ABC_FREE( p->vPages.pArray );
     ABC_FREE( p->vMapRefs.pArray );
@@ -441,6 +469,16 @@ void Nf_StoDelete( Nf_Man_t * p )
   SeeAlso     []
 
 ***********************************************************************/
+static inline int Nf_ManInsertTruth( Nf_Man_t * p, word * pTruth )
+{
+    int truthId;
+    if ( p->pPar == NULL )
+        return Vec_MemHashInsert( p->vTtMem, pTruth );
+    Gia_LevParLock( p->pPar );
+    truthId = Vec_MemHashInsert( p->vTtMem, pTruth );
+    Gia_LevParUnlock( p->pPar );
+    return truthId;
+}
 static inline int Nf_CutComputeTruth6( Nf_Man_t * p, Nf_Cut_t * pCut0, Nf_Cut_t * pCut1, int fCompl0, int fCompl1, Nf_Cut_t * pCutR, int fIsXor )
 {
 //    extern int Nf_ManTruthCanonicize( word * t, int nVars );
@@ -455,7 +493,7 @@ static inline int Nf_CutComputeTruth6( Nf_Man_t * p, Nf_Cut_t * pCut0, Nf_Cut_t
     if ( (fCompl = (int)(t & 1)) ) t = ~t;
     pCutR->nLeaves = Abc_Tt6MinBase( &t, pCutR->pLeaves, pCutR->nLeaves );
     assert( (int)(t & 1) == 0 );
-    truthId        = Vec_MemHashInsert(p->vTtMem, &t);
+    truthId        = Nf_ManInsertTruth(p, &t);
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
     pCutR->Useless = Nf_ObjCutUseless( p, truthId );
     assert( (int)pCutR->nLeaves <= nOldSupp );
@@ -477,7 +515,7 @@ static inline int Nf_CutComputeTruthMux6( Nf_Man_t * p, Nf_Cut_t * pCut0, Nf_Cut
     if ( (fCompl = (int)(t & 1)) ) t = ~t;
     pCutR->nLeaves = Abc_Tt6MinBase( &t, pCutR->pLeaves, pCutR->nLeaves );
     assert( (int)(t & 1) == 0 );
-    truthId        = Vec_MemHashInsert(p->vTtMem, &t);
+    truthId        = Nf_ManInsertTruth(p, &t);
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
     pCutR->Useless = Nf_ObjCutUseless( p, truthId );
     assert( (int)pCutR->nLeaves <= nOldSupp );
@@ -558,17 +596,36 @@ static inline int Nf_ManPrepareCuts( Nf_Cut_t * pCuts, Nf_Man_t * p, int iObj, i
     }
     return Nf_CutCreateUnit( pCuts, iObj );
 }
-static inline int Nf_ManSaveCuts( Nf_Man_t * p, Nf_Cut_t ** pCuts, int nCuts, int fUseful )
+static inline int Nf_ManAddPage( Nf_Man_t * p )
+{
+    // with several threads, each thread fills its own page
+    int iPage;
+    Gia_LevParLock( p->pPar );
+    iPage = Vec_PtrSize( &p->vPages );
+    assert( iPage < p->vPages.nCap );
+    Vec_PtrPush( &p->vPages, ABC_ALLOC(int, (1<<16)) );
+    Gia_LevParUnlock( p->pPar );
+    return Abc_MaxInt( 2, iPage << 16 );
+}
+static inline int Nf_ManSaveCuts( Nf_Man_t * p, int * piCur, Nf_Cut_t ** pCuts, int nCuts, int fUseful )
 {
     int i, * pPlace, iCur, nInts = 1, nCutsNew = 0;
     for ( i = 0; i < nCuts; i++ )
         if ( !fUseful || !pCuts[i]->Useless )
             nInts += pCuts[i]->nLeaves + 1, nCutsNew++;
-    if ( (p->iCur & 0xFFFF) + nInts > 0xFFFF )
-        p->iCur = ((p->iCur >> 16) + 1) << 16;
-    if ( Vec_PtrSize(&p->vPages) == (p->iCur >> 16) )
-        Vec_PtrPush( &p->vPages, ABC_ALLOC(int, (1<<16)) );
-    iCur = p->iCur; p->iCur += nInts;
+    if ( p->pPar )
+    {
+        if ( *piCur == 0 || (*piCur & 0xFFFF) + nInts > 0xFFFF )
+            *piCur = Nf_ManAddPage( p );
+    }
+    else
+    {
+        if ( (*piCur & 0xFFFF) + nInts > 0xFFFF )
+            *piCur = ((*piCur >> 16) + 1) << 16;
+        if ( Vec_PtrSize(&p->vPages) == (*piCur >> 16) )
+            Vec_PtrPush( &p->vPages, ABC_ALLOC(int, (1<<16)) );
+    }
+    iCur = *piCur; *piCur += nInts;
     pPlace = Nf_ManCutSet( p, iCur );
     *pPlace++ = nCutsNew;
     for ( i = 0; i < nCuts; i++ )
@@ -852,10 +909,12 @@ static inline void Nf_CutParams( Nf_Man_t * p, Nf_Cut_t * pCut, float FlowRefs )
     pCut->Delay += (int)(nLeaves > 1);
     pCut->Flow = (pCut->Flow + Nf_CutArea(p, nLeaves)) / FlowRefs;
 }
-void Nf_ObjMergeOrder( Nf_Man_t * p, int iObj )
+void Nf_ObjMergeOrder( Nf_Man_t * p, Nf_Thr_t * pThr, int iObj )
 {
     Nf_Cut_t pCuts0[NF_CUT_MAX], pCuts1[NF_CUT_MAX], pCuts[NF_CUT_MAX], * pCutsR[NF_CUT_MAX];
     Gia_Obj_t * pObj = Gia_ManObj(p->pGia, iObj);
+    double * CutCount = pThr ? pThr->CutCount : p->CutCount;
+    int * pnCutUseAll = pThr ? &pThr->nCutUseAll : &p->nCutUseAll;
     //Nf_Obj_t * pBest = Nf_ManObj(p, iObj);
     float dFlowRefs  = Nf_ObjFlowRefs(p, iObj, 0) + Nf_ObjFlowRefs(p, iObj, 1);
     int nLutSize = p->pPars->nLutSize;
@@ -891,19 +950,19 @@ void Nf_ObjMergeOrder( Nf_Man_t * p, int iObj )
         int nCuts2  = Nf_ManPrepareCuts(pCuts2, p, Gia_ObjFaninId2(p->pGia, iObj), 1);
         int fComp2  = Gia_ObjFaninC2(p->pGia, pObj);
         Nf_Cut_t * pCut2, * pCut2Lim = pCuts2 + nCuts2;
-        p->CutCount[0] += nCuts0 * nCuts1 * nCuts2;
+        CutCount[0] += nCuts0 * nCuts1 * nCuts2;
         for ( pCut0 = pCuts0; pCut0 < pCut0Lim; pCut0++ )
         for ( pCut1 = pCuts1; pCut1 < pCut1Lim; pCut1++ )
         for ( pCut2 = pCuts2; pCut2 < pCut2Lim; pCut2++ )
         {
             if ( Nf_CutCountBits(pCut0->Sign | pCut1->Sign | pCut2->Sign) > nLutSize )
                 continue;
-            p->CutCount[1]++; 
+            CutCount[1]++; 
             if ( !Nf_CutMergeOrderMux(pCut0, pCut1, pCut2, pCutsR[nCutsR], nLutSize) )
                 continue;
             if ( Nf_SetLastCutIsContained(pCutsR, nCutsR) )
                 continue;
-            p->CutCount[2]++;
+            CutCount[2]++;
             if ( Nf_CutComputeTruthMux6(p, pCut0, pCut1, pCut2, fComp0, fComp1, fComp2, pCutsR[nCutsR]) )
                 pCutsR[nCutsR]->Sign = Nf_CutGetSign(pCutsR[nCutsR]->pLeaves, pCutsR[nCutsR]->nLeaves);
             Nf_CutParams( p, pCutsR[nCutsR], dFlowRefs );
@@ -913,18 +972,18 @@ void Nf_ObjMergeOrder( Nf_Man_t * p, int iObj )
     else
     {
         int fIsXor = Gia_ObjIsXor(pObj);
-        p->CutCount[0] += nCuts0 * nCuts1;
+        CutCount[0] += nCuts0 * nCuts1;
         for ( pCut0 = pCuts0; pCut0 < pCut0Lim; pCut0++ )
         for ( pCut1 = pCuts1; pCut1 < pCut1Lim; pCut1++ )
         {
             if ( (int)(pCut0->nLeaves + pCut1->nLeaves) > nLutSize && Nf_CutCountBits(pCut0->Sign | pCut1->Sign) > nLutSize )
                 continue;
-            p->CutCount[1]++; 
+            CutCount[1]++; 
             if ( !Nf_CutMergeOrder(pCut0, pCut1, pCutsR[nCutsR], nLutSize) )
                 continue;
             if ( Nf_SetLastCutIsContained(pCutsR, nCutsR) )
                 continue;
-            p->CutCount[2]++;
+            CutCount[2]++;
             if ( Nf_CutComputeTruth6(p, pCut0, pCut1, fComp0, fComp1, pCutsR[nCutsR], fIsXor) )
                 pCutsR[nCutsR]->Sign = Nf_CutGetSign(pCutsR[nCutsR]->pLeaves, pCutsR[nCutsR]->nLeaves);
             Nf_CutParams( p, pCutsR[nCutsR], dFlowRefs );
@@ -947,16 +1006,53 @@ void Nf_ObjMergeOrder( Nf_Man_t * p, int iObj )
     // store the cutset
     Nf_ObjSetCutFlow( p, iObj, pCutsR[0]->Flow );
     Nf_ObjSetCutDelay( p, iObj, pCutsR[0]->Delay );
-    *Vec_IntEntryP(&p->vCutSets, iObj) = Nf_ManSaveCuts(p, pCutsR, nCutsR, 0);
-    p->CutCount[3] += nCutsR;
+    *Vec_IntEntryP(&p->vCutSets, iObj) = Nf_ManSaveCuts(p, pThr ? &pThr->iCur : &p->iCur, pCutsR, nCutsR, 0);
+    CutCount[3] += nCutsR;
     nCutsUse = Nf_ManCountUseful(pCutsR, nCutsR);
-    p->CutCount[4] += nCutsUse;
-    p->nCutUseAll  += nCutsUse == nCutsR;
-    p->CutCount[5] += Nf_ManCountMatches(p, pCutsR, nCutsR);
+    CutCount[4] += nCutsUse;
+    *pnCutUseAll   += nCutsUse == nCutsR;
+    CutCount[5] += Nf_ManCountMatches(p, pCutsR, nCutsR);
+}
+static void Nf_ObjMergeOrderPar( void * pMan, int iThread, int iObj )
+{
+    Nf_Man_t * p = (Nf_Man_t *)pMan;
+    Gia_Obj_t * pObj = Gia_ManObj( p->pGia, iObj );
+    if ( Gia_ObjIsBuf(pObj) )
+    {
+        int iFanin = Gia_ObjFaninId0(pObj, iObj);
+        Nf_ObjSetCutFlow( p, iObj,  Nf_ObjCutFlow(p, iFanin) );
+        Nf_ObjSetCutDelay( p, iObj, Nf_ObjCutDelay(p, iFanin) );
+    }
+    else
+        Nf_ObjMergeOrder( p, p->pThrs + iThread, iObj );
+}
+static void Nf_ManComputeCutsSync( void * pMan, int nNodes )
+{
+    Nf_Man_t * p = (Nf_Man_t *)pMan;
+    word nFuncs;
+    int i, k;
+    if ( nNodes == 0 ) // collect statistics
+    {
+        for ( i = 0; i < Gia_LevParThreadNum(p->pPar); i++ )
+        {
+            for ( k = 0; k < 6; k++ )
+                p->CutCount[k] += p->pThrs[i].CutCount[k];
+            p->nCutUseAll += p->pThrs[i].nCutUseAll;
+        }
+        return;
+    }
+    // make sure reading truth tables is not affected by adding new ones
+    nFuncs = (word)nNodes * p->pPars->nCutNum * p->pPars->nCutNum * (p->pGia->pMuxes ? p->pPars->nCutNum : 1);
+    Vec_MemReserve( p->vTtMem, (int)Abc_MinWord(nFuncs + Vec_MemEntryNum(p->vTtMem), 0x7FFFFFFF) );
 }
 void Nf_ManComputeCuts( Nf_Man_t * p )
 {
     Gia_Obj_t * pObj; int i, iFanin;
+    if ( p->pPar )
+    {
+        Gia_LevParRun( p->pPar, Nf_ObjMergeOrderPar, Nf_ManComputeCutsSync, p );
+        return;
+    }
     Gia_ManForEachAnd( p->pGia, pObj, i )
         if ( Gia_ObjIsBuf(pObj) )
         {
@@ -965,7 +1061,7 @@ void Nf_ManComputeCuts( Nf_Man_t * p )
             Nf_ObjSetCutDelay( p, i, Nf_ObjCutDelay(p, iFanin) );
         }
         else
-            Nf_ObjMergeOrder( p, i );
+            Nf_ObjMergeOrder( p, NULL, i );
 }
 
 
@@ -2358,6 +2454,7 @@ void Nf_ManSetDefaultPars( Jf_Par_t * pPars )
     pPars->fVeryVerbose =  0;
     pPars->nLutSizeMax  =  NF_LEAF_MAX;
     pPars->nCutNumMax   =  NF_CUT_MAX;
+    pPars->nProcNumMax  =  NF_PROC_MAX;
     pPars->MapDelayTarget = 0;
 }
 Gia_Man_t * Nf_ManPerformMapping( Gia_Man_t * pGia, Jf_Par_t * pPars )
@@ -0,0 +1,255 @@
+/**CFile****************************************************************
+
+  FileName    [giaSimPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Multi-threaded bit-parallel simulation.]
+
+  Author      [agent]
+
+  Date        [Ver. 1.0. Started - October 16, 2026.]
+
+  Revision    [$Id: giaSimPar.c,v 1.00 2026/10/16 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "gia.h"
+#include "misc/util/utilTruth.h"
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The AND nodes are visited level by level using Gia_LevParRun(), so that
+// the nodes on a wide level are simulated by several threads. The simulation 
+// info is stored object-major: nWords words per object.
+
+struct Gia_SimPar_t_
+{
+    Gia_Man_t *    pGia;       // the manager
+    Gia_LevPar_t * pLev;       // the level-parallel traversal
+    // current simulation task
+    word *         pSims;      // the simulation info
+    int            nWords;     // the number of words per object
+};
+
+#define GIA_SIM_WIDE_MIN 256      // the smallest number of nodes per thread in a wide level
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates one AND node.]
+
+  Description [When compiled with AVX2 enabled, the words are processed
+  four at a time. Otherwise, the loops are left to the compiler.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Gia_SimParAnd( word * pSims, int nWords, Gia_Obj_t * pObj, int iObj )
+{
+    word * pSim  = pSims + (size_t)nWords * iObj;
+    word * pSim0 = pSims + (size_t)nWords * Gia_ObjFaninId0(pObj, iObj);
+    word * pSim1 = pSims + (size_t)nWords * Gia_ObjFaninId1(pObj, iObj);
+    word Mask0 = Gia_ObjFaninC0(pObj) ? ~(word)0 : 0;
+    word Mask1 = Gia_ObjFaninC1(pObj) ? ~(word)0 : 0;
+    int w = 0;
+#ifdef __AVX2__
+    __m256i M0 = _mm256_set1_epi64x( (long long)Mask0 );
+    __m256i M1 = _mm256_set1_epi64x( (long long)Mask1 );
+    for ( ; w + 4 <= nWords; w += 4 )
+    {
+        __m256i S0 = _mm256_xor_si256( _mm256_loadu_si256((__m256i *)(pSim0 + w)), M0 );
+        __m256i S1 = _mm256_xor_si256( _mm256_loadu_si256((__m256i *)(pSim1 + w)), M1 );
+        _mm256_storeu_si256( (__m256i *)(pSim + w), _mm256_and_si256(S0, S1) );
+    }
+#endif
+    for ( ; w < nWords; w++ )
+        pSim[w] = (pSim0[w] ^ Mask0) & (pSim1[w] ^ Mask1);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates one AND node; called by Gia_LevParRun().]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_SimParNode( void * pMan, int iThread, int iObj )
+{
+    Gia_SimPar_t * p = (Gia_SimPar_t *)pMan;
+    Gia_SimParAnd( p->pSims, p->nWords, Gia_ManObj(p->pGia, iObj), iObj );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prepares the level order for parallel simulation.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_SimPar_t * Gia_SimParStart( Gia_Man_t * pGia, int nThreads )
+{
+    Gia_SimPar_t * p = ABC_CALLOC( Gia_SimPar_t, 1 );
+    p->pGia = pGia;
+    p->pLev = Gia_LevParStart( pGia, nThreads, GIA_SIM_WIDE_MIN );
+    return p;
+}
+void Gia_SimParStop( Gia_SimPar_t * p )
+{
+    Gia_LevParStop( p->pLev );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates the AND nodes.]
+
+  Description [The simulation info is an array of nWords words per object.
+  The info of the constant and the CIs should be assigned by the caller.
+  The info of the COs is not computed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_SimParSimulate( Gia_SimPar_t * p, word * pSims, int nWords )
+{
+    p->pSims  = pSims;
+    p->nWords = nWords;
+    Gia_LevParRun( p->pLev, Gia_SimParNode, NULL, p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Random sequential simulation with several threads.]
+
+  Description [Performs the same task as Gia_ManSimSimulate() but keeps
+  the simulation info of all objects, which allows the nodes on the same
+  level to be simulated in parallel. The refinement of equivalence classes
+  is not parallelized, so the serial simulation is used if the AIG has
+  equivalence classes.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline word * Gia_SimParObj( word * pSims, int nWords, int iObj ) { return pSims + (size_t)nWords * iObj; }
+
+int Gia_ManSimSimulatePar( Gia_Man_t * pAig, Gia_ParSim_t * pPars, int nThreads )
+{
+    Gia_SimPar_t * p;
+    Gia_Obj_t * pObj, * pObjRi, * pObjRo;
+    word * pSims, * pSimsPi, * pSim, * pSim0;
+    abctime clkTotal = Abc_Clock();
+    abctime nTimeToStop = pPars->TimeLimit ? pPars->TimeLimit * CLOCKS_PER_SEC + Abc_Clock(): 0;
+    int nWords = Abc_MaxInt( 1, pPars->nWords / 2 );
+    int i, k, w, f, iPat, RetValue = 0;
+    if ( pAig->pReprs && pAig->pNexts )
+        return Gia_ManSimSimulate( pAig, pPars );
+    ABC_FREE( pAig->pCexSeq );
+    pSims   = ABC_CALLOC( word, (size_t)nWords * Gia_ManObjNum(pAig) );
+    pSimsPi = ABC_ALLOC( word, (size_t)nWords * Gia_ManPiNum(pAig) * Abc_MaxInt(1, pPars->nIters) );
+    p       = Gia_SimParStart( pAig, nThreads );
+    Gia_ManRandomW( 1 );
+    for ( i = 0; i < pPars->RandSeed; i++ )
+        Gia_ManRandomW( 0 );
+    for ( f = 0; f < pPars->nIters; f++ )
+    {
+        // assign the primary inputs and remember their values
+        Gia_ManForEachPi( pAig, pObj, i )
+        {
+            pSim  = Gia_SimParObj( pSims, nWords, Gia_ObjId(pAig, pObj) );
+            pSim0 = pSimsPi + ((size_t)f * Gia_ManPiNum(pAig) + i) * nWords;
+            for ( w = 0; w < nWords; w++ )
+                pSim0[w] = pSim[w] = Gia_ManRandomW(0);
+        }
+        // transfer the register inputs (the registers start in zero)
+        if ( f > 0 )
+        Gia_ManForEachRiRo( pAig, pObjRi, pObjRo, i )
+            memcpy( Gia_SimParObj(pSims, nWords, Gia_ObjId(pAig, pObjRo)), Gia_SimParObj(pSims, nWords, Gia_ObjId(pAig, pObjRi)), sizeof(word) * nWords );
+        Gia_SimParSimulate( p, pSims, nWords );
+        Gia_ManForEachCo( pAig, pObj, i )
+        {
+            pSim  = Gia_SimParObj( pSims, nWords, Gia_ObjId(pAig, pObj) );
+            pSim0 = Gia_SimParObj( pSims, nWords, Gia_ObjFaninId0p(pAig, pObj) );
+            for ( w = 0; w < nWords; w++ )
+                pSim[w] = Gia_ObjFaninC0(pObj) ? ~pSim0[w] : pSim0[w];
+        }
+        if ( pPars->fVerbose )
+        {
+            Abc_Print( 1, "Frame %4d out of %4d and timeout %3d sec. ", f+1, pPars->nIters, pPars->TimeLimit );
+            Abc_Print( 1, "Time = %7.2f sec\r", (1.0*Abc_Clock()-clkTotal)/CLOCKS_PER_SEC );
+        }
+        if ( pPars->fCheckMiter )
+        {
+            Gia_ManForEachPo( pAig, pObj, i )
+            {
+                pSim = Gia_SimParObj( pSims, nWords, Gia_ObjId(pAig, pObj) );
+                iPat = Abc_TtFindFirstBit2( pSim, nWords );
+                if ( iPat < 0 )
+                    continue;
+                // derive the counter-example from the recorded inputs
+                pAig->pCexSeq = Abc_CexAlloc( Gia_ManRegNum(pAig), Gia_ManPiNum(pAig), f+1 );
+                pAig->pCexSeq->iFrame = f;
+                pAig->pCexSeq->iPo    = i;
+                for ( k = 0; k <= f; k++ )
+                    for ( w = 0; w < Gia_ManPiNum(pAig); w++ )
+                        if ( Abc_TtGetBit( pSimsPi + ((size_t)k * Gia_ManPiNum(pAig) + w) * nWords, iPat ) )
+                            Abc_InfoSetBit( pAig->pCexSeq->pData, Gia_ManRegNum(pAig) + k * Gia_ManPiNum(pAig) + w );
+                pPars->iOutFail = i;
+                Abc_Print( 1, "Output %d of miter \"%s\" was asserted in frame %d.  ", i, pAig->pName, f );
+                if ( !Gia_ManVerifyCex( pAig, pAig->pCexSeq, 0 ) )
+                    Abc_Print( 1, "\nGenerated counter-example is INVALID.                    " );
+                RetValue = 1;
+                break;
+            }
+            if ( RetValue )
+                break;
+        }
+        if ( nTimeToStop && Abc_Clock() > nTimeToStop )
+        {
+            f++;
+            break;
+        }
+    }
+    Gia_SimParStop( p );
+    ABC_FREE( pSims );
+    ABC_FREE( pSimsPi );
+    if ( pAig->pCexSeq == NULL )
+        Abc_Print( 1, "No bug detected after simulating %d frames with %d words.  ", f, 2 * nWords );
+    Abc_PrintTime( 1, "Time", Abc_Clock() - clkTotal );
+    return RetValue;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
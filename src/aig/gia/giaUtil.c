@@ -525,7 +525,8 @@ int Gia_ManLevelNum( Gia_Man_t * p )
 float Gia_ManLevelAve( Gia_Man_t * p )  
 {
     Gia_Obj_t * pObj;
-    int i, Ave = 0;
+    word Ave = 0;
+    int i;
     assert( p->vLevels );
     Gia_ManForEachCo( p, pObj, i )
         Ave += Gia_ObjLevel(p, pObj);
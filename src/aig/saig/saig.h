@@ -34,6 +34,8 @@ ABC_NAMESPACE_HEADER_START
 ///                         PARAMETERS                               ///
 ////////////////////////////////////////////////////////////////////////
 
+#define SAIG_CKPT_PERIOD 60    // the min number of seconds between two checkpoints
+
 ////////////////////////////////////////////////////////////////////////
 ///                         BASIC TYPES                              ///
 ////////////////////////////////////////////////////////////////////////
@@ -106,6 +108,18 @@ static inline int          Saig_ObjRegId( Aig_Man_t * p, Aig_Obj_t * pObj )   {
 ///                    FUNCTION DECLARATIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
+/*=== saigCkpt.c ==========================================================*/
+extern Vec_Str_t *       Saig_ManCkptStart( Aig_Man_t * p, char Engine, int Options );
+extern int               Saig_ManCkptGetNum( Vec_Str_t * vStr, int * pPos, int nLimit );
+extern int               Saig_ManCkptGetCount( Vec_Str_t * vStr, int * pPos );
+extern word              Saig_ManCkptGetW( Vec_Str_t * vStr, int * pPos );
+extern unsigned          Saig_ManCkptGetI_ne( Vec_Str_t * vStr, int * pPos );
+extern int               Saig_ManCkptCheck( Aig_Man_t * p, Vec_Str_t * vStr, char Engine, int Options, int * pPos );
+extern int               Saig_ManCkptWrite( Vec_Str_t * vStr, char * pFileName );
+extern Vec_Str_t *       Saig_ManCkptRead( char * pFileName );
+extern void              Saig_ManCkptPutCex( Vec_Str_t * vStr, Abc_Cex_t * pCex );
+extern Abc_Cex_t *       Saig_ManCkptGetCex( Aig_Man_t * p, Vec_Str_t * vStr, int * pPos );
+extern int               Saig_ManCkptTimeIsUp( abctime * pTimeLast, int fForce );
 /*=== saigCone.c ==========================================================*/
 extern void              Saig_ManPrintCones( Aig_Man_t * p );
 /*=== saigConstr.c ==========================================================*/
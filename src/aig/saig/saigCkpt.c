@@ -0,0 +1,389 @@
+/**CFile****************************************************************
+
+  FileName    [saigCkpt.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Sequential AIG package.]
+
+  Synopsis    [Checkpoint files of the sequential verification engines.]
+
+  Author      [agent]
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: saigCkpt.c,v 1.00 2026/10/17 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "saig.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// A checkpoint file starts with the header below, followed by the data
+// of the engine. The header records the engine and a signature of the
+// AIG, so that a checkpoint of another design or engine is not used.
+// All numbers are unsigned and stored using the 7-bit encoding. The file
+// ends with a checksum of the data, which is checked before the data is
+// parsed, so that a corrupted checkpoint is not used.
+// The numbers are read with bound checking: when the data is truncated
+// or corrupted, the reading position is moved past the end of the data,
+// so that the following reads fail too and the loader can detect this
+// by comparing the final position with the size of the data.
+
+#define SAIG_CKPT_VER_NUM 2
+
+static char * s_SaigCkptMagic = "ABC-CKPT";
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the structural signature of the AIG.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static word Saig_ManCkptSignature( Aig_Man_t * p )
+{
+    Aig_Obj_t * pObj;
+    word Sign = 0;
+    int i;
+    Aig_ManForEachObj( p, pObj, i )
+    {
+        Sign = (Sign << 7) ^ (Sign >> 57) ^ (word)Aig_ObjType(pObj);
+        if ( Aig_ObjIsNode(pObj) || Aig_ObjIsCo(pObj) )
+            Sign = Sign * 0x9E3779B97F4A7C15 + (word)(2*Aig_ObjFaninId0(pObj) + Aig_ObjFaninC0(pObj));
+        if ( Aig_ObjIsNode(pObj) )
+            Sign = Sign * 0x9E3779B97F4A7C15 + (word)(2*Aig_ObjFaninId1(pObj) + Aig_ObjFaninC1(pObj));
+    }
+    return Sign;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the checksum of the data (64-bit FNV-1a).]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static word Saig_ManCkptChecksum( char * pData, int nSize )
+{
+    word Sum = ABC_CONST(0xCBF29CE484222325);
+    int i;
+    for ( i = 0; i < nSize; i++ )
+        Sum = (Sum ^ (word)(unsigned char)pData[i]) * ABC_CONST(0x100000001B3);
+    return Sum;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the data of the checkpoint with bound checking.]
+
+  Description [Saig_ManCkptGetNum() returns the number if it is less
+  than nLimit. Saig_ManCkptGetCount() returns the number of items that
+  follow, each of which takes at least one byte. Saig_ManCkptGetW()
+  and Saig_ManCkptGetI_ne() read the numbers stored without encoding.
+  On failure, returns -1 (0 for the non-encoded numbers) and moves the
+  position past the end of the data.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Saig_ManCkptFail( Vec_Str_t * vStr, int * pPos )
+{
+    *pPos = Vec_StrSize(vStr) + 1;
+    return -1;
+}
+int Saig_ManCkptGetNum( Vec_Str_t * vStr, int * pPos, int nLimit )
+{
+    unsigned Val = 0;
+    int i;
+    for ( i = 0; i < 35 && *pPos < Vec_StrSize(vStr); i += 7 )
+    {
+        unsigned char ch = (unsigned char)Vec_StrEntry( vStr, (*pPos)++ );
+        Val |= (unsigned)(ch & 0x7f) << i;
+        if ( ch & 0x80 )
+            continue;
+        if ( (i == 28 && (ch & 0x7f) > 7) || Val >= (unsigned)nLimit )
+            break;
+        return (int)Val;
+    }
+    return Saig_ManCkptFail( vStr, pPos );
+}
+int Saig_ManCkptGetCount( Vec_Str_t * vStr, int * pPos )
+{
+    return Saig_ManCkptGetNum( vStr, pPos, Abc_MaxInt(Vec_StrSize(vStr) - *pPos + 1, 0) );
+}
+word Saig_ManCkptGetW( Vec_Str_t * vStr, int * pPos )
+{
+    if ( *pPos + 8 > Vec_StrSize(vStr) )
+        return (word)Saig_ManCkptFail( vStr, pPos ) + 1;
+    return Vec_StrGetW( vStr, pPos );
+}
+unsigned Saig_ManCkptGetI_ne( Vec_Str_t * vStr, int * pPos )
+{
+    if ( *pPos + 4 > Vec_StrSize(vStr) )
+        return (unsigned)(Saig_ManCkptFail( vStr, pPos ) + 1);
+    return (unsigned)Vec_StrGetI_ne( vStr, pPos );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the checkpoint of the engine.]
+
+  Description [Engine is a one-letter engine name. Options is a number
+  that changes when the engine parameters change the meaning of the
+  saved data.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Str_t * Saig_ManCkptStart( Aig_Man_t * p, char Engine, int Options )
+{
+    Vec_Str_t * vStr = Vec_StrAlloc( 1000 );
+    Vec_StrPutS( vStr, s_SaigCkptMagic );
+    Vec_StrPutI( vStr, SAIG_CKPT_VER_NUM );
+    Vec_StrPutC( vStr, Engine );
+    Vec_StrPutI( vStr, Options );
+    Vec_StrPutI( vStr, Saig_ManPiNum(p) );
+    Vec_StrPutI( vStr, Saig_ManPoNum(p) );
+    Vec_StrPutI( vStr, Saig_ManRegNum(p) );
+    Vec_StrPutI( vStr, Aig_ManNodeNum(p) );
+    Vec_StrPutW( vStr, Saig_ManCkptSignature(p) );
+    return vStr;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Checks the header of the checkpoint.]
+
+  Description [Returns 1 if the checkpoint was saved by the same engine
+  for the same AIG. In this case, *pPos points to the engine data.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Saig_ManCkptCheck( Aig_Man_t * p, Vec_Str_t * vStr, char Engine, int Options, int * pPos )
+{
+    int nMagic = strlen(s_SaigCkptMagic) + 1;
+    *pPos = 0;
+    if ( Vec_StrSize(vStr) < nMagic + 16 || strcmp(Vec_StrArray(vStr), s_SaigCkptMagic) )
+    {
+        Abc_Print( 0, "The checkpoint file has unknown format.\n" );
+        return 0;
+    }
+    *pPos = nMagic;
+    if ( Saig_ManCkptGetNum(vStr, pPos, ABC_INFINITY) != SAIG_CKPT_VER_NUM )
+    {
+        Abc_Print( 0, "The checkpoint file has unsupported version.\n" );
+        return 0;
+    }
+    if ( *pPos >= Vec_StrSize(vStr) || Vec_StrGetC(vStr, pPos) != Engine || Saig_ManCkptGetNum(vStr, pPos, ABC_INFINITY) != Options )
+    {
+        Abc_Print( 0, "The checkpoint file was saved by another engine or with other parameters.\n" );
+        return 0;
+    }
+    if ( Saig_ManCkptGetNum(vStr, pPos, ABC_INFINITY) != Saig_ManPiNum(p)   ||
+         Saig_ManCkptGetNum(vStr, pPos, ABC_INFINITY) != Saig_ManPoNum(p)   ||
+         Saig_ManCkptGetNum(vStr, pPos, ABC_INFINITY) != Saig_ManRegNum(p)  ||
+         Saig_ManCkptGetNum(vStr, pPos, ABC_INFINITY) != Aig_ManNodeNum(p)  ||
+         Saig_ManCkptGetW(vStr, pPos) != Saig_ManCkptSignature(p) )
+    {
+        Abc_Print( 0, "The checkpoint file was saved for another design.\n" );
+        return 0;
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the checkpoint into a file.]
+
+  Description [The data is written into a temporary file, which then
+  replaces the old checkpoint, so that the old checkpoint remains valid
+  if the process is killed while writing. On Windows, rename() does not
+  replace an existing file, so the old checkpoint is removed first.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Saig_ManCkptWrite( Vec_Str_t * vStr, char * pFileName )
+{
+    char * pFileTemp = ABC_ALLOC( char, strlen(pFileName) + 5 );
+    FILE * pFile;
+    int RetValue;
+    sprintf( pFileTemp, "%s.tmp", pFileName );
+    pFile = fopen( pFileTemp, "wb" );
+    if ( pFile == NULL )
+    {
+        Abc_Print( 1, "Cannot open checkpoint file \"%s\" for writing.\n", pFileTemp );
+        ABC_FREE( pFileTemp );
+        return 0;
+    }
+    Vec_StrPutW( vStr, Saig_ManCkptChecksum(Vec_StrArray(vStr), Vec_StrSize(vStr)) );
+    RetValue = (int)fwrite( Vec_StrArray(vStr), 1, Vec_StrSize(vStr), pFile );
+    RetValue = (fclose( pFile ) == 0) && RetValue == Vec_StrSize(vStr);
+    Vec_StrShrink( vStr, Vec_StrSize(vStr) - 8 );
+#ifdef _WIN32
+    if ( RetValue )
+        remove( pFileName );
+#endif
+    if ( !RetValue || rename( pFileTemp, pFileName ) )
+    {
+        Abc_Print( 1, "Writing checkpoint file \"%s\" has failed.\n", pFileName );
+        remove( pFileTemp );
+        RetValue = 0;
+    }
+    ABC_FREE( pFileTemp );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the checkpoint from a file.]
+
+  Description [Returns NULL if the file does not exist or its checksum
+  does not match. The returned data does not include the checksum.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Str_t * Saig_ManCkptRead( char * pFileName )
+{
+    Vec_Str_t * vStr;
+    FILE * pFile = fopen( pFileName, "rb" );
+    int nFileSize, RetValue, Pos;
+    if ( pFile == NULL )
+        return NULL;
+    fseek( pFile, 0, SEEK_END );
+    nFileSize = ftell( pFile );
+    rewind( pFile );
+    vStr = Vec_StrStart( nFileSize + 1 );
+    RetValue = (int)fread( Vec_StrArray(vStr), 1, nFileSize, pFile );
+    fclose( pFile );
+    Vec_StrShrink( vStr, RetValue );
+    Pos = Vec_StrSize(vStr) - 8;
+    if ( Pos < 0 || Vec_StrGetW(vStr, &Pos) != Saig_ManCkptChecksum(Vec_StrArray(vStr), Vec_StrSize(vStr) - 8) )
+    {
+        Abc_Print( 1, "The checkpoint file \"%s\" is truncated or corrupted.\n", pFileName );
+        Vec_StrFree( vStr );
+        return NULL;
+    }
+    Vec_StrShrink( vStr, Vec_StrSize(vStr) - 8 );
+    return vStr;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Saves and loads the counter-example.]
+
+  Description [Supports the fake counter-example (Abc_Cex_t *)1 used
+  by the engines when the CEXes are not stored. When loading, returns
+  NULL if the counter-example is corrupted or does not match the AIG.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Saig_ManCkptPutCex( Vec_Str_t * vStr, Abc_Cex_t * pCex )
+{
+    int i;
+    if ( pCex == (Abc_Cex_t *)(ABC_PTRINT_T)1 )
+    {
+        Vec_StrPutI( vStr, 0 );
+        return;
+    }
+    Vec_StrPutI( vStr, 1 );
+    Vec_StrPutI( vStr, pCex->iPo );
+    Vec_StrPutI( vStr, pCex->iFrame );
+    Vec_StrPutI( vStr, pCex->nRegs );
+    Vec_StrPutI( vStr, pCex->nPis );
+    for ( i = 0; i < Abc_BitWordNum(pCex->nBits); i++ )
+        Vec_StrPutI_ne( vStr, (int)pCex->pData[i] );
+}
+Abc_Cex_t * Saig_ManCkptGetCex( Aig_Man_t * p, Vec_Str_t * vStr, int * pPos )
+{
+    Abc_Cex_t * pCex;
+    word nBits;
+    int i, iPo, iFrame, nRegs, nPis, fReal = Saig_ManCkptGetNum( vStr, pPos, 2 );
+    if ( fReal == 0 )
+        return (Abc_Cex_t *)(ABC_PTRINT_T)1;
+    iPo    = Saig_ManCkptGetNum( vStr, pPos, Saig_ManPoNum(p) );
+    iFrame = Saig_ManCkptGetNum( vStr, pPos, ABC_INFINITY );
+    nRegs  = Saig_ManCkptGetNum( vStr, pPos, ABC_INFINITY );
+    nPis   = Saig_ManCkptGetNum( vStr, pPos, ABC_INFINITY );
+    // the data of the CEX takes 4 bytes for every 32 bits
+    nBits  = nRegs + (word)nPis * (iFrame + 1);
+    if ( fReal == -1 || iPo == -1 || iFrame == -1 || nRegs != Saig_ManRegNum(p) || nPis != Saig_ManPiNum(p) ||
+         nBits >= ABC_INFINITY || nBits > 8 * (word)Abc_MaxInt(Vec_StrSize(vStr) - *pPos, 0) )
+    {
+        Saig_ManCkptFail( vStr, pPos );
+        return NULL;
+    }
+    pCex   = Abc_CexAlloc( nRegs, nPis, iFrame + 1 );
+    pCex->iPo    = iPo;
+    pCex->iFrame = iFrame;
+    for ( i = 0; i < Abc_BitWordNum(pCex->nBits); i++ )
+        pCex->pData[i] = Saig_ManCkptGetI_ne( vStr, pPos );
+    if ( *pPos > Vec_StrSize(vStr) )
+    {
+        Abc_CexFree( pCex );
+        return NULL;
+    }
+    return pCex;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if it is time to save the checkpoint.]
+
+  Description [Updates the time of the last checkpoint.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Saig_ManCkptTimeIsUp( abctime * pTimeLast, int fForce )
+{
+    abctime clk = Abc_Clock();
+    if ( !fForce && clk < *pTimeLast + SAIG_CKPT_PERIOD * CLOCKS_PER_SEC )
+        return 0;
+    *pTimeLast = clk;
+    return 1;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
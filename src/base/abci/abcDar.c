@@ -1801,7 +1801,7 @@ Abc_Ntk_t * Abc_NtkConstructFromCnf( Abc_Ntk_t * pNtk, Cnf_Man_t * p, Vec_Ptr_t
   SeeAlso     []
 
 ***********************************************************************/
-Abc_Ntk_t * Abc_NtkDarToCnf( Abc_Ntk_t * pNtk, char * pFileName, int fFastAlgo, int fChangePol, int fVerbose )
+Abc_Ntk_t * Abc_NtkDarToCnf( Abc_Ntk_t * pNtk, char * pFileName, int fFastAlgo, int fChangePol, int fBinary, int fVerbose )
 {
 //    Vec_Ptr_t * vMapped = NULL;
     Aig_Man_t * pMan;
@@ -1825,11 +1825,17 @@ Abc_Ntk_t * Abc_NtkDarToCnf( Abc_Ntk_t * pNtk, char * pFileName, int fFastAlgo,
     if ( fVerbose )
     Aig_ManPrintStats( pMan );
 
+    // derive CNF and write it into a file without storing it
+    if ( !fFastAlgo )
+    {
+        Cnf_DeriveWriteIntoFile( pMan, 0, pFileName, fChangePol, fBinary, 1 );
+        Cnf_ManFree();
+        Aig_ManStop( pMan );
+        return pNtkNew;
+    }
+
     // derive CNF
-    if ( fFastAlgo )
-        pCnf = Cnf_DeriveFast( pMan, 0 );
-    else
-        pCnf = Cnf_Derive( pMan, 0 );
+    pCnf = Cnf_DeriveFast( pMan, 0 );
 
     // adjust polarity
     if ( fChangePol )
@@ -242,9 +242,9 @@ satoko_opts_t * Cmd_DeriveOptionFromSettings( int argc, char ** argv )
     satoko_default_opts(&opts);
     Extra_UtilGetoptReset();
 #ifdef SATOKO_ACT_VAR_FIXED
-    while ( ( c = Extra_UtilGetopt( argc, argv, "CPDEFGHIJKLMNOQRSTUhv" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "CPDEFGHIJKLMNOQRSTUVhv" ) ) != EOF )
 #else
-    while ( ( c = Extra_UtilGetopt( argc, argv, "CPDEFGHIJKLMNOQRShv" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "CPDEFGHIJKLMNOQRSVhv" ) ) != EOF )
 #endif
     {
         switch ( c )
@@ -418,6 +418,15 @@ satoko_opts_t * Cmd_DeriveOptionFromSettings( int argc, char ** argv )
                if ( opts.var_decay < 0 )
                    return NULL;
                break;
+         case 'V':
+               if ( globalUtilOptind >= argc )
+               {
+                   Abc_Print( -1, "Command line switch \"-V\" should be followed by an integer.\n" );
+                   return NULL;
+               }
+               opts.inproc_first = (unsigned)atoi(argv[globalUtilOptind]);
+               globalUtilOptind++;
+               break;
 #ifdef SATOKO_ACT_VAR_FIXED
          case 'T':
                if ( globalUtilOptind >= argc )
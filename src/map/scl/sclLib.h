@@ -85,6 +85,7 @@ struct SC_SizePars_
     int        TimeOut;
     int        BuffTreeEst;      // ratio for buffer tree estimation
     int        BypassFreq;       // frequency to try bypassing
+    int        nProcs;           // the number of threads for timing update and sizing
     int        fUseDept;
     int        fDumpStats;
     int        fUseWireLoads;
@@ -228,8 +229,12 @@ struct SC_Lib_
     Vec_Ptr_t      vTempls;        // NamedSet<SC_TableTempl>  
     Vec_Ptr_t      vCells;         // NamedSet<SC_Cell>
     Vec_Ptr_t      vCellClasses;   // NamedSet<SC_Cell>
+    Vec_Ptr_t      vCorners;       // libraries of other timing corners (cells ordered as in this library)
     int *          pBins;          // hashing gateName -> gateId
     int            nBins;
+    int *          pImage;         // binary image whose tables are used in-place
+    int            nImageWords;    // the number of words in the image
+    int            fImageMapped;   // the image is memory-mapped
 };
 
 ////////////////////////////////////////////////////////////////////////
@@ -348,6 +353,8 @@ static inline SC_Lib * Abc_SclLibAlloc()
 }
 
 
+extern void Abc_SclImageRelease( SC_Lib * p );
+
 /**Function*************************************************************
 
   Synopsis    [Destructors of the library data-structures.]
@@ -442,7 +449,13 @@ static inline void Abc_SclLibFree( SC_Lib * p )
     SC_WireLoadSel * pWLS;
     SC_TableTempl * pTempl;
     SC_Cell * pCell;
+    SC_Lib * pCorner;
     int i;
+    Vec_PtrForEachEntry( SC_Lib *, &p->vCorners, pCorner, i )
+        Abc_SclLibFree( pCorner );
+    Vec_PtrErase( &p->vCorners );
+    if ( p->pImage )
+        Abc_SclImageRelease( p );
     SC_LibForEachWireLoad( p, pWL, i )
         Abc_SclWireLoadFree( pWL );
     Vec_PtrErase( &p->vWireLoads );
@@ -741,6 +754,10 @@ extern SC_Lib *      Abc_SclReadFromStr( Vec_Str_t * vOut );
 extern SC_Lib *      Abc_SclReadFromFile( char * pFileName );
 extern void          Abc_SclWriteScl( char * pFileName, SC_Lib * p );
 extern void          Abc_SclWriteLiberty( char * pFileName, SC_Lib * p );
+/*=== sclLibImage.c ===============================================================*/
+extern int           Abc_SclImageWrite( char * pFileName, SC_Lib * p, word SrcSize, word SrcHash );
+extern SC_Lib *      Abc_SclImageRead( char * pFileName, word SrcSize, word SrcHash );
+extern SC_Lib *      Abc_SclReadLibertyCached( char * pFileName, int fVerbose, int fVeryVerbose );
 /*=== sclLibUtil.c ===============================================================*/
 extern void          Abc_SclHashCells( SC_Lib * p );
 extern int           Abc_SclCellFind( SC_Lib * p, char * pName );
@@ -751,6 +768,7 @@ extern void          Abc_SclLinkCells( SC_Lib * p );
 extern void          Abc_SclPrintCells( SC_Lib * p, float Slew, float Gain, int fInvOnly, int fShort );
 extern void          Abc_SclConvertLeakageIntoArea( SC_Lib * p, float A, float B );
 extern void          Abc_SclLibNormalize( SC_Lib * p );
+extern int           Abc_SclLibAddCorner( SC_Lib * p, SC_Lib * pCorner );
 extern SC_Cell *     Abc_SclFindInvertor( SC_Lib * p, int fFindBuff );
 extern SC_Cell *     Abc_SclFindSmallestGate( SC_Cell * p, float CinMin );
 extern SC_WireLoad * Abc_SclFindWireLoadModel( SC_Lib * p, float Area );
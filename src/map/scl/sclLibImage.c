@@ -0,0 +1,756 @@
+/**CFile****************************************************************
+
+  FileName    [sclLibImage.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Standard-cell library representation.]
+
+  Synopsis    [Binary library image loaded by memory-mapping.]
+
+  Author      [agent]
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: sclLibImage.c,v 1.00 2026/10/17 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "sclLib.h"
+
+#include <sys/stat.h>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The library image is an array of 32-bit words. It starts with the header
+// containing the 8-byte signature, the image version, the SCL version, the
+// number of words in the image, the size and the checksum of the contents
+// of the source Liberty file (two words each). The header is followed by the data
+// in the order of Abc_SclImageWriteLibrary(). A string is written as the
+// number of words it takes (0 for NULL) followed by the zero-padded chars.
+// A table is written as the number of floats, the floats, the number of
+// integers, and the integers. The image does not contain pointers, so it
+// can be mapped at any address. When the image is loaded, the tables of
+// the timing surfaces, which take most of the image, are not copied but
+// used in-place, while the remaining data-structures are rebuilt.
+
+#define SCL_IMAGE_SIGN     "ABCSCLIM"
+#define SCL_IMAGE_VER_NUM  2
+#define SCL_IMAGE_HEAD     9
+
+typedef struct Scl_Image_t_ Scl_Image_t;
+struct Scl_Image_t_
+{
+    int *          pData;        // the image contents
+    int            nWords;       // the number of words
+    int            iPos;         // the current reading position
+    int            fError;       // the image is corrupted
+};
+
+static inline int   Scl_Flt2IntImage( float f )   { union { float f; int i; } u; u.f = f; return u.i; }
+static inline float Scl_Int2FltImage( int i )     { union { float f; int i; } u; u.i = i; return u.f; }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Writing primitive data into the image.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Abc_SclImagePutI( Vec_Int_t * vOut, int Num )
+{
+    Vec_IntPush( vOut, Num );
+}
+static inline void Abc_SclImagePutF( Vec_Int_t * vOut, float Num )
+{
+    Vec_IntPush( vOut, Scl_Flt2IntImage(Num) );
+}
+static inline void Abc_SclImagePutW( Vec_Int_t * vOut, word Num )
+{
+    Vec_IntPush( vOut, (int)(Num & 0xFFFFFFFF) );
+    Vec_IntPush( vOut, (int)(Num >> 32) );
+}
+static void Abc_SclImagePutS( Vec_Int_t * vOut, char * pStr )
+{
+    int nChars = pStr ? (int)strlen(pStr) : 0;
+    int nWords = pStr ? nChars / 4 + 1 : 0;
+    int Start  = Vec_IntSize(vOut) + 1;
+    Vec_IntPush( vOut, nWords );
+    Vec_IntFillExtra( vOut, Start + nWords, 0 );
+    if ( nChars )
+        memcpy( Vec_IntArray(vOut) + Start, pStr, (size_t)nChars );
+}
+static void Abc_SclImagePutTable( Vec_Int_t * vOut, Vec_Flt_t * vFlt, Vec_Int_t * vInt )
+{
+    float Entry;
+    int i, EntryI;
+    Vec_IntPush( vOut, Vec_FltSize(vFlt) );
+    Vec_FltForEachEntry( vFlt, Entry, i )
+        Abc_SclImagePutF( vOut, Entry );
+    Vec_IntPush( vOut, Vec_IntSize(vInt) );
+    Vec_IntForEachEntry( vInt, EntryI, i )
+        Vec_IntPush( vOut, EntryI );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writing the library into the image.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Abc_SclImageWriteSurface( Vec_Int_t * vOut, SC_Surface * p )
+{
+    Vec_Flt_t * vVec;
+    int i, k;
+    assert( Vec_PtrSize(&p->vData) == Vec_PtrSize(&p->vDataI) );
+    Abc_SclImagePutS( vOut, p->pName );
+    Abc_SclImagePutTable( vOut, &p->vIndex0, &p->vIndex0I );
+    Abc_SclImagePutTable( vOut, &p->vIndex1, &p->vIndex1I );
+    Abc_SclImagePutI( vOut, Vec_PtrSize(&p->vData) );
+    Vec_PtrForEachEntry( Vec_Flt_t *, &p->vData, vVec, i )
+        Abc_SclImagePutTable( vOut, vVec, (Vec_Int_t *)Vec_PtrEntry(&p->vDataI, i) );
+    for ( i = 0; i < 3; i++ )
+        for ( k = 0; k < 6; k++ )
+            Abc_SclImagePutF( vOut, p->approx[i][k] );
+}
+static void Abc_SclImageWriteLibrary( Vec_Int_t * vOut, SC_Lib * p )
+{
+    SC_WireLoad * pWL;
+    SC_WireLoadSel * pWLS;
+    SC_Cell * pCell;
+    SC_Pin * pPin;
+    SC_Timings * pRTime;
+    SC_Timing * pTime;
+    word Func;
+    int i, j, k, n;
+
+    Abc_SclImagePutS( vOut, p->pName );
+    Abc_SclImagePutS( vOut, p->default_wire_load );
+    Abc_SclImagePutS( vOut, p->default_wire_load_sel );
+    Abc_SclImagePutF( vOut, p->default_max_out_slew );
+    Abc_SclImagePutI( vOut, p->unit_time );
+    Abc_SclImagePutF( vOut, p->unit_cap_fst );
+    Abc_SclImagePutI( vOut, p->unit_cap_snd );
+
+    Abc_SclImagePutI( vOut, Vec_PtrSize(&p->vWireLoads) );
+    SC_LibForEachWireLoad( p, pWL, i )
+    {
+        Abc_SclImagePutS( vOut, pWL->pName );
+        Abc_SclImagePutF( vOut, pWL->cap );
+        Abc_SclImagePutF( vOut, pWL->slope );
+        Abc_SclImagePutTable( vOut, &pWL->vLen, &pWL->vFanout );
+    }
+
+    Abc_SclImagePutI( vOut, Vec_PtrSize(&p->vWireLoadSels) );
+    SC_LibForEachWireLoadSel( p, pWLS, i )
+    {
+        Abc_SclImagePutS( vOut, pWLS->pName );
+        Abc_SclImagePutI( vOut, Vec_FltSize(&pWLS->vAreaFrom) );
+        for ( j = 0; j < Vec_FltSize(&pWLS->vAreaFrom); j++)
+        {
+            Abc_SclImagePutF( vOut, Vec_FltEntry(&pWLS->vAreaFrom, j) );
+            Abc_SclImagePutF( vOut, Vec_FltEntry(&pWLS->vAreaTo, j) );
+            Abc_SclImagePutS( vOut, (char *)Vec_PtrEntry(&pWLS->vWireLoadModel, j) );
+        }
+    }
+
+    Abc_SclImagePutI( vOut, SC_LibCellNum(p) );
+    SC_LibForEachCell( p, pCell, i )
+    {
+        Abc_SclImagePutS( vOut, pCell->pName );
+        Abc_SclImagePutI( vOut, pCell->fSkip );
+        Abc_SclImagePutI( vOut, pCell->seq );
+        Abc_SclImagePutI( vOut, pCell->unsupp );
+        Abc_SclImagePutF( vOut, pCell->area );
+        Abc_SclImagePutF( vOut, pCell->leakage );
+        Abc_SclImagePutI( vOut, pCell->areaI );
+        Abc_SclImagePutI( vOut, pCell->leakageI );
+        Abc_SclImagePutI( vOut, pCell->drive_strength );
+        Abc_SclImagePutI( vOut, pCell->n_inputs );
+        Abc_SclImagePutI( vOut, pCell->n_outputs );
+        Abc_SclImagePutI( vOut, Vec_PtrSize(&pCell->vPins) );
+        SC_CellForEachPin( pCell, pPin, j )
+        {
+            Abc_SclImagePutS( vOut, pPin->pName );
+            Abc_SclImagePutI( vOut, (int)pPin->dir );
+            Abc_SclImagePutF( vOut, pPin->cap );
+            Abc_SclImagePutF( vOut, pPin->rise_cap );
+            Abc_SclImagePutF( vOut, pPin->fall_cap );
+            Abc_SclImagePutI( vOut, pPin->rise_capI );
+            Abc_SclImagePutI( vOut, pPin->fall_capI );
+            Abc_SclImagePutF( vOut, pPin->max_out_cap );
+            Abc_SclImagePutF( vOut, pPin->max_out_slew );
+            Abc_SclImagePutS( vOut, pPin->func_text );
+            Abc_SclImagePutI( vOut, Vec_WrdSize(&pPin->vFunc) );
+            Vec_WrdForEachEntry( &pPin->vFunc, Func, k )
+                Abc_SclImagePutW( vOut, Func );
+            Abc_SclImagePutI( vOut, Vec_PtrSize(&pPin->vRTimings) );
+            SC_PinForEachRTiming( pPin, pRTime, k )
+            {
+                Abc_SclImagePutS( vOut, pRTime->pName );
+                Abc_SclImagePutI( vOut, Vec_PtrSize(&pRTime->vTimings) );
+                Vec_PtrForEachEntry( SC_Timing *, &pRTime->vTimings, pTime, n )
+                {
+                    Abc_SclImagePutS( vOut, pTime->related_pin );
+                    Abc_SclImagePutI( vOut, (int)pTime->tsense );
+                    Abc_SclImagePutS( vOut, pTime->when_text );
+                    Abc_SclImageWriteSurface( vOut, &pTime->pCellRise );
+                    Abc_SclImageWriteSurface( vOut, &pTime->pCellFall );
+                    Abc_SclImageWriteSurface( vOut, &pTime->pRiseTrans );
+                    Abc_SclImageWriteSurface( vOut, &pTime->pFallTrans );
+                }
+            }
+        }
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the library image into a file.]
+
+  Description [The image is written into a temporary file, which then
+  replaces the old image, so that another process reading the image at
+  the same time never sees an incomplete file. Except on Windows, where
+  rename() does not overwrite, the old image is not removed beforehand.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_SclImageWrite( char * pFileName, SC_Lib * p, word SrcSize, word SrcHash )
+{
+    char * pFileTemp = ABC_ALLOC( char, strlen(pFileName) + 5 );
+    Vec_Int_t * vOut = Vec_IntAlloc( 1 << 16 );
+    FILE * pFile;
+    int RetValue;
+    Vec_IntFill( vOut, 2, 0 );
+    memcpy( Vec_IntArray(vOut), SCL_IMAGE_SIGN, 8 );
+    Abc_SclImagePutI( vOut, SCL_IMAGE_VER_NUM );
+    Abc_SclImagePutI( vOut, ABC_SCL_CUR_VERSION );
+    Abc_SclImagePutI( vOut, 0 );
+    Abc_SclImagePutW( vOut, SrcSize );
+    Abc_SclImagePutW( vOut, SrcHash );
+    assert( Vec_IntSize(vOut) == SCL_IMAGE_HEAD );
+    Abc_SclImageWriteLibrary( vOut, p );
+    Vec_IntWriteEntry( vOut, 4, Vec_IntSize(vOut) );
+    sprintf( pFileTemp, "%s.tmp", pFileName );
+    pFile = fopen( pFileTemp, "wb" );
+    if ( pFile == NULL )
+    {
+        ABC_FREE( pFileTemp );
+        Vec_IntFree( vOut );
+        return 0;
+    }
+    RetValue = (int)fwrite( Vec_IntArray(vOut), sizeof(int), (size_t)Vec_IntSize(vOut), pFile );
+    RetValue = (fclose( pFile ) == 0) && RetValue == Vec_IntSize(vOut);
+#ifdef _WIN32
+    if ( RetValue )
+        remove( pFileName );
+#endif
+    if ( !RetValue || rename( pFileTemp, pFileName ) )
+    {
+        remove( pFileTemp );
+        RetValue = 0;
+    }
+    ABC_FREE( pFileTemp );
+    Vec_IntFree( vOut );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reading primitive data from the image.]
+
+  Description [Reading past the end of the image sets the error flag.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Abc_SclImageGetI( Scl_Image_t * p )
+{
+    if ( p->iPos >= p->nWords )
+    {
+        p->fError = 1;
+        return 0;
+    }
+    return p->pData[p->iPos++];
+}
+static inline float Abc_SclImageGetF( Scl_Image_t * p )
+{
+    return Scl_Int2FltImage( Abc_SclImageGetI(p) );
+}
+static inline word Abc_SclImageGetW( Scl_Image_t * p )
+{
+    word Lo = (word)(unsigned)Abc_SclImageGetI(p);
+    word Hi = (word)(unsigned)Abc_SclImageGetI(p);
+    return Lo | (Hi << 32);
+}
+static int * Abc_SclImageGetArray( Scl_Image_t * p, int * pnSize )
+{
+    int * pArray;
+    *pnSize = Abc_SclImageGetI( p );
+    if ( *pnSize < 0 || *pnSize > p->nWords - p->iPos )
+    {
+        p->fError = 1;
+        *pnSize = 0;
+    }
+    if ( *pnSize == 0 )
+        return NULL;
+    pArray = p->pData + p->iPos;
+    p->iPos += *pnSize;
+    return pArray;
+}
+static char * Abc_SclImageGetS( Scl_Image_t * p )
+{
+    int nWords;
+    char * pStr = (char *)Abc_SclImageGetArray( p, &nWords );
+    if ( pStr == NULL )
+        return NULL;
+    if ( pStr[4 * nWords - 1] != 0 )
+    {
+        p->fError = 1;
+        return NULL;
+    }
+    return Abc_UtilStrsav( pStr );
+}
+static void Abc_SclImageGetTable( Scl_Image_t * p, Vec_Flt_t * vFlt, Vec_Int_t * vInt )
+{
+    vFlt->pArray = (float *)Abc_SclImageGetArray( p, &vFlt->nSize );
+    vFlt->nCap   = vFlt->nSize;
+    vInt->pArray = Abc_SclImageGetArray( p, &vInt->nSize );
+    vInt->nCap   = vInt->nSize;
+}
+static void Abc_SclImageCopyTable( Scl_Image_t * p, Vec_Flt_t * vFlt, Vec_Int_t * vInt )
+{
+    Vec_Flt_t vFltImage;
+    Vec_Int_t vIntImage;
+    Abc_SclImageGetTable( p, &vFltImage, &vIntImage );
+    Vec_FltGrow( vFlt, vFltImage.nSize );
+    if ( vFltImage.nSize )
+        memcpy( Vec_FltArray(vFlt), vFltImage.pArray, sizeof(float) * (size_t)vFltImage.nSize );
+    vFlt->nSize = vFltImage.nSize;
+    Vec_IntGrow( vInt, vIntImage.nSize );
+    if ( vIntImage.nSize )
+        memcpy( Vec_IntArray(vInt), vIntImage.pArray, sizeof(int) * (size_t)vIntImage.nSize );
+    vInt->nSize = vIntImage.nSize;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reading the library from the image.]
+
+  Description [The tables of the timing surfaces point into the image.
+  The other data-structures, including all strings, are allocated as
+  usual, so that the library can be modified by the other procedures.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Abc_SclImageReadSurface( Scl_Image_t * pImg, SC_Surface * p )
+{
+    Vec_Flt_t * vVec;
+    Vec_Int_t * vVecI;
+    int i, k, nRows;
+    p->pName = Abc_SclImageGetS( pImg );
+    Abc_SclImageGetTable( pImg, &p->vIndex0, &p->vIndex0I );
+    Abc_SclImageGetTable( pImg, &p->vIndex1, &p->vIndex1I );
+    nRows = Abc_SclImageGetI( pImg );
+    if ( nRows < 0 || nRows > pImg->nWords - pImg->iPos )
+    {
+        pImg->fError = 1;
+        return;
+    }
+    Vec_PtrGrow( &p->vData, nRows );
+    Vec_PtrGrow( &p->vDataI, nRows );
+    for ( i = 0; i < nRows && !pImg->fError; i++ )
+    {
+        vVec  = ABC_CALLOC( Vec_Flt_t, 1 );
+        vVecI = ABC_CALLOC( Vec_Int_t, 1 );
+        Vec_PtrPush( &p->vData, vVec );
+        Vec_PtrPush( &p->vDataI, vVecI );
+        Abc_SclImageGetTable( pImg, vVec, vVecI );
+    }
+    for ( i = 0; i < 3; i++ )
+        for ( k = 0; k < 6; k++ )
+            p->approx[i][k] = Abc_SclImageGetF( pImg );
+}
+static int Abc_SclImageReadLibrary( Scl_Image_t * pImg, SC_Lib * p )
+{
+    int i, j, k, n, nItems, nPins, nRTimes, nTimes;
+
+    p->pName                 = Abc_SclImageGetS( pImg );
+    p->default_wire_load     = Abc_SclImageGetS( pImg );
+    p->default_wire_load_sel = Abc_SclImageGetS( pImg );
+    p->default_max_out_slew  = Abc_SclImageGetF( pImg );
+    p->unit_time             = Abc_SclImageGetI( pImg );
+    p->unit_cap_fst          = Abc_SclImageGetF( pImg );
+    p->unit_cap_snd          = Abc_SclImageGetI( pImg );
+
+    nItems = Abc_SclImageGetI( pImg );
+    for ( i = 0; i < nItems && !pImg->fError; i++ )
+    {
+        SC_WireLoad * pWL = Abc_SclWireLoadAlloc();
+        Vec_PtrPush( &p->vWireLoads, pWL );
+        pWL->pName = Abc_SclImageGetS( pImg );
+        pWL->cap   = Abc_SclImageGetF( pImg );
+        pWL->slope = Abc_SclImageGetF( pImg );
+        Abc_SclImageCopyTable( pImg, &pWL->vLen, &pWL->vFanout );
+    }
+
+    nItems = Abc_SclImageGetI( pImg );
+    for ( i = 0; i < nItems && !pImg->fError; i++ )
+    {
+        SC_WireLoadSel * pWLS = Abc_SclWireLoadSelAlloc();
+        Vec_PtrPush( &p->vWireLoadSels, pWLS );
+        pWLS->pName = Abc_SclImageGetS( pImg );
+        for ( j = Abc_SclImageGetI( pImg ); j > 0 && !pImg->fError; j-- )
+        {
+            Vec_FltPush( &pWLS->vAreaFrom,      Abc_SclImageGetF(pImg) );
+            Vec_FltPush( &pWLS->vAreaTo,        Abc_SclImageGetF(pImg) );
+            Vec_PtrPush( &pWLS->vWireLoadModel, Abc_SclImageGetS(pImg) );
+        }
+    }
+
+    nItems = Abc_SclImageGetI( pImg );
+    for ( i = 0; i < nItems && !pImg->fError; i++ )
+    {
+        SC_Cell * pCell = Abc_SclCellAlloc();
+        pCell->Id = SC_LibCellNum(p);
+        Vec_PtrPush( &p->vCells, pCell );
+        pCell->pName          = Abc_SclImageGetS( pImg );
+        pCell->fSkip          = Abc_SclImageGetI( pImg );
+        pCell->seq            = Abc_SclImageGetI( pImg );
+        pCell->unsupp         = Abc_SclImageGetI( pImg );
+        pCell->area           = Abc_SclImageGetF( pImg );
+        pCell->leakage        = Abc_SclImageGetF( pImg );
+        pCell->areaI          = Abc_SclImageGetI( pImg );
+        pCell->leakageI       = Abc_SclImageGetI( pImg );
+        pCell->drive_strength = Abc_SclImageGetI( pImg );
+        pCell->n_inputs       = Abc_SclImageGetI( pImg );
+        pCell->n_outputs      = Abc_SclImageGetI( pImg );
+        nPins = Abc_SclImageGetI( pImg );
+        if ( pCell->n_inputs < 0 || pCell->n_outputs < 0 || nPins != pCell->n_inputs + pCell->n_outputs )
+            pImg->fError = 1;
+        for ( j = 0; j < nPins && !pImg->fError; j++ )
+        {
+            SC_Pin * pPin = Abc_SclPinAlloc();
+            Vec_PtrPush( &pCell->vPins, pPin );
+            pPin->pName        = Abc_SclImageGetS( pImg );
+            pPin->dir          = (SC_Dir)Abc_SclImageGetI( pImg );
+            pPin->cap          = Abc_SclImageGetF( pImg );
+            pPin->rise_cap     = Abc_SclImageGetF( pImg );
+            pPin->fall_cap     = Abc_SclImageGetF( pImg );
+            pPin->rise_capI    = Abc_SclImageGetI( pImg );
+            pPin->fall_capI    = Abc_SclImageGetI( pImg );
+            pPin->max_out_cap  = Abc_SclImageGetF( pImg );
+            pPin->max_out_slew = Abc_SclImageGetF( pImg );
+            pPin->func_text    = Abc_SclImageGetS( pImg );
+            for ( k = Abc_SclImageGetI( pImg ); k > 0 && !pImg->fError; k-- )
+                Vec_WrdPush( &pPin->vFunc, Abc_SclImageGetW(pImg) );
+            nRTimes = Abc_SclImageGetI( pImg );
+            for ( k = 0; k < nRTimes && !pImg->fError; k++ )
+            {
+                SC_Timings * pRTime = Abc_SclTimingsAlloc();
+                Vec_PtrPush( &pPin->vRTimings, pRTime );
+                pRTime->pName = Abc_SclImageGetS( pImg );
+                nTimes = Abc_SclImageGetI( pImg );
+                for ( n = 0; n < nTimes && !pImg->fError; n++ )
+                {
+                    SC_Timing * pTime = Abc_SclTimingAlloc();
+                    Vec_PtrPush( &pRTime->vTimings, pTime );
+                    pTime->related_pin = Abc_SclImageGetS( pImg );
+                    pTime->tsense      = (SC_TSense)Abc_SclImageGetI( pImg );
+                    pTime->when_text   = Abc_SclImageGetS( pImg );
+                    Abc_SclImageReadSurface( pImg, &pTime->pCellRise );
+                    Abc_SclImageReadSurface( pImg, &pTime->pCellFall );
+                    Abc_SclImageReadSurface( pImg, &pTime->pRiseTrans );
+                    Abc_SclImageReadSurface( pImg, &pTime->pFallTrans );
+                }
+            }
+        }
+    }
+    return !pImg->fError && pImg->iPos == pImg->nWords;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Maps the image file into memory.]
+
+  Description [The file is mapped privately, so that the tables used
+  in-place can be updated without changing the file. If memory-mapping
+  is not available, the file is read into memory.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int * Abc_SclImageMap( char * pFileName, int * pnWords, int * pfMapped )
+{
+    int * pData = NULL;
+    int nFileSize = 0;
+#ifndef _WIN32
+    struct stat Stat;
+    void * pMap;
+    int fd = open( pFileName, O_RDONLY );
+    if ( fd == -1 )
+        return NULL;
+    if ( fstat( fd, &Stat ) == -1 || Stat.st_size < 4 * SCL_IMAGE_HEAD || Stat.st_size > 0x7FFFFFFF )
+    {
+        close( fd );
+        return NULL;
+    }
+    nFileSize = (int)Stat.st_size;
+    pMap = mmap( NULL, (size_t)nFileSize, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0 );
+    close( fd );
+    if ( pMap == MAP_FAILED )
+        return NULL;
+    pData = (int *)pMap;
+    *pfMapped = 1;
+#else
+    FILE * pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+        return NULL;
+    fseek( pFile, 0, SEEK_END );
+    nFileSize = (int)ftell( pFile );
+    rewind( pFile );
+    if ( nFileSize < 4 * SCL_IMAGE_HEAD )
+    {
+        fclose( pFile );
+        return NULL;
+    }
+    pData = ABC_ALLOC( int, nFileSize / 4 + 1 );
+    nFileSize = (int)fread( pData, 1, (size_t)nFileSize, pFile );
+    fclose( pFile );
+    *pfMapped = 0;
+#endif
+    *pnWords = nFileSize / 4;
+    return pData;
+}
+static void Abc_SclImageUnmap( int * pData, int nWords, int fMapped )
+{
+#ifndef _WIN32
+    if ( fMapped )
+        munmap( (void *)pData, 4 * (size_t)nWords );
+    else
+#endif
+    ABC_FREE( pData );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the library from the image file.]
+
+  Description [Returns NULL if the file does not exist, is corrupted,
+  was written by another version, or for another source file.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+SC_Lib * Abc_SclImageRead( char * pFileName, word SrcSize, word SrcHash )
+{
+    Scl_Image_t Img, * pImg = &Img;
+    SC_Lib * p;
+    int fMapped = 0;
+    memset( pImg, 0, sizeof(Scl_Image_t) );
+    pImg->pData = Abc_SclImageMap( pFileName, &pImg->nWords, &fMapped );
+    if ( pImg->pData == NULL )
+        return NULL;
+    if ( memcmp(pImg->pData, SCL_IMAGE_SIGN, 8) || pImg->pData[2] != SCL_IMAGE_VER_NUM ||
+         pImg->pData[3] != ABC_SCL_CUR_VERSION || pImg->pData[4] != pImg->nWords )
+    {
+        Abc_SclImageUnmap( pImg->pData, pImg->nWords, fMapped );
+        return NULL;
+    }
+    pImg->iPos = 5;
+    if ( Abc_SclImageGetW(pImg) != SrcSize || Abc_SclImageGetW(pImg) != SrcHash )
+    {
+        Abc_SclImageUnmap( pImg->pData, pImg->nWords, fMapped );
+        return NULL;
+    }
+    p = Abc_SclLibAlloc();
+    p->pImage       = pImg->pData;
+    p->nImageWords  = pImg->nWords;
+    p->fImageMapped = fMapped;
+    if ( !Abc_SclImageReadLibrary( pImg, p ) )
+    {
+        Abc_SclLibFree( p );
+        return NULL;
+    }
+    Abc_SclHashCells( p );
+    Abc_SclLinkCells( p );
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Releases the image used by the library.]
+
+  Description [Detaches the tables pointing into the image, so that
+  they are not freed, and unmaps the image.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Abc_SclImageDetachSurface( SC_Surface * p )
+{
+    Vec_Flt_t * vVec;
+    Vec_Int_t * vVecI;
+    int i;
+    p->vIndex0.pArray  = NULL;
+    p->vIndex1.pArray  = NULL;
+    p->vIndex0I.pArray = NULL;
+    p->vIndex1I.pArray = NULL;
+    Vec_PtrForEachEntry( Vec_Flt_t *, &p->vData, vVec, i )
+        vVec->pArray = NULL;
+    Vec_PtrForEachEntry( Vec_Int_t *, &p->vDataI, vVecI, i )
+        vVecI->pArray = NULL;
+}
+void Abc_SclImageRelease( SC_Lib * p )
+{
+    SC_Cell * pCell;
+    SC_Pin * pPin;
+    SC_Timings * pRTime;
+    SC_Timing * pTime;
+    int i, k, m, n;
+    if ( p->pImage == NULL )
+        return;
+    SC_LibForEachCell( p, pCell, i )
+    SC_CellForEachPin( pCell, pPin, k )
+    SC_PinForEachRTiming( pPin, pRTime, m )
+    Vec_PtrForEachEntry( SC_Timing *, &pRTime->vTimings, pTime, n )
+    {
+        Abc_SclImageDetachSurface( &pTime->pCellRise );
+        Abc_SclImageDetachSurface( &pTime->pCellFall );
+        Abc_SclImageDetachSurface( &pTime->pRiseTrans );
+        Abc_SclImageDetachSurface( &pTime->pFallTrans );
+    }
+    Abc_SclImageUnmap( p->pImage, p->nImageWords, p->fImageMapped );
+    p->pImage = NULL;
+    p->nImageWords = 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the size and the checksum of the file contents.]
+
+  Description [Uses 64-bit FNV-1a. Returns 0 if the file cannot be read.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Abc_SclImageFileChecksum( char * pFileName, word * pSize, word * pHash )
+{
+    unsigned char * pBuffer;
+    word Hash = ABC_CONST(0xcbf29ce484222325);
+    word Size = 0;
+    size_t i, nRead;
+    FILE * pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+        return 0;
+    pBuffer = ABC_ALLOC( unsigned char, 1 << 16 );
+    while ( (nRead = fread( pBuffer, 1, 1 << 16, pFile )) > 0 )
+    {
+        for ( i = 0; i < nRead; i++ )
+            Hash = (Hash ^ pBuffer[i]) * ABC_CONST(0x100000001b3);
+        Size += nRead;
+    }
+    ABC_FREE( pBuffer );
+    if ( ferror( pFile ) )
+    {
+        fclose( pFile );
+        return 0;
+    }
+    fclose( pFile );
+    *pSize = Size;
+    *pHash = Hash;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads Liberty library using the binary image as a cache.]
+
+  Description [The image is stored in file "<file>.scli". It is used
+  if it was derived from the current version of the Liberty file, as
+  determined by the size and the checksum of the file contents, so that
+  edits within the timestamp granularity are not missed. Otherwise, the
+  Liberty file is parsed and the image is regenerated.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+SC_Lib * Abc_SclReadLibertyCached( char * pFileName, int fVerbose, int fVeryVerbose )
+{
+    abctime clk = Abc_Clock();
+    char * pFileImage;
+    word SrcSize, SrcHash;
+    SC_Lib * p;
+    if ( !Abc_SclImageFileChecksum( pFileName, &SrcSize, &SrcHash ) )
+        return Abc_SclReadLiberty( pFileName, fVerbose, fVeryVerbose );
+    pFileImage = ABC_ALLOC( char, strlen(pFileName) + 6 );
+    sprintf( pFileImage, "%s.scli", pFileName );
+    p = Abc_SclImageRead( pFileImage, SrcSize, SrcHash );
+    if ( p != NULL )
+    {
+        p->pFileName = Abc_UtilStrsav( pFileName );
+        if ( fVerbose )
+        {
+            printf( "Library \"%s\" from \"%s\" has %d cells (loaded from image \"%s\").  ",
+                p->pName, pFileName, SC_LibCellNum(p), pFileImage );
+            Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+        }
+        ABC_FREE( pFileImage );
+        return p;
+    }
+    p = Abc_SclReadLiberty( pFileName, fVerbose, fVeryVerbose );
+    if ( p != NULL && !Abc_SclImageWrite( pFileImage, p, SrcSize, SrcHash ) && fVerbose )
+        printf( "Cannot write library image into file \"%s\".\n", pFileImage );
+    else if ( p != NULL && fVerbose )
+        printf( "Library image was written into file \"%s\".\n", pFileImage );
+    ABC_FREE( pFileImage );
+    return p;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -782,6 +782,99 @@ void Abc_SclLibNormalize( SC_Lib * p )
     }
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Adds the library of another timing corner.]
+
+  Description [The corner library should contain the cells of this library
+  with the same pins and functions. Its cells are reordered, so that each
+  cell has the same ID as the cell with the same name in this library,
+  followed by the cells not present in this library. The classes of the
+  corner library are rebuilt to mirror the classes of this library, so that
+  the cells not present in this library are not reachable when sizing.
+  Returns 0 if the libraries do not match, in which case the corner library
+  is not changed.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_SclLibAddCorner( SC_Lib * p, SC_Lib * pCorner )
+{
+    Vec_Ptr_t * vCells;
+    SC_Cell * pCell, * pCellC;
+    int i, k, iCell;
+    vCells = Vec_PtrAlloc( SC_LibCellNum(pCorner) );
+    SC_LibForEachCell( p, pCell, i )
+    {
+        iCell = Abc_SclCellFind( pCorner, pCell->pName );
+        if ( iCell == -1 )
+        {
+            printf( "Cell \"%s\" is not found in library \"%s\".\n", pCell->pName, pCorner->pName );
+            Vec_PtrFree( vCells );
+            return 0;
+        }
+        pCellC = SC_LibCell( pCorner, iCell );
+        if ( pCellC->n_inputs != pCell->n_inputs || pCellC->n_outputs != pCell->n_outputs || !Vec_WrdEqual(SC_CellFunc(pCellC), SC_CellFunc(pCell)) )
+        {
+            printf( "Cell \"%s\" has different pins or function in library \"%s\".\n", pCell->pName, pCorner->pName );
+            Vec_PtrFree( vCells );
+            return 0;
+        }
+        for ( k = 0; k < pCell->n_inputs; k++ )
+            if ( strcmp(SC_CellPinName(pCell, k), SC_CellPinName(pCellC, k)) )
+                break;
+        if ( k < pCell->n_inputs )
+        {
+            printf( "Cell \"%s\" has different order of pins in library \"%s\".\n", pCell->pName, pCorner->pName );
+            Vec_PtrFree( vCells );
+            return 0;
+        }
+        Vec_PtrPush( vCells, pCellC );
+    }
+    SC_LibForEachCell( pCorner, pCellC, i )
+        if ( Abc_SclCellFind(p, pCellC->pName) == -1 )
+            Vec_PtrPush( vCells, pCellC );
+    assert( Vec_PtrSize(vCells) == SC_LibCellNum(pCorner) );
+    // reorder the cells and rehash them
+    Vec_PtrClear( &pCorner->vCells );
+    Vec_PtrForEachEntry( SC_Cell *, vCells, pCellC, i )
+    {
+        pCellC->Id = i;
+        Vec_PtrPush( &pCorner->vCells, pCellC );
+    }
+    Vec_PtrFree( vCells );
+    ABC_FREE( pCorner->pBins );
+    pCorner->nBins = 0;
+    Abc_SclHashCells( pCorner );
+    // link the cells into the same classes as the cells of this library
+    SC_LibForEachCell( pCorner, pCellC, i )
+    {
+        if ( i < SC_LibCellNum(p) )
+        {
+            pCell = SC_LibCell( p, i );
+            pCellC->pNext  = SC_LibCell( pCorner, pCell->pNext->Id );
+            pCellC->pPrev  = SC_LibCell( pCorner, pCell->pPrev->Id );
+            pCellC->pRepr  = SC_LibCell( pCorner, pCell->pRepr->Id );
+            pCellC->pAve   = SC_LibCell( pCorner, pCell->pAve->Id );
+            pCellC->Order  = pCell->Order;
+            pCellC->nGates = pCell->nGates;
+        }
+        else
+        {
+            pCellC->pNext  = pCellC->pPrev = pCellC->pRepr = pCellC->pAve = pCellC;
+            pCellC->Order  = 0;
+            pCellC->nGates = 1;
+        }
+    }
+    Vec_PtrClear( &pCorner->vCellClasses );
+    SC_LibForEachCellClass( p, pCell, i )
+        Vec_PtrPush( &pCorner->vCellClasses, SC_LibCell(pCorner, pCell->Id) );
+    Vec_PtrPush( &p->vCorners, pCorner );
+    return 1;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Derives simple GENLIB library.]
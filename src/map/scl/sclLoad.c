@@ -105,7 +105,7 @@ void Abc_SclAddWireLoad( SC_Man * p, Abc_Obj_t * pObj, int fSubtr )
     Abc_SclObjLoad(p, pObj)->rise += fSubtr ? -Load : Load;
     Abc_SclObjLoad(p, pObj)->fall += fSubtr ? -Load : Load;
 }
-void Abc_SclComputeLoad( SC_Man * p )
+static void Abc_SclComputeLoadCorner( SC_Man * p )
 {
     Abc_Obj_t * pObj, * pFanin;
     int i, k;
@@ -186,6 +186,20 @@ void Abc_SclComputeLoad( SC_Man * p )
 //        printf( "Average load = %.2f\n", p->EstLoadAve );
     }
 }
+void Abc_SclComputeLoad( SC_Man * p )
+{
+    int c, iCorner = p->iCorner;
+    float EstLoadAve = 0;
+    // the average load of the first corner is used for estimation
+    for ( c = p->nCorners - 1; c >= 0; c-- )
+    {
+        Abc_SclManSetCorner( p, c );
+        Abc_SclComputeLoadCorner( p );
+        EstLoadAve = p->EstLoadAve;
+    }
+    Abc_SclManSetCorner( p, iCorner );
+    p->EstLoadAve = EstLoadAve;
+}
 
 /**Function*************************************************************
 
@@ -201,32 +215,40 @@ void Abc_SclComputeLoad( SC_Man * p )
 void Abc_SclUpdateLoad( SC_Man * p, Abc_Obj_t * pObj, SC_Cell * pOld, SC_Cell * pNew )
 {
     Abc_Obj_t * pFanin;
-    int k;
-    Abc_ObjForEachFanin( pObj, pFanin, k )
+    int k, c;
+    for ( c = 0; c < p->nCorners; c++ )
     {
-        SC_Pair * pLoad = Abc_SclObjLoad( p, pFanin );
-        SC_Pin * pPinOld = SC_CellPin( pOld, k );
-        SC_Pin * pPinNew = SC_CellPin( pNew, k );
-        pLoad->rise += pPinNew->rise_cap - pPinOld->rise_cap;
-        pLoad->fall += pPinNew->fall_cap - pPinOld->fall_cap;
+        SC_Cell * pOldC = SC_LibCell( p->pCornerLibs[c], pOld->Id );
+        SC_Cell * pNewC = SC_LibCell( p->pCornerLibs[c], pNew->Id );
+        Abc_ObjForEachFanin( pObj, pFanin, k )
+        {
+            SC_Pair * pLoad = Abc_SclObjLoadCorner( p, pFanin, c );
+            SC_Pin * pPinOld = SC_CellPin( pOldC, k );
+            SC_Pin * pPinNew = SC_CellPin( pNewC, k );
+            pLoad->rise += pPinNew->rise_cap - pPinOld->rise_cap;
+            pLoad->fall += pPinNew->fall_cap - pPinOld->fall_cap;
+        }
     }
 }
 void Abc_SclUpdateLoadSplit( SC_Man * p, Abc_Obj_t * pBuffer, Abc_Obj_t * pFanout )
 {
     SC_Pin * pPin;
     SC_Pair * pLoad;
-    int iFanin = Abc_NodeFindFanin( pFanout, pBuffer );
+    int c, iFanin = Abc_NodeFindFanin( pFanout, pBuffer );
     assert( iFanin >= 0 );
     assert( Abc_ObjFaninNum(pBuffer) == 1 );
-    pPin = SC_CellPin( Abc_SclObjCell(pFanout), iFanin );
-    // update load of the buffer
-    pLoad = Abc_SclObjLoad( p, pBuffer );
-    pLoad->rise -= pPin->rise_cap;
-    pLoad->fall -= pPin->fall_cap;
-    // update load of the fanin
-    pLoad = Abc_SclObjLoad( p, Abc_ObjFanin0(pBuffer) );
-    pLoad->rise += pPin->rise_cap;
-    pLoad->fall += pPin->fall_cap;
+    for ( c = 0; c < p->nCorners; c++ )
+    {
+        pPin = SC_CellPin( SC_LibCell(p->pCornerLibs[c], Abc_SclObjCellId(pFanout)), iFanin );
+        // update load of the buffer
+        pLoad = Abc_SclObjLoadCorner( p, pBuffer, c );
+        pLoad->rise -= pPin->rise_cap;
+        pLoad->fall -= pPin->fall_cap;
+        // update load of the fanin
+        pLoad = Abc_SclObjLoadCorner( p, Abc_ObjFanin0(pBuffer), c );
+        pLoad->rise += pPin->rise_cap;
+        pLoad->fall += pPin->fall_cap;
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////
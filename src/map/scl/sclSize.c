@@ -173,6 +173,17 @@ void Abc_SclTimeNtkPrint( SC_Man * p, int fShowAll, int fPrintPath )
     Abc_Print( 1, "            \n" );
 #endif
 
+    if ( p->nCorners > 1 )
+    {
+        int c;
+        for ( c = 0; c < p->nCorners; c++ )
+        {
+            float Delay = 0;
+            Abc_NtkForEachCo( p->pNtk, pObj, i )
+                Delay = Abc_MaxFloat( Delay, SC_PairMax(Abc_SclObjTimeCorner(p, pObj, c)) );
+            Abc_Print( 1, "Corner %d : Library = \"%s\"  Delay =%9.2f ps%s\n", c, p->pCornerLibs[c]->pName, Delay, c == p->iCorner ? "  (worst)" : "" );
+        }
+    }
     if ( fShowAll )
     {
 //        printf( "Timing information for all nodes: \n" );
@@ -290,11 +301,6 @@ static inline void Abc_SclDeptObj( SC_Man * p, Abc_Obj_t * pObj )
         Abc_SclDeptFanin( p, pTime, pFanout, pObj );
     }
 }
-static inline float Abc_SclObjLoadValue( SC_Man * p, Abc_Obj_t * pObj )
-{
-//    float Value = Abc_MaxFloat(pLoad->fall, pLoad->rise) / (p->EstLoadAve * p->EstLoadMax);
-    return (0.5 * Abc_SclObjLoad(p, pObj)->fall + 0.5 * Abc_SclObjLoad(p, pObj)->rise) / (p->EstLoadAve * p->EstLoadMax);
-}
 static inline void Abc_SclTimeCi( SC_Man * p, Abc_Obj_t * pObj )
 {
     if ( p->pPiDrive != NULL )
@@ -309,13 +315,12 @@ void Abc_SclTimeNode( SC_Man * p, Abc_Obj_t * pObj, int fDept )
 {
     SC_Timing * pTime;
     SC_Cell * pCell;
-    int k;
+    int k, fEst;
     SC_Pair * pLoad = Abc_SclObjLoad( p, pObj );
-    float LoadRise = pLoad->rise;
-    float LoadFall = pLoad->fall;
+    SC_Pair Load = *pLoad;
     float DeptRise = 0;
     float DeptFall = 0;
-    float Value = p->EstLoadMax ? Abc_SclObjLoadValue( p, pObj ) : 0;
+    float EstDelta;
     Abc_Obj_t * pFanin;
     if ( Abc_ObjIsCi(pObj) )
     {
@@ -328,21 +333,19 @@ void Abc_SclTimeNode( SC_Man * p, Abc_Obj_t * pObj, int fDept )
         if ( !fDept )
         {
             Abc_SclObjDupFanin( p, pObj );
-            Vec_FltWriteEntry( p->vTimesOut, pObj->iData, Abc_SclObjTimeMax(p, pObj) );
+            Vec_FltWriteEntry( p->vTimesOut, pObj->iData, Abc_SclObjTimeMaxCorners(p, pObj) );
             Vec_QueUpdate( p->vQue, pObj->iData );
         }
         return;
     }
     assert( Abc_ObjIsNode(pObj) );
-//    if ( !(Abc_ObjFaninNum(pObj) == 1 && Abc_ObjIsPi(Abc_ObjFanin0(pObj))) && p->EstLoadMax && Value > 1 )
-    if ( p->EstLoadMax && Value > 1 )
+    // the estimated load is used while the fanins are visited
+    fEst = Abc_SclLoadEstimate( p, &Load, pLoad, &EstDelta );
+    if ( fEst )
     {
-        pLoad->rise = p->EstLoadAve * p->EstLoadMax;
-        pLoad->fall = p->EstLoadAve * p->EstLoadMax;
         if ( fDept )
         {
             SC_Pair * pDepOut  = Abc_SclObjDept( p, pObj );
-            float EstDelta = p->EstLinear * log( Value );
             DeptRise = pDepOut->rise;
             DeptFall = pDepOut->fall;
             pDepOut->rise += EstDelta;
@@ -361,10 +364,9 @@ void Abc_SclTimeNode( SC_Man * p, Abc_Obj_t * pObj, int fDept )
         else
             Abc_SclTimeFanin( p, pTime, pObj, pFanin );
     }
-    if ( p->EstLoadMax && Value > 1 )
+    if ( fEst )
     {
-        pLoad->rise = LoadRise;
-        pLoad->fall = LoadFall;
+        *pLoad = Load;
         if ( fDept )
         {
             SC_Pair * pDepOut  = Abc_SclObjDept( p, pObj );
@@ -374,7 +376,6 @@ void Abc_SclTimeNode( SC_Man * p, Abc_Obj_t * pObj, int fDept )
         else
         {
             SC_Pair * pArrOut  = Abc_SclObjTime( p, pObj );
-            float EstDelta = p->EstLinear * log( Value );
             pArrOut->rise += EstDelta;
             pArrOut->fall += EstDelta;
         }
@@ -397,21 +398,58 @@ void Abc_SclTimeCone( SC_Man * p, Vec_Int_t * vCone )
         printf( "after (%6.1f ps  %6.1f ps)\n", Abc_SclObjTimeOne(p, pObj, 1), Abc_SclObjTimeOne(p, pObj, 0) );
     }
 }
+void Abc_SclTimeConeCorners( SC_Man * p, Vec_Int_t * vCone )
+{
+    int c;
+    if ( p->nCorners == 1 )
+    {
+        Abc_SclTimeCone( p, vCone );
+        return;
+    }
+    for ( c = 0; c < p->nCorners; c++ )
+    {
+        Abc_SclManSetCorner( p, c );
+        Abc_SclTimeCone( p, vCone );
+    }
+    Abc_SclManSetCorner( p, Abc_SclReadWorstCorner(p) );
+}
+static inline void Abc_SclTimeNodeCorners( SC_Man * p, Abc_Obj_t * pObj, int fDept )
+{
+    int c, iCorner = p->iCorner;
+    if ( p->nCorners == 1 )
+    {
+        Abc_SclTimeNode( p, pObj, fDept );
+        return;
+    }
+    for ( c = 0; c < p->nCorners; c++ )
+    {
+        Abc_SclManSetCorner( p, c );
+        Abc_SclTimeNode( p, pObj, fDept );
+    }
+    Abc_SclManSetCorner( p, iCorner );
+}
 void Abc_SclTimeNtkRecompute( SC_Man * p, float * pArea, float * pDelay, int fReverse, float DUser )
 {
     Abc_Obj_t * pObj;
     float D;
     int i;
+    if ( p->nProcs > 1 )
+    {
+        Abc_SclTimeNtkRecomputePar( p, pArea, pDelay, fReverse, DUser );
+        return;
+    }
     Abc_SclComputeLoad( p );
     Abc_SclManCleanTime( p );
     p->nEstNodes = 0;
     Abc_NtkForEachCi( p->pNtk, pObj, i )
-        Abc_SclTimeNode( p, pObj, 0 );
+        Abc_SclTimeNodeCorners( p, pObj, 0 );
     Abc_NtkForEachNode1( p->pNtk, pObj, i )
-        Abc_SclTimeNode( p, pObj, 0 );
+        Abc_SclTimeNodeCorners( p, pObj, 0 );
     Abc_NtkForEachCo( p->pNtk, pObj, i )
-        Abc_SclTimeNode( p, pObj, 0 );
+        Abc_SclTimeNodeCorners( p, pObj, 0 );
     D = Abc_SclReadMaxDelay( p );
+    // the worst corner is used for the critical path
+    Abc_SclManSetCorner( p, Abc_SclReadWorstCorner(p) );
     if ( fReverse && DUser > 0 && D < DUser )
         D = DUser;
     if ( pArea )
@@ -422,7 +460,7 @@ void Abc_SclTimeNtkRecompute( SC_Man * p, float * pArea, float * pDelay, int fRe
     {
         p->nEstNodes = 0;
         Abc_NtkForEachNodeReverse1( p->pNtk, pObj, i )
-            Abc_SclTimeNode( p, pObj, 1 );
+            Abc_SclTimeNodeCorners( p, pObj, 1 );
     }
 }
 
@@ -492,7 +530,7 @@ static inline void Abc_SclTimeIncUpdateArrival( SC_Man * p )
             if ( Abc_ObjIsCo(pObj) )
             {
                 Abc_SclObjDupFanin( p, pObj );
-                Vec_FltWriteEntry( p->vTimesOut, pObj->iData, Abc_SclObjTimeMax(p, pObj) );
+                Vec_FltWriteEntry( p->vTimesOut, pObj->iData, Abc_SclObjTimeMaxCorners(p, pObj) );
                 Vec_QueUpdate( p->vQue, pObj->iData );
                 continue;
             }
@@ -552,8 +590,28 @@ int Abc_SclTimeIncUpdate( SC_Man * p )
         Abc_SclTimeIncAddNode( p, pObj );
     }
     Vec_IntClear( p->vChanged );
-    Abc_SclTimeIncUpdateArrival( p );
-    Abc_SclTimeIncUpdateDeparture( p );
+    if ( p->nCorners == 1 )
+    {
+        Abc_SclTimeIncUpdateArrival( p );
+        Abc_SclTimeIncUpdateDeparture( p );
+    }
+    else
+    {
+        // the nodes added to the levels in one corner are updated in all of them
+        int c;
+        for ( c = 0; c < p->nCorners; c++ )
+        {
+            Abc_SclManSetCorner( p, c );
+            Abc_SclTimeIncUpdateArrival( p );
+        }
+        Abc_SclManSetCorner( p, Abc_SclReadWorstCorner(p) );
+        for ( c = 0; c < p->nCorners; c++ )
+        {
+            Abc_SclManSetCorner( p, c );
+            Abc_SclTimeIncUpdateDeparture( p );
+        }
+        Abc_SclManSetCorner( p, Abc_SclReadWorstCorner(p) );
+    }
     Abc_SclTimeIncUpdateClean( p );
     RetValue = p->nIncUpdates;
     p->nIncUpdates = 0;
@@ -598,11 +656,13 @@ void Abc_SclManReadSlewAndLoad( SC_Man * p, Abc_Ntk_t * pNtk )
         Abc_Obj_t * pObj;  int i;
         float MaxLoad = Abc_FrameReadMaxLoad();
 //        printf( "Default output load is specified (%.2f ff).\n", MaxLoad );
+        int c;
         Abc_NtkForEachPo( pNtk, pObj, i )
-        {
-            SC_Pair * pLoad = Abc_SclObjLoad( p, pObj );
-            pLoad->rise = pLoad->fall = MaxLoad;
-        }
+            for ( c = 0; c < p->nCorners; c++ )
+            {
+                SC_Pair * pLoad = Abc_SclObjLoadCorner( p, pObj, c );
+                pLoad->rise = pLoad->fall = MaxLoad;
+            }
     }
     if ( Abc_FrameReadDrivingCell() )
     {
@@ -630,9 +690,10 @@ void Abc_SclManReadSlewAndLoad( SC_Man * p, Abc_Ntk_t * pNtk )
   SeeAlso     []
 
 ***********************************************************************/
-SC_Man * Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, int fDept, float DUser, int nTreeCRatio )
+SC_Man * Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, int fDept, float DUser, int nTreeCRatio, int nProcs )
 {
     SC_Man * p = Abc_SclManAlloc( pLib, pNtk );
+    p->nProcs = nProcs;
     if ( nTreeCRatio )
     {
         p->EstLoadMax = 0.01 * nTreeCRatio;  // max ratio of Cout/Cave when the estimation is used
@@ -668,10 +729,10 @@ SC_Man * Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, in
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_SclTimePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats )
+void Abc_SclTimePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats, int nProcs )
 {
     SC_Man * p;
-    p = Abc_SclManStart( pLib, pNtk, fUseWireLoads, 1, 0, nTreeCRatio );
+    p = Abc_SclManStart( pLib, pNtk, fUseWireLoads, 1, 0, nTreeCRatio, nProcs );
     Abc_SclTimeNtkPrint( p, fShowAll, fPrintPath );
     if ( fDumpStats )
         Abc_SclDumpStats( p, "stats.txt", 0 );
@@ -689,12 +750,12 @@ void Abc_SclTimePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, in
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_SclTimePerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats )
+void Abc_SclTimePerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats, int nProcs )
 {
     Abc_Ntk_t * pNtkNew = pNtk;
     if ( pNtk->nBarBufs2 > 0 )
         pNtkNew = Abc_NtkDupDfsNoBarBufs( pNtk );
-    Abc_SclTimePerformInt( pLib, pNtkNew, nTreeCRatio, fUseWireLoads, fShowAll, fPrintPath, fDumpStats );
+    Abc_SclTimePerformInt( pLib, pNtkNew, nTreeCRatio, fUseWireLoads, fShowAll, fPrintPath, fDumpStats, nProcs );
     if ( pNtk->nBarBufs2 > 0 )
         Abc_NtkDelete( pNtkNew );
 }
@@ -899,7 +960,7 @@ void Abc_SclPrintBuffers( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fVerbose )
     int fUseWireLoads = 0;
     SC_Man * p;
     assert( Abc_NtkIsMappedLogic(pNtk) );
-    p = Abc_SclManStart( pLib, pNtk, fUseWireLoads, 1, 0, 10000 ); 
+    p = Abc_SclManStart( pLib, pNtk, fUseWireLoads, 1, 0, 10000, 1 ); 
     Abc_SclPrintBufferTrees( p, pNtk ); 
 //    Abc_SclPrintFaninPairs( p, pNtk );
     Abc_SclManFree( p );
@@ -42,6 +42,8 @@ ABC_NAMESPACE_HEADER_START
 ////////////////////////////////////////////////////////////////////////
 
 typedef struct SC_Man_          SC_Man;
+typedef struct Scl_TimePar_t_   Scl_TimePar_t;
+typedef struct Scl_UpsPar_t_    Scl_UpsPar_t;
 struct SC_Man_ 
 {
     SC_Lib *       pLib;          // library
@@ -62,6 +64,13 @@ struct SC_Man_
     Vec_Flt_t *    vTimesOut;     // output arrival times
     Vec_Que_t *    vQue;          // outputs by their time
     SC_Cell *      pPiDrive;      // cell driving primary inputs
+    int            nProcs;        // the number of threads for timing update and sizing
+    Scl_TimePar_t * pTimePar;     // the flat netlist and the threads of parallel timing
+    Scl_UpsPar_t * pUpsPar;       // the threads of parallel upsizing
+    // timing corners
+    int            nCorners;      // the number of timing corners
+    int            iCorner;       // the current corner (the arrays above belong to it)
+    SC_Lib **      pCornerLibs;   // the library of each corner
     // backup information
     Vec_Flt_t *    vLoads2;       // backup storage for loads
     Vec_Flt_t *    vLoads3;       // backup storage for loads
@@ -125,6 +134,9 @@ static inline float     Abc_SclObjGetSlackF( SC_Man * p, Abc_Obj_t * pObj, float
 static inline float     Abc_SclObjGetSlack( SC_Man * p, Abc_Obj_t * pObj, float D ) { return D - Abc_MaxFloat(Abc_SclObjTime(p, pObj)->rise + Abc_SclObjDept(p, pObj)->rise, Abc_SclObjTime(p, pObj)->fall + Abc_SclObjDept(p, pObj)->fall);  }
 static inline double    Abc_SclObjSlackMax( SC_Man * p, Abc_Obj_t * pObj, float D ) { return Abc_SclObjGetSlack(p, pObj, D);                                              }
 static inline void      Abc_SclObjDupFanin( SC_Man * p, Abc_Obj_t * pObj )          { assert( Abc_ObjIsCo(pObj) ); *Abc_SclObjTime(p, pObj) = *Abc_SclObjTime(p, Abc_ObjFanin0(pObj));  }
+static inline SC_Pair * Abc_SclObjLoadCorner( SC_Man * p, Abc_Obj_t * pObj, int c ) { return p->pLoads + (c - p->iCorner) * p->nObjs + Abc_ObjId(pObj);  }
+static inline SC_Pair * Abc_SclObjTimeCorner( SC_Man * p, Abc_Obj_t * pObj, int c ) { return p->pTimes + (c - p->iCorner) * p->nObjs + Abc_ObjId(pObj);  }
+static inline float     Abc_SclObjTimeMaxCorners( SC_Man * p, Abc_Obj_t * pObj )    { int c; float t = SC_PairMax(Abc_SclObjTimeCorner(p, pObj, 0)); for ( c = 1; c < p->nCorners; c++ ) t = Abc_MaxFloat(t, SC_PairMax(Abc_SclObjTimeCorner(p, pObj, c))); return t; }
 static inline float     Abc_SclObjInDrive( SC_Man * p, Abc_Obj_t * pObj )           { return Vec_FltEntry( p->vInDrive, pObj->iData );                                    }
 static inline void      Abc_SclObjSetInDrive( SC_Man * p, Abc_Obj_t * pObj, float c){ Vec_FltWriteEntry( p->vInDrive, pObj->iData, c );                                   }
 
@@ -133,6 +145,65 @@ static inline void      Abc_SclObjSetInDrive( SC_Man * p, Abc_Obj_t * pObj, floa
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
+/**Function*************************************************************
+
+  Synopsis    [Switches the STA manager to another timing corner.]
+
+  Description [The timing data of the corners is stored in consecutive
+  blocks of the arrays. The current corner determines the block used by
+  Abc_SclObjLoad() and other accessors and the library of the cells.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Abc_SclManSetCorner( SC_Man * p, int iCorner )
+{
+    int Shift = (iCorner - p->iCorner) * p->nObjs;
+    if ( Shift == 0 )
+        return;
+    p->pLoads += Shift;
+    p->pDepts += Shift;
+    p->pTimes += Shift;
+    p->pSlews += Shift;
+    p->iCorner = iCorner;
+    p->pLib    = p->pCornerLibs[iCorner];
+    p->pNtk->pSCLib = p->pLib;
+    if ( p->pPiDrive )
+        p->pPiDrive = SC_LibCell( p->pLib, p->pPiDrive->Id );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Estimates the load of a node driving a buffer tree.]
+
+  Description [If the load is large enough for the buffer tree to be
+  estimated (-X), writes the average load into pLoadEst, sets the delay
+  of the buffer tree in pEstDelta and returns 1. Otherwise, copies the
+  load and returns 0. The pointers pLoad and pLoadEst may be the same.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Abc_SclLoadEstimate( SC_Man * p, SC_Pair * pLoad, SC_Pair * pLoadEst, float * pEstDelta )
+{
+    float Value;
+    *pLoadEst = *pLoad;
+    *pEstDelta = 0;
+    if ( !p->EstLoadMax )
+        return 0;
+    Value = (0.5 * pLoad->fall + 0.5 * pLoad->rise) / (p->EstLoadAve * p->EstLoadMax);
+    if ( Value <= 1 )
+        return 0;
+    pLoadEst->rise = p->EstLoadAve * p->EstLoadMax;
+    pLoadEst->fall = p->EstLoadAve * p->EstLoadMax;
+    *pEstDelta = p->EstLinear * log( Value );
+    return 1;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Constructor/destructor of STA manager.]
@@ -156,10 +227,15 @@ static inline SC_Man * Abc_SclManAlloc( SC_Lib * pLib, Abc_Ntk_t * pNtk )
     p->pLib      = pLib;
     p->pNtk      = pNtk;
     p->nObjs     = Abc_NtkObjNumMax(pNtk);
-    p->pLoads    = ABC_CALLOC( SC_Pair, p->nObjs );
-    p->pDepts    = ABC_CALLOC( SC_Pair, p->nObjs );
-    p->pTimes    = ABC_CALLOC( SC_Pair, p->nObjs );
-    p->pSlews    = ABC_CALLOC( SC_Pair, p->nObjs );
+    p->nCorners  = 1 + Vec_PtrSize(&pLib->vCorners);
+    p->pCornerLibs = ABC_ALLOC( SC_Lib *, p->nCorners );
+    p->pCornerLibs[0] = pLib;
+    for ( i = 1; i < p->nCorners; i++ )
+        p->pCornerLibs[i] = (SC_Lib *)Vec_PtrEntry( &pLib->vCorners, i - 1 );
+    p->pLoads    = ABC_CALLOC( SC_Pair, p->nObjs * p->nCorners );
+    p->pDepts    = ABC_CALLOC( SC_Pair, p->nObjs * p->nCorners );
+    p->pTimes    = ABC_CALLOC( SC_Pair, p->nObjs * p->nCorners );
+    p->pSlews    = ABC_CALLOC( SC_Pair, p->nObjs * p->nCorners );
     p->vBestFans = Vec_IntStart( p->nObjs );
     p->vTimesOut = Vec_FltStart( Abc_NtkCoNum(pNtk) );
     p->vQue      = Vec_QueAlloc( Abc_NtkCoNum(pNtk) );
@@ -189,10 +265,15 @@ static inline SC_Man * Abc_SclManAlloc( SC_Lib * pLib, Abc_Ntk_t * pNtk )
         pObj->iData = i;
     return p;
 }
+extern void Abc_SclTimeParFree( SC_Man * p );
+extern void Abc_SclUpsParFree( SC_Man * p );
 static inline void Abc_SclManFree( SC_Man * p )
 {
     Abc_Obj_t * pObj;
     int i;
+    Abc_SclTimeParFree( p );
+    Abc_SclUpsParFree( p );
+    Abc_SclManSetCorner( p, 0 );
     // set CI/CO ids
     Abc_NtkForEachCi( p->pNtk, pObj, i )
         pObj->iData = 0;
@@ -226,6 +307,7 @@ static inline void Abc_SclManFree( SC_Man * p )
     ABC_FREE( p->pDepts );
     ABC_FREE( p->pTimes );
     ABC_FREE( p->pSlews );
+    ABC_FREE( p->pCornerLibs );
     ABC_FREE( p );
 }
 /*
@@ -255,9 +337,10 @@ static inline void Abc_SclManCleanTime( SC_Man * p )
 */
 static inline void Abc_SclManCleanTime( SC_Man * p )
 {
-    memset( p->pTimes, 0, sizeof(SC_Pair) * p->nObjs );
-    memset( p->pSlews, 0, sizeof(SC_Pair) * p->nObjs );
-    memset( p->pDepts, 0, sizeof(SC_Pair) * p->nObjs );
+    int Shift = p->iCorner * p->nObjs;
+    memset( p->pTimes - Shift, 0, sizeof(SC_Pair) * p->nObjs * p->nCorners );
+    memset( p->pSlews - Shift, 0, sizeof(SC_Pair) * p->nObjs * p->nCorners );
+    memset( p->pDepts - Shift, 0, sizeof(SC_Pair) * p->nObjs * p->nCorners );
 /*
     if ( p->pPiDrive != NULL )
     {
@@ -290,22 +373,24 @@ static inline void Abc_SclManCleanTime( SC_Man * p )
 static inline void Abc_SclLoadStore( SC_Man * p, Abc_Obj_t * pObj )
 {
     Abc_Obj_t * pFanin;
-    int i;
+    int i, c;
     Vec_FltClear( p->vLoads2 );
+    for ( c = 0; c < p->nCorners; c++ )
     Abc_ObjForEachFanin( pObj, pFanin, i )
     {
-        Vec_FltPush( p->vLoads2, Abc_SclObjLoad(p, pFanin)->rise );
-        Vec_FltPush( p->vLoads2, Abc_SclObjLoad(p, pFanin)->fall );
+        Vec_FltPush( p->vLoads2, Abc_SclObjLoadCorner(p, pFanin, c)->rise );
+        Vec_FltPush( p->vLoads2, Abc_SclObjLoadCorner(p, pFanin, c)->fall );
     }
 }
 static inline void Abc_SclLoadRestore( SC_Man * p, Abc_Obj_t * pObj )
 {
     Abc_Obj_t * pFanin;
-    int i, k = 0;
+    int i, c, k = 0;
+    for ( c = 0; c < p->nCorners; c++ )
     Abc_ObjForEachFanin( pObj, pFanin, i )
     {
-        Abc_SclObjLoad(p, pFanin)->rise = Vec_FltEntry(p->vLoads2, k++);
-        Abc_SclObjLoad(p, pFanin)->fall = Vec_FltEntry(p->vLoads2, k++);
+        Abc_SclObjLoadCorner(p, pFanin, c)->rise = Vec_FltEntry(p->vLoads2, k++);
+        Abc_SclObjLoadCorner(p, pFanin, c)->fall = Vec_FltEntry(p->vLoads2, k++);
     }
     assert( Vec_FltSize(p->vLoads2) == k );
 }
@@ -313,26 +398,32 @@ static inline void Abc_SclLoadRestore( SC_Man * p, Abc_Obj_t * pObj )
 static inline void Abc_SclLoadStore3( SC_Man * p, Abc_Obj_t * pObj )
 {
     Abc_Obj_t * pFanin;
-    int i;
+    int i, c;
     Vec_FltClear( p->vLoads3 );
-    Vec_FltPush( p->vLoads3, Abc_SclObjLoad(p, pObj)->rise );
-    Vec_FltPush( p->vLoads3, Abc_SclObjLoad(p, pObj)->fall );
-    Abc_ObjForEachFanin( pObj, pFanin, i )
+    for ( c = 0; c < p->nCorners; c++ )
     {
-        Vec_FltPush( p->vLoads3, Abc_SclObjLoad(p, pFanin)->rise );
-        Vec_FltPush( p->vLoads3, Abc_SclObjLoad(p, pFanin)->fall );
+        Vec_FltPush( p->vLoads3, Abc_SclObjLoadCorner(p, pObj, c)->rise );
+        Vec_FltPush( p->vLoads3, Abc_SclObjLoadCorner(p, pObj, c)->fall );
+        Abc_ObjForEachFanin( pObj, pFanin, i )
+        {
+            Vec_FltPush( p->vLoads3, Abc_SclObjLoadCorner(p, pFanin, c)->rise );
+            Vec_FltPush( p->vLoads3, Abc_SclObjLoadCorner(p, pFanin, c)->fall );
+        }
     }
 }
 static inline void Abc_SclLoadRestore3( SC_Man * p, Abc_Obj_t * pObj )
 {
     Abc_Obj_t * pFanin;
-    int i, k = 0;
-    Abc_SclObjLoad(p, pObj)->rise = Vec_FltEntry(p->vLoads3, k++);
-    Abc_SclObjLoad(p, pObj)->fall = Vec_FltEntry(p->vLoads3, k++);
-    Abc_ObjForEachFanin( pObj, pFanin, i )
+    int i, c, k = 0;
+    for ( c = 0; c < p->nCorners; c++ )
     {
-        Abc_SclObjLoad(p, pFanin)->rise = Vec_FltEntry(p->vLoads3, k++);
-        Abc_SclObjLoad(p, pFanin)->fall = Vec_FltEntry(p->vLoads3, k++);
+        Abc_SclObjLoadCorner(p, pObj, c)->rise = Vec_FltEntry(p->vLoads3, k++);
+        Abc_SclObjLoadCorner(p, pObj, c)->fall = Vec_FltEntry(p->vLoads3, k++);
+        Abc_ObjForEachFanin( pObj, pFanin, i )
+        {
+            Abc_SclObjLoadCorner(p, pFanin, c)->rise = Vec_FltEntry(p->vLoads3, k++);
+            Abc_SclObjLoadCorner(p, pFanin, c)->fall = Vec_FltEntry(p->vLoads3, k++);
+        }
     }
     assert( Vec_FltSize(p->vLoads3) == k );
 }
@@ -473,7 +564,16 @@ static inline float Abc_SclGetMaxDelayNodeFanins( SC_Man * p, Abc_Obj_t * pNode
 }
 static inline float Abc_SclReadMaxDelay( SC_Man * p )
 {
-    return Abc_SclObjTimeMax( p, Abc_NtkCo(p->pNtk, Vec_QueTop(p->vQue)) );
+    return Abc_SclObjTimeMaxCorners( p, Abc_NtkCo(p->pNtk, Vec_QueTop(p->vQue)) );
+}
+static inline int Abc_SclReadWorstCorner( SC_Man * p )
+{
+    Abc_Obj_t * pObj = Abc_NtkCo( p->pNtk, Vec_QueTop(p->vQue) );
+    int c, iWorst = 0;
+    for ( c = 1; c < p->nCorners; c++ )
+        if ( SC_PairMax(Abc_SclObjTimeCorner(p, pObj, c)) > SC_PairMax(Abc_SclObjTimeCorner(p, pObj, iWorst)) )
+            iWorst = c;
+    return iWorst;
 }
 
 /**Function*************************************************************
@@ -563,17 +663,23 @@ extern void          Abc_SclUpdateLoadSplit( SC_Man * p, Abc_Obj_t * pBuffer, Ab
 extern Abc_Obj_t *   Abc_SclFindCriticalCo( SC_Man * p, int * pfRise );
 extern Abc_Obj_t *   Abc_SclFindMostCriticalFanin( SC_Man * p, int * pfRise, Abc_Obj_t * pNode );
 extern void          Abc_SclTimeNtkPrint( SC_Man * p, int fShowAll, int fPrintPath );
-extern SC_Man *      Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, int fDept, float DUser, int nTreeCRatio );
+extern SC_Man *      Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, int fDept, float DUser, int nTreeCRatio, int nProcs );
+extern void          Abc_SclTimeNode( SC_Man * p, Abc_Obj_t * pObj, int fDept );
 extern void          Abc_SclTimeCone( SC_Man * p, Vec_Int_t * vCone );
+extern void          Abc_SclTimeConeCorners( SC_Man * p, Vec_Int_t * vCone );
 extern void          Abc_SclTimeNtkRecompute( SC_Man * p, float * pArea, float * pDelay, int fReverse, float DUser );
 extern int           Abc_SclTimeIncUpdate( SC_Man * p );
 extern void          Abc_SclTimeIncInsert( SC_Man * p, Abc_Obj_t * pObj );
 extern void          Abc_SclTimeIncUpdateLevel( Abc_Obj_t * pObj );
-extern void          Abc_SclTimePerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats );
+extern void          Abc_SclTimePerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats, int nProcs );
 extern void          Abc_SclPrintBuffers( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fVerbose );
+/*=== sclTimePar.c ===============================================================*/
+extern void          Abc_SclTimeNtkRecomputePar( SC_Man * p, float * pArea, float * pDelay, int fReverse, float DUser );
 /*=== sclUpsize.c ===============================================================*/
 extern int           Abc_SclCountNearCriticalNodes( SC_Man * p );
 extern void          Abc_SclUpsizePerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPars );
+/*=== sclUpsizePar.c ===============================================================*/
+extern void          Abc_SclFindBestCellsPar( SC_Man * pMan, Vec_Int_t * vNodes, Vec_Wec_t * vRecalcs, Vec_Wec_t * vEvals, int Notches, int DelayGap, Vec_Int_t * vGates, Vec_Flt_t * vGains );
 /*=== sclUtil.c ===============================================================*/
 extern void          Abc_SclMioGates2SclGates( SC_Lib * pLib, Abc_Ntk_t * p );
 extern void          Abc_SclSclGates2MioGates( SC_Lib * pLib, Abc_Ntk_t * p );
@@ -0,0 +1,543 @@
+/**CFile****************************************************************
+
+  FileName    [sclTimePar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Standard-cell library representation.]
+
+  Synopsis    [Multi-threaded static timing analysis.]
+
+  Author      [agent]
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: sclTimePar.c,v 1.00 2026/10/17 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "sclSize.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
+#ifdef _MSC_VER
+#include <windows.h>
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The netlist is copied into flat arrays indexed by the position of the
+// object in the level order: the object ID, the library cell, the fanins
+// and the fanouts (with the fanin index of the object in the fanout).
+// The CIs and the constant nodes are on level 0. The levels are grouped
+// into bands as in giaSimPar.c: a wide band contains one level and is
+// split between the threads, which synchronize after each band, while the
+// consecutive narrow levels are merged into one band processed by the
+// first thread. The arrival times are computed in the forward order by
+// each node reading its fanins. The departure times are computed in the
+// reverse order by each object reading its fanouts, so that the threads
+// never write into the same object. The results are identical to those
+// of Abc_SclTimeNtkRecompute(). The flat netlist and the threads are kept
+// in the timing manager and reused by the following calls; only the cells
+// are updated, because sizing does not change the structure.
+
+#define SCL_TIME_THR_MAX  64
+#define SCL_TIME_WIDE_MIN 256      // the smallest number of nodes per thread in a wide band
+
+typedef struct Scl_TimeParThData_t_ Scl_TimeParThData_t;
+struct Scl_TimeParThData_t_
+{
+    Scl_TimePar_t * p;
+    int             iThread;
+};
+
+struct Scl_TimePar_t_
+{
+    SC_Man *       pMan;       // the timing manager
+    int            nThreads;   // the number of threads
+    int            nObjsMax;   // the number of objects in the network
+    int            nObjs;      // the number of objects in the order
+    int *          pIds;       // the object IDs in the level order
+    SC_Cell **     pCells;     // the cells (NULL for CIs and constants)
+    int *          pFanStart;  // the first fanin of each object (nObjs + 1 entries)
+    int *          pFanins;    // the fanin IDs
+    int *          pFoStart;   // the first fanout of each object (nObjs + 1 entries)
+    int *          pFanouts;   // the pairs (fanout position, fanin index)
+    Vec_Int_t *    vBands;     // the first object of each band (the last entry is nObjs)
+    Vec_Int_t *    vWide;      // the flag that the band is split between the threads
+    int            nWide;      // the number of wide bands
+    int            nEstNodes[SCL_TIME_THR_MAX]; // the number of estimations by each thread
+    // thread synchronization
+    int            fDept;      // computing departure times
+    int            nArrived;   // the number of threads waiting at the barrier
+    int            fSense;     // the barrier phase
+    int            iJob;       // the number of started jobs
+    int            fStop;      // the threads should exit
+    Scl_TimeParThData_t ThData[SCL_TIME_THR_MAX];
+#ifdef ABC_USE_PTHREADS
+    pthread_t      Workers[SCL_TIME_THR_MAX];
+    pthread_mutex_t Mutex;
+    pthread_cond_t Cond;
+#endif
+};
+
+#ifdef ABC_USE_PTHREADS
+static void * Scl_TimeParWorker( void * pArg );
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Copies the netlist into the level order.]
+
+  Description [Assumes that the objects are in a topological order, as
+  does Abc_SclTimeNtkRecompute().]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Scl_TimePar_t * Scl_TimeParStart( SC_Man * pMan, int nThreads )
+{
+    Abc_Ntk_t * pNtk = pMan->pNtk;
+    Scl_TimePar_t * p;
+    Abc_Obj_t * pObj, * pFanin;
+    Vec_Int_t * vLevels, * vCounts, * vPos;
+    int i, k, iPos, Level, LevelMax = 0, nFanins = 0, nWideMin;
+    p = ABC_CALLOC( Scl_TimePar_t, 1 );
+    p->pMan     = pMan;
+    p->nThreads = Abc_MaxInt( 1, Abc_MinInt(nThreads, SCL_TIME_THR_MAX) );
+    p->nObjsMax = Abc_NtkObjNumMax( pNtk );
+#ifndef ABC_USE_PTHREADS
+    p->nThreads = 1;
+#endif
+    // compute levels of the CIs and the nodes (the constant nodes are on level 0)
+    vLevels = Vec_IntStartFull( Abc_NtkObjNumMax(pNtk) );
+    Abc_NtkForEachCi( pNtk, pObj, i )
+        Vec_IntWriteEntry( vLevels, Abc_ObjId(pObj), 0 ), p->nObjs++;
+    Abc_NtkForEachNode( pNtk, pObj, i )
+    {
+        Level = 0;
+        Abc_ObjForEachFanin( pObj, pFanin, k )
+        {
+            assert( Vec_IntEntry(vLevels, Abc_ObjId(pFanin)) >= 0 );
+            Level = Abc_MaxInt( Level, Vec_IntEntry(vLevels, Abc_ObjId(pFanin)) + 1 );
+        }
+        Vec_IntWriteEntry( vLevels, i, Level );
+        LevelMax = Abc_MaxInt( LevelMax, Level );
+        nFanins += Abc_ObjFaninNum(pObj);
+        p->nObjs++;
+    }
+    // order the objects by level
+    vCounts = Vec_IntStart( LevelMax + 2 );
+    Vec_IntForEachEntry( vLevels, Level, i )
+        if ( Level >= 0 )
+            Vec_IntAddToEntry( vCounts, Level + 1, 1 );
+    for ( k = 1; k <= LevelMax + 1; k++ )
+        Vec_IntAddToEntry( vCounts, k, Vec_IntEntry(vCounts, k-1) );
+    p->pIds   = ABC_ALLOC( int, p->nObjs );
+    p->pCells = ABC_CALLOC( SC_Cell *, p->nObjs );
+    vPos      = Vec_IntStartFull( Abc_NtkObjNumMax(pNtk) );
+    Vec_IntForEachEntry( vLevels, Level, i )
+        if ( Level >= 0 )
+        {
+            iPos = Vec_IntEntry( vCounts, Level );
+            Vec_IntAddToEntry( vCounts, Level, 1 );
+            p->pIds[iPos] = i;
+            Vec_IntWriteEntry( vPos, i, iPos );
+            pObj = Abc_NtkObj( pNtk, i );
+            if ( Abc_ObjIsNode(pObj) && Abc_ObjFaninNum(pObj) > 0 )
+                p->pCells[iPos] = Abc_SclObjCell( pObj );
+        }
+    // after the loop above, entry k is the end of level k
+    // collect the fanins and count the fanouts
+    p->pFanStart = ABC_ALLOC( int, p->nObjs + 1 );
+    p->pFanins   = ABC_ALLOC( int, nFanins );
+    p->pFoStart  = ABC_CALLOC( int, p->nObjs + 1 );
+    p->pFanouts  = ABC_ALLOC( int, 2 * nFanins );
+    for ( nFanins = iPos = 0; iPos < p->nObjs; iPos++ )
+    {
+        p->pFanStart[iPos] = nFanins;
+        pObj = Abc_NtkObj( pNtk, p->pIds[iPos] );
+        if ( p->pCells[iPos] == NULL )
+            continue;
+        Abc_ObjForEachFanin( pObj, pFanin, k )
+        {
+            p->pFanins[nFanins++] = Abc_ObjId(pFanin);
+            p->pFoStart[Vec_IntEntry(vPos, Abc_ObjId(pFanin)) + 1]++;
+        }
+    }
+    p->pFanStart[p->nObjs] = nFanins;
+    for ( iPos = 0; iPos < p->nObjs; iPos++ )
+        p->pFoStart[iPos + 1] += p->pFoStart[iPos];
+    // collect the fanouts (the first fanout of each object is used as the running counter)
+    for ( iPos = 0; iPos < p->nObjs; iPos++ )
+        for ( k = p->pFanStart[iPos]; k < p->pFanStart[iPos + 1]; k++ )
+        {
+            int iOut = p->pFoStart[Vec_IntEntry(vPos, p->pFanins[k])]++;
+            p->pFanouts[2*iOut+0] = iPos;
+            p->pFanouts[2*iOut+1] = k - p->pFanStart[iPos];
+        }
+    for ( iPos = p->nObjs; iPos > 0; iPos-- )
+        p->pFoStart[iPos] = p->pFoStart[iPos - 1];
+    p->pFoStart[0] = 0;
+    // create the bands
+    p->vBands = Vec_IntAlloc( 100 );
+    p->vWide  = Vec_IntAlloc( 100 );
+    nWideMin  = p->nThreads > 1 ? p->nThreads * SCL_TIME_WIDE_MIN : ABC_INFINITY;
+    Vec_IntPush( p->vBands, 0 );
+    for ( k = 0; k <= LevelMax; k++ )
+    {
+        int iStart = k ? Vec_IntEntry( vCounts, k-1 ) : 0;
+        int iStop  = Vec_IntEntry( vCounts, k );
+        int fWide  = iStop - iStart >= nWideMin;
+        if ( !fWide && Vec_IntSize(p->vWide) > 0 && !Vec_IntEntryLast(p->vWide) )
+        {
+            Vec_IntWriteEntry( p->vBands, Vec_IntSize(p->vBands)-1, iStop );
+            continue;
+        }
+        Vec_IntPush( p->vBands, iStop );
+        Vec_IntPush( p->vWide, fWide );
+        p->nWide += fWide;
+    }
+    assert( Vec_IntEntryLast(p->vBands) == p->nObjs );
+    Vec_IntFree( vLevels );
+    Vec_IntFree( vCounts );
+    Vec_IntFree( vPos );
+    // start the threads, which wait for the jobs
+    for ( i = 0; i < p->nThreads; i++ )
+    {
+        p->ThData[i].p       = p;
+        p->ThData[i].iThread = i;
+    }
+    if ( p->nWide == 0 )
+        p->nThreads = 1;
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_init( &p->Mutex, NULL );
+    pthread_cond_init( &p->Cond, NULL );
+    for ( i = 1; i < p->nThreads; i++ )
+    {
+        int status;
+        status = pthread_create( p->Workers + i, NULL, Scl_TimeParWorker, (void *)(p->ThData + i) );
+        assert( status == 0 );
+    }
+#endif
+    return p;
+}
+static void Scl_TimeParStop( Scl_TimePar_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    int i;
+    pthread_mutex_lock( &p->Mutex );
+    p->fStop = 1;
+    pthread_cond_broadcast( &p->Cond );
+    pthread_mutex_unlock( &p->Mutex );
+    for ( i = 1; i < p->nThreads; i++ )
+        pthread_join( p->Workers[i], NULL );
+    pthread_mutex_destroy( &p->Mutex );
+    pthread_cond_destroy( &p->Cond );
+#endif
+    Vec_IntFree( p->vBands );
+    Vec_IntFree( p->vWide );
+    ABC_FREE( p->pIds );
+    ABC_FREE( p->pCells );
+    ABC_FREE( p->pFanStart );
+    ABC_FREE( p->pFanins );
+    ABC_FREE( p->pFoStart );
+    ABC_FREE( p->pFanouts );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes arrival and departure times of one object.]
+
+  Description [Follow Abc_SclTimeNode() and Abc_SclDeptFanin() but keep
+  the estimated load and departure time of the node in local variables.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Scl_TimeParArrival( Scl_TimePar_t * p, int iPos, int iThread )
+{
+    SC_Man * pMan = p->pMan;
+    SC_Cell * pCell = p->pCells[iPos];
+    int k, iObj = p->pIds[iPos];
+    SC_Pair Load, * pArrOut = pMan->pTimes + iObj, * pSlewOut = pMan->pSlews + iObj;
+    float EstDelta;
+    int fEst = Abc_SclLoadEstimate( pMan, pMan->pLoads + iObj, &Load, &EstDelta );
+    for ( k = p->pFanStart[iPos]; k < p->pFanStart[iPos + 1]; k++ )
+    {
+        int iFanin = p->pFanins[k];
+        Scl_LibPinArrival( Scl_CellPinTime(pCell, k - p->pFanStart[iPos]), pMan->pTimes + iFanin, pMan->pSlews + iFanin, &Load, pArrOut, pSlewOut );
+    }
+    if ( fEst )
+    {
+        pArrOut->rise += EstDelta;
+        pArrOut->fall += EstDelta;
+        p->nEstNodes[iThread]++;
+    }
+}
+static inline void Scl_TimeParDeparture( Scl_TimePar_t * p, int iPos )
+{
+    SC_Man * pMan = p->pMan;
+    int k, iObj = p->pIds[iPos];
+    SC_Pair Load, DepOut, * pDepIn = pMan->pDepts + iObj, * pSlewIn = pMan->pSlews + iObj;
+    float EstDelta;
+    pDepIn->rise = pDepIn->fall = 0;
+    for ( k = p->pFoStart[iPos]; k < p->pFoStart[iPos + 1]; k++ )
+    {
+        int iFanout = p->pFanouts[2*k+0];
+        int iPin    = p->pFanouts[2*k+1];
+        DepOut = pMan->pDepts[p->pIds[iFanout]];
+        if ( Abc_SclLoadEstimate( pMan, pMan->pLoads + p->pIds[iFanout], &Load, &EstDelta ) )
+        {
+            DepOut.rise += EstDelta;
+            DepOut.fall += EstDelta;
+        }
+        Scl_LibPinDeparture( Scl_CellPinTime(p->pCells[iFanout], iPin), pDepIn, pSlewIn, &Load, &DepOut );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Processes a range of objects in the level order.]
+
+  Description [The arrival times of level 0 are computed by the caller.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Scl_TimeParRange( Scl_TimePar_t * p, int iStart, int iStop, int iThread )
+{
+    int k;
+    if ( p->fDept )
+    {
+        for ( k = iStop - 1; k >= iStart; k-- )
+            Scl_TimeParDeparture( p, k );
+    }
+    else
+    {
+        for ( k = iStart; k < iStop; k++ )
+            if ( p->pCells[k] )
+                Scl_TimeParArrival( p, k, iThread );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Waits until all threads finish the current band.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Scl_TimeParWait( Scl_TimePar_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    int fSense;
+    pthread_mutex_lock( &p->Mutex );
+    fSense = p->fSense;
+    if ( ++p->nArrived == p->nThreads )
+    {
+        p->nArrived = 0;
+        p->fSense   = !fSense;
+        pthread_cond_broadcast( &p->Cond );
+    }
+    else while ( p->fSense == fSense )
+        pthread_cond_wait( &p->Cond, &p->Mutex );
+    pthread_mutex_unlock( &p->Mutex );
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Processes the part of each band assigned to one thread.]
+
+  Description [The bands are visited in the reverse order when computing
+  departure times. The threads synchronize after each band, including
+  the last one, so that the job is complete when the first thread returns.
+  The other threads wait for the next job between the calls.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void * Scl_TimeParThread( void * pArg )
+{
+    Scl_TimeParThData_t * pData = (Scl_TimeParThData_t *)pArg;
+    Scl_TimePar_t * p = pData->p;
+    int i, nBands = Vec_IntSize(p->vWide);
+    for ( i = 0; i < nBands; i++ )
+    {
+        int b      = p->fDept ? nBands - 1 - i : i;
+        int iStart = Vec_IntEntry( p->vBands, b );
+        int iStop  = Vec_IntEntry( p->vBands, b+1 );
+        if ( Vec_IntEntry(p->vWide, b) )
+        {
+            int nNodes = iStop - iStart;
+            Scl_TimeParRange( p, iStart + (int)((word)nNodes * pData->iThread / p->nThreads),
+                                 iStart + (int)((word)nNodes * (pData->iThread + 1) / p->nThreads), pData->iThread );
+        }
+        else if ( pData->iThread == 0 )
+            Scl_TimeParRange( p, iStart, iStop, 0 );
+        Scl_TimeParWait( p );
+    }
+    return NULL;
+}
+#ifdef ABC_USE_PTHREADS
+static void * Scl_TimeParWorker( void * pArg )
+{
+    Scl_TimePar_t * p = ((Scl_TimeParThData_t *)pArg)->p;
+    int iJob = 0, fStop;
+    while ( 1 )
+    {
+        pthread_mutex_lock( &p->Mutex );
+        while ( p->iJob == iJob && !p->fStop )
+            pthread_cond_wait( &p->Cond, &p->Mutex );
+        iJob  = p->iJob;
+        fStop = p->fStop;
+        pthread_mutex_unlock( &p->Mutex );
+        if ( fStop )
+            break;
+        Scl_TimeParThread( pArg );
+    }
+    return NULL;
+}
+#endif
+static void Scl_TimeParPerform( Scl_TimePar_t * p, int fDept )
+{
+    if ( p->nThreads == 1 )
+    {
+        p->fDept = fDept;
+        Scl_TimeParRange( p, 0, p->nObjs, 0 );
+        return;
+    }
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_lock( &p->Mutex );
+    p->fDept = fDept;
+    p->iJob++;
+    pthread_cond_broadcast( &p->Cond );
+    pthread_mutex_unlock( &p->Mutex );
+#endif
+    Scl_TimeParThread( (void *)p->ThData );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Switches the computation to another timing corner.]
+
+  Description [The cells are taken from the current gate assignment in
+  the corner library.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Scl_TimeParSetCorner( Scl_TimePar_t * p, int iCorner )
+{
+    SC_Man * pMan = p->pMan;
+    int iPos;
+    Abc_SclManSetCorner( pMan, iCorner );
+    for ( iPos = 0; iPos < p->nObjs; iPos++ )
+        if ( p->pCells[iPos] )
+            p->pCells[iPos] = SC_LibCell( pMan->pLib, Vec_IntEntry(pMan->pNtk->vGates, p->pIds[iPos]) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Recomputes timing of the network using several threads.]
+
+  Description [Performs the same computation as Abc_SclTimeNtkRecompute().
+  The flat netlist is derived by the first call and kept in the manager.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_SclTimeNtkRecomputePar( SC_Man * p, float * pArea, float * pDelay, int fReverse, float DUser )
+{
+    Scl_TimePar_t * pPar;
+    Abc_Obj_t * pObj;
+    float D;
+    int i, c;
+    Abc_SclComputeLoad( p );
+    Abc_SclManCleanTime( p );
+    if ( p->pTimePar && p->pTimePar->nObjsMax != Abc_NtkObjNumMax(p->pNtk) )
+        Abc_SclTimeParFree( p );
+    if ( p->pTimePar == NULL )
+        p->pTimePar = Scl_TimeParStart( p, p->nProcs );
+    pPar = p->pTimePar;
+    memset( pPar->nEstNodes, 0, sizeof(int) * SCL_TIME_THR_MAX );
+    for ( c = 0; c < p->nCorners; c++ )
+    {
+        Scl_TimeParSetCorner( pPar, c );
+        Abc_NtkForEachCi( p->pNtk, pObj, i )
+            Abc_SclTimeNode( p, pObj, 0 );
+        Scl_TimeParPerform( pPar, 0 );
+        Abc_NtkForEachCo( p->pNtk, pObj, i )
+            Abc_SclTimeNode( p, pObj, 0 );
+    }
+    p->nEstNodes = 0;
+    for ( i = 0; i < pPar->nThreads; i++ )
+        p->nEstNodes += pPar->nEstNodes[i];
+    D = Abc_SclReadMaxDelay( p );
+    if ( fReverse && DUser > 0 && D < DUser )
+        D = DUser;
+    if ( pArea )
+        *pArea = Abc_SclGetTotalArea(p->pNtk);
+    if ( pDelay )
+        *pDelay = D;
+    if ( fReverse )
+    {
+        for ( c = 0; c < p->nCorners; c++ )
+        {
+            Scl_TimeParSetCorner( pPar, c );
+            Scl_TimeParPerform( pPar, 1 );
+        }
+    }
+    // the worst corner is used for the critical path
+    Scl_TimeParSetCorner( pPar, Abc_SclReadWorstCorner(p) );
+}
+void Abc_SclTimeParFree( SC_Man * p )
+{
+    if ( p->pTimePar == NULL )
+        return;
+    Scl_TimeParStop( p->pTimePar );
+    p->pTimePar = NULL;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -606,25 +606,65 @@ int Abc_SclFindUpsizes( SC_Man * p, Vec_Int_t * vPathNodes, int Ratio, int Notch
     vRecalcs = Vec_IntAlloc( 100 );
     vEvals = Vec_IntAlloc( 100 );
     Vec_QueClear( p->vNodeByGain );
-    Abc_NtkForEachObjVec( vPathNodes, p->pNtk, pObj, i )
+    if ( p->nProcs > 1 )
     {
-        assert( pObj->fMarkB == 0 );
-        iIterLast = Vec_IntEntry(p->vNodeIter, Abc_ObjId(pObj));
-        if ( iIterLast >= 0 && iIterLast + 5 > iIter )
-            continue;
-        // compute nodes to recalculate timing and nodes to evaluate afterwards
-        Abc_SclFindNodesToUpdate( pObj, &vRecalcs, &vEvals, NULL );
-        assert( Vec_IntSize(vEvals) > 0 );
-        //printf( "%d -> %d\n", Vec_IntSize(vRecalcs), Vec_IntSize(vEvals) );
-        gateBest = Abc_SclFindBestCell( p, pObj, vRecalcs, vEvals, Notches, DelayGap, &dGainBest );
-        // remember savings
-        if ( gateBest >= 0 )
+        // collect the windows of the nodes and evaluate them using several threads
+        Vec_Int_t * vNodes = Vec_IntAlloc( 100 );
+        Vec_Wec_t * vRecalcsAll = Vec_WecAlloc( 100 );
+        Vec_Wec_t * vEvalsAll = Vec_WecAlloc( 100 );
+        Vec_Int_t * vGates = Vec_IntAlloc( 100 );
+        Vec_Flt_t * vGains = Vec_FltAlloc( 100 );
+        Abc_NtkForEachObjVec( vPathNodes, p->pNtk, pObj, i )
         {
-            assert( dGainBest > 0.0 );
-            Vec_FltWriteEntry( p->vNode2Gain, Abc_ObjId(pObj), dGainBest );
-            Vec_IntWriteEntry( p->vNode2Gate, Abc_ObjId(pObj), gateBest );
+            assert( pObj->fMarkB == 0 );
+            iIterLast = Vec_IntEntry(p->vNodeIter, Abc_ObjId(pObj));
+            if ( iIterLast >= 0 && iIterLast + 5 > iIter )
+                continue;
+            Abc_SclFindNodesToUpdate( pObj, &vRecalcs, &vEvals, NULL );
+            assert( Vec_IntSize(vEvals) > 0 );
+            Vec_IntPush( vNodes, Abc_ObjId(pObj) );
+            Vec_IntAppend( Vec_WecPushLevel(vRecalcsAll), vRecalcs );
+            Vec_IntAppend( Vec_WecPushLevel(vEvalsAll), vEvals );
+        }
+        Abc_SclFindBestCellsPar( p, vNodes, vRecalcsAll, vEvalsAll, Notches, DelayGap, vGates, vGains );
+        // remember savings in the same order as the sequential evaluation
+        Abc_NtkForEachObjVec( vNodes, p->pNtk, pObj, i )
+        {
+            if ( Vec_IntEntry(vGates, i) < 0 )
+                continue;
+            assert( Vec_FltEntry(vGains, i) > 0.0 );
+            Vec_FltWriteEntry( p->vNode2Gain, Abc_ObjId(pObj), Vec_FltEntry(vGains, i) );
+            Vec_IntWriteEntry( p->vNode2Gate, Abc_ObjId(pObj), Vec_IntEntry(vGates, i) );
             Vec_QuePush( p->vNodeByGain, Abc_ObjId(pObj) );
         }
+        Vec_IntFree( vNodes );
+        Vec_WecFree( vRecalcsAll );
+        Vec_WecFree( vEvalsAll );
+        Vec_IntFree( vGates );
+        Vec_FltFree( vGains );
+    }
+    else
+    {
+        Abc_NtkForEachObjVec( vPathNodes, p->pNtk, pObj, i )
+        {
+            assert( pObj->fMarkB == 0 );
+            iIterLast = Vec_IntEntry(p->vNodeIter, Abc_ObjId(pObj));
+            if ( iIterLast >= 0 && iIterLast + 5 > iIter )
+                continue;
+            // compute nodes to recalculate timing and nodes to evaluate afterwards
+            Abc_SclFindNodesToUpdate( pObj, &vRecalcs, &vEvals, NULL );
+            assert( Vec_IntSize(vEvals) > 0 );
+            //printf( "%d -> %d\n", Vec_IntSize(vRecalcs), Vec_IntSize(vEvals) );
+            gateBest = Abc_SclFindBestCell( p, pObj, vRecalcs, vEvals, Notches, DelayGap, &dGainBest );
+            // remember savings
+            if ( gateBest >= 0 )
+            {
+                assert( dGainBest > 0.0 );
+                Vec_FltWriteEntry( p->vNode2Gain, Abc_ObjId(pObj), dGainBest );
+                Vec_IntWriteEntry( p->vNode2Gate, Abc_ObjId(pObj), gateBest );
+                Vec_QuePush( p->vNodeByGain, Abc_ObjId(pObj) );
+            }
+        }
     }
     Vec_IntFree( vRecalcs );
     Vec_IntFree( vEvals );
@@ -890,7 +930,7 @@ void Abc_SclUpsizePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPa
     if ( pPars->Window == 1 )
         pPars->Window += (Abc_NtkNodeNum(pNtk) > 40000);
     // prepare the manager; collect init stats
-    p = Abc_SclManStart( pLib, pNtk, pPars->fUseWireLoads, pPars->fUseDept, 0, pPars->BuffTreeEst );
+    p = Abc_SclManStart( pLib, pNtk, pPars->fUseWireLoads, pPars->fUseDept, 0, pPars->BuffTreeEst, pPars->nProcs );
     p->timeTotal  = Abc_Clock();
     assert( p->vGatesBest == NULL );
     p->vGatesBest = Vec_IntDup( p->pNtk->vGates );
@@ -943,7 +983,7 @@ void Abc_SclUpsizePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPa
         else
         {
             Vec_Int_t * vTFO = Abc_SclFindTFO( p->pNtk, vPathNodes );
-            Abc_SclTimeCone( p, vTFO );
+            Abc_SclTimeConeCorners( p, vTFO );
             nConeSize = Vec_IntSize( vTFO );
             Vec_IntFree( vTFO );
         }
@@ -0,0 +1,412 @@
+/**CFile****************************************************************
+
+  FileName    [sclUpsizePar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Standard-cell library representation.]
+
+  Synopsis    [Multi-threaded evaluation of gate sizing candidates.]
+
+  Author      [agent]
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: sclUpsizePar.c,v 1.00 2026/10/17 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "sclSize.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// Each thread evaluates the candidate cells of a subset of the nodes on
+// the critical path. The loads, arrival times and slews of the window
+// of the node (the nodes whose timing is recomputed after resizing) are
+// kept in the scratch arrays of the thread, while the timing information
+// outside of the window is read from the manager. The manager and the
+// network are not modified, so the threads do not synchronize while
+// evaluating. The computation follows Abc_SclFindBestCell() and gives the
+// same results. The threads and their scratch arrays are kept in the
+// timing manager and reused in the following iterations of upsizing.
+
+#define SCL_UPS_THR_MAX  64
+
+typedef struct Scl_UpsParThData_t_ Scl_UpsParThData_t;
+struct Scl_UpsParThData_t_
+{
+    Scl_UpsPar_t * p;
+    int            iThread;
+    Vec_Int_t *    vMap;       // maps object IDs into the window positions
+    int            nCap;       // the size of the scratch arrays
+    SC_Pair *      pLoads;     // the loads of the window
+    SC_Pair *      pTimes;     // the arrival times of the window
+    SC_Pair *      pSlews;     // the slews of the window
+};
+
+struct Scl_UpsPar_t_
+{
+    SC_Man *       pMan;       // the timing manager
+    int            nThreads;   // the number of threads
+    int            nObjsMax;   // the number of objects in the network
+    // the current job
+    Vec_Int_t *    vNodes;     // the nodes to evaluate
+    Vec_Wec_t *    vRecalcs;   // the window of each node
+    Vec_Wec_t *    vEvals;     // the nodes of the window whose timing is evaluated
+    int            Notches;    // the max number of cells tried
+    int            DelayGap;   // the smallest gain accepted
+    int *          pGates;     // the best cell of each node (-1 if none)
+    float *        pGains;     // the best gain of each node
+    // thread synchronization
+    int            iJob;       // the number of started jobs
+    int            nDone;      // the number of threads that finished the job
+    int            fStop;      // the threads should exit
+    Scl_UpsParThData_t ThData[SCL_UPS_THR_MAX];
+#ifdef ABC_USE_PTHREADS
+    pthread_t      Workers[SCL_UPS_THR_MAX];
+    pthread_mutex_t Mutex;
+    pthread_cond_t Cond;
+#endif
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Timing information of the objects seen by one thread.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline SC_Pair * Scl_UpsParTime( Scl_UpsParThData_t * t, Abc_Obj_t * pObj )
+{
+    int iPos = Vec_IntEntry( t->vMap, Abc_ObjId(pObj) );
+    return iPos >= 0 ? t->pTimes + iPos : Abc_SclObjTime( t->p->pMan, pObj );
+}
+static inline SC_Pair * Scl_UpsParSlew( Scl_UpsParThData_t * t, Abc_Obj_t * pObj )
+{
+    int iPos = Vec_IntEntry( t->vMap, Abc_ObjId(pObj) );
+    return iPos >= 0 ? t->pSlews + iPos : Abc_SclObjSlew( t->p->pMan, pObj );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes arrival time of one object of the window.]
+
+  Description [Follows Abc_SclTimeNode() but keeps the estimated load in
+  a local variable.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Scl_UpsParTimeNode( Scl_UpsParThData_t * t, Abc_Obj_t * pObj, SC_Cell * pCell, int iPos )
+{
+    SC_Man * p = t->p->pMan;
+    SC_Pair * pLoad    = t->pLoads + iPos;
+    SC_Pair * pArrOut  = t->pTimes + iPos;
+    SC_Pair * pSlewOut = t->pSlews + iPos;
+    SC_Pair Load;
+    Abc_Obj_t * pFanin;
+    float EstDelta;
+    int k, fEst;
+    if ( Abc_ObjIsCi(pObj) )
+    {
+        if ( p->pPiDrive != NULL )
+            Scl_LibHandleInputDriver( p->pPiDrive, pLoad, pArrOut, pSlewOut );
+        return;
+    }
+    fEst = Abc_SclLoadEstimate( p, pLoad, &Load, &EstDelta );
+    Abc_ObjForEachFanin( pObj, pFanin, k )
+        Scl_LibPinArrival( Scl_CellPinTime(pCell, k), Scl_UpsParTime(t, pFanin), Scl_UpsParSlew(t, pFanin), &Load, pArrOut, pSlewOut );
+    if ( fEst )
+    {
+        pArrOut->rise += EstDelta;
+        pArrOut->fall += EstDelta;
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Evaluates the candidate cells of one node.]
+
+  Description [Follows Abc_SclFindBestCell(), Abc_SclUpdateLoad(),
+  Abc_SclTimeCone() and Abc_SclEvalPerform().]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Scl_UpsParFindBestCell( Scl_UpsParThData_t * t, Abc_Obj_t * pObj, Vec_Int_t * vRecalcs, Vec_Int_t * vEvals, float * pGainBest )
+{
+    SC_Man * p = t->p->pMan;
+    SC_Cell * pCellOld, * pCellNew;
+    Abc_Obj_t * pTemp, * pFanin;
+    float dGain, dGainBest;
+    int i, k, c, iPos, gateBest, NoChange = 0;
+    int nWin = Vec_IntSize(vRecalcs);
+    // prepare the window
+    if ( t->nCap < nWin )
+    {
+        t->nCap   = 2 * nWin;
+        t->pLoads = ABC_REALLOC( SC_Pair, t->pLoads, t->nCap );
+        t->pTimes = ABC_REALLOC( SC_Pair, t->pTimes, t->nCap );
+        t->pSlews = ABC_REALLOC( SC_Pair, t->pSlews, t->nCap );
+    }
+    Abc_NtkForEachObjVec( vRecalcs, p->pNtk, pTemp, i )
+        Vec_IntWriteEntry( t->vMap, Abc_ObjId(pTemp), i );
+    // try different gate sizes for this node
+    pCellOld = Abc_SclObjCell( pObj );
+    gateBest = -1;
+    dGainBest = -t->p->DelayGap;
+    SC_RingForEachCell( pCellOld, pCellNew, k )
+    {
+        float Diff, Multi = 1.5, Eval = 0;
+        if ( pCellNew == pCellOld )
+            continue;
+        if ( k > t->p->Notches )
+            break;
+        // set the loads for the new cell
+        Abc_NtkForEachObjVec( vRecalcs, p->pNtk, pTemp, i )
+            t->pLoads[i] = *Abc_SclObjLoad( p, pTemp );
+        Abc_ObjForEachFanin( pObj, pFanin, c )
+        {
+            SC_Pin * pPinOld = SC_CellPin( pCellOld, c );
+            SC_Pin * pPinNew = SC_CellPin( pCellNew, c );
+            if ( (iPos = Vec_IntEntry(t->vMap, Abc_ObjId(pFanin))) < 0 )
+                continue;
+            t->pLoads[iPos].rise += pPinNew->rise_cap - pPinOld->rise_cap;
+            t->pLoads[iPos].fall += pPinNew->fall_cap - pPinOld->fall_cap;
+        }
+        // recompute timing
+        memset( t->pTimes, 0, sizeof(SC_Pair) * nWin );
+        memset( t->pSlews, 0, sizeof(SC_Pair) * nWin );
+        Abc_NtkForEachObjVec( vRecalcs, p->pNtk, pTemp, i )
+            Scl_UpsParTimeNode( t, pTemp, pTemp == pObj ? pCellNew : (Abc_ObjIsNode(pTemp) ? Abc_SclObjCell(pTemp) : NULL), i );
+        // evaluate the gain
+        Abc_NtkForEachObjVec( vEvals, p->pNtk, pTemp, i )
+        {
+            SC_Pair * pOld = Abc_SclObjTime( p, pTemp );
+            SC_Pair * pNew = Scl_UpsParTime( t, pTemp );
+            Diff  = (pOld->rise - pNew->rise);
+            Diff += (pOld->fall - pNew->fall);
+            Eval += 0.5 * (Diff > 0 ? Diff : Multi * Diff);
+        }
+        dGain = Eval / Vec_IntSize(vEvals);
+        // save best gain
+        if ( dGainBest < dGain )
+        {
+            dGainBest = dGain;
+            gateBest = pCellNew->Id;
+            NoChange = 1;
+        }
+        else if ( NoChange )
+            NoChange++;
+        if ( NoChange == 4 )
+            break;
+    }
+    Abc_NtkForEachObjVec( vRecalcs, p->pNtk, pTemp, i )
+        Vec_IntWriteEntry( t->vMap, Abc_ObjId(pTemp), -1 );
+    *pGainBest = dGainBest;
+    return gateBest;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Evaluates the nodes assigned to one thread.]
+
+  Description [The other threads wait for the next job between the calls
+  and report to the first thread when they are done.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void * Scl_UpsParThread( void * pArg )
+{
+    Scl_UpsParThData_t * t = (Scl_UpsParThData_t *)pArg;
+    Scl_UpsPar_t * p = t->p;
+    int i;
+    for ( i = t->iThread; i < Vec_IntSize(p->vNodes); i += p->nThreads )
+        p->pGates[i] = Scl_UpsParFindBestCell( t, Abc_NtkObj(p->pMan->pNtk, Vec_IntEntry(p->vNodes, i)),
+            Vec_WecEntry(p->vRecalcs, i), Vec_WecEntry(p->vEvals, i), p->pGains + i );
+    return NULL;
+}
+#ifdef ABC_USE_PTHREADS
+static void * Scl_UpsParWorker( void * pArg )
+{
+    Scl_UpsPar_t * p = ((Scl_UpsParThData_t *)pArg)->p;
+    int iJob = 0, fStop;
+    while ( 1 )
+    {
+        pthread_mutex_lock( &p->Mutex );
+        while ( p->iJob == iJob && !p->fStop )
+            pthread_cond_wait( &p->Cond, &p->Mutex );
+        iJob  = p->iJob;
+        fStop = p->fStop;
+        pthread_mutex_unlock( &p->Mutex );
+        if ( fStop )
+            break;
+        Scl_UpsParThread( pArg );
+        pthread_mutex_lock( &p->Mutex );
+        if ( ++p->nDone == p->nThreads - 1 )
+            pthread_cond_broadcast( &p->Cond );
+        pthread_mutex_unlock( &p->Mutex );
+    }
+    return NULL;
+}
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the threads.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Scl_UpsPar_t * Scl_UpsParStart( SC_Man * pMan )
+{
+    Scl_UpsPar_t * p = ABC_CALLOC( Scl_UpsPar_t, 1 );
+    int i;
+    p->pMan     = pMan;
+    p->nThreads = Abc_MaxInt( 1, Abc_MinInt(pMan->nProcs, SCL_UPS_THR_MAX) );
+    p->nObjsMax = Abc_NtkObjNumMax( pMan->pNtk );
+#ifndef ABC_USE_PTHREADS
+    p->nThreads = 1;
+#endif
+    for ( i = 0; i < p->nThreads; i++ )
+    {
+        p->ThData[i].p       = p;
+        p->ThData[i].iThread = i;
+        p->ThData[i].vMap    = Vec_IntStartFull( p->nObjsMax );
+    }
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_init( &p->Mutex, NULL );
+    pthread_cond_init( &p->Cond, NULL );
+    for ( i = 1; i < p->nThreads; i++ )
+    {
+        int status;
+        status = pthread_create( p->Workers + i, NULL, Scl_UpsParWorker, (void *)(p->ThData + i) );
+        assert( status == 0 );
+    }
+#endif
+    return p;
+}
+static void Scl_UpsParStop( Scl_UpsPar_t * p )
+{
+    int i;
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_lock( &p->Mutex );
+    p->fStop = 1;
+    pthread_cond_broadcast( &p->Cond );
+    pthread_mutex_unlock( &p->Mutex );
+    for ( i = 1; i < p->nThreads; i++ )
+        pthread_join( p->Workers[i], NULL );
+    pthread_mutex_destroy( &p->Mutex );
+    pthread_cond_destroy( &p->Cond );
+#endif
+    for ( i = 0; i < p->nThreads; i++ )
+    {
+        Vec_IntFree( p->ThData[i].vMap );
+        ABC_FREE( p->ThData[i].pLoads );
+        ABC_FREE( p->ThData[i].pTimes );
+        ABC_FREE( p->ThData[i].pSlews );
+    }
+    ABC_FREE( p );
+}
+void Abc_SclUpsParFree( SC_Man * p )
+{
+    if ( p->pUpsPar == NULL )
+        return;
+    Scl_UpsParStop( p->pUpsPar );
+    p->pUpsPar = NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Finds the best cell of each node using several threads.]
+
+  Description [For each node in vNodes, the window and the evaluated
+  nodes are given by the corresponding levels of vRecalcs and vEvals.
+  Returns the best cell (or -1) and the best gain of each node in vGates
+  and vGains. The results are the same as those of Abc_SclFindBestCell()
+  and do not depend on the number of threads. The threads are started
+  by the first call and kept in the manager.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_SclFindBestCellsPar( SC_Man * pMan, Vec_Int_t * vNodes, Vec_Wec_t * vRecalcs, Vec_Wec_t * vEvals, int Notches, int DelayGap, Vec_Int_t * vGates, Vec_Flt_t * vGains )
+{
+    Scl_UpsPar_t * p;
+    assert( Vec_IntSize(vNodes) == Vec_WecSize(vRecalcs) );
+    assert( Vec_IntSize(vNodes) == Vec_WecSize(vEvals) );
+    Vec_IntFill( vGates, Vec_IntSize(vNodes), -1 );
+    Vec_FltFill( vGains, Vec_IntSize(vNodes), 0 );
+    if ( pMan->pUpsPar && pMan->pUpsPar->nObjsMax != Abc_NtkObjNumMax(pMan->pNtk) )
+        Abc_SclUpsParFree( pMan );
+    if ( pMan->pUpsPar == NULL )
+        pMan->pUpsPar = Scl_UpsParStart( pMan );
+    p = pMan->pUpsPar;
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_lock( &p->Mutex );
+#endif
+    p->vNodes   = vNodes;
+    p->vRecalcs = vRecalcs;
+    p->vEvals   = vEvals;
+    p->Notches  = Notches;
+    p->DelayGap = DelayGap;
+    p->pGates   = Vec_IntArray( vGates );
+    p->pGains   = Vec_FltArray( vGains );
+#ifdef ABC_USE_PTHREADS
+    p->nDone    = 0;
+    p->iJob++;
+    pthread_cond_broadcast( &p->Cond );
+    pthread_mutex_unlock( &p->Mutex );
+#endif
+    Scl_UpsParThread( (void *)p->ThData );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_lock( &p->Mutex );
+    while ( p->nDone < p->nThreads - 1 )
+        pthread_cond_wait( &p->Cond, &p->Mutex );
+    pthread_mutex_unlock( &p->Mutex );
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
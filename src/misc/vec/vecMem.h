@@ -243,6 +243,13 @@ static inline void Vec_MemPush( Vec_Mem_t * p, word * pEntry )
     word * pPlace = Vec_MemGetEntry( p, p->nEntries );
     memmove( pPlace, pEntry, sizeof(word) * (size_t)p->nEntrySize );
 }
+static inline void Vec_MemReserve( Vec_Mem_t * p, int nEntries )
+{
+    // makes sure page pointers are not reallocated before the number of entries exceeds nEntries
+    int nPages = (nEntries >> p->LogPageSze) + 1;
+    if ( nPages > p->nPageAlloc )
+        p->ppPages = ABC_REALLOC( word *, p->ppPages, (p->nPageAlloc = nPages) );
+}
 
 /**Function*************************************************************
 
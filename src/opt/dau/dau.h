@@ -76,6 +76,13 @@ static inline int Dau_DsdReadVar( char * p )  { if ( *p == '!' ) p++; return *p
 ///                    FUNCTION DECLARATIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
+/*=== dauCache.c ==========================================================*/
+extern int           Abc_TtCacheStart( char * pFileName, int fVerbose );
+extern void          Abc_TtCacheStop( int fVerbose );
+extern int           Abc_TtCacheIsStarted();
+extern void          Abc_TtCachePrint();
+extern int           Abc_TtCacheLookup( word * pTruth, int nVars, char * pCanonPerm, unsigned * puCanonPhase );
+extern void          Abc_TtCacheInsert( word * pTruth, word * pCanon, int nVars, char * pCanonPerm, unsigned uCanonPhase );
 /*=== dauCanon.c ==========================================================*/
 extern unsigned      Abc_TtCanonicize( word * pTruth, int nVars, char * pCanonPerm );
 extern unsigned      Abc_TtCanonicizePerm( word * pTruth, int nVars, char * pCanonPerm );
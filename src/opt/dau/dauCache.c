@@ -0,0 +1,422 @@
+/**CFile****************************************************************
+
+  FileName    [dauCache.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [DAG-aware unmapping.]
+
+  Synopsis    [Persistent cache of canonical forms of truth tables.]
+
+  Author      [agent]
+
+  Date        [Ver. 1.0. Started - October 16, 2026.]
+
+  Revision    [$Id: dauCache.c,v 1.00 2026/10/16 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "dauInt.h"
+#include "misc/util/utilTruth.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The cache file starts with an 8-byte signature followed by records.
+// Each record contains (1) the header word with the number of variables
+// in the lower byte and the canonical phase in the upper half, (2) the
+// canonical permutation packed into 4-bit fields, (3) the original truth
+// table and (4) its canonical form. The file is only appended to: records
+// computed in a session are written at the end of the file when the cache
+// is stopped, while the records loaded from the file are used in-place
+// from the memory-mapped file contents.
+
+#define ABC_TT_CACHE_SIGN    "ABCTTC01"
+#define ABC_TT_CACHE_VMIN    6
+#define ABC_TT_CACHE_VMAX   12
+
+typedef struct Abc_TtCache_t_ Abc_TtCache_t;
+struct Abc_TtCache_t_
+{
+    char *         pFileName;    // the file name
+    word *         pMap;         // the file contents
+    int            nMapBytes;    // the file size in bytes
+    int            nMapWords;    // the number of complete words in the file
+    int            fMapped;      // the contents are memory-mapped
+    int            fReadOnly;    // new records are not written into the file
+    Vec_Wrd_t *    vNew;         // records computed in this session
+    Vec_Int_t *    vHandles;     // record handles (word offset * 2 + is-new)
+    Vec_Int_t *    vTable;       // hash table
+    Vec_Int_t *    vNexts;       // next entries in the hash table
+    int            nLoaded;      // the number of records loaded from file
+    int            nHits;        // the number of successful lookups
+    int            nMisses;      // the number of failed lookups
+};
+
+static Abc_TtCache_t * s_pTtCache = NULL;
+
+static inline int      Abc_TtCacheRecWords( int nVars )                   { return 2 + 2 * Abc_TtWordNum(nVars);                                          }
+static inline word *   Abc_TtCacheRec( Abc_TtCache_t * p, int h )         { return (h & 1) ? Vec_WrdEntryP(p->vNew, h >> 1) : p->pMap + (h >> 1);          }
+static inline int      Abc_TtCacheRecVars( word * pRec )                  { return (int)(pRec[0] & 0xFF);                                                 }
+static inline unsigned Abc_TtCacheRecPhase( word * pRec )                 { return (unsigned)(pRec[0] >> 32);                                             }
+static inline word *   Abc_TtCacheRecTruth( word * pRec )                 { return pRec + 2;                                                              }
+static inline word *   Abc_TtCacheRecCanon( word * pRec )                 { return pRec + 2 + Abc_TtWordNum(Abc_TtCacheRecVars(pRec));                    }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Hash table.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline unsigned Abc_TtCacheHashKey( Abc_TtCache_t * p, word * pTruth, int nVars )
+{
+    static int s_Primes[8] = { 1699, 4177, 5147, 5647, 6343, 7103, 7873, 8147 };
+    int i, nData = 2 * Abc_TtWordNum(nVars);
+    unsigned * pData = (unsigned *)pTruth;
+    unsigned uHash = nVars * 7937;
+    for ( i = 0; i < nData; i++ )
+        uHash += pData[i] * s_Primes[i & 0x7];
+    return uHash % Vec_IntSize(p->vTable);
+}
+static int * Abc_TtCacheHashLookup( Abc_TtCache_t * p, word * pTruth, int nVars )
+{
+    int * pSpot = Vec_IntEntryP( p->vTable, Abc_TtCacheHashKey(p, pTruth, nVars) );
+    for ( ; *pSpot != -1; pSpot = Vec_IntEntryP(p->vNexts, *pSpot) )
+    {
+        word * pRec = Abc_TtCacheRec( p, Vec_IntEntry(p->vHandles, *pSpot) );
+        if ( Abc_TtCacheRecVars(pRec) == nVars && Abc_TtEqual(Abc_TtCacheRecTruth(pRec), pTruth, Abc_TtWordNum(nVars)) )
+            return pSpot;
+    }
+    return pSpot;
+}
+static void Abc_TtCacheHashResize( Abc_TtCache_t * p )
+{
+    int * pSpot, i, Handle;
+    Vec_IntFill( p->vTable, Abc_PrimeCudd(2 * Vec_IntSize(p->vTable)), -1 );
+    Vec_IntClear( p->vNexts );
+    Vec_IntForEachEntry( p->vHandles, Handle, i )
+    {
+        word * pRec = Abc_TtCacheRec( p, Handle );
+        pSpot = Abc_TtCacheHashLookup( p, Abc_TtCacheRecTruth(pRec), Abc_TtCacheRecVars(pRec) );
+        assert( *pSpot == -1 );
+        *pSpot = Vec_IntSize(p->vNexts);
+        Vec_IntPush( p->vNexts, -1 );
+    }
+    assert( Vec_IntSize(p->vNexts) == Vec_IntSize(p->vHandles) );
+}
+static void Abc_TtCacheHashAdd( Abc_TtCache_t * p, int Handle )
+{
+    word * pRec = Abc_TtCacheRec( p, Handle );
+    int * pSpot = Abc_TtCacheHashLookup( p, Abc_TtCacheRecTruth(pRec), Abc_TtCacheRecVars(pRec) );
+    if ( *pSpot != -1 ) // duplicated record
+        return;
+    *pSpot = Vec_IntSize(p->vHandles);
+    Vec_IntPush( p->vHandles, Handle );
+    Vec_IntPush( p->vNexts, -1 );
+    if ( Vec_IntSize(p->vHandles) > Vec_IntSize(p->vTable) )
+        Abc_TtCacheHashResize( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the records from file.]
+
+  Description [The file is memory-mapped when possible. The records that
+  are read from file are not copied but used directly from the mapping.
+  The incomplete record at the end of file (for example, left by a run
+  interrupted while appending) is ignored and the file is not updated.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Abc_TtCacheMap( Abc_TtCache_t * p )
+{
+    int nFileSize = 0;
+#ifndef _WIN32
+    struct stat Stat;
+    void * pMap;
+    int fd = open( p->pFileName, O_RDONLY );
+    if ( fd == -1 )
+        return 1;
+    if ( fstat( fd, &Stat ) == -1 || Stat.st_size > 0x7FFFFFFF )
+    {
+        close( fd );
+        return 0;
+    }
+    nFileSize = (int)Stat.st_size;
+    if ( nFileSize == 0 )
+    {
+        close( fd );
+        return 1;
+    }
+    pMap = mmap( NULL, (size_t)nFileSize, PROT_READ, MAP_SHARED, fd, 0 );
+    close( fd );
+    if ( pMap == MAP_FAILED )
+        return 0;
+    p->pMap = (word *)pMap;
+    p->fMapped = 1;
+#else
+    FILE * pFile = fopen( p->pFileName, "rb" );
+    if ( pFile == NULL )
+        return 1;
+    fseek( pFile, 0, SEEK_END );
+    nFileSize = (int)ftell( pFile );
+    rewind( pFile );
+    if ( nFileSize == 0 )
+    {
+        fclose( pFile );
+        return 1;
+    }
+    p->pMap = ABC_ALLOC( word, nFileSize / 8 + 1 );
+    nFileSize = (int)fread( p->pMap, 1, nFileSize, pFile );
+    fclose( pFile );
+#endif
+    p->nMapBytes = nFileSize;
+    p->nMapWords = nFileSize / 8;
+    return 1;
+}
+static void Abc_TtCacheUnmap( Abc_TtCache_t * p )
+{
+    if ( p->pMap == NULL )
+        return;
+#ifndef _WIN32
+    if ( p->fMapped )
+        munmap( p->pMap, (size_t)p->nMapBytes );
+    else
+#endif
+    ABC_FREE( p->pMap );
+    p->pMap = NULL;
+}
+static int Abc_TtCacheLoad( Abc_TtCache_t * p )
+{
+    int nRecWords, nVars, iWord;
+    if ( !Abc_TtCacheMap(p) )
+    {
+        printf( "Cannot read the truth table cache from file \"%s\".\n", p->pFileName );
+        return 0;
+    }
+    if ( p->pMap == NULL ) // new file
+        return 1;
+    if ( p->nMapWords < 1 || memcmp(p->pMap, ABC_TT_CACHE_SIGN, 8) )
+    {
+        printf( "File \"%s\" is not a truth table cache.\n", p->pFileName );
+        return 0;
+    }
+    for ( iWord = 1; iWord < p->nMapWords; iWord += nRecWords )
+    {
+        nVars = Abc_TtCacheRecVars( p->pMap + iWord );
+        if ( nVars < ABC_TT_CACHE_VMIN || nVars > ABC_TT_CACHE_VMAX )
+            break;
+        nRecWords = Abc_TtCacheRecWords( nVars );
+        if ( iWord + nRecWords > p->nMapWords )
+            break;
+        Abc_TtCacheHashAdd( p, iWord << 1 );
+    }
+    if ( iWord < p->nMapWords || p->nMapBytes % 8 )
+    {
+        printf( "The truth table cache \"%s\" ends with an incomplete record. New records will not be saved.\n", p->pFileName );
+        p->fReadOnly = 1;
+    }
+    p->nLoaded = Vec_IntSize( p->vHandles );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Appends the new records to the file.]
+
+  Description [The records are written by one unbuffered call, so that
+  runs sharing the cache file do not interleave their records.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Abc_TtCacheSave( Abc_TtCache_t * p )
+{
+    Vec_Wrd_t * vOut;
+    FILE * pFile;
+    int nWritten;
+    if ( p->fReadOnly || Vec_WrdSize(p->vNew) == 0 )
+        return 1;
+    pFile = fopen( p->pFileName, "ab" );
+    if ( pFile == NULL )
+    {
+        printf( "Cannot open file \"%s\" for appending.\n", p->pFileName );
+        return 0;
+    }
+    setvbuf( pFile, NULL, _IONBF, 0 );
+    fseek( pFile, 0, SEEK_END );
+    vOut = Vec_WrdAlloc( Vec_WrdSize(p->vNew) + 1 );
+    if ( ftell(pFile) == 0 )
+    {
+        word Sign;
+        memcpy( &Sign, ABC_TT_CACHE_SIGN, 8 );
+        Vec_WrdPush( vOut, Sign );
+    }
+    Vec_WrdAppend( vOut, p->vNew );
+    nWritten = (int)fwrite( Vec_WrdArray(vOut), sizeof(word), Vec_WrdSize(vOut), pFile );
+    fclose( pFile );
+    nWritten -= Vec_WrdSize(vOut) - Vec_WrdSize(p->vNew);
+    Vec_WrdFree( vOut );
+    if ( nWritten != Vec_WrdSize(p->vNew) )
+    {
+        printf( "Writing the truth table cache into file \"%s\" has failed.\n", p->pFileName );
+        return 0;
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the cache.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_TtCacheStart( char * pFileName, int fVerbose )
+{
+    Abc_TtCache_t * p;
+    abctime clk = Abc_Clock();
+    Abc_TtCacheStop( fVerbose );
+    p = ABC_CALLOC( Abc_TtCache_t, 1 );
+    p->pFileName = Abc_UtilStrsav( pFileName );
+    p->vNew      = Vec_WrdAlloc( 1 << 12 );
+    p->vHandles  = Vec_IntAlloc( 1 << 12 );
+    p->vNexts    = Vec_IntAlloc( 1 << 12 );
+    p->vTable    = Vec_IntStartFull( Abc_PrimeCudd(1 << 12) );
+    if ( !Abc_TtCacheLoad(p) )
+    {
+        s_pTtCache = p;
+        Abc_TtCacheStop( 0 );
+        return 0;
+    }
+    s_pTtCache = p;
+    if ( fVerbose )
+    {
+        printf( "Loaded %d canonical forms from file \"%s\"%s.  ", p->nLoaded, p->pFileName, p->fMapped ? " (memory-mapped)" : "" );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    return 1;
+}
+void Abc_TtCacheStop( int fVerbose )
+{
+    Abc_TtCache_t * p = s_pTtCache;
+    if ( p == NULL )
+        return;
+    if ( fVerbose )
+        Abc_TtCachePrint();
+    Abc_TtCacheSave( p );
+    Abc_TtCacheUnmap( p );
+    Vec_WrdFree( p->vNew );
+    Vec_IntFree( p->vHandles );
+    Vec_IntFree( p->vNexts );
+    Vec_IntFree( p->vTable );
+    ABC_FREE( p->pFileName );
+    ABC_FREE( p );
+    s_pTtCache = NULL;
+}
+int Abc_TtCacheIsStarted()
+{
+    return s_pTtCache != NULL;
+}
+void Abc_TtCachePrint()
+{
+    Abc_TtCache_t * p = s_pTtCache;
+    if ( p == NULL )
+    {
+        printf( "The truth table cache is not started.\n" );
+        return;
+    }
+    printf( "Cache \"%s\":  Loaded = %d.  New = %d.  Lookups = %d.  Hits = %d (%.2f %%).%s\n",
+        p->pFileName, p->nLoaded, Vec_IntSize(p->vHandles) - p->nLoaded, p->nHits + p->nMisses,
+        p->nHits, 100.0 * p->nHits / Abc_MaxInt(1, p->nHits + p->nMisses), p->fReadOnly ? "  Read-only." : "" );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Looks up and adds the canonical forms.]
+
+  Description [If the canonical form of the truth table is found, it is
+  written in place of the truth table, the permutation is written into
+  pCanonPerm, and the phase is returned in puCanonPhase.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_TtCacheLookup( word * pTruth, int nVars, char * pCanonPerm, unsigned * puCanonPhase )
+{
+    Abc_TtCache_t * p = s_pTtCache;
+    word * pRec, Perm; int * pSpot, i;
+    if ( p == NULL || nVars < ABC_TT_CACHE_VMIN || nVars > ABC_TT_CACHE_VMAX )
+        return 0;
+    pSpot = Abc_TtCacheHashLookup( p, pTruth, nVars );
+    if ( *pSpot == -1 )
+    {
+        p->nMisses++;
+        return 0;
+    }
+    p->nHits++;
+    pRec = Abc_TtCacheRec( p, Vec_IntEntry(p->vHandles, *pSpot) );
+    Abc_TtCopy( pTruth, Abc_TtCacheRecCanon(pRec), Abc_TtWordNum(nVars), 0 );
+    for ( Perm = pRec[1], i = 0; i < nVars; i++, Perm >>= 4 )
+        pCanonPerm[i] = (char)(Perm & 0xF);
+    *puCanonPhase = Abc_TtCacheRecPhase( pRec );
+    return 1;
+}
+void Abc_TtCacheInsert( word * pTruth, word * pCanon, int nVars, char * pCanonPerm, unsigned uCanonPhase )
+{
+    Abc_TtCache_t * p = s_pTtCache;
+    int i, nWords = Abc_TtWordNum(nVars), iWord;
+    word Perm = 0;
+    if ( p == NULL || nVars < ABC_TT_CACHE_VMIN || nVars > ABC_TT_CACHE_VMAX )
+        return;
+    if ( *Abc_TtCacheHashLookup(p, pTruth, nVars) != -1 )
+        return;
+    for ( i = nVars - 1; i >= 0; i-- )
+        Perm = (Perm << 4) | (word)(pCanonPerm[i] & 0xF);
+    iWord = Vec_WrdSize( p->vNew );
+    Vec_WrdPush( p->vNew, ((word)uCanonPhase << 32) | (word)nVars );
+    Vec_WrdPush( p->vNew, Perm );
+    for ( i = 0; i < nWords; i++ )
+        Vec_WrdPush( p->vNew, pTruth[i] );
+    for ( i = 0; i < nWords; i++ )
+        Vec_WrdPush( p->vNew, pCanon[i] );
+    Abc_TtCacheHashAdd( p, (iWord << 1) | 1 );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -302,7 +302,7 @@ void Abc_TtNormalizeSmallTruth(word * pTruth, int nVars)
     }
 }
 
-inline void Abc_TtVerifySmallTruth(word * pTruth, int nVars)
+static inline void Abc_TtVerifySmallTruth(word * pTruth, int nVars)
 {
 #ifndef NDEBUG
     if (nVars < 6) {
@@ -369,7 +369,7 @@ int Abc_TtCountOnesInCofsSimple( word * pTruth, int nVars, int * pStore )
 }
 
 // Shifted Cofactor Coefficient
-inline int shiftFunc(int ci)
+static inline int shiftFunc(int ci)
 //{ return ci * ci; }
 { return 1 << ci; }
 
@@ -1034,6 +1034,8 @@ unsigned Abc_TtCanonicize( word * pTruth, int nVars, char * pCanonPerm )
     unsigned uCanonPhase;
     int i, k, nWords = Abc_TtWordNum( nVars );
     int fNaive = 1;
+    int fCache = Abc_TtCacheIsStarted() && nVars <= DAU_MAX_VAR;
+    word pTruthInit[DAU_MAX_WORD];
 
 #ifdef CANON_VERIFY
     char pCanonPermCopy[16];
@@ -1042,6 +1044,14 @@ unsigned Abc_TtCanonicize( word * pTruth, int nVars, char * pCanonPerm )
     Abc_TtCopy( pCopy1, pTruth, nWords, 0 );
 #endif
 
+    // consult the persistent cache first
+    if ( fCache )
+    {
+        if ( Abc_TtCacheLookup( pTruth, nVars, pCanonPerm, &uCanonPhase ) )
+            return uCanonPhase;
+        Abc_TtCopy( pTruthInit, pTruth, nWords, 0 );
+    }
+
     uCanonPhase = Abc_TtSemiCanonicize( pTruth, nVars, pCanonPerm, pStoreIn, 0 );
     for ( k = 0; k < 5; k++ )
     {
@@ -1074,6 +1084,8 @@ unsigned Abc_TtCanonicize( word * pTruth, int nVars, char * pCanonPerm )
         i = 0;
     }
 */
+    if ( fCache )
+        Abc_TtCacheInsert( pTruthInit, pTruth, nVars, pCanonPerm, uCanonPhase );
     return uCanonPhase;
 }
 
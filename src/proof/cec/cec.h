@@ -51,6 +51,7 @@ struct Cec_ParSat_t_
     int              fCheckMiter;   // the circuit is the miter
 //    int              fFirstStop;    // stop on the first sat output
     int              fLearnCls;     // perform clause learning
+    int              fLazyCnf;      // load CNF of a node when its variable is assigned
     int              fSaveCexes;    // saves counter-examples
     int              fVerbose;      // verbose stats
 };
@@ -102,6 +103,8 @@ struct Cec_ParFra_t_
     int              TimeLimit;     // the runtime limit in seconds
     int              nLevelMax;     // restriction on the level nodes to be swept
     int              nDepthMax;     // the depth in terms of steps of speculative reduction
+    int              nProcs;        // the number of threads for simulation and SAT sweeping
+    int              nSolverType;   // the SAT solver used by the new sweeper (Bmc_SatType_t)
     int              fRewriting;    // enables AIG rewriting
     int              fCheckMiter;   // the circuit is the miter
 //    int              fFirstStop;    // stop on the first sat output
@@ -110,6 +113,7 @@ struct Cec_ParFra_t_
     int              fSatSweeping;  // enable SAT sweeping
     int              fRunCSat;      // enable another solver
     int              fUseCones;     // use cones
+    int              fLazyCnf;      // load CNF of a node when its variable is assigned
     int              fUseOrigIds;   // enable recording of original IDs
     int              fVeryVerbose;  // verbose stats
     int              fVerbose;      // verbose stats
@@ -126,6 +130,7 @@ struct Cec_ParCec_t_
     int              fUseSmartCnf;  // use smart CNF computation
     int              fRewriting;    // enables AIG rewriting
     int              fNaive;        // performs naive SAT-based checking
+    int              nSolverType;   // the SAT solver used by naive checking (Bmc_SatType_t)
     int              fSilent;       // print no messages
     int              fVeryVerbose;  // verbose stats
     int              fVerbose;      // verbose stats
@@ -23,6 +23,7 @@
 #include "aig/gia/giaAig.h"
 #include "misc/extra/extra.h"
 #include "sat/cnf/cnf.h"
+#include "sat/bmc/bmc.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -226,14 +227,23 @@ int Cec_ManHandleSpecialCases( Gia_Man_t * p, Cec_ParCec_t * pPars )
 int Cec_ManVerifyNaive( Gia_Man_t * p, Cec_ParCec_t * pPars )
 {
     Cnf_Dat_t * pCnf = (Cnf_Dat_t *)Mf_ManGenerateCnf( p, 8, 0, 0, 0, 0 );
-    sat_solver * pSat = (sat_solver *)Cnf_DataWriteIntoSolver( pCnf, 1, 0 );
+    Bmc_Sat_t * pSat = Bmc_SatStart( pPars->nSolverType );
     Gia_Obj_t * pObj0, * pObj1;
     abctime clkStart = Abc_Clock();
     int nPairs = Gia_ManPoNum(p)/2;
     int nUnsats = 0, nSats = 0, nUndecs = 0, nTrivs = 0;
     int i, iVar0, iVar1, pLits[2], status, RetValue;
-    ProgressBar * pProgress = Extra_ProgressBarStart( stdout, nPairs );
+    ProgressBar * pProgress;
     assert( Gia_ManPoNum(p) % 2 == 0 );
+    // load the CNF of the miter
+    for ( i = 0; i < pCnf->nVars; i++ )
+        Bmc_SatAddVar( pSat );
+    for ( i = 0; i < pCnf->nClauses; i++ )
+    {
+        RetValue = Bmc_SatAddClause( pSat, pCnf->pClauses[i], pCnf->pClauses[i+1] - pCnf->pClauses[i] );
+        assert( RetValue );
+    }
+    pProgress = Extra_ProgressBarStart( stdout, nPairs );
     for ( i = 0; i < nPairs; i++ )
     {
         if ( (i & 0xFF) == 0 )
@@ -258,16 +268,16 @@ int Cec_ManVerifyNaive( Gia_Man_t * p, Cec_ParCec_t * pPars )
         pLits[0] = Abc_Var2Lit( iVar0, 0 );
         pLits[1] = Abc_Var2Lit( iVar1, 0 );
         // check direct
-        pLits[0] = lit_neg(pLits[0]);
-        status = sat_solver_solve( pSat, pLits, pLits + 2, pPars->nBTLimit, 0, 0, 0 );
-        if ( status == l_False )
+        pLits[0] = Abc_LitNot( pLits[0] );
+        status = Bmc_SatSolve( pSat, pLits, 2, pPars->nBTLimit );
+        if ( status == -1 )
         {
-            pLits[0] = lit_neg( pLits[0] );
-            pLits[1] = lit_neg( pLits[1] );
-            RetValue = sat_solver_addclause( pSat, pLits, pLits + 2 );
+            pLits[0] = Abc_LitNot( pLits[0] );
+            pLits[1] = Abc_LitNot( pLits[1] );
+            RetValue = Bmc_SatAddClause( pSat, pLits, 2 );
             assert( RetValue );
         }
-        else if ( status == l_True )
+        else if ( status == 1 )
         {
             printf( "Output %d is SAT.\n", i );
             nSats++;
@@ -279,15 +289,15 @@ int Cec_ManVerifyNaive( Gia_Man_t * p, Cec_ParCec_t * pPars )
             continue;
         }
         // check inverse
-        status = sat_solver_solve( pSat, pLits, pLits + 2, pPars->nBTLimit, 0, 0, 0 );
-        if ( status == l_False )
+        status = Bmc_SatSolve( pSat, pLits, 2, pPars->nBTLimit );
+        if ( status == -1 )
         {
-            pLits[0] = lit_neg( pLits[0] );
-            pLits[1] = lit_neg( pLits[1] );
-            RetValue = sat_solver_addclause( pSat, pLits, pLits + 2 );
+            pLits[0] = Abc_LitNot( pLits[0] );
+            pLits[1] = Abc_LitNot( pLits[1] );
+            RetValue = Bmc_SatAddClause( pSat, pLits, 2 );
             assert( RetValue );
         }
-        else if ( status == l_True )
+        else if ( status == 1 )
         {
             printf( "Output %d is SAT.\n", i );
             nSats++;
@@ -304,7 +314,7 @@ int Cec_ManVerifyNaive( Gia_Man_t * p, Cec_ParCec_t * pPars )
     printf( "UNSAT = %6d.  SAT = %6d.   UNDEC = %6d.  Trivial = %6d.  ", nUnsats, nSats, nUndecs, nTrivs );
     Abc_PrintTime( 1, "Time", Abc_Clock() - clkStart );
     Cnf_DataFree( pCnf );
-    sat_solver_delete( pSat );
+    Bmc_SatStop( pSat );
     if ( nSats )
         return 0;
     if ( nUndecs )
@@ -84,6 +84,8 @@ struct Cec_ManSat_t_
     int              nSatVars;       // the counter of SAT variables
     int *            pSatVars;       // mapping of each node into its SAT var
     Vec_Ptr_t *      vUsedNodes;     // nodes whose SAT vars are assigned
+    Vec_Int_t *      vSatObjs;       // mapping of each SAT var into its node (lazy CNF)
+    double           nSatClauses;    // the number of clauses in the recycled solvers
     int              nRecycles;      // the number of times SAT solver was recycled
     int              nCallsSince;    // the number of calls since the last recycle
     Vec_Ptr_t *      vFanins;        // fanins of the CNF node
@@ -57,6 +57,8 @@ Cec_ManSat_t * Cec_ManSatCreate( Gia_Man_t * pAig, Cec_ParSat_t * pPars )
     p->vFanins      = Vec_PtrAlloc( 100 );
     p->vCex         = Vec_IntAlloc( 100 );
     p->vVisits      = Vec_IntAlloc( 100 );
+    if ( pPars->fLazyCnf )
+        p->vSatObjs = Vec_IntAlloc( 1000 );
     return p;
 }
 
@@ -77,7 +79,8 @@ void Cec_ManSatPrintStats( Cec_ManSat_t * p )
     Abc_Print( 1, "AND = %8d  ", Gia_ManAndNum(p->pAig) );
     Abc_Print( 1, "Conf = %5d  ", p->pPars->nBTLimit );
     Abc_Print( 1, "MinVar = %5d  ", p->pPars->nSatVarMax );
-    Abc_Print( 1, "MinCalls = %5d\n", p->pPars->nCallsRecycle );
+    Abc_Print( 1, "MinCalls = %5d  ", p->pPars->nCallsRecycle );
+    Abc_Print( 1, "Clauses = %.0f%s\n", p->nSatClauses + (p->pSat ? sat_solver_nclauses(p->pSat) : 0), p->pPars->fLazyCnf ? " (lazy)" : "" );
     Abc_Print( 1, "Unsat calls %6d  (%6.2f %%)   Ave conf = %8.1f   ", 
         p->nSatUnsat, p->nSatTotal? 100.0*p->nSatUnsat/p->nSatTotal : 0.0, p->nSatUnsat? 1.0*p->nConfUnsat/p->nSatUnsat :0.0 );
     Abc_PrintTimeP( 1, "Time", p->timeSatUnsat, p->timeTotal );
@@ -109,6 +112,7 @@ void Cec_ManSatStop( Cec_ManSat_t * p )
     Vec_IntFree( p->vVisits );
     Vec_PtrFree( p->vUsedNodes );
     Vec_PtrFree( p->vFanins );
+    Vec_IntFreeP( &p->vSatObjs );
     ABC_FREE( p->pSatVars );
     ABC_FREE( p );
 }
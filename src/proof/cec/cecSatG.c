@@ -21,8 +21,23 @@
 #include "aig/gia/gia.h"
 #include "misc/util/utilTruth.h"
 #include "sat/glucose/AbcGlucose.h"
+#include "sat/bmc/bmc.h"
 #include "cec.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
+#ifdef _MSC_VER
+#include <windows.h>
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
@@ -37,8 +52,11 @@ struct Cec3_Par_t_
     int              nSimRounds;    // simulation rounds
     int              nItersMax;     // max number of iterations
     int              nConfLimit;    // SAT solver conflict limit
+    int              nProcs;        // the number of threads for simulation and SAT sweeping
+    int              nSolverType;   // SAT solver type (Bmc_SatType_t)
     int              fIsMiter;      // this is a miter
     int              fUseCones;     // use logic cones
+    int              fLazyCnf;      // load CNF of a node when its variable is assigned
     int              fVeryVerbose;  // verbose stats
     int              fVerbose;      // verbose stats
 };
@@ -51,7 +69,7 @@ struct Cec3_Man_t_
     Gia_Man_t *      pAig;           // user's AIG
     Gia_Man_t *      pNew;           // internal AIG
     // SAT solving
-    bmcg_sat_solver* pSat;           // SAT solver
+    Bmc_Sat_t *      pSat;           // SAT solver
     Vec_Ptr_t *      vFrontier;      // CNF construction
     Vec_Ptr_t *      vFanins;        // CNF construction
     Vec_Wrd_t *      vSims;          // CI simulation info
@@ -59,11 +77,20 @@ struct Cec3_Man_t_
     Vec_Int_t *      vSatVars;       // nodes
     Vec_Int_t *      vObjSatPairs;   // nodes
     Vec_Int_t *      vCexTriples;    // nodes
+    Vec_Int_t *      vSatObjs;       // the node of each SAT variable (lazy CNF)
+    Gia_SimPar_t *   pSimPar;        // parallel simulation
+    // parallel SAT sweeping
+    Vec_Ptr_t *      vWorkers;       // the contexts of the additional threads
+    Vec_Int_t *      vCands;         // the candidates (node, literal, phase)
+    Vec_Int_t *      vResults;       // the results (status, thread, CEX start)
+    Vec_Int_t *      vCexes;         // the CEXes found by this thread
+    volatile int     iNextCand;      // the next candidate to be solved
     // statistics
     int              nPatterns;
     int              nSatSat;
     int              nSatUnsat;
     int              nSatUndec;
+    word             nSatClauses;
     abctime          timeSatSat;
     abctime          timeSatUnsat;
     abctime          timeSatUndec;
@@ -77,8 +104,16 @@ static inline int    Cec3_ObjSatId( Gia_Man_t * p, Gia_Obj_t * pObj )
 static inline int    Cec3_ObjSetSatId( Gia_Man_t * p, Gia_Obj_t * pObj, int Num ) { assert(Cec3_ObjSatId(p, pObj) == -1); Gia_ObjSetCopy2Array(p, Gia_ObjId(p, pObj), Num); return Num;  }
 static inline void   Cec3_ObjCleanSatId( Gia_Man_t * p, Gia_Obj_t * pObj )        { assert(Cec3_ObjSatId(p, pObj) != -1); Gia_ObjSetCopy2Array(p, Gia_ObjId(p, pObj), -1);               }
 
-static inline void   satoko_mark_cone( bmcg_sat_solver * p, int * pVars, int nVars )   {}
-static inline void   satoko_unmark_cone( bmcg_sat_solver * p, int * pVars, int nVars ) {}
+#ifdef _MSC_VER
+#define CEC3_ADD32( p, Add )  ((int)InterlockedExchangeAdd((volatile LONG *)(p), (LONG)(Add)))
+#else
+#define CEC3_ADD32( p, Add )  __sync_fetch_and_add( (p), (Add) )
+#endif
+
+#define CEC3_PAR_THR_MAX 64
+
+static inline void   satoko_mark_cone( Bmc_Sat_t * p, int * pVars, int nVars )   {}
+static inline void   satoko_unmark_cone( Bmc_Sat_t * p, int * pVars, int nVars ) {}
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -102,8 +137,11 @@ void Cec3_SetDefaultParams( Cec3_Par_t * p )
     p->nSimRounds     =       4;    // simulation rounds
     p->nItersMax      =      10;    // max number of iterations
     p->nConfLimit     =    1000;    // conflict limit at a node
+    p->nProcs         =       1;    // the number of threads for simulation and SAT sweeping
+    p->nSolverType    = BMC_SAT_GLUCOSE; // SAT solver type
     p->fIsMiter       =       0;    // this is a miter
     p->fUseCones      =       0;    // use logic cones
+    p->fLazyCnf       =       0;    // load CNF of a node when its variable is assigned
     p->fVeryVerbose   =       0;    // verbose stats
     p->fVerbose       =       0;    // verbose stats
 }  
@@ -119,7 +157,7 @@ void Cec3_SetDefaultParams( Cec3_Par_t * p )
   SeeAlso     []
 
 ***********************************************************************/
-void Cec3_AddClausesMux( Gia_Man_t * p, Gia_Obj_t * pNode, bmcg_sat_solver * pSat )
+void Cec3_AddClausesMux( Gia_Man_t * p, Gia_Obj_t * pNode, Bmc_Sat_t * pSat )
 {
     int fPolarFlip = 0;
     Gia_Obj_t * pNodeI, * pNodeT, * pNodeE;
@@ -155,7 +193,7 @@ void Cec3_AddClausesMux( Gia_Man_t * p, Gia_Obj_t * pNode, bmcg_sat_solver * pSa
         if ( Gia_Regular(pNodeT)->fPhase )  pLits[1] = Abc_LitNot( pLits[1] );
         if ( pNode->fPhase )                pLits[2] = Abc_LitNot( pLits[2] );
     }
-    RetValue = bmcg_sat_solver_addclause( pSat, pLits, 3 );
+    RetValue = Bmc_SatAddClause( pSat, pLits, 3 );
     assert( RetValue );
     pLits[0] = Abc_Var2Lit(VarI, 1);
     pLits[1] = Abc_Var2Lit(VarT, 0^fCompT);
@@ -166,7 +204,7 @@ void Cec3_AddClausesMux( Gia_Man_t * p, Gia_Obj_t * pNode, bmcg_sat_solver * pSa
         if ( Gia_Regular(pNodeT)->fPhase )  pLits[1] = Abc_LitNot( pLits[1] );
         if ( pNode->fPhase )                pLits[2] = Abc_LitNot( pLits[2] );
     }
-    RetValue = bmcg_sat_solver_addclause( pSat, pLits, 3 );
+    RetValue = Bmc_SatAddClause( pSat, pLits, 3 );
     assert( RetValue );
     pLits[0] = Abc_Var2Lit(VarI, 0);
     pLits[1] = Abc_Var2Lit(VarE, 1^fCompE);
@@ -177,7 +215,7 @@ void Cec3_AddClausesMux( Gia_Man_t * p, Gia_Obj_t * pNode, bmcg_sat_solver * pSa
         if ( Gia_Regular(pNodeE)->fPhase )  pLits[1] = Abc_LitNot( pLits[1] );
         if ( pNode->fPhase )                pLits[2] = Abc_LitNot( pLits[2] );
     }
-    RetValue = bmcg_sat_solver_addclause( pSat, pLits, 3 );
+    RetValue = Bmc_SatAddClause( pSat, pLits, 3 );
     assert( RetValue );
     pLits[0] = Abc_Var2Lit(VarI, 0);
     pLits[1] = Abc_Var2Lit(VarE, 0^fCompE);
@@ -188,7 +226,7 @@ void Cec3_AddClausesMux( Gia_Man_t * p, Gia_Obj_t * pNode, bmcg_sat_solver * pSa
         if ( Gia_Regular(pNodeE)->fPhase )  pLits[1] = Abc_LitNot( pLits[1] );
         if ( pNode->fPhase )                pLits[2] = Abc_LitNot( pLits[2] );
     }
-    RetValue = bmcg_sat_solver_addclause( pSat, pLits, 3 );
+    RetValue = Bmc_SatAddClause( pSat, pLits, 3 );
     assert( RetValue );
 
     // two additional clauses
@@ -213,7 +251,7 @@ void Cec3_AddClausesMux( Gia_Man_t * p, Gia_Obj_t * pNode, bmcg_sat_solver * pSa
         if ( Gia_Regular(pNodeE)->fPhase )  pLits[1] = Abc_LitNot( pLits[1] );
         if ( pNode->fPhase )                pLits[2] = Abc_LitNot( pLits[2] );
     }
-    RetValue = bmcg_sat_solver_addclause( pSat, pLits, 3 );
+    RetValue = Bmc_SatAddClause( pSat, pLits, 3 );
     assert( RetValue );
     pLits[0] = Abc_Var2Lit(VarT, 1^fCompT);
     pLits[1] = Abc_Var2Lit(VarE, 1^fCompE);
@@ -224,10 +262,10 @@ void Cec3_AddClausesMux( Gia_Man_t * p, Gia_Obj_t * pNode, bmcg_sat_solver * pSa
         if ( Gia_Regular(pNodeE)->fPhase )  pLits[1] = Abc_LitNot( pLits[1] );
         if ( pNode->fPhase )                pLits[2] = Abc_LitNot( pLits[2] );
     }
-    RetValue = bmcg_sat_solver_addclause( pSat, pLits, 3 );
+    RetValue = Bmc_SatAddClause( pSat, pLits, 3 );
     assert( RetValue );
 }
-void Cec3_AddClausesSuper( Gia_Man_t * p, Gia_Obj_t * pNode, Vec_Ptr_t * vSuper, bmcg_sat_solver * pSat )
+void Cec3_AddClausesSuper( Gia_Man_t * p, Gia_Obj_t * pNode, Vec_Ptr_t * vSuper, Bmc_Sat_t * pSat )
 {
     int fPolarFlip = 0;
     Gia_Obj_t * pFanin;
@@ -248,7 +286,7 @@ void Cec3_AddClausesSuper( Gia_Man_t * p, Gia_Obj_t * pNode, Vec_Ptr_t * vSuper,
             if ( Gia_Regular(pFanin)->fPhase )  pLits[0] = Abc_LitNot( pLits[0] );
             if ( pNode->fPhase )                pLits[1] = Abc_LitNot( pLits[1] );
         }
-        RetValue = bmcg_sat_solver_addclause( pSat, pLits, 2 );
+        RetValue = Bmc_SatAddClause( pSat, pLits, 2 );
         assert( RetValue );
     }
     // add A & B => C   or   !A + !B + C
@@ -265,7 +303,7 @@ void Cec3_AddClausesSuper( Gia_Man_t * p, Gia_Obj_t * pNode, Vec_Ptr_t * vSuper,
     {
         if ( pNode->fPhase )  pLits[nLits-1] = Abc_LitNot( pLits[nLits-1] );
     }
-    RetValue = bmcg_sat_solver_addclause( pSat, pLits, nLits );
+    RetValue = Bmc_SatAddClause( pSat, pLits, nLits );
     assert( RetValue );
     ABC_FREE( pLits );
 }
@@ -302,14 +340,14 @@ void Cec3_CollectSuper( Gia_Obj_t * pObj, int fUseMuxes, Vec_Ptr_t * vSuper )
     Vec_PtrClear( vSuper );
     Cec3_CollectSuper_rec( pObj, vSuper, 1, fUseMuxes );
 }
-void Cec3_ObjAddToFrontier( Gia_Man_t * p, Gia_Obj_t * pObj, Vec_Ptr_t * vFrontier, bmcg_sat_solver * pSat )
+void Cec3_ObjAddToFrontier( Gia_Man_t * p, Gia_Obj_t * pObj, Vec_Ptr_t * vFrontier, Bmc_Sat_t * pSat )
 {
     assert( !Gia_IsComplement(pObj) );
     assert( !Gia_ObjIsConst0(pObj) );
     if ( Cec3_ObjSatId(p, pObj) >= 0 )
         return;
     assert( Cec3_ObjSatId(p, pObj) == -1 );
-    Cec3_ObjSetSatId( p, pObj, bmcg_sat_solver_addvar(pSat) );
+    Cec3_ObjSetSatId( p, pObj, Bmc_SatAddVar(pSat) );
     if ( Gia_ObjIsAnd(pObj) )
         Vec_PtrPush( vFrontier, pObj );
 }
@@ -323,7 +361,7 @@ int Cec3_ObjGetCnfVar( Cec3_Man_t * p, int iObj )
         return Cec3_ObjSatId(p->pNew,pObj);
     assert( iObj > 0 );
     if ( Gia_ObjIsCi(pObj) )
-        return Cec3_ObjSetSatId( p->pNew, pObj, bmcg_sat_solver_addvar(p->pSat) );
+        return Cec3_ObjSetSatId( p->pNew, pObj, Bmc_SatAddVar(p->pSat) );
     assert( Gia_ObjIsAnd(pObj) );
     // start the frontier
     Vec_PtrClear( p->vFrontier );
@@ -356,6 +394,67 @@ int Cec3_ObjGetCnfVar( Cec3_Man_t * p, int iObj )
     return Cec3_ObjSatId(p->pNew,pObj);
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Lazy CNF loading.]
+
+  Description [The nodes get SAT variables without clauses. When the 
+  solver assigns a value to the node for the first time, the callback
+  adds the clauses implying the values of the fanins (two binary clauses
+  if the node is 1, one ternary clause if the node is 0), which creates 
+  variables for the fanins. The CIs and the nodes not reached in this 
+  way do not influence the values of the nodes in the satisfying 
+  assignment and are treated as don't-cares.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Cec3_ObjGetLazyVar( Cec3_Man_t * p, int iObj )
+{ 
+    Gia_Obj_t * pObj = Gia_ManObj( p->pNew, iObj );
+    if ( Cec3_ObjSatId(p->pNew, pObj) >= 0 )
+        return Cec3_ObjSatId(p->pNew, pObj);
+    Cec3_ObjSetSatId( p->pNew, pObj, Bmc_SatAddVar(p->pSat) );
+    Vec_IntSetEntryFull( p->vSatObjs, Cec3_ObjSatId(p->pNew, pObj), iObj );
+    Vec_IntPush( p->vNodesNew, iObj );
+    return Cec3_ObjSatId(p->pNew, pObj);
+}
+int Cec3_ManLoadCnf( void * pMan, int iLit )
+{
+    Cec3_Man_t * p = (Cec3_Man_t *)pMan;
+    int iObj = Vec_IntGetEntry( p->vSatObjs, Abc_Lit2Var(iLit) );
+    Gia_Obj_t * pObj = Gia_ManObj( p->pNew, iObj );
+    int Lits[3], Lit0, Lit1;
+    if ( !Gia_ObjIsAnd(pObj) )
+        return 0;
+    Lit0 = Abc_Var2Lit( Cec3_ObjGetLazyVar(p, Gia_ObjFaninId0(pObj, iObj)), Gia_ObjFaninC0(pObj) );
+    Lit1 = Abc_Var2Lit( Cec3_ObjGetLazyVar(p, Gia_ObjFaninId1(pObj, iObj)), Gia_ObjFaninC1(pObj) );
+    Lits[0] = Abc_LitNot( iLit );
+    if ( !Abc_LitIsCompl(iLit) ) // the node is 1
+    {
+        Lits[1] = Lit0;
+        Bmc_SatAddClauseLoad( p->pSat, Lits, 2 );
+        Lits[1] = Lit1;
+        Bmc_SatAddClauseLoad( p->pSat, Lits, 2 );
+    }
+    else // the node is 0
+    {
+        Lits[1] = Abc_LitNot( Lit0 );
+        Lits[2] = Abc_LitNot( Lit1 );
+        Bmc_SatAddClauseLoad( p->pSat, Lits, 3 );
+    }
+    return 1;
+}
+void Cec3_ManSetLoader( Cec3_Man_t * p )
+{
+    if ( !p->pPars->fLazyCnf )
+        return;
+    p->vSatObjs = Vec_IntAlloc( 1000 );
+    Bmc_SatSetLoader( p->pSat, p, Cec3_ManLoadCnf );
+}
+
 
 
 /**Function*************************************************************
@@ -497,6 +596,9 @@ int Cec3_ManSimulate( Gia_Man_t * p, Vec_Int_t * vTriples, Cec3_Man_t * pMan )
     Gia_Obj_t * pObj; 
     int i, iRepr, iObj, Entry, Count = 0;
     //Cec3_ManSaveCis( p );
+    if ( pMan->pSimPar )
+        Gia_SimParSimulate( pMan->pSimPar, Vec_WrdArray(p->vSims), p->nSimWords );
+    else
     Gia_ManForEachAnd( p, pObj, i )
         Cec3_ObjSimAnd( p, i );
     pMan->timeSim += Abc_Clock() - clk;
@@ -647,6 +749,66 @@ void Cec3_ManCreateClasses( Gia_Man_t * p, Cec3_Man_t * pMan )
 }
 
 
+/**Function*************************************************************
+
+  Synopsis    [Creates the context of an additional sweeping thread.]
+
+  Description [The thread has its own SAT solver. Its AIG manager is 
+  a shallow copy of the internal AIG, which shares the objects but keeps 
+  private SAT variables and traversal IDs. The copy is refreshed by
+  Cec3_ManRefreshWorker() each time the internal AIG is extended.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Cec3_Man_t * Cec3_ManCreateWorker( Cec3_Man_t * pMain )
+{
+    Cec3_Man_t * p;
+    p = ABC_CALLOC( Cec3_Man_t, 1 );
+    p->pPars        = pMain->pPars;
+    p->pAig         = pMain->pAig;
+    p->pNew         = ABC_CALLOC( Gia_Man_t, 1 );
+    p->pSat         = Bmc_SatStart( pMain->pPars->nSolverType );
+    p->vFrontier    = Vec_PtrAlloc( 1000 );
+    p->vFanins      = Vec_PtrAlloc( 100 );
+    p->vNodesNew    = Vec_IntAlloc( 100 );
+    p->vSatVars     = Vec_IntAlloc( 100 );
+    p->vObjSatPairs = Vec_IntAlloc( 100 );
+    p->vCexes       = Vec_IntAlloc( 100 );
+    Cec3_ManSetLoader( p );
+    return p;
+}
+void Cec3_ManRefreshWorker( Cec3_Man_t * p, Gia_Man_t * pNew )
+{
+    Vec_Int_t vCopies2  = p->pNew->vCopies2;
+    int * pTravIds      = p->pNew->pTravIds;
+    int nTravIds        = p->pNew->nTravIds;
+    int nTravIdsAlloc   = p->pNew->nTravIdsAlloc;
+    *p->pNew = *pNew;
+    p->pNew->vCopies2      = vCopies2;
+    p->pNew->pTravIds      = pTravIds;
+    p->pNew->nTravIds      = nTravIds;
+    p->pNew->nTravIdsAlloc = nTravIdsAlloc;
+    Vec_IntFillExtra( &p->pNew->vCopies2, Gia_ManObjNum(pNew), -1 );
+}
+void Cec3_ManStopWorker( Cec3_Man_t * p )
+{
+    Bmc_SatStop( p->pSat );
+    Vec_IntErase( &p->pNew->vCopies2 );
+    ABC_FREE( p->pNew->pTravIds );
+    ABC_FREE( p->pNew );
+    Vec_PtrFreeP( &p->vFrontier );
+    Vec_PtrFreeP( &p->vFanins );
+    Vec_IntFreeP( &p->vNodesNew );
+    Vec_IntFreeP( &p->vSatVars );
+    Vec_IntFreeP( &p->vObjSatPairs );
+    Vec_IntFreeP( &p->vCexes );
+    Vec_IntFreeP( &p->vSatObjs );
+    ABC_FREE( p );
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -679,13 +841,30 @@ Cec3_Man_t * Cec3_ManCreate( Gia_Man_t * pAig, Cec3_Par_t * pPars )
     Vec_IntFill( &p->pNew->vCopies2, Gia_ManObjNum(p->pNew), -1 );
     // SAT solving
     //memset( &Pars, 0, sizeof(satoko_opts_t) );
-    p->pSat         = bmcg_sat_solver_start();
+    p->pSat         = Bmc_SatStart( pPars->nSolverType );
     p->vFrontier    = Vec_PtrAlloc( 1000 );
     p->vFanins      = Vec_PtrAlloc( 100 );
     p->vNodesNew    = Vec_IntAlloc( 100 );
     p->vSatVars     = Vec_IntAlloc( 100 );
     p->vObjSatPairs = Vec_IntAlloc( 100 );
     p->vCexTriples  = Vec_IntAlloc( 100 );
+    if ( pPars->fLazyCnf && (pPars->fUseCones || !Bmc_SatSetLoader(p->pSat, NULL, NULL)) )
+    {
+        Abc_Print( 0, "Lazy CNF loading is not supported by SAT solver \"%s\"%s.\n", Bmc_SatName(p->pSat), pPars->fUseCones ? " with logic cones" : "" );
+        pPars->fLazyCnf = 0;
+    }
+    Cec3_ManSetLoader( p );
+    if ( pPars->nProcs > 1 )
+        p->pSimPar  = Gia_SimParStart( pAig, pPars->nProcs );
+    if ( pPars->nProcs > 1 && !pPars->fUseCones )
+    {
+        p->vWorkers = Vec_PtrAlloc( pPars->nProcs - 1 );
+        for ( i = 1; i < Abc_MinInt(pPars->nProcs, CEC3_PAR_THR_MAX); i++ )
+            Vec_PtrPush( p->vWorkers, Cec3_ManCreateWorker(p) );
+        p->vCands   = Vec_IntAlloc( 100 );
+        p->vResults = Vec_IntAlloc( 100 );
+        p->vCexes   = Vec_IntAlloc( 100 );
+    }
     //Pars.conf_limit = pPars->nConfLimit;
     //satoko_configure(p->pSat, &Pars);
     // remember pointer to the solver in the AIG manager
@@ -697,6 +876,13 @@ void Cec3_ManDestroy( Cec3_Man_t * p )
     if ( p->pPars->fVerbose ) 
     {
         abctime timeTotal = Abc_Clock() - p->timeStart;
+        word nSatClauses = p->nSatClauses;
+        if ( p->vWorkers )
+        {
+            Cec3_Man_t * pWorker; int i;
+            Vec_PtrForEachEntry( Cec3_Man_t *, p->vWorkers, pWorker, i )
+                nSatClauses += pWorker->nSatClauses;
+        }
         abctime timeSat   = p->timeSatSat + p->timeSatUnsat + p->timeSatUndec;
         abctime timeOther = timeTotal - timeSat - p->timeSim - p->timeRefine - p->timeExtra;
 //        Abc_Print( 1, "%d\n", p->Num );
@@ -709,13 +895,15 @@ void Cec3_ManDestroy( Cec3_Man_t * p )
         ABC_PRTP( "Rollback   ", p->timeExtra,     timeTotal );
         ABC_PRTP( "Other      ", timeOther,        timeTotal );
         ABC_PRTP( "TOTAL      ", timeTotal,        timeTotal );
+        Abc_Print( 1, "SAT calls = %d. Clauses loaded = %.0f (%.1f per call).\n", p->nSatSat + p->nSatUnsat + p->nSatUndec, 
+            (double)nSatClauses, (double)nSatClauses / Abc_MaxInt(1, p->nSatSat + p->nSatUnsat + p->nSatUndec) );
         fflush( stdout );
     }
 
     Vec_WrdFreeP( &p->pAig->vSims );
     //Vec_WrdFreeP( &p->pAig->vSimsPi );
     Gia_ManCleanMark01( p->pAig );
-    bmcg_sat_solver_stop( p->pSat );
+    Bmc_SatStop( p->pSat );
     Gia_ManStopP( &p->pNew );
     Vec_PtrFreeP( &p->vFrontier );
     Vec_PtrFreeP( &p->vFanins );
@@ -723,6 +911,19 @@ void Cec3_ManDestroy( Cec3_Man_t * p )
     Vec_IntFreeP( &p->vSatVars );
     Vec_IntFreeP( &p->vObjSatPairs );
     Vec_IntFreeP( &p->vCexTriples );
+    Vec_IntFreeP( &p->vSatObjs );
+    if ( p->pSimPar )
+        Gia_SimParStop( p->pSimPar );
+    if ( p->vWorkers )
+    {
+        Cec3_Man_t * pWorker; int i;
+        Vec_PtrForEachEntry( Cec3_Man_t *, p->vWorkers, pWorker, i )
+            Cec3_ManStopWorker( pWorker );
+        Vec_PtrFree( p->vWorkers );
+    }
+    Vec_IntFreeP( &p->vCands );
+    Vec_IntFreeP( &p->vResults );
+    Vec_IntFreeP( &p->vCexes );
     ABC_FREE( p );
 }
 
@@ -738,7 +939,7 @@ void Cec3_ManDestroy( Cec3_Man_t * p )
   SeeAlso     []
 
 ***********************************************************************/
-int Cec3_ManVerify_rec( Gia_Man_t * p, int iObj, bmcg_sat_solver * pSat )
+int Cec3_ManVerify_rec( Gia_Man_t * p, int iObj, Bmc_Sat_t * pSat )
 {
     int Value0, Value1;
     Gia_Obj_t * pObj = Gia_ManObj( p, iObj );
@@ -748,13 +949,13 @@ int Cec3_ManVerify_rec( Gia_Man_t * p, int iObj, bmcg_sat_solver * pSat )
     Gia_ObjSetTravIdCurrentId(p, iObj);
     if ( Gia_ObjIsCi(pObj) )
 //        return pObj->fMark1 = satoko_var_polarity(pSat, Cec3_ObjSatId(p, pObj)) == SATOKO_LIT_TRUE;
-        return pObj->fMark1 = bmcg_sat_solver_read_cex_varvalue(pSat, Cec3_ObjSatId(p, pObj));
+        return pObj->fMark1 = Bmc_SatVarValue(pSat, Cec3_ObjSatId(p, pObj));
     assert( Gia_ObjIsAnd(pObj) );
     Value0 = Cec3_ManVerify_rec( p, Gia_ObjFaninId0(pObj, iObj), pSat ) ^ Gia_ObjFaninC0(pObj);
     Value1 = Cec3_ManVerify_rec( p, Gia_ObjFaninId1(pObj, iObj), pSat ) ^ Gia_ObjFaninC1(pObj);
     return pObj->fMark1 = Value0 & Value1;
 }
-void Cec3_ManVerify( Gia_Man_t * p, int iObj0, int iObj1, int fPhase, bmcg_sat_solver * pSat )
+void Cec3_ManVerify( Gia_Man_t * p, int iObj0, int iObj1, int fPhase, Bmc_Sat_t * pSat )
 {
 //    int val0 = satoko_var_polarity(pSat, Cec3_ObjSatId(p, Gia_ManObj(p, iObj0))) == SATOKO_LIT_TRUE;
 //    int val1 = satoko_var_polarity(pSat, Cec3_ObjSatId(p, Gia_ManObj(p, iObj1))) == SATOKO_LIT_TRUE;
@@ -811,18 +1012,28 @@ int Cec3_ManSolveTwo( Cec3_Man_t * p, int iObj0, int iObj1, int fPhase )
     if (iObj1 < iObj0) 
         iObj1 ^= iObj0, iObj0 ^= iObj1, iObj1 ^= iObj0;
     assert( iObj0 < iObj1 );
-    assert( p->pPars->fUseCones || bmcg_sat_solver_varnum(p->pSat) == 0 );
-    if ( !iObj0 && Cec3_ObjSatId(p->pNew, Gia_ManConst0(p->pNew)) == -1 )
-        Cec3_ObjSetSatId( p->pNew, Gia_ManConst0(p->pNew), bmcg_sat_solver_addvar(p->pSat) );
-    iVar0 = Cec3_ObjGetCnfVar( p, iObj0 );
-    iVar1 = Cec3_ObjGetCnfVar( p, iObj1 );
-    // collect inputs and internal nodes
-    Vec_IntClear( p->vNodesNew );
-    Vec_IntClear( p->vSatVars );
+    assert( p->pPars->fUseCones || Bmc_SatVarNum(p->pSat) == 0 );
     Vec_IntClear( p->vObjSatPairs );
-    Gia_ManIncrementTravId( p->pNew );
-    Cec3_ManCollect_rec( p, iObj0 );
-    Cec3_ManCollect_rec( p, iObj1 );
+    if ( p->pPars->fLazyCnf )
+    {
+        // create variables of the two nodes (the rest is created by the callback)
+        Vec_IntClear( p->vNodesNew );
+        iVar0 = Cec3_ObjGetLazyVar( p, iObj0 );
+        iVar1 = Cec3_ObjGetLazyVar( p, iObj1 );
+    }
+    else
+    {
+        if ( !iObj0 && Cec3_ObjSatId(p->pNew, Gia_ManConst0(p->pNew)) == -1 )
+            Cec3_ObjSetSatId( p->pNew, Gia_ManConst0(p->pNew), Bmc_SatAddVar(p->pSat) );
+        iVar0 = Cec3_ObjGetCnfVar( p, iObj0 );
+        iVar1 = Cec3_ObjGetCnfVar( p, iObj1 );
+        // collect inputs and internal nodes
+        Vec_IntClear( p->vNodesNew );
+        Vec_IntClear( p->vSatVars );
+        Gia_ManIncrementTravId( p->pNew );
+        Cec3_ManCollect_rec( p, iObj0 );
+        Cec3_ManCollect_rec( p, iObj1 );
+    }
 //printf( "%d ", Vec_IntSize(p->vNodesNew) );
     // solve direct
     if ( p->pPars->fUseCones )  satoko_mark_cone( p->pSat, Vec_IntArray(p->vSatVars), Vec_IntSize(p->vSatVars) );
@@ -833,8 +1044,7 @@ int Cec3_ManSolveTwo( Cec3_Man_t * p, int iObj0, int iObj1, int fPhase )
 //    satoko_assump_pop( p->pSat );
     Lits[0] = Abc_Var2Lit(iVar0, 1);
     Lits[1] = Abc_Var2Lit(iVar1, fPhase);
-    bmcg_sat_solver_set_conflict_budget( p->pSat, p->pPars->nConfLimit );
-    status = bmcg_sat_solver_solve( p->pSat, Lits, 2 );
+    status = Bmc_SatSolve( p->pSat, Lits, 2, p->pPars->nConfLimit );
     if ( status == GLUCOSE_UNSAT && iObj0 > 0 )
     {
         // solve reverse
@@ -845,14 +1055,18 @@ int Cec3_ManSolveTwo( Cec3_Man_t * p, int iObj0, int iObj1, int fPhase )
 //        satoko_assump_pop( p->pSat );
         Lits[0] = Abc_Var2Lit(iVar0, 0);
         Lits[1] = Abc_Var2Lit(iVar1, !fPhase);
-        bmcg_sat_solver_set_conflict_budget( p->pSat, p->pPars->nConfLimit );
-        status = bmcg_sat_solver_solve( p->pSat, Lits, 2 );
+        status = Bmc_SatSolve( p->pSat, Lits, 2, p->pPars->nConfLimit );
     }
     if ( p->pPars->fUseCones )  satoko_unmark_cone( p->pSat, Vec_IntArray(p->vSatVars), Vec_IntSize(p->vSatVars) );
     //if ( status == SATOKO_SAT )
     //    Cec3_ManVerify( p->pNew, iObj0, iObj1, fPhase, p->pSat );
     if ( p->pPars->fUseCones )
         return status;
+    // collect the inputs reached by the lazy CNF
+    if ( p->pPars->fLazyCnf && status == GLUCOSE_SAT )
+        Gia_ManForEachObjVec( p->vNodesNew, p->pNew, pObj, i )
+            if ( Gia_ObjIsCi(pObj) )
+                Vec_IntPushTwo( p->vObjSatPairs, Gia_ManCiIdToId(p->pAig, Gia_ObjCioId(pObj)), Cec3_ObjSatId(p->pNew, pObj) );
     Gia_ManForEachObjVec( p->vNodesNew, p->pNew, pObj, i )
         Cec3_ObjCleanSatId( p->pNew, pObj );
     return status;
@@ -874,7 +1088,7 @@ int Cec3_ManSweepNode( Cec3_Man_t * p, int iObj )
         assert( p->pAig->iPatsPi > 0 && p->pAig->iPatsPi < 64 * p->pAig->nSimWords );
         Vec_IntForEachEntryDouble( p->vObjSatPairs, IdAig, IdSat, i )
 //            Cec3_ObjSimSetInputBit( p->pAig, IdAig, satoko_var_polarity(p->pSat, IdSat) == SATOKO_LIT_TRUE );
-            Cec3_ObjSimSetInputBit( p->pAig, IdAig, bmcg_sat_solver_read_cex_varvalue(p->pSat, IdSat) );
+            Cec3_ObjSimSetInputBit( p->pAig, IdAig, Bmc_SatVarValue(p->pSat, IdSat) );
         p->timeSatSat += Abc_Clock() - clk;
         RetValue = 0;
     }
@@ -897,11 +1111,221 @@ int Cec3_ManSweepNode( Cec3_Man_t * p, int iObj )
     if ( p->pPars->fUseCones )
         return RetValue;
     clk = Abc_Clock();
-    bmcg_sat_solver_reset( p->pSat );
+    p->nSatClauses += Bmc_SatClauseNum( p->pSat );
+    Bmc_SatReset( p->pSat );
     p->timeExtra += Abc_Clock() - clk;
 //    satoko_stats(p->pSat)->n_conflicts = 0;
     return RetValue;
 }
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the candidate equivalences using several threads.]
+
+  Description [The threads take the candidates one at a time from the 
+  shared list, so that a thread finishing an easy problem takes the next 
+  one without waiting for others. Each thread records the status and the
+  values of the CIs in the counter-example, which are later applied in 
+  the order of the candidates by Cec3_ManSweepPar().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Cec3_ThData_t_
+{
+    Cec3_Man_t *    pMain;
+    Cec3_Man_t *    pMan;
+    int             iThread;
+} Cec3_ThData_t;
+static void * Cec3_ManSolveParThread( void * pArg )
+{
+    Cec3_ThData_t * pData = (Cec3_ThData_t *)pArg;
+    Cec3_Man_t * pMain = pData->pMain, * p = pData->pMan;
+    int nCands = Vec_IntSize(pMain->vCands) / 3;
+    int i, k, IdAig, IdSat, status;
+    Vec_IntClear( p->vCexes );
+    while ( (k = CEC3_ADD32(&pMain->iNextCand, 1)) < nCands )
+    {
+        abctime clk = Abc_Clock();
+        int iObj    = Vec_IntEntry( pMain->vCands, 3*k );
+        int iLit    = Vec_IntEntry( pMain->vCands, 3*k+1 );
+        int fCompl  = Vec_IntEntry( pMain->vCands, 3*k+2 );
+        int * pRes  = Vec_IntEntryP( pMain->vResults, 3*k );
+        Gia_Obj_t * pRepr = Gia_ObjReprObj( p->pAig, iObj );
+        status = Cec3_ManSolveTwo( p, Abc_Lit2Var(pRepr->Value), Abc_Lit2Var(iLit), fCompl );
+        pRes[0] = status;
+        pRes[1] = pData->iThread;
+        pRes[2] = Vec_IntSize(p->vCexes);
+        if ( status == GLUCOSE_SAT )
+        {
+            Vec_IntPush( p->vCexes, Vec_IntSize(p->vObjSatPairs) / 2 );
+            Vec_IntForEachEntryDouble( p->vObjSatPairs, IdAig, IdSat, i )
+                Vec_IntPushTwo( p->vCexes, IdAig, Bmc_SatVarValue(p->pSat, IdSat) );
+            p->timeSatSat += Abc_Clock() - clk;
+        }
+        else if ( status == GLUCOSE_UNSAT )
+            p->timeSatUnsat += Abc_Clock() - clk;
+        else
+            p->timeSatUndec += Abc_Clock() - clk;
+        clk = Abc_Clock();
+        p->nSatClauses += Bmc_SatClauseNum( p->pSat );
+        Bmc_SatReset( p->pSat );
+        p->timeExtra += Abc_Clock() - clk;
+    }
+    return NULL;
+}
+void Cec3_ManSolvePar( Cec3_Man_t * pMan )
+{
+    Cec3_ThData_t ThData[CEC3_PAR_THR_MAX];
+    Cec3_Man_t * pWorker;
+    int i, nCands = Vec_IntSize(pMan->vCands) / 3;
+    int nThreads = Abc_MinInt( 1 + Vec_PtrSize(pMan->vWorkers), nCands );
+    Vec_IntFill( pMan->vResults, 3 * nCands, 0 );
+    pMan->iNextCand = 0;
+    for ( i = 0; i < nThreads; i++ )
+    {
+        ThData[i].pMain   = pMan;
+        ThData[i].pMan    = i ? (Cec3_Man_t *)Vec_PtrEntry(pMan->vWorkers, i-1) : pMan;
+        ThData[i].iThread = i;
+        if ( i )
+            Cec3_ManRefreshWorker( ThData[i].pMan, pMan->pNew );
+    }
+#ifdef ABC_USE_PTHREADS
+    if ( nThreads > 1 )
+    {
+        pthread_t WorkerThread[CEC3_PAR_THR_MAX];
+        int status;
+        for ( i = 1; i < nThreads; i++ )
+        {
+            status = pthread_create( WorkerThread + i, NULL, Cec3_ManSolveParThread, (void *)(ThData + i) );
+            assert( status == 0 );
+        }
+        Cec3_ManSolveParThread( (void *)ThData );
+        for ( i = 1; i < nThreads; i++ )
+            pthread_join( WorkerThread[i], NULL );
+    }
+    else
+#endif
+    for ( i = 0; i < nThreads; i++ )
+        Cec3_ManSolveParThread( (void *)(ThData + i) );
+    // collect the runtime of the threads
+    for ( i = 1; i < nThreads; i++ )
+    {
+        pWorker = ThData[i].pMan;
+        pMan->timeSatSat   += pWorker->timeSatSat;    pWorker->timeSatSat   = 0;
+        pMan->timeSatUnsat += pWorker->timeSatUnsat;  pWorker->timeSatUnsat = 0;
+        pMan->timeSatUndec += pWorker->timeSatUndec;  pWorker->timeSatUndec = 0;
+        pMan->timeExtra    += pWorker->timeExtra;     pWorker->timeExtra    = 0;
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs one iteration of sweeping using several threads.]
+
+  Description [Proceeds in waves. Each wave duplicates the nodes whose 
+  fanins are already swept and collects the nodes that should be compared 
+  with their representatives. These candidates are solved concurrently 
+  and their fanouts are considered in the next wave. A node whose 
+  representative is still being solved waits for the next wave too.
+  The nodes disproved in this iteration are marked with fMark0 and the
+  candidates being solved are marked with fMark1.
+  Returns 1 if at least one candidate was disproved.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec3_ManSweepPar( Cec3_Man_t * pMan )
+{
+    Gia_Man_t * p = pMan->pAig;
+    Gia_Obj_t * pObj, * pRepr, * pObjNew;
+    int i, k, w, iLit, * pRes, * pCex, iFirst = 0, fDisproved = 0;
+    Gia_ManCleanMark01( p );
+    while ( 1 )
+    {
+        // collect the candidates
+        Vec_IntClear( pMan->vCands );
+        for ( i = iFirst; i < Gia_ManObjNum(p); i++ )
+        {
+            pObj = Gia_ManObj( p, i );
+            if ( !Gia_ObjIsAnd(pObj) )
+                continue;
+            if ( ~pObj->Value || pObj->fMark0 || Gia_ObjFailed(p, i) ) // skip swept, disproved and failed nodes
+                continue;
+            if ( !~Gia_ObjFanin0(pObj)->Value || !~Gia_ObjFanin1(pObj)->Value ) // skip fanouts of non-swept nodes
+                continue;
+            pRepr = Gia_ObjReprObj( p, i );
+            if ( pRepr && pRepr->fMark1 ) // skip nodes whose representative is being solved
+                continue;
+            // duplicate the node
+            pObj->Value = Gia_ManHashAnd( pMan->pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+            if ( Vec_IntSize(&pMan->pNew->vCopies2) == Abc_Lit2Var(pObj->Value) )
+            {
+                pObjNew = Gia_ManObj( pMan->pNew, Abc_Lit2Var(pObj->Value) );
+                pObjNew->fMark0 = Gia_ObjIsMuxType( pObjNew );
+                Gia_ObjSetPhase( pMan->pNew, pObjNew );
+                Vec_IntPush( &pMan->pNew->vCopies2, -1 );
+            }
+            assert( Vec_IntSize(&pMan->pNew->vCopies2) == Gia_ManObjNum(pMan->pNew) );
+            if ( pRepr == NULL || !~pRepr->Value )
+                continue;
+            if ( Abc_Lit2Var(pObj->Value) == Abc_Lit2Var(pRepr->Value) )
+            {
+                assert( (pObj->Value ^ pRepr->Value) == (pObj->fPhase ^ pRepr->fPhase) );
+                Gia_ObjSetProved( p, i );
+                continue;
+            }
+            Vec_IntPushThree( pMan->vCands, i, pObj->Value, Abc_LitIsCompl(pObj->Value) ^ Abc_LitIsCompl(pRepr->Value) ^ pObj->fPhase ^ pRepr->fPhase );
+            pObj->Value = ~0;
+            pObj->fMark1 = 1;
+        }
+        if ( Vec_IntSize(pMan->vCands) == 0 )
+            break;
+        iFirst = Vec_IntEntry( pMan->vCands, 0 );
+        Cec3_ManSolvePar( pMan );
+        // apply the results in the order of the candidates
+        for ( k = 0; k < Vec_IntSize(pMan->vCands) / 3; k++ )
+        {
+            i     = Vec_IntEntry( pMan->vCands, 3*k );
+            iLit  = Vec_IntEntry( pMan->vCands, 3*k+1 );
+            pRes  = Vec_IntEntryP( pMan->vResults, 3*k );
+            pObj  = Gia_ManObj( p, i );
+            pRepr = Gia_ObjReprObj( p, i );
+            pObj->fMark1 = 0;
+            if ( pRes[0] == GLUCOSE_SAT )
+            {
+                pMan->nSatSat++;
+                pMan->nPatterns++;
+                p->iPatsPi = (p->iPatsPi == 64 * p->nSimWords - 1) ? 1 : p->iPatsPi + 1;
+                pCex = Vec_IntEntryP( pRes[1] ? ((Cec3_Man_t *)Vec_PtrEntry(pMan->vWorkers, pRes[1]-1))->vCexes : pMan->vCexes, pRes[2] );
+                for ( w = 0; w < pCex[0]; w++ )
+                    Cec3_ObjSimSetInputBit( p, pCex[1+2*w], pCex[2+2*w] );
+                pObj->fMark0 = 1;
+                Vec_IntPushThree( pMan->vCexTriples, Gia_ObjId(p, pRepr), i, Abc_Var2Lit(p->iPatsPi, pObj->fPhase ^ pRepr->fPhase) );
+                fDisproved = 1;
+            }
+            else if ( pRes[0] == GLUCOSE_UNSAT )
+            {
+                pMan->nSatUnsat++;
+                Gia_ObjSetProved( p, i );
+                pObj->Value = Abc_LitNotCond( pRepr->Value, pObj->fPhase ^ pRepr->fPhase );
+            }
+            else
+            {
+                pMan->nSatUndec++;
+                assert( pRes[0] == GLUCOSE_UNDEC );
+                Gia_ObjSetFailed( p, i );
+                pObj->Value = iLit;
+            }
+        }
+    }
+    Gia_ManCleanMark01( p );
+    return fDisproved;
+}
 void Cec3_ManPrintStats( Gia_Man_t * p, Cec3_Par_t * pPars, Cec3_Man_t * pMan )
 {
     if ( !pPars->fVerbose )
@@ -956,6 +1380,9 @@ int Cec3_ManPerformSweeping( Gia_Man_t * p, Cec3_Par_t * pPars, Gia_Man_t ** ppN
         pMan->nPatterns = 0;
         Cec3_ManSimulateCis( p );
         Vec_IntClear( pMan->vCexTriples );
+        if ( pMan->vWorkers )
+            fDisproved = Cec3_ManSweepPar( pMan );
+        else
         Gia_ManForEachAnd( p, pObj, i )
         {
             if ( ~pObj->Value || Gia_ObjFailed(p, i) ) // skip swept nodes and failed nodes
@@ -1030,7 +1457,10 @@ Gia_Man_t * Cec3_ManSimulateTest( Gia_Man_t * p, Cec_ParFra_t * pPars0 )
 //    pPars->nSimRounds = pPars0->nRounds;    // simulation rounds
 //    pPars->nItersMax  = pPars0->nItersMax;  // max number of iterations
     pPars->nConfLimit = pPars0->nBTLimit;   // conflict limit at a node
+    pPars->nProcs     = pPars0->nProcs;
+    pPars->nSolverType = pPars0->nSolverType;
     pPars->fUseCones  = pPars0->fUseCones;
+    pPars->fLazyCnf   = pPars0->fLazyCnf;
     pPars->fVerbose   = pPars0->fVerbose;
 //    Gia_ManComputeGiaEquivs( p, 100000, 0 );
 //    Gia_ManEquivPrintClasses( p, 1, 0 );
@@ -292,6 +292,69 @@ void Cec_ObjAddToFrontier( Cec_ManSat_t * p, Gia_Obj_t * pObj, Vec_Ptr_t * vFron
         Vec_PtrPush( vFrontier, pObj );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Loads the clauses of the node lazily.]
+
+  Description [In the lazy mode, only the SAT variable of the node is
+  created. The solver calls Cec_ManSatLoadCnf() when a variable is 
+  assigned for the first time in each polarity. The callback adds the 
+  clauses of the AND-gate that propagate this value (two binary clauses
+  for value 1 and one ternary clause for value 0) and creates the fanin
+  variables. As a result, only the part of the cone needed to justify
+  the assignment is ever loaded into the solver.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Cec_ObjAddLazyVar( Cec_ManSat_t * p, Gia_Obj_t * pObj )
+{
+    if ( Cec_ObjSatNum(p,pObj) )
+        return Cec_ObjSatNum(p,pObj);
+    Vec_PtrPush( p->vUsedNodes, pObj );
+    Vec_IntSetEntry( p->vSatObjs, p->nSatVars, Gia_ObjId(p->pAig, pObj) );
+    Cec_ObjSetSatNum( p, pObj, p->nSatVars++ );
+    sat_solver_setnvars( p->pSat, p->nSatVars );
+    return Cec_ObjSatNum(p,pObj);
+}
+static inline int Cec_ObjLazyLit( Cec_ManSat_t * p, Gia_Obj_t * pObj, int fCompl )
+{
+    int Lit = toLitCond( Cec_ObjAddLazyVar(p, pObj), fCompl );
+    if ( p->pPars->fPolarFlip && pObj->fPhase )
+        Lit = lit_neg( Lit );
+    return Lit;
+}
+int Cec_ManSatLoadCnf( void * pMan, int iLit )
+{
+    Cec_ManSat_t * p = (Cec_ManSat_t *)pMan;
+    Gia_Obj_t * pObj = Gia_ManObj( p->pAig, Vec_IntGetEntry(p->vSatObjs, lit_var(iLit)) );
+    int Lits[3], Lit0, Lit1, fValue;
+    if ( !Gia_ObjIsAnd(pObj) )
+        return 0;
+    fValue = !lit_sign(iLit);
+    if ( p->pPars->fPolarFlip && pObj->fPhase )
+        fValue ^= 1;
+    Lit0 = Cec_ObjLazyLit( p, Gia_ObjFanin0(pObj), Gia_ObjFaninC0(pObj) );
+    Lit1 = Cec_ObjLazyLit( p, Gia_ObjFanin1(pObj), Gia_ObjFaninC1(pObj) );
+    Lits[0] = lit_neg( iLit );
+    if ( fValue ) // the node is 1
+    {
+        Lits[1] = Lit0;
+        sat_solver_clause_new( p->pSat, Lits, Lits + 2, 0 );
+        Lits[1] = Lit1;
+        sat_solver_clause_new( p->pSat, Lits, Lits + 2, 0 );
+    }
+    else // the node is 0
+    {
+        Lits[1] = lit_neg( Lit0 );
+        Lits[2] = lit_neg( Lit1 );
+        sat_solver_clause_new( p->pSat, Lits, Lits + 3, 0 );
+    }
+    return 1;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Updates the solver clause database.]
@@ -311,6 +374,12 @@ void Cec_CnfNodeAddToSolver( Cec_ManSat_t * p, Gia_Obj_t * pObj )
     // quit if CNF is ready
     if ( Cec_ObjSatNum(p,pObj) )
         return;
+    // the clauses are loaded by the solver when the variable is assigned
+    if ( p->pPars->fLazyCnf )
+    {
+        Cec_ObjAddLazyVar( p, pObj );
+        return;
+    }
     if ( Gia_ObjIsCi(pObj) )
     {
         Vec_PtrPush( p->vUsedNodes, pObj );
@@ -373,10 +442,13 @@ void Cec_ManSatSolverRecycle( Cec_ManSat_t * p )
             Cec_ObjSetSatNum( p, pObj, 0 );
         Vec_PtrClear( p->vUsedNodes );
 //        memset( p->pSatVars, 0, sizeof(int) * Gia_ManObjNumMax(p->pAigTotal) );
+        p->nSatClauses += sat_solver_nclauses( p->pSat );
         sat_solver_delete( p->pSat );
     }
     p->pSat = sat_solver_new();
-    sat_solver_setnvars( p->pSat, 1000 );
+    // in the lazy mode, the variables are added one by one because 
+    // an unused variable can be assigned and marked as loaded
+    sat_solver_setnvars( p->pSat, p->pPars->fLazyCnf ? 2 : 1000 );
     p->pSat->factors = ABC_CALLOC( double, p->pSat->cap );
     // var 0 is not used
     // var 1 is reserved for const0 node - add the clause
@@ -387,6 +459,11 @@ void Cec_ManSatSolverRecycle( Cec_ManSat_t * p )
 //        Lit = lit_neg( Lit );
     sat_solver_addclause( p->pSat, &Lit, &Lit + 1 );
     Cec_ObjSetSatNum( p, Gia_ManConst0(p->pAig), p->nSatVars++ );
+    if ( p->pPars->fLazyCnf )
+    {
+        Vec_IntClear( p->vSatObjs );
+        sat_solver_set_loader( p->pSat, p, Cec_ManSatLoadCnf );
+    }
 
     p->nRecycles++;
     p->nCallsSince = 0;
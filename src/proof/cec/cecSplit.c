@@ -33,6 +33,10 @@
 #else
 #include <pthread.h>
 #include <unistd.h>
+#include <signal.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+#include <sys/select.h>
 #endif
 
 #endif
@@ -46,7 +50,7 @@ ABC_NAMESPACE_IMPL_START
 
 #ifndef ABC_USE_PTHREADS
 
-int Cec_GiaSplitTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int LookAhead, int fVerbose, int fVeryVerbose, int fSilent ) { return -1; }
+int Cec_GiaSplitTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nConfLimit, int nIterMax, int LookAhead, int fUseProcs, int fVerbose, int fVeryVerbose, int fSilent ) { return -1; }
 
 #else // pthreads are used
 
@@ -327,7 +331,7 @@ static inline sat_solver * Cec_GiaDeriveSolver( Gia_Man_t * p, Cnf_Dat_t * pCnf,
     sat_solver_set_runtime_limit( pSat, nTimeOut ? nTimeOut * CLOCKS_PER_SEC + Abc_Clock(): 0 );
     return pSat;
 }
-static inline int Cnf_GiaSolveOne( Gia_Man_t * p, Cnf_Dat_t * pCnf, int nTimeOut, int * pnVars, int * pnConfs )
+static inline int Cnf_GiaSolveOne( Gia_Man_t * p, Cnf_Dat_t * pCnf, int nTimeOut, int nConfLimit, int * pnVars, int * pnConfs )
 {
     int status;
     sat_solver * pSat = Cec_GiaDeriveSolver( p, pCnf, nTimeOut );
@@ -337,7 +341,7 @@ static inline int Cnf_GiaSolveOne( Gia_Man_t * p, Cnf_Dat_t * pCnf, int nTimeOut
         *pnConfs = 0;
         return 1;
     }
-    status   = sat_solver_solve( pSat, NULL, NULL, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
+    status   = sat_solver_solve( pSat, NULL, NULL, (ABC_INT64_T)nConfLimit, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
     *pnVars  = sat_solver_nvars( pSat );
     *pnConfs = sat_solver_nconflicts( pSat );
     if ( status == l_True )
@@ -403,7 +407,7 @@ void Cec_GiaSplitPrintRefs( Gia_Man_t * p )
   SeeAlso     []
 
 ***********************************************************************/
-int Cec_GiaSplitTest2( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int LookAhead, int fVerbose, int fVeryVerbose, int fSilent )
+int Cec_GiaSplitTest2( Gia_Man_t * p, int nProcs, int nTimeOut, int nConfLimit, int nIterMax, int LookAhead, int fVerbose, int fVeryVerbose, int fSilent )
 {
     abctime clkTotal = Abc_Clock();
     Vec_Ptr_t * vStack;
@@ -413,7 +417,7 @@ int Cec_GiaSplitTest2( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, in
     double Progress = 0;
     // check the problem
     pCnf = Cec_GiaDeriveGiaRemapped( p );
-    status = Cnf_GiaSolveOne( p, pCnf, nTimeOut, &nSatVars, &nSatConfs );
+    status = Cnf_GiaSolveOne( p, pCnf, nTimeOut, nConfLimit, &nSatVars, &nSatConfs );
     Cnf_DataFree( pCnf );
     if ( fVerbose )
         Cec_GiaSplitPrint( 0, 0, nSatVars, nSatConfs, status, Progress, Abc_Clock() - clkTotal );
@@ -459,7 +463,7 @@ int Cec_GiaSplitTest2( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, in
         Vec_IntPush( pPart->vCofVars, Abc_Var2Lit(iVar, 1) );
         // solve the problem
         pCnf = Cec_GiaDeriveGiaRemapped( pPart );
-        status = Cnf_GiaSolveOne( pPart, pCnf, nTimeOut, &nSatVars, &nSatConfs );
+        status = Cnf_GiaSolveOne( pPart, pCnf, nTimeOut, nConfLimit, &nSatVars, &nSatConfs );
         Cnf_DataFree( pCnf );
         if ( status == 1 )
             Progress += 1.0 / pow((double)2, (double)Depth);
@@ -486,7 +490,7 @@ int Cec_GiaSplitTest2( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, in
         Gia_ManStop( pLast );
         // solve the problem
         pCnf = Cec_GiaDeriveGiaRemapped( pPart );
-        status = Cnf_GiaSolveOne( pPart, pCnf, nTimeOut, &nSatVars, &nSatConfs );
+        status = Cnf_GiaSolveOne( pPart, pCnf, nTimeOut, nConfLimit, &nSatVars, &nSatConfs );
         Cnf_DataFree( pCnf );
         if ( status == 1 )
             Progress += 1.0 / pow((double)2, (double)Depth);
@@ -544,6 +548,7 @@ typedef struct Par_ThData_t_
     Cnf_Dat_t * pCnf;
     int         iThread;
     int         nTimeOut;
+    int         nConfLimit;
     int         fWorking;
     int         Result;
     int         nVars;
@@ -563,13 +568,13 @@ void * Cec_GiaSplitWorkerThread( void * pArg )
             assert( 0 );
             return NULL;
         }
-        pThData->Result = Cnf_GiaSolveOne( pThData->p, pThData->pCnf, pThData->nTimeOut, &pThData->nVars, &pThData->nConfs );
+        pThData->Result = Cnf_GiaSolveOne( pThData->p, pThData->pCnf, pThData->nTimeOut, pThData->nConfLimit, &pThData->nVars, &pThData->nConfs );
         pThData->fWorking = 0;
     }
     assert( 0 );
     return NULL;
 }
-int Cec_GiaSplitTestInt( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int LookAhead, int fVerbose, int fVeryVerbose, int fSilent )
+int Cec_GiaSplitTestInt( Gia_Man_t * p, int nProcs, int nTimeOut, int nConfLimit, int nIterMax, int LookAhead, int fVerbose, int fVeryVerbose, int fSilent )
 {
     abctime clkTotal = Abc_Clock();
     Par_ThData_t ThData[PAR_THR_MAX];
@@ -583,16 +588,16 @@ int Cec_GiaSplitTestInt( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax,
     if ( fVerbose )
         printf( "Solving CEC problem by cofactoring with the following parameters:\n" );
     if ( fVerbose )
-        printf( "Processes = %d   TimeOut = %d sec   MaxIter = %d   LookAhead = %d   Verbose = %d.\n", nProcs, nTimeOut, nIterMax, LookAhead, fVerbose );
+        printf( "Processes = %d   TimeOut = %d sec   ConfLimit = %d   MaxIter = %d   LookAhead = %d   Verbose = %d.\n", nProcs, nTimeOut, nConfLimit, nIterMax, LookAhead, fVerbose );
     fflush( stdout );
     if ( nProcs == 1 )
-        return Cec_GiaSplitTest2( p, nProcs, nTimeOut, nIterMax, LookAhead, fVerbose, fVeryVerbose, fSilent );
+        return Cec_GiaSplitTest2( p, nProcs, nTimeOut, nConfLimit, nIterMax, LookAhead, fVerbose, fVeryVerbose, fSilent );
     // subtract manager thread
     nProcs--;
     assert( nProcs >= 1 && nProcs <= PAR_THR_MAX );
     // check the problem
     pCnf = Cec_GiaDeriveGiaRemapped( p );
-    status = Cnf_GiaSolveOne( p, pCnf, nTimeOut, &nSatVars, &nSatConfs );
+    status = Cnf_GiaSolveOne( p, pCnf, nTimeOut, nConfLimit, &nSatVars, &nSatConfs );
     Cnf_DataFree( pCnf );
     if ( fVerbose && status != -1 )
         Cec_GiaSplitPrint( 0, 0, nSatVars, nSatConfs, status, Progress, Abc_Clock() - clkTotal );
@@ -619,6 +624,7 @@ int Cec_GiaSplitTestInt( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax,
         ThData[i].pCnf     = NULL;
         ThData[i].iThread  = i;
         ThData[i].nTimeOut = nTimeOut;
+        ThData[i].nConfLimit = nConfLimit;
         ThData[i].fWorking = 0;
         ThData[i].Result   = -1;
         ThData[i].nVars    = -1;
@@ -674,7 +680,7 @@ int Cec_GiaSplitTestInt( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax,
                     pPart = Gia_ManDupCofactorVar( pLast, iVar, 1 );
                     pPart->vCofVars = Vec_IntAlloc( Vec_IntSize(pLast->vCofVars) + 1 );
                     Vec_IntAppend( pPart->vCofVars, pLast->vCofVars );
-                    Vec_IntPush( pPart->vCofVars, Abc_Var2Lit(iVar, 1) );
+                    Vec_IntPush( pPart->vCofVars, Abc_Var2Lit(iVar, 0) );
                     Vec_PtrPush( vStack, pPart );
                     // keep working
                     fWorkToDo = 1;
@@ -737,7 +743,331 @@ finish:
     }
     return RetValue;
 }
-int Cec_GiaSplitTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int LookAhead, int fVerbose, int fVeryVerbose, int fSilent )
+
+/**Function*************************************************************
+
+  Synopsis    [Transfers integers over a pipe.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifndef _WIN32
+static int Cec_GiaSplitWrite( int fd, int * pBuffer, int nInts )
+{
+    char * pData = (char *)pBuffer;
+    int nDone, nBytes = sizeof(int) * nInts;
+    while ( nBytes > 0 )
+    {
+        nDone = write( fd, pData, nBytes );
+        if ( nDone <= 0 )
+            return 0;
+        pData  += nDone;
+        nBytes -= nDone;
+    }
+    return 1;
+}
+static int Cec_GiaSplitRead( int fd, int * pBuffer, int nInts )
+{
+    char * pData = (char *)pBuffer;
+    int nDone, nBytes = sizeof(int) * nInts;
+    while ( nBytes > 0 )
+    {
+        nDone = read( fd, pData, nBytes );
+        if ( nDone <= 0 )
+            return 0;
+        pData  += nDone;
+        nBytes -= nDone;
+    }
+    return 1;
+}
+static abctime Cec_GiaSplitClock()
+{
+    struct timeval tv;
+    gettimeofday( &tv, NULL );
+    return (abctime)tv.tv_sec * CLOCKS_PER_SEC + (abctime)tv.tv_usec * CLOCKS_PER_SEC / 1000000;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the cubes received from the manager.]
+
+  Description [Runs in a worker process. Each request contains the conflict 
+  limit and the cube, given as literals of the PIs. The reply contains the 
+  status and the number of conflicts, followed by the values of the PIs 
+  if the cube is satisfiable. The solver is incremental: the cube is given 
+  as assumptions and the learned clauses are kept for the next cubes.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cec_GiaSplitWorkerProc( Gia_Man_t * p, Cnf_Dat_t * pCnf, int fdIn, int fdOut, int nTimeOut )
+{
+    sat_solver * pSat = Cec_GiaDeriveSolver( p, pCnf, 0 );
+    Vec_Int_t * vLits  = Vec_IntAlloc( 100 );
+    Vec_Int_t * vReply = Vec_IntAlloc( 100 );
+    Gia_Obj_t * pObj;
+    int i, iLit, status, nConfs, Request[2];
+    while ( Cec_GiaSplitRead(fdIn, Request, 2) && Request[1] >= 0 )
+    {
+        Vec_IntFill( vLits, Request[1], 0 );
+        if ( !Cec_GiaSplitRead(fdIn, Vec_IntArray(vLits), Request[1]) )
+            break;
+        status = l_False;
+        nConfs = 0;
+        if ( pSat != NULL )
+        {
+            // translate the literals of the PIs into SAT literals
+            Vec_IntForEachEntry( vLits, iLit, i )
+                Vec_IntWriteEntry( vLits, i, Abc_Var2Lit(pCnf->pVarNums[Gia_ObjId(p, Gia_ManPi(p, Abc_Lit2Var(iLit)))], Abc_LitIsCompl(iLit)) );
+            sat_solver_set_runtime_limit( pSat, nTimeOut ? nTimeOut * CLOCKS_PER_SEC + Abc_Clock(): 0 );
+            nConfs = sat_solver_nconflicts( pSat );
+            status = sat_solver_solve( pSat, Vec_IntArray(vLits), Vec_IntLimit(vLits), (ABC_INT64_T)Request[0], (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
+            nConfs = sat_solver_nconflicts( pSat ) - nConfs;
+        }
+        Vec_IntClear( vReply );
+        Vec_IntPush( vReply, status == l_True ? 0 : (status == l_False ? 1 : -1) );
+        Vec_IntPush( vReply, nConfs );
+        if ( status == l_True )
+            Gia_ManForEachPi( p, pObj, i )
+                Vec_IntPush( vReply, sat_solver_var_value(pSat, pCnf->pVarNums[Gia_ObjId(p, pObj)]) );
+        if ( !Cec_GiaSplitWrite(fdOut, Vec_IntArray(vReply), Vec_IntSize(vReply)) )
+            break;
+    }
+    if ( pSat )
+        sat_solver_delete( pSat );
+    Vec_IntFree( vLits );
+    Vec_IntFree( vReply );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Cube-and-conquer using worker processes.]
+
+  Description [The workers are forked after the CNF of the problem is 
+  derived and communicate with the manager over pipes. The manager keeps 
+  the queue of cubes together with the AIGs cofactored by the cubes. 
+  The cube whose conflict budget is exhausted is split into two by 
+  cofactoring its AIG on the variable selected by look-ahead. The cubes 
+  whose cofactored AIG is constant 0 are proved without a SAT call.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec_GiaSplitTestProcs( Gia_Man_t * p, int nProcs, int nTimeOut, int nConfLimit, int nIterMax, int LookAhead, int fVerbose, int fVeryVerbose, int fSilent )
+{
+    abctime clkTotal = Cec_GiaSplitClock();
+    Gia_Man_t * pBusy[PAR_THR_MAX], * pLast, * pPart;
+    int pPids[PAR_THR_MAX], pFdIn[PAR_THR_MAX], pFdOut[PAR_THR_MAX];
+    void (*pOldHandler)(int);
+    Vec_Ptr_t * vStack;
+    Cnf_Dat_t * pCnf;
+    double Progress = 0;
+    int i, k, v, Depth, iVar, nFanouts, Cost, nFdMax, Request[2], Reply[2];
+    int nIter = 0, RetValue = -1;
+    fd_set Set;
+    Abc_CexFreeP( &p->pCexComb );
+    nProcs = Abc_MinInt( nProcs, PAR_THR_MAX );
+    if ( fVerbose )
+        printf( "Solving CEC problem by cube-and-conquer with the following parameters:\n" );
+    if ( fVerbose )
+        printf( "Processes = %d   TimeOut = %d sec   ConfLimit = %d   MaxIter = %d   LookAhead = %d   Verbose = %d.\n", nProcs, nTimeOut, nConfLimit, nIterMax, LookAhead, fVerbose );
+    fflush( stdout );
+    // start the workers
+    pCnf = Cec_GiaDeriveGiaRemapped( p );
+    pOldHandler = signal( SIGPIPE, SIG_IGN );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        int fdToWorker[2], fdToManager[2];
+        if ( pipe(fdToWorker) )
+            break;
+        if ( pipe(fdToManager) )
+        {
+            close( fdToWorker[0] ); close( fdToWorker[1] );
+            break;
+        }
+        pPids[i] = fork();
+        if ( pPids[i] < 0 )
+        {
+            close( fdToWorker[0] );  close( fdToWorker[1] );
+            close( fdToManager[0] ); close( fdToManager[1] );
+            break;
+        }
+        if ( pPids[i] == 0 )
+        {
+            for ( k = 0; k < i; k++ )
+                close( pFdIn[k] ), close( pFdOut[k] );
+            close( fdToWorker[1] );
+            close( fdToManager[0] );
+            Cec_GiaSplitWorkerProc( p, pCnf, fdToWorker[0], fdToManager[1], nTimeOut );
+            _exit( 0 );
+        }
+        close( fdToWorker[0] );
+        close( fdToManager[1] );
+        pFdOut[i] = fdToWorker[1];
+        pFdIn[i]  = fdToManager[0];
+        pBusy[i]  = NULL;
+    }
+    if ( i < nProcs )
+        printf( "Could not start more than %d worker processes.\n", i );
+    nProcs = i;
+    if ( nProcs == 0 )
+    {
+        signal( SIGPIPE, pOldHandler );
+        Cnf_DataFree( pCnf );
+        return Cec_GiaSplitTest2( p, 1, nTimeOut, nConfLimit, nIterMax, LookAhead, fVerbose, fVeryVerbose, fSilent );
+    }
+    // start with the current problem
+    vStack = Vec_PtrAlloc( 1000 );
+    pPart = Gia_ManDup( p );
+    pPart->vCofVars = Vec_IntAlloc( 100 );
+    Vec_PtrPush( vStack, pPart );
+    while ( 1 )
+    {
+        // send the cubes to the idle workers
+        for ( i = 0; i < nProcs && Vec_PtrSize(vStack) > 0; i++ )
+        {
+            if ( pBusy[i] != NULL )
+                continue;
+            pBusy[i] = (Gia_Man_t *)Vec_PtrPop( vStack );
+            Request[0] = nConfLimit;
+            Request[1] = Vec_IntSize(pBusy[i]->vCofVars);
+            if ( !Cec_GiaSplitWrite(pFdOut[i], Request, 2) || !Cec_GiaSplitWrite(pFdOut[i], Vec_IntArray(pBusy[i]->vCofVars), Request[1]) )
+            {
+                printf( "Worker process %d has terminated unexpectedly.\n", i+1 );
+                goto finish;
+            }
+        }
+        // wait for the replies
+        FD_ZERO( &Set );
+        nFdMax = -1;
+        for ( i = 0; i < nProcs; i++ )
+            if ( pBusy[i] != NULL )
+            {
+                FD_SET( pFdIn[i], &Set );
+                nFdMax = Abc_MaxInt( nFdMax, pFdIn[i] );
+            }
+        if ( nFdMax == -1 ) // no more cubes
+        {
+            RetValue = 1;
+            break;
+        }
+        if ( select(nFdMax + 1, &Set, NULL, NULL, NULL) < 0 )
+            continue;
+        for ( i = 0; i < nProcs; i++ )
+        {
+            if ( pBusy[i] == NULL || !FD_ISSET(pFdIn[i], &Set) )
+                continue;
+            pLast = pBusy[i];
+            pBusy[i] = NULL;
+            Depth = Vec_IntSize(pLast->vCofVars);
+            if ( !Cec_GiaSplitRead(pFdIn[i], Reply, 2) )
+            {
+                printf( "Worker process %d has terminated unexpectedly.\n", i+1 );
+                Gia_ManStop( pLast );
+                goto finish;
+            }
+            if ( Reply[0] == 1 )
+                Progress += 1.0 / pow((double)2, (double)Depth);
+            if ( fVerbose )
+                Cec_GiaSplitPrint( i+1, Depth, pCnf->nVars, Reply[1], Reply[0], Progress, Cec_GiaSplitClock() - clkTotal );
+            if ( Reply[0] == 0 ) // SAT
+            {
+                int * pModel = ABC_ALLOC( int, Gia_ManPiNum(p) );
+                if ( Cec_GiaSplitRead(pFdIn[i], pModel, Gia_ManPiNum(p)) )
+                {
+                    p->pCexComb = Abc_CexCreate( 0, Gia_ManPiNum(p), pModel, 0, 0, 0 );
+                    RetValue = 0;
+                }
+                ABC_FREE( pModel );
+                Gia_ManStop( pLast );
+                goto finish;
+            }
+            if ( Reply[0] == 1 ) // UNSAT
+            {
+                Gia_ManStop( pLast );
+                continue;
+            }
+            // UNDEC: split the cube
+            iVar = Gia_SplitCofVar( pLast, LookAhead, &nFanouts, &Cost );
+            for ( v = 0; v < 2; v++ )
+            {
+                pPart = Gia_ManDupCofactorVar( pLast, iVar, v );
+                if ( fVeryVerbose )
+                    printf( "Var = %5d. Fanouts = %5d. Cost = %8d.  AndBefore = %6d.  AndAfter = %6d.\n", 
+                        iVar, nFanouts, Cost, Gia_ManAndNum(pLast), Gia_ManAndNum(pPart) );
+                if ( Gia_ObjFaninLit0p(pPart, Gia_ManPo(pPart, 0)) == 0 )
+                {
+                    Progress += 1.0 / pow((double)2, (double)(Depth + 1));
+                    Gia_ManStop( pPart );
+                    continue;
+                }
+                pPart->vCofVars = Vec_IntAlloc( Depth + 1 );
+                Vec_IntAppend( pPart->vCofVars, pLast->vCofVars );
+                Vec_IntPush( pPart->vCofVars, Abc_Var2Lit(iVar, !v) );
+                Vec_PtrPush( vStack, pPart );
+            }
+            Gia_ManStop( pLast );
+            nIter++;
+        }
+        if ( nIterMax && nIter >= nIterMax )
+            break;
+    }
+finish:
+    // stop the workers, including those still solving
+    for ( i = 0; i < nProcs; i++ )
+    {
+        kill( pPids[i], SIGKILL );
+        close( pFdOut[i] );
+        close( pFdIn[i] );
+        waitpid( pPids[i], NULL, 0 );
+        Gia_ManStopP( &pBusy[i] );
+    }
+    signal( SIGPIPE, pOldHandler );
+    Cnf_DataFree( pCnf );
+    Cec_GiaSplitClean( vStack );
+    if ( !fSilent )
+    {
+        if ( RetValue == 0 )
+            printf( "Problem is SAT " );
+        else if ( RetValue == 1 )
+            printf( "Problem is UNSAT " );
+        else if ( RetValue == -1 )
+            printf( "Problem is UNDECIDED " );
+        else assert( 0 );
+        printf( "after %d case-splits.  ", nIter );
+        Abc_PrintTime( 1, "Time", Cec_GiaSplitClock() - clkTotal );
+        fflush( stdout );
+    }
+    return RetValue;
+}
+#else
+int Cec_GiaSplitTestProcs( Gia_Man_t * p, int nProcs, int nTimeOut, int nConfLimit, int nIterMax, int LookAhead, int fVerbose, int fVeryVerbose, int fSilent )
+{
+    printf( "Worker processes are not supported on this platform. Using threads.\n" );
+    return Cec_GiaSplitTestInt( p, nProcs, nTimeOut, nConfLimit, nIterMax, LookAhead, fVerbose, fVeryVerbose, fSilent );
+}
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the outputs of the miter one at a time.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec_GiaSplitTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nConfLimit, int nIterMax, int LookAhead, int fUseProcs, int fVerbose, int fVeryVerbose, int fSilent )
 {
     Abc_Cex_t * pCex = NULL;
     Gia_Man_t * pOne;
@@ -749,7 +1079,10 @@ int Cec_GiaSplitTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int
         pOne = Gia_ManDupOutputGroup( p, i, i+1 );
         if ( fVerbose )
             printf( "\nSolving output %d:\n", i );
-        RetValue1 = Cec_GiaSplitTestInt( pOne, nProcs, nTimeOut, nIterMax, LookAhead,  fVerbose, fVeryVerbose, fSilent );
+        if ( fUseProcs )
+            RetValue1 = Cec_GiaSplitTestProcs( pOne, nProcs, nTimeOut, nConfLimit, nIterMax, LookAhead, fVerbose, fVeryVerbose, fSilent );
+        else
+            RetValue1 = Cec_GiaSplitTestInt( pOne, nProcs, nTimeOut, nConfLimit, nIterMax, LookAhead, fVerbose, fVeryVerbose, fSilent );
         Gia_ManStop( pOne );
         // collect the result
         if ( RetValue1 == 0 && RetValue == -1 )
@@ -67,6 +67,7 @@ struct Inter_ManParams_t_
     int  fVerbose;      // print verbose statistics
     int  iFrameMax;     // the time frame reached
     char * pFileName;   // file name to dump interpolant
+    char * pCkptFileName; // checkpoint file name
 };
 
 ////////////////////////////////////////////////////////////////////////
@@ -81,8 +81,9 @@ int Inter_ManPerformInterpolation( Aig_Man_t * pAig, Inter_ManParams_t * pPars,
     extern int Inter_ManCheckInductiveContainment( Aig_Man_t * pTrans, Aig_Man_t * pInter, int nSteps, int fBackward );
     Inter_Man_t * p;
     Inter_Check_t * pCheck = NULL;
-    Aig_Man_t * pAigTemp;
-    int s, i, RetValue, Status;
+    Aig_Man_t * pAigTemp, * pCkptInter = NULL;
+    Vec_Ptr_t * vCkptInters = NULL;
+    int s, i, k, iCkptStep = 0, RetValue, Status;
     abctime clk, clk2, clkTotal = Abc_Clock(), timeTemp = 0;
     abctime nTimeNewOut = pPars->nSecLimit ? pPars->nSecLimit * CLOCKS_PER_SEC + Abc_Clock() : 0;
 
@@ -132,6 +133,8 @@ p->timeCnf += Abc_Clock() - clk;
     // derive interpolant
     *piFrame = -1;
     p->nFrames = 1;
+    // resume from the checkpoint
+    Inter_ManCkptLoad( p, pPars, &iCkptStep, &vCkptInters, &pCkptInter );
     for ( s = 0; ; s++ )
     {
         Cnf_Dat_t * pCnfInter2;
@@ -193,13 +196,38 @@ p->timeEqu += Abc_Clock() - clk;
         }
         //////////////////////////////////////////
 
+        // restore the interpolants of the checkpoint
+        i = 0;
+        if ( pCkptInter )
+        {
+            Vec_PtrForEachEntry( Aig_Man_t *, vCkptInters, pAigTemp, k )
+            {
+                if ( pCheck )
+                {
+                    pCnfInter2 = Cnf_Derive( pAigTemp, 1 );  
+                    Inter_CheckPerform( pCheck, pCnfInter2, nTimeNewOut );
+                    Cnf_DataFree( pCnfInter2 );
+                }
+                Vec_PtrPush( p->vInters, pAigTemp );
+            }
+            Vec_PtrFreeP( &vCkptInters );
+            Aig_ManStop( p->pInter );
+            Cnf_DataFree( p->pCnfInter );
+            p->pInter = pCkptInter;
+            p->pCnfInter = Cnf_Derive( p->pInter, 0 );  
+            pCkptInter = NULL;
+            i = iCkptStep;
+        }
+
         // iterate the interpolation procedure
-        for ( i = 0; ; i++ )
+        for ( ; ; i++ )
         {
+            Inter_ManCkptSave( p, pPars, i, 0 );
             if ( pPars->nFramesMax && p->nFrames + i >= pPars->nFramesMax )
             { 
                 if ( pPars->fVerbose )
                     printf( "Reached limit (%d) on the number of timeframes.\n", pPars->nFramesMax );
+                Inter_ManCkptSave( p, pPars, i, 1 );
                 p->timeTotal = Abc_Clock() - clkTotal;
                 Inter_ManStop( p, 0 );
                 Inter_CheckStop( pCheck );
@@ -270,6 +298,7 @@ p->timeEqu += Abc_Clock() - clk;
                     if ( pPars->fVerbose )
                         printf( "Reached limit (%d) on the number of conflicts.\n", p->nConfLimit );
                 }
+                Inter_ManCkptSave( p, pPars, i, 1 );
                 p->timeTotal = Abc_Clock() - clkTotal;
                 Inter_ManStop( p, 0 );
                 Inter_CheckStop( pCheck );
@@ -289,6 +318,7 @@ clk = Abc_Clock();
                 if ( p->pInterNew == NULL )
                 {
                     printf( "Reached timeout (%d seconds) during rewriting.\n",  pPars->nSecLimit );
+                    Inter_ManCkptSave( p, pPars, i, 1 );
                     p->timeTotal = Abc_Clock() - clkTotal;
                     Inter_ManStop( p, 1 );
                     Inter_CheckStop( pCheck );
@@ -357,6 +387,7 @@ p->timeEqu += Abc_Clock() - clk - timeTemp;
             if ( pPars->nSecLimit && Abc_Clock() > nTimeNewOut )
             {
                 printf( "Reached timeout (%d seconds).\n",  pPars->nSecLimit );
+                Inter_ManCkptSave( p, pPars, i, 1 );
                 p->timeTotal = Abc_Clock() - clkTotal;
                 Inter_ManStop( p, 1 );
                 Inter_CheckStop( pCheck );
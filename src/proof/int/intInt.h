@@ -69,7 +69,10 @@ struct Inter_Man_t_
     int              nConfCur;     // the current number of conflicts
     int              nConfLimit;   // the limit on the number of conflicts
     int              fVerbose;     // the verbosiness flag
+    int              fDropInvar;   // dump the interpolants into a file
     char *           pFileName;
+    char *           pCkptFileName;
+    abctime          timeCkpt;     // the time of the last checkpoint
     // runtime
     abctime          timeRwr;
     abctime          timeCnf;
@@ -116,6 +119,8 @@ extern Aig_Man_t *     Inter_ManFramesInter( Aig_Man_t * pAig, int nFrames, int
 extern Inter_Man_t *   Inter_ManCreate( Aig_Man_t * pAig, Inter_ManParams_t * pPars );
 extern void            Inter_ManClean( Inter_Man_t * p );
 extern void            Inter_ManStop( Inter_Man_t * p, int fProved );
+extern void            Inter_ManCkptSave( Inter_Man_t * p, Inter_ManParams_t * pPars, int iStep, int fForce );
+extern int             Inter_ManCkptLoad( Inter_Man_t * p, Inter_ManParams_t * pPars, int * piStep, Vec_Ptr_t ** pvInters, Aig_Man_t ** ppInter );
 
 /*=== intM114.c ============================================================*/
 extern int             Inter_ManPerformOneStep( Inter_Man_t * p, int fUseBias, int fUseBackward, abctime nTimeNewOut );
@@ -52,9 +52,12 @@ Inter_Man_t * Inter_ManCreate( Aig_Man_t * pAig, Inter_ManParams_t * pPars )
     p->vVarsAB = Vec_IntAlloc( Aig_ManRegNum(pAig) );
     p->nConfLimit = pPars->nBTLimit;
     p->fVerbose = pPars->fVerbose;
+    p->fDropInvar = pPars->fDropInvar;
     p->pFileName = pPars->pFileName;
+    p->pCkptFileName = pPars->pCkptFileName;
+    p->timeCkpt = Abc_Clock();
     p->pAig = pAig;
-    if ( pPars->fDropInvar )
+    if ( pPars->fDropInvar || pPars->pCkptFileName )
         p->vInters = Vec_PtrAlloc( 100 );
     return p;
 }
@@ -114,6 +117,127 @@ void Inter_ManInterDump( Inter_Man_t * p, int fProved )
         printf( "Interpolants are dumped into file \"%s\".\n", pFileName );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Saves the interpolation state into the checkpoint.]
+
+  Description [Records the number of timeframes, the current step, the
+  interpolants used in the containment check, and the current interpolant.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Inter_ManCkptOptions( Inter_ManParams_t * pPars )
+{
+    return pPars->fTransLoop | (pPars->fUseBackward << 1) | (pPars->fUseTwoFrames << 2) | (pPars->fCheckKstep << 3) | (pPars->nFramesK << 4);
+}
+static void Inter_ManCkptPutAig( Vec_Str_t * vStr, Aig_Man_t * pMan )
+{
+    Vec_Str_t * vAig = Ioa_WriteAigerIntoMemoryStr( pMan );
+    Vec_StrPutI( vStr, Vec_StrSize(vAig) );
+    Vec_StrPushBuffer( vStr, Vec_StrArray(vAig), Vec_StrSize(vAig) );
+    Vec_StrFree( vAig );
+}
+static Aig_Man_t * Inter_ManCkptGetAig( Inter_Man_t * p, Vec_Str_t * vStr, int * pPos )
+{
+    int nSize = Saig_ManCkptGetCount( vStr, pPos );
+    Aig_Man_t * pMan;
+    if ( nSize <= 0 )
+        return NULL;
+    pMan = Ioa_ReadAigerFromMemory( Vec_StrEntryP(vStr, *pPos), nSize, 0 );
+    *pPos += nSize;
+    // the interpolant is a single-output function of the flops
+    if ( pMan && (Aig_ManCiNum(pMan) != Saig_ManRegNum(p->pAig) || Aig_ManCoNum(pMan) != 1) )
+    {
+        Aig_ManStop( pMan );
+        pMan = NULL;
+    }
+    return pMan;
+}
+void Inter_ManCkptSave( Inter_Man_t * p, Inter_ManParams_t * pPars, int iStep, int fForce )
+{
+    Vec_Str_t * vStr;
+    Aig_Man_t * pMan;
+    int i;
+    if ( p->pCkptFileName == NULL || p->pInter == NULL || !Saig_ManCkptTimeIsUp(&p->timeCkpt, fForce) )
+        return;
+    vStr = Saig_ManCkptStart( p->pAig, 'I', Inter_ManCkptOptions(pPars) );
+    Vec_StrPutI( vStr, p->nFrames );
+    Vec_StrPutI( vStr, iStep );
+    // the first interpolant is the initial state, which is not saved
+    Vec_StrPutI( vStr, Abc_MaxInt(Vec_PtrSize(p->vInters) - 1, 0) );
+    Vec_PtrForEachEntryStart( Aig_Man_t *, p->vInters, pMan, i, 1 )
+        Inter_ManCkptPutAig( vStr, pMan );
+    Inter_ManCkptPutAig( vStr, p->pInter );
+    if ( Saig_ManCkptWrite( vStr, p->pCkptFileName ) && p->fVerbose )
+        printf( "Saved step %d of %d frames into checkpoint file \"%s\".\n", iStep + 1, p->nFrames, p->pCkptFileName );
+    Vec_StrFree( vStr );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Loads the interpolation state from the checkpoint.]
+
+  Description [Returns 1 if the checkpoint is loaded. In this case, sets
+  the number of timeframes in the manager and returns the step, the
+  interpolants used in the containment check, and the current interpolant.
+  Returns 0 and changes nothing if the checkpoint is not valid.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Inter_ManCkptLoad( Inter_Man_t * p, Inter_ManParams_t * pPars, int * piStep, Vec_Ptr_t ** pvInters, Aig_Man_t ** ppInter )
+{
+    Vec_Str_t * vStr;
+    Vec_Ptr_t * vInters;
+    Aig_Man_t * pMan, * pInter = NULL;
+    int i, nFrames, iStep, nInters, Pos;
+    if ( p->pCkptFileName == NULL )
+        return 0;
+    vStr = Saig_ManCkptRead( p->pCkptFileName );
+    if ( vStr == NULL )
+        return 0;
+    if ( !Saig_ManCkptCheck( p->pAig, vStr, 'I', Inter_ManCkptOptions(pPars), &Pos ) )
+    {
+        Vec_StrFree( vStr );
+        return 0;
+    }
+    nFrames  = Saig_ManCkptGetNum( vStr, &Pos, ABC_INFINITY );
+    iStep    = Saig_ManCkptGetNum( vStr, &Pos, ABC_INFINITY );
+    nInters  = Saig_ManCkptGetCount( vStr, &Pos );
+    vInters  = Vec_PtrAlloc( Abc_MaxInt(nInters, 0) );
+    for ( i = 0; i < nInters; i++ )
+    {
+        if ( (pMan = Inter_ManCkptGetAig(p, vStr, &Pos)) == NULL )
+            break;
+        Vec_PtrPush( vInters, pMan );
+    }
+    if ( i == nInters )
+        pInter = Inter_ManCkptGetAig( p, vStr, &Pos );
+    if ( Pos != Vec_StrSize(vStr) || nFrames < 1 || iStep < 0 || pInter == NULL )
+    {
+        printf( "The checkpoint file \"%s\" is truncated or corrupted.\n", p->pCkptFileName );
+        Vec_PtrForEachEntry( Aig_Man_t *, vInters, pMan, i )
+            Aig_ManStop( pMan );
+        Vec_PtrFree( vInters );
+        if ( pInter )
+            Aig_ManStop( pInter );
+        Vec_StrFree( vStr );
+        return 0;
+    }
+    p->nFrames = nFrames;
+    *piStep    = iStep;
+    *pvInters  = vInters;
+    *ppInter   = pInter;
+    printf( "Resuming from step %d of %d frames in checkpoint file \"%s\".\n", *piStep + 1, p->nFrames, p->pCkptFileName );
+    Vec_StrFree( vStr );
+    return 1;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Frees the interpolation manager.]
@@ -140,7 +264,7 @@ void Inter_ManStop( Inter_Man_t * p, int fProved )
         ABC_PRTP( "TOTAL      ", p->timeTotal, p->timeTotal );
     }
 
-    if ( p->vInters )
+    if ( p->fDropInvar )
         Inter_ManInterDump( p, fProved );
 
     if ( p->pCnfAig )
@@ -59,9 +59,11 @@ void Pdr_ManSetDefaultParams( Pdr_Par_t * pPars )
     pPars->nConfGenLimit  =       0;  // limit on SAT solver conflicts during generalization
     pPars->nRestLimit     =       0;  // limit on the number of proof-obligations
     pPars->nRandomSeed   = 91648253;  // value to seed the SAT solver with
+    pPars->nProcs         =       0;  // the number of threads solving the outputs separately
     pPars->fTwoRounds     =       0;  // use two rounds for generalization
     pPars->fMonoCnf       =       0;  // monolythic CNF
     pPars->fNewXSim       =       0;  // updated X-valued simulation
+    pPars->fBitXSim       =       0;  // bit-sliced X-valued simulation
     pPars->fFlopPrio      =       0;  // use structural flop priorities
     pPars->fFlopOrder     =       0;  // order flops for 'analyze_final' during generalization
     pPars->fDumpInv       =       0;  // dump inductive invariant
@@ -80,6 +82,8 @@ void Pdr_ManSetDefaultParams( Pdr_Par_t * pPars )
     pPars->nDropOuts      =       0;  // the number of timed out outputs
     pPars->timeLastSolved =       0;  // last one solved
     pPars->pInvFileName   =    NULL;  // invariant file name
+    pPars->pSumFileName   =    NULL;  // per-output summary file name
+    pPars->pCkptFileName  =    NULL;  // checkpoint file name
 }
 
 /**Function*************************************************************
@@ -1281,6 +1285,7 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
         assert( pCube == NULL );
         Pdr_ManSetPropertyOutput( p, iFrame );
         Pdr_ManCreateSolver( p, ++iFrame );
+        Pdr_ManCkptSave( p, 0 );
         if ( fPrintClauses )
         {
             Abc_Print( 1, "*** Clauses after frame %d:\n", iFrame );
@@ -1393,8 +1398,11 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
 int Pdr_ManSolve( Aig_Man_t * pAig, Pdr_Par_t * pPars )
 {
     Pdr_Man_t * p;
+    Vec_Vec_t * vClauses;
     int k, RetValue;
     abctime clk = Abc_Clock();
+    if ( pPars->nProcs > 0 )
+        return Pdr_ManSolvePar( pAig, pPars );
     if ( pPars->nTimeOutOne && !pPars->fSolveAll )
         pPars->nTimeOutOne = 0;
     if ( pPars->nTimeOutOne && pPars->nTimeOut == 0 )
@@ -1414,7 +1422,16 @@ int Pdr_ManSolve( Aig_Man_t * pAig, Pdr_Par_t * pPars )
     }
     ABC_FREE( pAig->pSeqModel );
     p = Pdr_ManStart( pAig, pPars, NULL );
-    RetValue = Pdr_ManSolveInt( p );
+    vClauses = Pdr_ManCkptLoad( p );
+    if ( vClauses )
+    {
+        IPdr_ManRestoreClauses( p, vClauses, NULL );
+        RetValue = IPdr_ManSolveInt( p, 0, 1 );
+    }
+    else
+        RetValue = Pdr_ManSolveInt( p );
+    if ( RetValue == -1 )
+        Pdr_ManCkptSave( p, 1 );
     if ( RetValue == 0 )
         assert( pAig->pSeqModel != NULL || p->vCexes != NULL );
     if ( p->vCexes )
@@ -359,6 +359,163 @@ int IPdr_ManRestoreClauses( Pdr_Man_t * p, Vec_Vec_t * vClauses, Vec_Int_t * vMa
     return 0;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Saves the clauses and the solved outputs into the checkpoint.]
+
+  Description [Does nothing if the checkpoint file is not given or if
+  the last checkpoint was saved recently, unless fForce is set.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Pdr_ManCkptOptions( Pdr_Man_t * p )
+{
+    return p->pPars->fUsePropOut | (p->pPars->fUseAbs << 1) | (p->pPars->fSolveAll << 2);
+}
+void Pdr_ManCkptSave( Pdr_Man_t * p, int fForce )
+{
+    Vec_Str_t * vStr;
+    Vec_Ptr_t * vArrayK;
+    Pdr_Set_t * pCube;
+    int i, k, n;
+    if ( p->pPars->pCkptFileName == NULL || !Saig_ManCkptTimeIsUp(&p->timeCkpt, fForce) )
+        return;
+    vStr = Saig_ManCkptStart( p->pAig, 'P', Pdr_ManCkptOptions(p) );
+    Vec_StrPutI( vStr, Vec_VecSize(p->vClauses) );
+    Vec_VecForEachLevel( p->vClauses, vArrayK, k )
+    {
+        Vec_StrPutI( vStr, Vec_PtrSize(vArrayK) );
+        Vec_PtrForEachEntry( Pdr_Set_t *, vArrayK, pCube, i )
+        {
+            Vec_StrPutI( vStr, pCube->nTotal );
+            Vec_StrPutI( vStr, pCube->nLits );
+            for ( n = 0; n < pCube->nTotal; n++ )
+                Vec_StrPutI( vStr, pCube->Lits[n] + 1 );
+        }
+    }
+    if ( p->pPars->fSolveAll )
+    {
+        for ( i = 0; i < Saig_ManPoNum(p->pAig); i++ )
+        {
+            Vec_StrPutI( vStr, Vec_PtrEntry(p->vCexes, i) != NULL );
+            if ( Vec_PtrEntry(p->vCexes, i) )
+                Saig_ManCkptPutCex( vStr, (Abc_Cex_t *)Vec_PtrEntry(p->vCexes, i) );
+        }
+    }
+    if ( Saig_ManCkptWrite( vStr, p->pPars->pCkptFileName ) && p->pPars->fVerbose )
+        Abc_Print( 1, "Saved %d frames into checkpoint file \"%s\".\n", Vec_VecSize(p->vClauses), p->pPars->pCkptFileName );
+    Vec_StrFree( vStr );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Loads the clauses and the solved outputs from the checkpoint.]
+
+  Description [Returns NULL if there is no valid checkpoint. The failed
+  outputs are recorded in the manager. The checkpoint is validated
+  before the manager is changed.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Vec_t * Pdr_ManCkptLoad( Pdr_Man_t * p )
+{
+    Vec_Str_t * vStr;
+    Vec_Vec_t * vClauses;
+    Vec_Int_t * vLits, * vPiLits;
+    Vec_Ptr_t * vCexes;
+    Pdr_Set_t * pCube;
+    Abc_Cex_t * pCex;
+    int i, k, n, nLevels, nCubes, nTotal, nLits, Lit, Pos, nFailOuts = 0, fCorrupt = 0;
+    if ( p->pPars->pCkptFileName == NULL )
+        return NULL;
+    vStr = Saig_ManCkptRead( p->pPars->pCkptFileName );
+    if ( vStr == NULL )
+        return NULL;
+    if ( !Saig_ManCkptCheck( p->pAig, vStr, 'P', Pdr_ManCkptOptions(p), &Pos ) )
+    {
+        Vec_StrFree( vStr );
+        return NULL;
+    }
+    vLits    = Vec_IntAlloc( 100 );
+    vPiLits  = Vec_IntAlloc( 100 );
+    vCexes   = Vec_PtrStart( Saig_ManPoNum(p->pAig) );
+    nLevels  = Saig_ManCkptGetCount( vStr, &Pos );
+    vClauses = Vec_VecStart( Abc_MaxInt(nLevels, 0) );
+    for ( k = 0; k < nLevels; k++ )
+    {
+        nCubes = Saig_ManCkptGetCount( vStr, &Pos );
+        for ( i = 0; i < nCubes; i++ )
+        {
+            nTotal = Saig_ManCkptGetCount( vStr, &Pos );
+            nLits  = Saig_ManCkptGetNum( vStr, &Pos, nTotal + 1 );
+            if ( nLits == -1 )
+                break;
+            Vec_IntClear( vLits );
+            Vec_IntClear( vPiLits );
+            // the literals are stored incremented by one
+            for ( n = 0; n < nTotal; n++ )
+            {
+                Lit = Saig_ManCkptGetNum( vStr, &Pos, 2 * (n < nLits ? Saig_ManRegNum(p->pAig) : Saig_ManPiNum(p->pAig)) + 1 );
+                Vec_IntPush( n < nLits ? vLits : vPiLits, Lit - 1 );
+            }
+            if ( Pos > Vec_StrSize(vStr) )
+                break;
+            Vec_VecPush( vClauses, k, Pdr_SetCreate(vLits, vPiLits) );
+        }
+    }
+    if ( p->pPars->fSolveAll )
+    {
+        for ( i = 0; i < Saig_ManPoNum(p->pAig); i++ )
+        {
+            if ( Saig_ManCkptGetNum(vStr, &Pos, 2) != 1 )
+                continue;
+            pCex = Saig_ManCkptGetCex( p->pAig, vStr, &Pos );
+            Vec_PtrWriteEntry( vCexes, i, pCex );
+            if ( pCex == NULL || (pCex != (Abc_Cex_t *)(ABC_PTRINT_T)1 && pCex->iPo != i) )
+            {
+                fCorrupt = 1;
+                break;
+            }
+        }
+    }
+    Vec_IntFree( vLits );
+    Vec_IntFree( vPiLits );
+    if ( Pos != Vec_StrSize(vStr) || fCorrupt )
+    {
+        Abc_Print( 1, "The checkpoint file \"%s\" is truncated or corrupted.\n", p->pPars->pCkptFileName );
+        Vec_VecForEachEntry( Pdr_Set_t *, vClauses, pCube, k, i )
+            Pdr_SetDeref( pCube );
+        Vec_VecFree( vClauses );
+        Vec_PtrForEachEntry( Abc_Cex_t *, vCexes, pCex, i )
+            Abc_CexFreeP( &pCex );
+        Vec_PtrFree( vCexes );
+        Vec_StrFree( vStr );
+        return NULL;
+    }
+    Vec_PtrForEachEntry( Abc_Cex_t *, vCexes, pCex, i )
+    {
+        if ( pCex == NULL )
+            continue;
+        Vec_PtrWriteEntry( p->vCexes, i, pCex );
+        if ( p->pPars->vOutMap )
+            Vec_IntWriteEntry( p->pPars->vOutMap, i, 0 ); // sat
+        nFailOuts++;
+    }
+    p->pPars->nFailOuts += nFailOuts;
+    Vec_PtrFree( vCexes );
+    if ( !p->pPars->fSilent )
+        Abc_Print( 1, "Resuming from %d frames in checkpoint file \"%s\" (%d failed outputs).\n", 
+            nLevels, p->pPars->pCkptFileName, p->pPars->nFailOuts );
+    Vec_StrFree( vStr );
+    return vClauses;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -680,6 +837,7 @@ int IPdr_ManSolveInt( Pdr_Man_t * p, int fCheckClauses, int fPushClauses )
         assert( pCube == NULL );
         Pdr_ManSetPropertyOutput( p, iFrame );
         Pdr_ManCreateSolver( p, ++iFrame );
+        Pdr_ManCkptSave( p, 0 );
         if ( fPrintClauses )
         {
             Abc_Print( 1, "*** Clauses after frame %d:\n", iFrame );
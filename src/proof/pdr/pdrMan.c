@@ -251,6 +251,7 @@ Pdr_Man_t * Pdr_ManStart( Aig_Man_t * pAig, Pdr_Par_t * pPars, Vec_Int_t * vPrio
     p = ABC_CALLOC( Pdr_Man_t, 1 );
     p->pPars    = pPars;
     p->pAig     = pAig;
+    p->timeCkpt = Abc_Clock();
     p->pGia     = (pPars->fFlopPrio || p->pPars->fNewXSim || p->pPars->fUseAbs) ? Gia_ManFromAigSimple(pAig) : NULL;
     p->vSolvers = Vec_PtrAlloc( 0 );
     p->vClauses = Vec_VecAlloc( 0 );
@@ -282,6 +283,7 @@ Pdr_Man_t * Pdr_ManStart( Aig_Man_t * pAig, Pdr_Par_t * pPars, Vec_Int_t * vPrio
     p->pCnfMan  = Cnf_ManStart();
     // ternary simulation
     p->pTxs3    = pPars->fNewXSim ? Txs3_ManStart( p, pAig, p->vPrio ) : NULL;
+    p->pTxs4    = pPars->fBitXSim ? Txs4_ManStart( p, pAig ) : NULL;
     // additional AIG data-members
     if ( pAig->pFanData == NULL )
         Aig_ManFanoutStart( pAig );
@@ -370,6 +372,8 @@ void Pdr_ManStop( Pdr_Man_t * p )
     // terminary simulation
     if ( p->pPars->fNewXSim )
         Txs3_ManStop( p->pTxs3 );
+    if ( p->pPars->fBitXSim )
+        Txs4_ManStop( p->pTxs4 );
     // internal use
     Vec_IntFreeP( &p->vPrio   );  // priority flops
     Vec_IntFree( p->vLits     );  // array of literals
@@ -0,0 +1,526 @@
+/**CFile****************************************************************
+
+  FileName    [pdrPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Property driven reachability.]
+
+  Synopsis    [Solving the outputs in parallel with shared lemmas.]
+
+  Author      [agent]
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: pdrPar.c,v 1.00 2026/10/17 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "pdrInt.h"
+#include "misc/vec/vecHsh.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// Each output is solved by a separate PDR run on the single-output copy
+// of the design, which keeps all flops, so that the clauses of all runs
+// are expressed in terms of the same flops. The runs do not use the property
+// output as the inductive hypothesis, so that a clause in frame k of any run
+// holds in all states reachable in k steps and is valid for every output.
+// The clauses are collected in a store, which records for each clause
+// the highest frame (or infinity for the clauses of an inductive invariant),
+// and each new run starts with the frames restored from the store.
+
+#define PDR_PAR_THR_MAX   64
+#define PDR_PAR_INF       ABC_INFINITY
+
+typedef struct Pdr_ParMan_t_ Pdr_ParMan_t;
+struct Pdr_ParMan_t_
+{
+    Aig_Man_t *      pAig;       // the design
+    Pdr_Par_t *      pPars;      // the parameters
+    int              nThreads;   // the number of threads
+    volatile int     iNext;      // the next output to solve
+    volatile int     fStop;      // the flag to stop all runs
+    abctime          timeToStop; // the global runtime limit
+    abctime          timeLastSolved; // the time when the last output was solved (for the gap timeout)
+    volatile int     fGapStop;   // the flag showing that the gap timeout was reached
+    abctime          pDeadlines[PDR_PAR_THR_MAX]; // the per-output runtime limits of the threads
+    // lemma store
+    Hsh_VecMan_t *   pHash;      // the flop literals of the lemmas
+    Vec_Ptr_t *      vLemmas;    // the lemmas
+    Vec_Int_t *      vLevels;    // the highest frame of each lemma
+    int              nLevelMax;  // the highest finite frame
+    // per-output results
+    Vec_Int_t *      vStatus;    // the status (0 = sat; 1 = unsat; -1 = undecided)
+    Vec_Int_t *      vFrames;    // the last frame explored
+    Vec_Int_t *      vReused;    // the number of lemmas reused from the store
+    Vec_Int_t *      vThreads;   // the thread used
+    Vec_Wrd_t *      vTimes;     // the runtime
+    Vec_Ptr_t *      vCexes;     // the counter-examples
+    int              nSolved;    // the number of solved outputs
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t  Mutex;      // the lock protecting the store and the results
+#endif
+};
+
+typedef struct Pdr_ParThData_t_ Pdr_ParThData_t;
+struct Pdr_ParThData_t_
+{
+    Pdr_ParMan_t *   p;
+    int              iThread;
+};
+
+// the manager used by the callback (only one parallel run at a time)
+static Pdr_ParMan_t * s_pParMan = NULL;
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Protects the lemma store and the results.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Pdr_ParLock( Pdr_ParMan_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_lock( &p->Mutex );
+#endif
+}
+static inline void Pdr_ParUnlock( Pdr_ParMan_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_unlock( &p->Mutex );
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Call back procedure for the PDR runs.]
+
+  Description [The run identifier is the thread number.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_ParCallBackToStop( int RunId )
+{
+    Pdr_ParMan_t * p = s_pParMan;
+    assert( RunId >= 0 && RunId < p->nThreads );
+    if ( p->fStop )
+        return 1;
+    if ( p->timeToStop && Abc_Clock() > p->timeToStop )
+        return 1;
+    if ( p->pPars->nTimeOutGap && Abc_Clock() > p->timeLastSolved + p->pPars->nTimeOutGap * CLOCKS_PER_SEC )
+        return (p->fGapStop = 1);
+    return p->pDeadlines[RunId] && Abc_Clock() > p->pDeadlines[RunId];
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the manager.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Pdr_ParMan_t * Pdr_ParManStart( Aig_Man_t * pAig, Pdr_Par_t * pPars )
+{
+    Pdr_ParMan_t * p = ABC_CALLOC( Pdr_ParMan_t, 1 );
+    p->pAig       = pAig;
+    p->pPars      = pPars;
+    p->nThreads   = Abc_MaxInt( 1, Abc_MinInt(pPars->nProcs, PDR_PAR_THR_MAX) );
+#ifndef ABC_USE_PTHREADS
+    p->nThreads   = 1;
+#else
+    pthread_mutex_init( &p->Mutex, NULL );
+#endif
+    p->timeToStop = pPars->nTimeOut ? pPars->nTimeOut * CLOCKS_PER_SEC + Abc_Clock() : 0;
+    p->timeLastSolved = Abc_Clock();
+    p->pHash      = Hsh_VecManStart( 1000 );
+    p->vLemmas    = Vec_PtrAlloc( 1000 );
+    p->vLevels    = Vec_IntAlloc( 1000 );
+    p->vStatus    = Vec_IntStartFull( Saig_ManPoNum(pAig) );
+    p->vFrames    = Vec_IntStartFull( Saig_ManPoNum(pAig) );
+    p->vReused    = Vec_IntStart( Saig_ManPoNum(pAig) );
+    p->vThreads   = Vec_IntStartFull( Saig_ManPoNum(pAig) );
+    p->vTimes     = Vec_WrdStart( Saig_ManPoNum(pAig) );
+    p->vCexes     = Vec_PtrStart( Saig_ManPoNum(pAig) );
+    return p;
+}
+void Pdr_ParManStop( Pdr_ParMan_t * p )
+{
+    Pdr_Set_t * pSet; int i;
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_destroy( &p->Mutex );
+#endif
+    Vec_PtrForEachEntry( Pdr_Set_t *, p->vLemmas, pSet, i )
+        Pdr_SetDeref( pSet );
+    Vec_PtrFree( p->vLemmas );
+    Vec_IntFree( p->vLevels );
+    Hsh_VecManStop( p->pHash );
+    Vec_IntFree( p->vStatus );
+    Vec_IntFree( p->vFrames );
+    Vec_IntFree( p->vReused );
+    Vec_IntFree( p->vThreads );
+    Vec_WrdFree( p->vTimes );
+    if ( p->vCexes )
+        Vec_PtrFreeFree( p->vCexes );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the clauses of one PDR run to the lemma store.]
+
+  Description [The clauses are hashed by their flop literals. If the
+  clause is already in the store, its frame is updated to the highest
+  of the two. The clauses in the frames above the empty frame found
+  when the output was proved are the inductive invariant.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ParLemmasAdd( Pdr_ParMan_t * p, Pdr_Man_t * pMan, int RetValue )
+{
+    Vec_Ptr_t * vArrayK;
+    Pdr_Set_t * pSet;
+    Vec_Int_t Vec = { 0 };
+    int i, k, iLemma, Level, kInv = RetValue == 1 ? Pdr_ManFindInvariantStart(pMan) : PDR_PAR_INF;
+    Vec_VecForEachLevelStart( pMan->vClauses, vArrayK, k, 1 )
+    {
+        Level = k >= kInv ? PDR_PAR_INF : k;
+        Vec_PtrForEachEntry( Pdr_Set_t *, vArrayK, pSet, i )
+        {
+            Vec.nSize = Vec.nCap = pSet->nLits;
+            Vec.pArray = pSet->Lits;
+            iLemma = Hsh_VecManAdd( p->pHash, &Vec );
+            if ( iLemma == Vec_PtrSize(p->vLemmas) )
+            {
+                Vec_PtrPush( p->vLemmas, Pdr_SetDup(pSet) );
+                Vec_IntPush( p->vLevels, Level );
+            }
+            else if ( Vec_IntEntry(p->vLevels, iLemma) < Level )
+                Vec_IntWriteEntry( p->vLevels, iLemma, Level );
+            if ( Level != PDR_PAR_INF )
+                p->nLevelMax = Abc_MaxInt( p->nLevelMax, Level );
+        }
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the frames to start a new PDR run.]
+
+  Description [Returns NULL if the store is empty. Otherwise, returns
+  the frames 0..K, where K is the highest finite frame in the store,
+  with each lemma added to its frame and the inductive lemmas added
+  to frame K.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Vec_t * Pdr_ParLemmasSeed( Pdr_ParMan_t * p, int * pnLemmas )
+{
+    Vec_Vec_t * vClauses;
+    Pdr_Set_t * pSet;
+    int i, nLevels = Abc_MaxInt( p->nLevelMax, 1 );
+    *pnLemmas = Vec_PtrSize(p->vLemmas);
+    if ( Vec_PtrSize(p->vLemmas) == 0 )
+        return NULL;
+    vClauses = Vec_VecStart( nLevels + 1 );
+    Vec_PtrForEachEntry( Pdr_Set_t *, p->vLemmas, pSet, i )
+        Vec_VecPush( vClauses, Abc_MinInt(Vec_IntEntry(p->vLevels, i), nLevels), Pdr_SetDup(pSet) );
+    return vClauses;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves one output.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ParSolveOne( Pdr_ParMan_t * p, int iThread, int iOut )
+{
+    Pdr_Par_t Pars, * pPars = &Pars;
+    Pdr_Man_t * pMan;
+    Aig_Man_t * pOne;
+    Vec_Vec_t * vSeed;
+    Abc_Cex_t * pCex = NULL;
+    abctime clk = Abc_Clock();
+    int RetValue, nReused = 0, nOutDigits = Abc_Base10Log( Saig_ManPoNum(p->pAig) );
+    // the single-output copy is derived under the lock because it uses the data of the objects
+    Pdr_ParLock( p );
+    pOne  = Aig_ManDupOneOutput( p->pAig, iOut, 1 );
+    vSeed = p->pPars->fShortest ? NULL : Pdr_ParLemmasSeed( p, &nReused );
+    Pdr_ParUnlock( p );
+    assert( Aig_ManRegNum(pOne) == Aig_ManRegNum(p->pAig) );
+    Aig_ManSetCioIds( pOne );
+    // set the parameters of this run
+    *pPars = *p->pPars;
+    pPars->nProcs       = 0;
+    pPars->nTimeOut     = 0;
+    pPars->nTimeOutGap  = 0;
+    pPars->nTimeOutOne  = 0;
+    pPars->fUsePropOut  = 0;
+    pPars->fUseAbs      = 0;
+    pPars->fDumpInv     = 0;
+    pPars->fSolveAll    = 0;
+    pPars->fStoreCex    = 0;
+    pPars->fUseBridge   = 0;
+    pPars->fVerbose     = 0;
+    pPars->fVeryVerbose = 0;
+    pPars->fNotVerbose  = 1;
+    pPars->fSilent      = 1;
+    pPars->nFailOuts    = 0;
+    pPars->nDropOuts    = 0;
+    pPars->nProveOuts   = 0;
+    pPars->iFrame       = 0;
+    pPars->RunId        = iThread;
+    pPars->pFuncStop    = Pdr_ParCallBackToStop;
+    pPars->pFuncOnFail  = NULL;
+    pPars->vOutMap      = NULL;
+    pPars->pInvFileName = NULL;
+    pPars->pSumFileName = NULL;
+    p->pDeadlines[iThread] = p->pPars->nTimeOutOne ? p->pPars->nTimeOutOne * CLOCKS_PER_SEC / 1000 + 1 + Abc_Clock() : 0;
+    // solve the output starting with the lemmas in the store
+    pMan = Pdr_ManStart( pOne, pPars, NULL );
+    if ( vSeed )
+        IPdr_ManRestoreClauses( pMan, vSeed, NULL );
+    RetValue = IPdr_ManSolveInt( pMan, 0, vSeed != NULL );
+    p->pDeadlines[iThread] = 0;
+    if ( RetValue == 0 )
+    {
+        pCex = pOne->pSeqModel;  pOne->pSeqModel = NULL;
+        assert( pCex != NULL && pCex->iPo == 0 );
+        pCex->iPo = iOut;
+    }
+    // record the results
+    Pdr_ParLock( p );
+    Pdr_ParLemmasAdd( p, pMan, RetValue );
+    Vec_IntWriteEntry( p->vStatus,  iOut, RetValue );
+    Vec_IntWriteEntry( p->vFrames,  iOut, pCex ? pCex->iFrame : pPars->iFrame );
+    Vec_IntWriteEntry( p->vReused,  iOut, nReused );
+    Vec_IntWriteEntry( p->vThreads, iOut, iThread );
+    Vec_WrdWriteEntry( p->vTimes,   iOut, Abc_Clock() - clk );
+    Vec_PtrWriteEntry( p->vCexes,   iOut, pCex );
+    if ( RetValue != -1 )
+    {
+        p->nSolved++;
+        p->timeLastSolved = Abc_Clock();
+    }
+    if ( RetValue == 0 && !p->pPars->fSolveAll )
+        p->fStop = 1;
+    if ( !p->pPars->fNotVerbose && !(RetValue == -1 && p->fStop) )
+    {
+        Abc_Print( 1, "Output %*d %s in frame %3d (thread %2d, reused %6d lemmas, solved %*d out of %*d outputs).  ",
+            nOutDigits, iOut, RetValue == 1 ? "was proved  " : RetValue == 0 ? "was asserted" : "is undecided",
+            Vec_IntEntry(p->vFrames, iOut), iThread, nReused, nOutDigits, p->nSolved, nOutDigits, Saig_ManPoNum(p->pAig) );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    Pdr_ParUnlock( p );
+    Pdr_ManStop( pMan );
+    Aig_ManStop( pOne );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the outputs handed out to one thread.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Pdr_ParThread( void * pArg )
+{
+    Pdr_ParThData_t * pThData = (Pdr_ParThData_t *)pArg;
+    Pdr_ParMan_t * p = pThData->p;
+    int iOut;
+    while ( 1 )
+    {
+        Pdr_ParLock( p );
+        iOut = (p->fStop || p->iNext == Saig_ManPoNum(p->pAig)) ? -1 : p->iNext++;
+        Pdr_ParUnlock( p );
+        if ( iOut == -1 )
+            break;
+        if ( p->timeToStop && Abc_Clock() > p->timeToStop )
+            break;
+        if ( p->fGapStop )
+            break;
+        Pdr_ParSolveOne( p, pThData->iThread, iOut );
+    }
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the per-output results.]
+
+  Description [Each line contains the output number, the status
+  (proved, failed, or undecided), the last frame explored (or the
+  frame of the counter-example), the runtime in seconds, the number
+  of lemmas reused from the store, and the thread number.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ParWriteSummary( Pdr_ParMan_t * p, char * pFileName )
+{
+    FILE * pFile = fopen( pFileName, "wb" );
+    int i, Status;
+    if ( pFile == NULL )
+    {
+        Abc_Print( 1, "Cannot open file \"%s\" for writing.\n", pFileName );
+        return;
+    }
+    fprintf( pFile, "output,status,frame,time,reused,thread\n" );
+    Vec_IntForEachEntry( p->vStatus, Status, i )
+        fprintf( pFile, "%d,%s,%d,%.3f,%d,%d\n", i,
+            Status == 1 ? "proved" : Status == 0 ? "failed" : "undecided",
+            Vec_IntEntry(p->vFrames, i), 1.0*((double)Vec_WrdEntry(p->vTimes, i))/((double)CLOCKS_PER_SEC),
+            Vec_IntEntry(p->vReused, i), Vec_IntEntry(p->vThreads, i) );
+    fclose( pFile );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the outputs in parallel.]
+
+  Description [In the multi-output mode (pPars->fSolveAll), the results
+  are returned in pPars->vOutMap and, if pPars->fStoreCex is set, in
+  pAig->vSeqModelVec. Otherwise, the computation stops when an output
+  is asserted, whose counter-example is returned in pAig->pSeqModel.
+  In both modes, the computation stops when no output is solved within
+  pPars->nTimeOutGap seconds.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_ManSolvePar( Aig_Man_t * pAig, Pdr_Par_t * pPars )
+{
+    Pdr_ParThData_t ThData[PDR_PAR_THR_MAX];
+    Pdr_ParMan_t * p;
+    abctime clk = Abc_Clock();
+    int i, Status, RetValue;
+    assert( s_pParMan == NULL );
+    ABC_FREE( pAig->pSeqModel );
+    p = Pdr_ParManStart( pAig, pPars );
+    s_pParMan = p;
+    if ( pPars->fVerbose )
+        Abc_Print( 1, "Solving %d outputs using %d threads with shared lemmas. TimeMax = %d. TimeOne = %d ms.\n",
+            Saig_ManPoNum(pAig), p->nThreads, pPars->nTimeOut, pPars->nTimeOutOne );
+    for ( i = 0; i < p->nThreads; i++ )
+    {
+        ThData[i].p       = p;
+        ThData[i].iThread = i;
+    }
+#ifdef ABC_USE_PTHREADS
+    if ( p->nThreads > 1 )
+    {
+        pthread_t WorkerThread[PDR_PAR_THR_MAX];
+        int status;
+        for ( i = 1; i < p->nThreads; i++ )
+        {
+            status = pthread_create( WorkerThread + i, NULL, Pdr_ParThread, (void *)(ThData + i) );
+            assert( status == 0 );
+        }
+        Pdr_ParThread( (void *)ThData );
+        for ( i = 1; i < p->nThreads; i++ )
+            pthread_join( WorkerThread[i], NULL );
+    }
+    else
+#endif
+    Pdr_ParThread( (void *)ThData );
+    s_pParMan = NULL;
+    // collect the results
+    pPars->nProveOuts = Vec_IntCountEntry( p->vStatus, 1 );
+    pPars->nFailOuts  = Vec_IntCountEntry( p->vStatus, 0 );
+    pPars->nDropOuts  = Saig_ManPoNum(pAig) - pPars->nProveOuts - pPars->nFailOuts;
+    pPars->iFrame     = Vec_IntFindMax( p->vFrames );
+    if ( pPars->fSolveAll )
+    {
+        Vec_IntFreeP( &pPars->vOutMap );
+        pPars->vOutMap = Vec_IntDup( p->vStatus );
+        if ( pPars->fStoreCex )
+        {
+            assert( pAig->vSeqModelVec == NULL );
+            pAig->vSeqModelVec = p->vCexes;
+            p->vCexes = NULL;
+        }
+    }
+    else
+    {
+        Vec_IntForEachEntry( p->vStatus, Status, i )
+            if ( Status == 0 )
+            {
+                pAig->pSeqModel = (Abc_Cex_t *)Vec_PtrEntry( p->vCexes, i );
+                Vec_PtrWriteEntry( p->vCexes, i, NULL );
+                break;
+            }
+    }
+    if ( p->fGapStop && !pPars->fSilent )
+        Abc_Print( 1, "Reached gap timeout (%d seconds).\n", pPars->nTimeOutGap );
+    if ( pPars->pSumFileName )
+        Pdr_ParWriteSummary( p, pPars->pSumFileName );
+    if ( pPars->fVerbose )
+    {
+        Abc_Print( 1, "The store contains %d lemmas (%d inductive) in %d frames.  ",
+            Vec_PtrSize(p->vLemmas), Vec_IntCountEntry(p->vLevels, PDR_PAR_INF), p->nLevelMax );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    RetValue = pPars->nFailOuts ? 0 : (pPars->nProveOuts == Saig_ManPoNum(pAig) ? 1 : -1);
+    Pdr_ParManStop( p );
+    return RetValue;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -0,0 +1,434 @@
+/**CFile****************************************************************
+
+  FileName    [pdrTsim4.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Property driven reachability.]
+
+  Synopsis    [Bit-sliced ternary simulation.]
+
+  Author      [agent]
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: pdrTsim4.c,v 1.00 2026/10/17 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "pdrInt.h"
+#include "misc/util/utilTruth.h"
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// This engine computes the same cube as Pdr_ManTernarySim() but, instead
+// of trying the flops one at a time with event-driven simulation, it
+// simulates the cone once for up to 64*TXS4_WORDS_MAX flop-removal
+// experiments, one experiment per bit-lane. Each cone object has two
+// planes of nWords words: the lanes where the value is 0 and the lanes
+// where the value is 1 (the lanes where neither bit is set are X).
+//
+// The greedy removal is reproduced exactly using the monotonicity of
+// ternary simulation (adding X-values never turns X into 0/1):
+// - in the first pass, each lane makes X one new candidate in addition
+//   to the flops already removed; the candidates that fail here would
+//   fail in the greedy order too and are dropped;
+// - in the following passes, lane i makes X the first i+1 survivors;
+//   the lanes before the first failing one are removed, the failing
+//   survivor is kept, and the remaining survivors are tried again.
+
+#define TXS4_WORDS_MAX 8
+
+struct Txs4_Man_t_
+{
+    Pdr_Man_t * pMan;      // calling manager
+    Aig_Man_t * pAig;      // user's AIG
+    int         nWords;    // the number of words in the current pass
+    Vec_Int_t * vObj2Slot; // simulation slot of each cone object
+    Vec_Int_t * vFlops;    // candidate flops (CI obj IDs) in the order of trying
+    Vec_Int_t * vSurv;     // candidates that passed the first pass (CI obj IDs)
+    Vec_Int_t * vRemoved;  // flags of removed cone leaves (by CI slot)
+    Vec_Wrd_t * vSims;     // simulation info (two planes per slot)
+    Vec_Wrd_t * vMasks;    // X-lanes of each cone leaf (by CI slot)
+    Vec_Wrd_t * vOk;       // the lanes where the roots keep their values
+    // statistics
+    int         nCalls;    // the number of calls
+    int         nPasses;   // the number of simulation passes
+    int         nFlops;    // the number of flops tried
+};
+
+static inline word * Txs4_ManSim0( Txs4_Man_t * p, int iSlot )    { return Vec_WrdEntryP( p->vSims, 2 * p->nWords * iSlot );            }
+static inline word * Txs4_ManSim1( Txs4_Man_t * p, int iSlot )    { return Vec_WrdEntryP( p->vSims, 2 * p->nWords * iSlot + p->nWords ); }
+static inline word * Txs4_ManMask( Txs4_Man_t * p, int iCi )      { return Vec_WrdEntryP( p->vMasks, p->nWords * iCi );                 }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Start and stop the ternary simulation engine.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Txs4_Man_t * Txs4_ManStart( Pdr_Man_t * pMan, Aig_Man_t * pAig )
+{
+    Txs4_Man_t * p;
+    p = ABC_CALLOC( Txs4_Man_t, 1 );
+    p->pMan      = pMan;
+    p->pAig      = pAig;
+    p->vObj2Slot = Vec_IntStartFull( Aig_ManObjNumMax(pAig) );
+    p->vFlops    = Vec_IntAlloc( 100 );
+    p->vSurv     = Vec_IntAlloc( 100 );
+    p->vRemoved  = Vec_IntAlloc( 100 );
+    p->vSims     = Vec_WrdAlloc( 1000 );
+    p->vMasks    = Vec_WrdAlloc( 1000 );
+    p->vOk       = Vec_WrdAlloc( TXS4_WORDS_MAX );
+    return p;
+}
+void Txs4_ManStop( Txs4_Man_t * p )
+{
+    if ( p->pMan->pPars->fVerbose && p->nCalls )
+        Abc_Print( 1, "Bit-sliced ternary simulation: Calls = %d. Flops tried = %d. Passes = %d (%.2f flops per pass).\n",
+            p->nCalls, p->nFlops, p->nPasses, 1.0 * p->nFlops / Abc_MaxInt(1, p->nPasses) );
+    Vec_IntFree( p->vObj2Slot );
+    Vec_IntFree( p->vFlops );
+    Vec_IntFree( p->vSurv );
+    Vec_IntFree( p->vRemoved );
+    Vec_WrdFree( p->vSims );
+    Vec_WrdFree( p->vMasks );
+    Vec_WrdFree( p->vOk );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates one AND node in all lanes.]
+
+  Description [The complemented fanins are handled by swapping the planes.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Txs4_ManSimAnd( word * pRes0, word * pRes1, word * p00, word * p01, word * p10, word * p11, int nWords )
+{
+    int w = 0;
+#ifdef __AVX2__
+    for ( ; w + 4 <= nWords; w += 4 )
+    {
+        __m256i A0 = _mm256_loadu_si256( (__m256i *)(p00 + w) );
+        __m256i A1 = _mm256_loadu_si256( (__m256i *)(p01 + w) );
+        __m256i B0 = _mm256_loadu_si256( (__m256i *)(p10 + w) );
+        __m256i B1 = _mm256_loadu_si256( (__m256i *)(p11 + w) );
+        _mm256_storeu_si256( (__m256i *)(pRes0 + w), _mm256_or_si256(A0, B0) );
+        _mm256_storeu_si256( (__m256i *)(pRes1 + w), _mm256_and_si256(A1, B1) );
+    }
+#endif
+    for ( ; w < nWords; w++ )
+    {
+        pRes0[w] = p00[w] | p10[w];
+        pRes1[w] = p01[w] & p11[w];
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates the cone in all lanes.]
+
+  Description [Returns the lanes where all roots have the same values
+  as those derived by the SAT solver.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static word * Txs4_ManSimulate( Txs4_Man_t * p, Vec_Int_t * vCiObjs, Vec_Int_t * vCiVals, Vec_Int_t * vNodes, Vec_Int_t * vCoObjs, Vec_Int_t * vCoVals )
+{
+    Aig_Obj_t * pObj;
+    word * pSim0, * pSim1, * pMask, * pFan[2][2], * pOk;
+    int i, w, iSlot, nWords = p->nWords;
+    p->nPasses++;
+    // constant 1 is in slot 0
+    pSim0 = Txs4_ManSim0( p, 0 );
+    pSim1 = Txs4_ManSim1( p, 0 );
+    for ( w = 0; w < nWords; w++ )
+        pSim0[w] = 0, pSim1[w] = ~(word)0;
+    // the leaves take their values except in the X-lanes
+    Aig_ManForEachObjVec( vCiObjs, p->pAig, pObj, i )
+    {
+        pSim0 = Txs4_ManSim0( p, i + 1 );
+        pSim1 = Txs4_ManSim1( p, i + 1 );
+        pMask = Txs4_ManMask( p, i );
+        if ( Vec_IntEntry(vCiVals, i) )
+            for ( w = 0; w < nWords; w++ )
+                pSim0[w] = 0, pSim1[w] = ~pMask[w];
+        else
+            for ( w = 0; w < nWords; w++ )
+                pSim0[w] = ~pMask[w], pSim1[w] = 0;
+    }
+    // the nodes follow the leaves
+    iSlot = Vec_IntSize(vCiObjs) + 1;
+    Aig_ManForEachObjVec( vNodes, p->pAig, pObj, i )
+    {
+        int iSlot0 = Vec_IntEntry( p->vObj2Slot, Aig_ObjFaninId0(pObj) );
+        int iSlot1 = Vec_IntEntry( p->vObj2Slot, Aig_ObjFaninId1(pObj) );
+        pFan[0][ Aig_ObjFaninC0(pObj)] = Txs4_ManSim0( p, iSlot0 );
+        pFan[0][!Aig_ObjFaninC0(pObj)] = Txs4_ManSim1( p, iSlot0 );
+        pFan[1][ Aig_ObjFaninC1(pObj)] = Txs4_ManSim0( p, iSlot1 );
+        pFan[1][!Aig_ObjFaninC1(pObj)] = Txs4_ManSim1( p, iSlot1 );
+        Txs4_ManSimAnd( Txs4_ManSim0(p, iSlot), Txs4_ManSim1(p, iSlot), pFan[0][0], pFan[0][1], pFan[1][0], pFan[1][1], nWords );
+        iSlot++;
+    }
+    // compare the roots
+    pOk = Vec_WrdArray( p->vOk );
+    for ( w = 0; w < nWords; w++ )
+        pOk[w] = ~(word)0;
+    Aig_ManForEachObjVec( vCoObjs, p->pAig, pObj, i )
+    {
+        int iSlot0 = Vec_IntEntry( p->vObj2Slot, Aig_ObjFaninId0(pObj) );
+        int fValue = Vec_IntEntry( vCoVals, i ) ^ Aig_ObjFaninC0(pObj);
+        pSim0 = fValue ? Txs4_ManSim1( p, iSlot0 ) : Txs4_ManSim0( p, iSlot0 );
+        for ( w = 0; w < nWords; w++ )
+            pOk[w] &= pSim0[w];
+    }
+    return pOk;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prepares the X-lanes for the next pass.]
+
+  Description [The removed flops are X in all lanes; the other leaves
+  are X in none of them until the caller marks the lanes.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Txs4_ManStartPass( Txs4_Man_t * p, int nLanes )
+{
+    int i, w, fRemoved;
+    assert( nLanes > 0 && nLanes <= 64 * TXS4_WORDS_MAX );
+    p->nWords = Abc_Bit6WordNum( nLanes );
+    Vec_WrdFill( p->vMasks, p->nWords * Vec_IntSize(p->vRemoved), 0 );
+    Vec_IntForEachEntry( p->vRemoved, fRemoved, i )
+        if ( fRemoved )
+            for ( w = 0; w < p->nWords; w++ )
+                Txs4_ManMask(p, i)[w] = ~(word)0;
+}
+static inline int Txs4_ManCiSlot( Txs4_Man_t * p, int iCiObj )
+{
+    return Vec_IntEntry( p->vObj2Slot, iCiObj ) - 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Orders the flops in the cone for removal.]
+
+  Description [Follows the order used by Pdr_ManTernarySim().]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Txs4_ManOrderFlops( Txs4_Man_t * p, Vec_Int_t * vCiObjs )
+{
+    Aig_Man_t * pAig = p->pAig;
+    Vec_Int_t * vPrio = p->pMan->vPrio;
+    Aig_Obj_t * pObj;
+    int i, Entry, fHigh;
+    Vec_IntClear( p->vFlops );
+    if ( p->pMan->pPars->fFlopPrio )
+    {
+        Aig_ManForEachObjVec( vCiObjs, pAig, pObj, i )
+            if ( Saig_ObjIsLo(pAig, pObj) )
+                Vec_IntPush( p->vFlops, Aig_ObjCioId(pObj) - Saig_ManPiNum(pAig) );
+        Vec_IntSelectSortCost( Vec_IntArray(p->vFlops), Vec_IntSize(p->vFlops), vPrio );
+        Vec_IntForEachEntry( p->vFlops, Entry, i )
+            Vec_IntWriteEntry( p->vFlops, i, Aig_ObjId(Saig_ManLo(pAig, Entry)) );
+        return;
+    }
+    // low-priority flops first, then high-priority flops
+    for ( fHigh = 0; fHigh < 2; fHigh++ )
+    Aig_ManForEachObjVec( vCiObjs, pAig, pObj, i )
+    {
+        if ( !Saig_ObjIsLo(pAig, pObj) )
+            continue;
+        Entry = Aig_ObjCioId(pObj) - Saig_ManPiNum(pAig);
+        if ( (Vec_IntEntry(vPrio, Entry) != 0) == fHigh )
+            Vec_IntPush( p->vFlops, Aig_ObjId(pObj) );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Removes the flop and records it in the result.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Txs4_ManRemove( Txs4_Man_t * p, int iCiObj, Vec_Int_t * vCi2Rem )
+{
+    Vec_IntWriteEntry( p->vRemoved, Txs4_ManCiSlot(p, iCiObj), 1 );
+    Vec_IntPush( vCi2Rem, iCiObj );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Shrinks values using bit-sliced ternary simulation.]
+
+  Description [The interface and the result are the same as those of
+  Pdr_ManTernarySim().]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Pdr_Set_t * Txs4_ManTernarySim( Txs4_Man_t * p, int k, Pdr_Set_t * pCube )
+{
+    Pdr_Man_t * pMan    = p->pMan;
+    Aig_Man_t * pAig    = p->pAig;
+    Vec_Int_t * vPiLits = pMan->vLits;    // array of literals (0/1 PI values)
+    Vec_Int_t * vCiObjs = pMan->vCiObjs;  // cone leaves (CI obj IDs)
+    Vec_Int_t * vCoObjs = pMan->vCoObjs;  // cone roots (CO obj IDs)
+    Vec_Int_t * vCiVals = pMan->vCiVals;  // cone leaf values (0/1 CI values)
+    Vec_Int_t * vCoVals = pMan->vCoVals;  // cone root values (0/1 CO values)
+    Vec_Int_t * vNodes  = pMan->vNodes;   // cone nodes (node obj IDs)
+    Vec_Int_t * vCi2Rem = pMan->vCi2Rem;  // CIs to be removed (CI obj IDs)
+    Vec_Int_t * vRes    = pMan->vRes;     // final result (flop literals)
+    Aig_Obj_t * pObj;
+    word * pOk;
+    int i, j, w, iFlop, iCand, nLanes, iStart, nSurv, iFail, fFresh;
+    p->nCalls++;
+
+    // collect CO objects
+    Vec_IntClear( vCoObjs );
+    if ( pCube == NULL ) // the target is the property output
+        Vec_IntPush( vCoObjs, Aig_ObjId(Aig_ManCo(pAig, pMan->iOutCur)) );
+    else // the target is the cube
+    {
+        for ( i = 0; i < pCube->nLits; i++ )
+        {
+            if ( pCube->Lits[i] == -1 )
+                continue;
+            pObj = Saig_ManLi(pAig, (pCube->Lits[i] >> 1));
+            Vec_IntPush( vCoObjs, Aig_ObjId(pObj) );
+        }
+    }
+    // collect the cone and the values
+    Pdr_ManCollectCone( pAig, vCoObjs, vCiObjs, vNodes );
+    Pdr_ManCollectValues( pMan, k, vCiObjs, vCiVals );
+    Pdr_ManCollectValues( pMan, k, vCoObjs, vCoVals );
+
+    // assign simulation slots: constant, leaves, nodes
+    Vec_IntWriteEntry( p->vObj2Slot, 0, 0 );
+    Vec_IntForEachEntry( vCiObjs, iFlop, i )
+        Vec_IntWriteEntry( p->vObj2Slot, iFlop, i + 1 );
+    Vec_IntForEachEntry( vNodes, iFlop, i )
+        Vec_IntWriteEntry( p->vObj2Slot, iFlop, Vec_IntSize(vCiObjs) + i + 1 );
+    Vec_WrdFill( p->vSims, 2 * TXS4_WORDS_MAX * (1 + Vec_IntSize(vCiObjs) + Vec_IntSize(vNodes)), 0 );
+    Vec_WrdFill( p->vOk, TXS4_WORDS_MAX, 0 );
+    Vec_IntFill( p->vRemoved, Vec_IntSize(vCiObjs), 0 );
+
+    // iteratively remove flops
+    Txs4_ManOrderFlops( p, vCiObjs );
+    p->nFlops += Vec_IntSize(p->vFlops);
+    Vec_IntClear( vCi2Rem );
+    for ( iCand = 0; iCand < Vec_IntSize(p->vFlops); iCand += nLanes )
+    {
+        // try each candidate on top of the flops removed so far
+        nLanes = Abc_MinInt( 64 * TXS4_WORDS_MAX, Vec_IntSize(p->vFlops) - iCand );
+        Txs4_ManStartPass( p, nLanes );
+        for ( j = 0; j < nLanes; j++ )
+            Abc_TtSetBit( Txs4_ManMask(p, Txs4_ManCiSlot(p, Vec_IntEntry(p->vFlops, iCand + j))), j );
+        pOk = Txs4_ManSimulate( p, vCiObjs, vCiVals, vNodes, vCoObjs, vCoVals );
+        Vec_IntClear( p->vSurv );
+        for ( j = 0; j < nLanes; j++ )
+            if ( Abc_TtGetBit(pOk, j) )
+                Vec_IntPush( p->vSurv, Vec_IntEntry(p->vFlops, iCand + j) );
+        // try the prefixes of the survivors (lane i makes X survivors 0..i)
+        fFresh = 1;
+        for ( iStart = 0; iStart < Vec_IntSize(p->vSurv); iStart += iFail + 1 )
+        {
+            nSurv = Vec_IntSize(p->vSurv) - iStart;
+            // the first survivor was tested with the same removed flops
+            if ( fFresh && nSurv == 1 )
+            {
+                Txs4_ManRemove( p, Vec_IntEntry(p->vSurv, iStart), vCi2Rem );
+                break;
+            }
+            Txs4_ManStartPass( p, nSurv );
+            for ( i = 0; i < nSurv; i++ )
+            {
+                word * pMask = Txs4_ManMask( p, Txs4_ManCiSlot(p, Vec_IntEntry(p->vSurv, iStart + i)) );
+                for ( j = i; j & 63; j++ )
+                    Abc_TtSetBit( pMask, j );
+                for ( w = j >> 6; w < p->nWords; w++ )
+                    pMask[w] = ~(word)0;
+            }
+            pOk = Txs4_ManSimulate( p, vCiObjs, vCiVals, vNodes, vCoObjs, vCoVals );
+            for ( iFail = 0; iFail < nSurv; iFail++ )
+                if ( !Abc_TtGetBit(pOk, iFail) )
+                    break;
+            assert( iFail > 0 || !fFresh );
+            for ( i = 0; i < iFail; i++ )
+                Txs4_ManRemove( p, Vec_IntEntry(p->vSurv, iStart + i), vCi2Rem );
+            // the failed survivor stays, the remaining ones are tried again
+            fFresh &= (iFail == 0);
+        }
+    }
+    Vec_IntForEachEntry( vCiObjs, iFlop, i )
+        Vec_IntWriteEntry( p->vObj2Slot, iFlop, -1 );
+    Vec_IntForEachEntry( vNodes, iFlop, i )
+        Vec_IntWriteEntry( p->vObj2Slot, iFlop, -1 );
+
+    // derive the set of resulting registers
+    Pdr_ManDeriveResult( pAig, vCiObjs, vCiVals, vCi2Rem, vRes, vPiLits );
+    assert( Vec_IntSize(vRes) > 0 );
+
+    // move abstracted literals from flops to inputs
+    if ( pMan->pPars->fUseAbs && pMan->vAbsFlops )
+    {
+        int iLit, k = 0;
+        Vec_IntForEachEntry( vRes, iLit, i )
+        {
+            if ( Vec_IntEntry(pMan->vAbsFlops, Abc_Lit2Var(iLit)) ) // used flop
+                Vec_IntWriteEntry( vRes, k++, iLit );
+            else
+                Vec_IntPush( vPiLits, 2*Saig_ManPiNum(pAig) + iLit );
+        }
+        Vec_IntShrink( vRes, k );
+    }
+    return Pdr_SetCreate( vRes, vPiLits );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
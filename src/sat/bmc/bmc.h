@@ -112,6 +112,7 @@ struct Saig_ParBmc_t_
     int         fVerbose;       // verbose 
     int         fNotVerbose;    // skip line-by-line print-out 
     char *      pLogFileName;   // log file name
+    char *      pCkptFileName;  // checkpoint file name
     int         fSilent;        // completely silent
     int         iFrame;         // explored up to this frame
     int         nFailOuts;      // the number of failed outputs
@@ -133,6 +134,11 @@ struct Bmc_AndPar_t_
     int         nTimeOut;       // timeout in seconds
     int         nLutSize;       // LUT size for cut computation
     int         nProcs;         // the number of parallel solvers
+    int         nSolverType;    // SAT solver type (Bmc_SatType_t)
+    char *      pSolverTypes;   // comma-separated SAT solver names of the parallel solvers
+    int         fShareClauses;  // portfolio solving with sharing of learned clauses
+    int         fDeterm;        // deterministic portfolio solving
+    int         fCnfTemplate;   // instantiate the CNF of one timeframe in each frame
     int         fLoadCnf;       // dynamic CNF loading
     int         fDumpFrames;    // dump unrolled timeframes
     int         fUseSynth;      // use synthesis
@@ -196,10 +202,82 @@ struct Bmc_ParFf_t_
     int        fVerbose;
 };
 
+// pluggable SAT solvers
+
+typedef enum { 
+    BMC_SAT_BSAT = 0,               // 0: MiniSat-based solver (sat_solver)
+    BMC_SAT_BSAT3,                  // 1: modified MiniSat-based solver (sat_solver3)
+    BMC_SAT_SATOKO,                 // 2: Satoko
+    BMC_SAT_GLUCOSE,                // 3: Glucose 3.0
+    BMC_SAT_NUM                     // 4: the number of solver types
+} Bmc_SatType_t;
+
+// the literals are 2*Var+Compl; solving returns 1 (SAT), -1 (UNSAT), or 0 (undecided)
+typedef struct Bmc_SatFuncs_t_ Bmc_SatFuncs_t;
+struct Bmc_SatFuncs_t_
+{
+    char *      pName;                                               // solver name
+    void *   (* pStart)           ( void );                          // creates the solver
+    void     (* pStop)            ( void * s );                      // deletes the solver
+    void     (* pReset)           ( void * s );                      // removes all variables and clauses
+    int      (* pAddVar)          ( void * s );                      // adds a variable and returns its number
+    int      (* pAddClause)       ( void * s, int * pLits, int nLits ); // returns 0 if the problem became UNSAT
+    int      (* pSolve)           ( void * s, int * pLits, int nLits, int nConfLimit ); // the limit is relative (0 = no limit)
+    int      (* pFinal)           ( void * s, int ** ppLits );       // the final conflict in terms of negated assumptions
+    int      (* pVarValue)        ( void * s, int iVar );            // the value of the variable in the satisfying assignment
+    abctime  (* pSetRuntimeLimit) ( void * s, abctime Limit );       // sets the absolute runtime limit (0 = no limit)
+    void     (* pSetStop)         ( void * s, int * pStop );         // sets the external flag to terminate
+    void     (* pSetExport)       ( void * s, void * pMan, void(*pFunc)(void *, int *, int, int) ); // sets the callback receiving learned clauses
+    void     (* pDiversify)       ( void * s, int iSeed );           // perturbs the heuristics for portfolio solving
+    void     (* pSetInproc)       ( void * s, int fEnable );         // toggles inprocessing (ignored if not supported)
+    int      (* pSetLoader)       ( void * s, void * pMan, int(*pFunc)(void *, int) ); // sets the callback called when a literal is propagated for the first time (returns 0 if not supported)
+    int      (* pAddClauseLoad)   ( void * s, int * pLits, int nLits ); // adds a clause in the callback (the first literal is the negation of the propagated literal)
+    int      (* pVarNum)          ( void * s );
+    int      (* pClauseNum)       ( void * s );
+    int      (* pConflictNum)     ( void * s );
+};
+
+typedef struct Bmc_Sat_t_ Bmc_Sat_t;
+struct Bmc_Sat_t_
+{
+    int                    Type;            // solver type
+    const Bmc_SatFuncs_t * pFuncs;          // solver functions
+    void *                 pSolver;         // solver
+    int *                  pStop;           // external flag to terminate
+    void *                 pExportMan;      // the manager receiving learned clauses
+    void                (* pExportFunc)(void *, int *, int, int); // the callback receiving learned clauses
+    abctime                nRuntimeLimit;   // absolute runtime limit
+    int                    iSeed;           // diversification seed
+    int                    fInproc;         // inprocessing is enabled
+    void *                 pLoaderMan;      // the manager loading clauses lazily
+    int                 (* pLoaderFunc)(void *, int); // the callback loading clauses lazily
+};
+
+// portfolio of solvers exchanging short learned clauses
+typedef struct Bmc_Port_t_ Bmc_Port_t;
+
 ////////////////////////////////////////////////////////////////////////
 ///                      MACRO DEFINITIONS                           ///
 ////////////////////////////////////////////////////////////////////////
 
+static inline int     Bmc_SatAddVar( Bmc_Sat_t * p )                                { return p->pFuncs->pAddVar( p->pSolver );                          }
+static inline int     Bmc_SatAddClause( Bmc_Sat_t * p, int * pLits, int nLits )     { return p->pFuncs->pAddClause( p->pSolver, pLits, nLits );         }
+static inline int     Bmc_SatSolve( Bmc_Sat_t * p, int * pLits, int nLits, int nConfLimit ) { return p->pFuncs->pSolve( p->pSolver, pLits, nLits, nConfLimit ); }
+static inline int     Bmc_SatFinal( Bmc_Sat_t * p, int ** ppLits )                  { return p->pFuncs->pFinal( p->pSolver, ppLits );                   }
+static inline int     Bmc_SatVarValue( Bmc_Sat_t * p, int iVar )                    { return p->pFuncs->pVarValue( p->pSolver, iVar );                  }
+static inline int     Bmc_SatVarNum( Bmc_Sat_t * p )                                { return p->pFuncs->pVarNum( p->pSolver );                          }
+static inline int     Bmc_SatClauseNum( Bmc_Sat_t * p )                             { return p->pFuncs->pClauseNum( p->pSolver );                       }
+static inline int     Bmc_SatConflictNum( Bmc_Sat_t * p )                           { return p->pFuncs->pConflictNum( p->pSolver );                     }
+static inline char *  Bmc_SatName( Bmc_Sat_t * p )                                  { return p->pFuncs->pName;                                          }
+
+static inline void    Bmc_SatSetStop( Bmc_Sat_t * p, int * pStop )                  { p->pStop = pStop; p->pFuncs->pSetStop( p->pSolver, pStop );       }
+static inline void    Bmc_SatSetExport( Bmc_Sat_t * p, void * pMan, void(*pFunc)(void *, int *, int, int) ) { p->pExportMan = pMan; p->pExportFunc = pFunc; p->pFuncs->pSetExport( p->pSolver, pMan, pFunc ); }
+static inline abctime Bmc_SatSetRuntimeLimit( Bmc_Sat_t * p, abctime Limit )        { abctime Old = p->nRuntimeLimit; p->nRuntimeLimit = Limit; p->pFuncs->pSetRuntimeLimit( p->pSolver, Limit ); return Old; }
+static inline void    Bmc_SatDiversify( Bmc_Sat_t * p, int iSeed )                  { p->iSeed = iSeed; p->pFuncs->pDiversify( p->pSolver, iSeed );     }
+static inline void    Bmc_SatSetInproc( Bmc_Sat_t * p, int fEnable )                { p->fInproc = fEnable; p->pFuncs->pSetInproc( p->pSolver, fEnable ); }
+static inline int     Bmc_SatSetLoader( Bmc_Sat_t * p, void * pMan, int(*pFunc)(void *, int) ) { p->pLoaderMan = pMan; p->pLoaderFunc = pFunc; return p->pFuncs->pSetLoader( p->pSolver, pMan, pFunc ); }
+static inline int     Bmc_SatAddClauseLoad( Bmc_Sat_t * p, int * pLits, int nLits ) { return p->pFuncs->pAddClauseLoad( p->pSolver, pLits, nLits );     }
+
 ////////////////////////////////////////////////////////////////////////
 ///                    FUNCTION DECLARATIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -233,6 +311,24 @@ extern int               Bmc_CexVerify( Gia_Man_t * p, Abc_Cex_t * pCex, Abc_Cex
 /*=== bmcICheck.c ==========================================================*/
 extern void              Bmc_PerformICheck( Gia_Man_t * p, int nFramesMax, int nTimeOut, int fEmpty, int fVerbose );
 extern Vec_Int_t *       Bmc_PerformISearch( Gia_Man_t * p, int nFramesMax, int nTimeOut, int fReverse, int fBackTopo, int fDump, int fVerbose );
+/*=== bmcSat.c ==========================================================*/
+extern const Bmc_SatFuncs_t * Bmc_SatFuncs( int Type );
+extern int               Bmc_SatTypeFromName( char * pName );
+extern char *            Bmc_SatTypeName( int Type );
+extern char *            Bmc_SatTypeNames();
+extern int               Bmc_SatTypeFromList( char * pNames, int i );
+extern Bmc_Sat_t *       Bmc_SatStart( int Type );
+extern void              Bmc_SatStop( Bmc_Sat_t * p );
+extern void              Bmc_SatReset( Bmc_Sat_t * p );
+extern int               Bmc_SatNoSetLoader( void * s, void * pMan, int(*pFunc)(void *, int) );
+extern int               Bmc_SatNoAddClauseLoad( void * s, int * pLits, int nLits );
+/*=== bmcSat3.c ==========================================================*/
+extern const Bmc_SatFuncs_t Bmc_SatFuncsBsat3;
+/*=== bmcSatPort.c ==========================================================*/
+extern Bmc_Port_t *      Bmc_PortStart( Bmc_Sat_t ** pSats, int nSats, int nSizeMax, int nLbdMax, int fDeterm );
+extern void              Bmc_PortStop( Bmc_Port_t * p );
+extern int               Bmc_PortSolve( Bmc_Port_t * p, int * pLits, int nLits, int nConfLimit, int * piWinner );
+extern void              Bmc_PortPrintStats( Bmc_Port_t * p );
 /*=== bmcUnroll.c ==========================================================*/
 extern Unr_Man_t *       Unr_ManUnrollStart( Gia_Man_t * pGia, int fVerbose );
 extern Gia_Man_t *       Unr_ManUnrollFrame( Unr_Man_t * p, int f );
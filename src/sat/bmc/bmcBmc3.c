@@ -1447,6 +1447,168 @@ int Saig_ManCallSolver( Gia_ManBmc_t * p, int Lit )
         return sat_solver_solve( p->pSat, &Lit, &Lit + 1, (ABC_INT64_T)p->pPars->nConfLimit, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Saves the checkpoint after nFrames completed timeframes.]
+
+  Description [Besides the failed outputs, records the values of the
+  objects of these timeframes, which are fixed at the top level of the
+  SAT solver (the properties proved and the units learned).]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Saig_ManBmcCkptSave( Gia_ManBmc_t * p, int nFrames, abctime * pTimeLast, int fForce )
+{
+    Vec_Str_t * vStr;
+    Vec_Int_t * vUnits;
+    Aig_Obj_t * pObj;
+    int i, f, Lit, Value;
+    if ( p->pPars->pCkptFileName == NULL || !Saig_ManCkptTimeIsUp(pTimeLast, fForce) )
+        return;
+    vUnits = Vec_IntAlloc( 1000 );
+    // the frames resumed from the previous checkpoint may not be built in this run
+    for ( f = 0; p->pSat && f < nFrames && f < Vec_PtrSize(p->vId2Var); f++ )
+        Aig_ManForEachObj( p->pAig, pObj, i )
+        {
+            if ( Vec_IntEntry(p->vId2Num, i) < 0 )
+                continue;
+            Lit = Saig_ManBmcLiteral( p, pObj, f );
+            if ( Lit == ~0 || lit_var(Lit) == 0 || lit_var(Lit) >= sat_solver_nvars(p->pSat) )
+                continue;
+            Value = sat_solver_get_var_value( p->pSat, lit_var(Lit) );
+            if ( Value == l_Undef )
+                continue;
+            Vec_IntPushTwo( vUnits, f, Abc_Var2Lit(i, (Value == l_True) ^ lit_sign(Lit)) );
+        }
+    vStr = Saig_ManCkptStart( p->pAig, 'B', p->pPars->fSolveAll );
+    Vec_StrPutI( vStr, nFrames );
+    for ( i = 0; i < Saig_ManPoNum(p->pAig); i++ )
+    {
+        Vec_StrPutI( vStr, p->vCexes && Vec_PtrEntry(p->vCexes, i) );
+        if ( p->vCexes && Vec_PtrEntry(p->vCexes, i) )
+            Saig_ManCkptPutCex( vStr, (Abc_Cex_t *)Vec_PtrEntry(p->vCexes, i) );
+    }
+    Vec_StrPutI( vStr, Vec_IntSize(vUnits) / 2 );
+    Vec_IntForEachEntryDouble( vUnits, f, Lit, i )
+    {
+        Vec_StrPutI( vStr, f );
+        Vec_StrPutI( vStr, Lit );
+    }
+    if ( Saig_ManCkptWrite( vStr, p->pPars->pCkptFileName ) && p->pPars->fVerbose )
+        Abc_Print( 1, "Saved %d frames and %d units into checkpoint file \"%s\".\n", nFrames, Vec_IntSize(vUnits) / 2, p->pPars->pCkptFileName );
+    Vec_IntFree( vUnits );
+    Vec_StrFree( vStr );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Loads the checkpoint.]
+
+  Description [Returns the number of completed timeframes. Records the
+  failed outputs in the manager and returns the top-level values of the
+  objects as pairs (frame, object literal) in *pvUnits. Returns 0 if
+  the checkpoint is not valid.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Saig_ManBmcCkptLoad( Gia_ManBmc_t * p, Vec_Int_t ** pvUnits )
+{
+    Vec_Str_t * vStr;
+    Vec_Ptr_t * vCexes;
+    Vec_Int_t * vUnits;
+    Abc_Cex_t * pCex;
+    int i, f, iObjLit, nFrames, nUnits, Pos, nFailOuts = 0, fCorrupt = 0;
+    *pvUnits = NULL;
+    if ( p->pPars->pCkptFileName == NULL )
+        return 0;
+    vStr = Saig_ManCkptRead( p->pPars->pCkptFileName );
+    if ( vStr == NULL )
+        return 0;
+    if ( !Saig_ManCkptCheck( p->pAig, vStr, 'B', p->pPars->fSolveAll, &Pos ) )
+    {
+        Vec_StrFree( vStr );
+        return 0;
+    }
+    nFrames = Saig_ManCkptGetNum( vStr, &Pos, ABC_INFINITY );
+    vCexes  = Vec_PtrStart( Saig_ManPoNum(p->pAig) );
+    for ( i = 0; i < Saig_ManPoNum(p->pAig); i++ )
+    {
+        if ( Saig_ManCkptGetNum(vStr, &Pos, 2) != 1 )
+            continue;
+        pCex = Saig_ManCkptGetCex( p->pAig, vStr, &Pos );
+        Vec_PtrWriteEntry( vCexes, i, pCex );
+        if ( pCex == NULL || (pCex != (Abc_Cex_t *)(ABC_PTRINT_T)1 && pCex->iPo != i) )
+        {
+            fCorrupt = 1;
+            break;
+        }
+    }
+    nUnits = Saig_ManCkptGetCount( vStr, &Pos );
+    vUnits = Vec_IntAlloc( 2 * Abc_MaxInt(nUnits, 0) );
+    for ( i = 0; i < nUnits; i++ )
+    {
+        f       = Saig_ManCkptGetNum( vStr, &Pos, Abc_MaxInt(nFrames, 0) );
+        iObjLit = Saig_ManCkptGetNum( vStr, &Pos, 2 * Aig_ManObjNumMax(p->pAig) );
+        if ( f == -1 || iObjLit == -1 || Vec_IntEntry(p->vId2Num, Abc_Lit2Var(iObjLit)) < 0 )
+        {
+            fCorrupt = 1;
+            break;
+        }
+        Vec_IntPushTwo( vUnits, f, iObjLit );
+    }
+    if ( Pos != Vec_StrSize(vStr) || fCorrupt )
+    {
+        Abc_Print( 1, "The checkpoint file \"%s\" is truncated or corrupted.\n", p->pPars->pCkptFileName );
+        Vec_PtrForEachEntry( Abc_Cex_t *, vCexes, pCex, i )
+            Abc_CexFreeP( &pCex );
+        Vec_PtrFree( vCexes );
+        Vec_IntFree( vUnits );
+        Vec_StrFree( vStr );
+        return 0;
+    }
+    Vec_PtrForEachEntry( Abc_Cex_t *, vCexes, pCex, i )
+    {
+        if ( pCex == NULL )
+            continue;
+        if ( p->vCexes == NULL )
+            p->vCexes = Vec_PtrStart( Saig_ManPoNum(p->pAig) );
+        Vec_PtrWriteEntry( p->vCexes, i, pCex );
+        nFailOuts++;
+    }
+    p->pPars->nFailOuts += nFailOuts;
+    Vec_PtrFree( vCexes );
+    *pvUnits = vUnits;
+    if ( !p->pPars->fSilent )
+        Abc_Print( 1, "Resuming after %d frames in checkpoint file \"%s\" (%d failed outputs).\n", 
+            nFrames, p->pPars->pCkptFileName, p->pPars->nFailOuts );
+    Vec_StrFree( vStr );
+    return nFrames;
+}
+void Saig_ManBmcCkptAddUnits( Gia_ManBmc_t * p, Vec_Int_t * vUnits )
+{
+    int i, f, iObjLit, Lit, status;
+    Vec_IntForEachEntryDouble( vUnits, f, iObjLit, i )
+    {
+        Lit = Saig_ManBmcCreateCnf( p, Aig_ManObj(p->pAig, Abc_Lit2Var(iObjLit)), f );
+        if ( Lit < 2 )
+            continue;
+        Lit = Abc_LitNotCond( Lit, !Abc_LitIsCompl(iObjLit) );
+        if ( p->pSat2 )
+            status = satoko_add_clause( p->pSat2, &Lit, 1 );
+        else if ( p->pSat3 )
+            status = bmcg_sat_solver_addclause( p->pSat3, &Lit, 1 );
+        else
+            status = sat_solver_addclause( p->pSat, &Lit, &Lit + 1 );
+        assert( status );
+    }
+}
+
 /**Function*************************************************************
 
   Synopsis    [Bounded model checking engine.]
@@ -1465,10 +1627,11 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
     Abc_Cex_t * pCexNew, * pCexNew0;
     FILE * pLogFile = NULL;
     unsigned * pInfo;
-    int RetValue = -1, fFirst = 1, nJumpFrame = 0, fUnfinished = 0;
+    Vec_Int_t * vCkptUnits = NULL;
+    int RetValue = -1, fFirst = 1, nJumpFrame = 0, fUnfinished = 0, nResume = 0, nDone = 0;
     int nOutDigits = Abc_Base10Log( Saig_ManPoNum(pAig) );
     int i, f, k, Lit, status;
-    abctime clk, clk2, clkSatRun, clkOther = 0, clkTotal = Abc_Clock();
+    abctime clk, clk2, clkSatRun, clkOther = 0, clkTotal = Abc_Clock(), timeCkpt = Abc_Clock();
     abctime nTimeUnsat = 0, nTimeSat = 0, nTimeUndec = 0, clkOne = 0;
     abctime nTimeToStopNG, nTimeToStop;
     if ( pPars->pLogFileName )
@@ -1504,6 +1667,10 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
     }
     if ( pPars->fSolveAll && p->vCexes == NULL )
         p->vCexes = Vec_PtrStart( Saig_ManPoNum(pAig) );
+    // resume from the checkpoint
+    nResume = nDone = Saig_ManBmcCkptLoad( p, &vCkptUnits );
+    if ( pPars->nFailOuts )
+        RetValue = 0;
     if ( pPars->fVerbose )
     {
         Abc_Print( 1, "Running \"bmc3\". PI/PO/Reg = %d/%d/%d. And =%7d. Lev =%6d. ObjNums =%6d.\n",// Sect =%3d.\n", 
@@ -1575,8 +1742,14 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
                 Saig_ManBmcSimInfoSet( pInfo, pObj, SAIG_TER_ZER );
             }
         }
-        if ( (pPars->nStart && f < pPars->nStart) || (nJumpFrame && f < nJumpFrame) )
+        if ( (pPars->nStart && f < pPars->nStart) || (nJumpFrame && f < nJumpFrame) || f < nResume )
             continue;
+        // add the values of the resumed timeframes
+        if ( vCkptUnits )
+        {
+            Saig_ManBmcCkptAddUnits( p, vCkptUnits );
+            Vec_IntFreeP( &vCkptUnits );
+        }
         // create CNF upfront
         if ( pPars->fSolveAll )
         {
@@ -1860,6 +2033,11 @@ nTimeUndec += clkSatRun;
             Abc_Print( 1, "\n" );
             fflush( stdout );
         }
+        if ( !nJumpFrame )
+        {
+            nDone = f + 1;
+            Saig_ManBmcCkptSave( p, nDone, &timeCkpt, 0 );
+        }
     }
     // consider the next timeframe
     if ( nJumpFrame && pPars->nStart == 0 )
@@ -1877,6 +2055,9 @@ finish:
         Abc_Print( 1, "UNDEC = %.1f sec (%.1f %%)",   1.0*nTimeUndec/CLOCKS_PER_SEC, 100.0*nTimeUndec/(Abc_Clock() - clkTotal) );
         Abc_Print( 1, "\n" );
     }
+    if ( !nJumpFrame && (RetValue == -1 || pPars->fSolveAll) )
+        Saig_ManBmcCkptSave( p, nDone, &timeCkpt, 1 );
+    Vec_IntFreeP( &vCkptUnits );
     Saig_Bmc3ManStop( p );
     fflush( stdout );
     if ( pLogFile )
@@ -20,7 +20,6 @@
 
 #include "bmc.h"
 #include "sat/cnf/cnf.h"
-#include "sat/satoko/satoko.h"
 
 
 //#define ABC_USE_EXT_SOLVERS 1
@@ -34,14 +33,13 @@
     #define l_Undef  0
     #define l_True   1
     #define l_False -1
-    #define bmc_sat_solver                     satoko_t
-    #define bmc_sat_solver_start(type)         satoko_create()
-    #define bmc_sat_solver_stop                satoko_destroy
-    #define bmc_sat_solver_addclause           satoko_add_clause
-    #define bmc_sat_solver_addvar(s)           satoko_add_variable(s, 0)
-    #define bmc_sat_solver_solve               satoko_solve_assumptions
-    #define bmc_sat_solver_read_cex_varvalue   satoko_read_cex_varvalue
-    #define bmc_sat_solver_setstop             satoko_set_stop
+    #define bmc_sat_solver                     Bmc_Sat_t
+    #define bmc_sat_solver_start(type)         Bmc_SatStart(type)
+    #define bmc_sat_solver_stop                Bmc_SatStop
+    #define bmc_sat_solver_addclause           Bmc_SatAddClause
+    #define bmc_sat_solver_addvar(s)           Bmc_SatAddVar(s)
+    #define bmc_sat_solver_read_cex_varvalue   Bmc_SatVarValue
+    #define bmc_sat_solver_setstop             Bmc_SatSetStop
 #endif
 
 
@@ -80,6 +78,10 @@ struct Bmcs_Man_t_
     int               nSatVars;            // number of SAT variables used
     int               nSatVarsOld;         // number of SAT variables used
     int               fStopNow;            // signal when it is time to stop
+    Cnf_Dat_t *       pTemp;               // CNF of the transition relation (object IDs are variables)
+    Vec_Int_t         vTempLits;           // SAT literals of the objects in the last timeframe
+    Vec_Int_t         vTempOuts;           // SAT literals of the POs in each timeframe
+    Vec_Int_t         vTempPis;            // SAT variables of the PIs in each timeframe
     abctime           timeUnf;             // runtime of unfolding
     abctime           timeCnf;             // runtime of CNF generation
     abctime           timeSat;             // runtime of the solvers
@@ -89,6 +91,29 @@ struct Bmcs_Man_t_
 //static inline int * Bmcs_ManCopies( Bmcs_Man_t * p, int f ) { return (int*)Vec_PtrEntry(&p->vGia2Fr, f % Vec_PtrSize(&p->vGia2Fr)); }
 static inline int * Bmcs_ManCopies( Bmcs_Man_t * p, int f ) { return (int*)Vec_PtrEntry(&p->vGia2Fr, f); }
 
+// the SAT literal of the given PO in the given timeframe
+static inline int Bmcs_ManOutLit( Bmcs_Man_t * p, int f, int i )
+{
+    int iObj;
+    if ( p->pTemp )
+        return Vec_IntEntry( &p->vTempOuts, f * Gia_ManPoNum(p->pGia) + i );
+    iObj = Gia_ObjId( p->pFrames, Gia_ManCo(p->pFrames, f * Gia_ManPoNum(p->pGia) + i) );
+    return Abc_Var2Lit( Vec_IntEntry(&p->vFr2Sat, iObj), 0 );
+}
+
+// the conflict limit is global for the solver, rather than for each call
+static inline int Bmcs_ManSolve( bmc_sat_solver * pSat, int * pLits, int nLits, int nConfLimit )
+{
+#ifdef ABC_USE_EXT_SOLVERS
+    return bmc_sat_solver_solve( pSat, pLits, nLits );
+#else
+    int nConfLeft = nConfLimit ? nConfLimit - Bmc_SatConflictNum(pSat) : 0;
+    if ( nConfLimit && nConfLeft <= 0 )
+        return l_Undef;
+    return Bmc_SatSolve( pSat, pLits, nLits, nConfLeft );
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -351,6 +376,114 @@ int Gia_ManCountRanks( Gia_Man_t * p )
 }
 
 
+/**Function*************************************************************
+
+  Synopsis    [Derives the CNF of the transition relation.]
+
+  Description [The CNF is derived once using object IDs as variables.
+  It is instantiated in each timeframe by Bmcs_ManAddTempCnf() instead of
+  unfolding the new timeframes and deriving their CNF.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmcs_ManDeriveTemp( Bmcs_Man_t * p )
+{
+    abctime clk = Abc_Clock();
+    // mapping changes the manager, so it is performed on a copy with the same object IDs
+    Gia_Man_t * pDup = Gia_ManDup( p->pGia );
+    assert( Gia_ManObjNum(pDup) == Gia_ManObjNum(p->pGia) );
+    p->pTemp = (Cnf_Dat_t *)Mf_ManGenerateCnf( pDup, 8, 1, 0, 0, 0 );
+    pDup->pData = NULL;
+    Gia_ManStop( pDup );
+    Vec_IntFill( &p->vTempLits, Gia_ManObjNum(p->pGia), -1 );
+    p->timeCnf += Abc_Clock() - clk;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Instantiates the CNF of the transition relation.]
+
+  Description [Maps the objects into SAT literals: the mapped nodes and 
+  the PIs get new variables, the flop outputs get the literals of the flop 
+  inputs in the previous frame (or constant 0 in the first frame), and the 
+  COs get the literals of their drivers. The clauses are copied with the 
+  constants and the duplicated literals removed.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Bmcs_ManTempClause( int * pMap, int * pBeg, int * pEnd, int * pOut )
+{
+    int * pLit, k, nLits = 0;
+    for ( pLit = pBeg; pLit < pEnd; pLit++ )
+    {
+        int Lit = Abc_Lit2LitL( pMap, *pLit );
+        if ( Lit == 1 ) // constant 1
+            return 0;
+        if ( Lit == 0 ) // constant 0
+            continue;
+        for ( k = 0; k < nLits; k++ )
+            if ( Abc_Lit2Var(pOut[k]) == Abc_Lit2Var(Lit) )
+                break;
+        if ( k == nLits )
+            pOut[nLits++] = Lit;
+        else if ( pOut[k] != Lit ) // tautology
+            return 0;
+    }
+    assert( nLits > 0 );
+    return nLits;
+}
+Cnf_Dat_t * Bmcs_ManAddTempCnf( Bmcs_Man_t * p, int f, int nFramesAdd )
+{
+    abctime clk = Abc_Clock();
+    Cnf_Dat_t * pTemp = p->pTemp, * pCnf;
+    Gia_Obj_t * pObj, * pObjRi;
+    int * pMap = Vec_IntArray( &p->vTempLits );
+    int i, k, iCla = 0, iLit = 0;
+    pCnf = ABC_CALLOC( Cnf_Dat_t, 1 );
+    pCnf->pClauses    = ABC_ALLOC( int *, nFramesAdd * pTemp->nClauses + 1 );
+    pCnf->pClauses[0] = ABC_ALLOC( int, nFramesAdd * pTemp->nLiterals + 1 );
+    for ( k = 0; k < nFramesAdd; k++ )
+    {
+        // flop outputs take the values of flop inputs in the previous frame
+        Gia_ManForEachRiRo( p->pGia, pObjRi, pObj, i )
+            pMap[Gia_ObjId(p->pGia, pObj)] = f+k ? pMap[Gia_ObjId(p->pGia, pObjRi)] : 0;
+        pMap[0] = 0;
+        Gia_ManForEachPi( p->pGia, pObj, i )
+        {
+            Vec_IntPush( &p->vTempPis, p->nSatVars );
+            pMap[Gia_ObjId(p->pGia, pObj)] = Abc_Var2Lit( p->nSatVars++, 0 );
+        }
+        Gia_ManForEachAnd( p->pGia, pObj, i )
+            if ( pTemp->pObj2Count[i] > 0 )
+                pMap[i] = Abc_Var2Lit( p->nSatVars++, 0 );
+        Gia_ManForEachCo( p->pGia, pObj, i )
+            pMap[Gia_ObjId(p->pGia, pObj)] = Abc_LitNotCond( pMap[Gia_ObjFaninId0p(p->pGia, pObj)], Gia_ObjFaninC0(pObj) );
+        Gia_ManForEachPo( p->pGia, pObj, i )
+            Vec_IntPush( &p->vTempOuts, pMap[Gia_ObjId(p->pGia, pObj)] );
+        // instantiate the clauses
+        for ( i = 0; i < pTemp->nClauses; i++ )
+        {
+            int nLits = Bmcs_ManTempClause( pMap, pTemp->pClauses[i], pTemp->pClauses[i+1], pCnf->pClauses[0] + iLit );
+            if ( nLits == 0 )
+                continue;
+            pCnf->pClauses[iCla++] = pCnf->pClauses[0] + iLit;
+            iLit += nLits;
+        }
+    }
+    pCnf->nVars     = p->nSatVars;
+    pCnf->nClauses  = iCla;
+    pCnf->nLiterals = iLit;
+    pCnf->pClauses[iCla] = pCnf->pClauses[0] + iLit;
+    p->timeCnf += Abc_Clock() - clk;
+    return pCnf;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -366,9 +499,6 @@ Bmcs_Man_t * Bmcs_ManStart( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
 {
     Bmcs_Man_t * p = ABC_CALLOC( Bmcs_Man_t, 1 ); 
     int i, Lit = Abc_Var2Lit( 0, 1 );
-    satoko_opts_t opts;
-    satoko_default_opts(&opts);
-    opts.conf_limit = pPars->nConfLimit;
     assert( Gia_ManRegNum(pGia) > 0 );
     p->pPars   = pPars;
     p->pGia    = pGia;
@@ -383,27 +513,33 @@ Bmcs_Man_t * Bmcs_ManStart( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
     Vec_IntGrow( &p->vCiMap, 3*Gia_ManCiNum(pGia) );
     for ( i = 0; i < pPars->nProcs; i++ )
     {
-        // modify parameters to get different SAT solvers
-        opts.f_rst = 0.8 - i * 0.05;
-        opts.b_rst = 1.4 - i * 0.05;
-        opts.garbage_max_ratio = (float) 0.3 + i * 0.05;
         // create SAT solvers
-        p->pSats[i] = bmc_sat_solver_start( i );  
 #ifdef ABC_USE_EXT_SOLVERS
+        p->pSats[i] = bmc_sat_solver_start( i );  
         p->pSats[i]->SolverType = i;
 #else
-        satoko_configure(p->pSats[i], &opts);
+        p->pSats[i] = bmc_sat_solver_start( pPars->pSolverTypes ? Bmc_SatTypeFromList(pPars->pSolverTypes, i) : pPars->nSolverType );  
+        // modify parameters to get different SAT solvers
+        Bmc_SatDiversify( p->pSats[i], i );
+        if ( pPars->fUseEliminate )
+            Bmc_SatSetInproc( p->pSats[i], 1 );
 #endif
         bmc_sat_solver_addvar( p->pSats[i] );
         bmc_sat_solver_addclause( p->pSats[i], &Lit, 1 );  
         bmc_sat_solver_setstop( p->pSats[i], &p->fStopNow );
     }
     p->nSatVars = 1;
+    if ( pPars->fCnfTemplate )
+        Bmcs_ManDeriveTemp( p );
     return p;
 }
 void Bmcs_ManStop( Bmcs_Man_t * p )
 {
     int i;
+    Cnf_DataFree( p->pTemp );
+    Vec_IntErase( &p->vTempLits );
+    Vec_IntErase( &p->vTempOuts );
+    Vec_IntErase( &p->vTempPis );
     Gia_ManStopP( &p->pFrames );
     Gia_ManStopP( &p->pClean );
     Vec_PtrFreeData( &p->vGia2Fr );
@@ -537,10 +673,13 @@ Gia_Man_t * Bmcs_ManUnfold( Bmcs_Man_t * p, int f, int nFramesAdd )
 Cnf_Dat_t * Bmcs_ManAddNewCnf( Bmcs_Man_t * p, int f, int nFramesAdd )
 {
     abctime clk = Abc_Clock();
-    Gia_Man_t * pNew = Bmcs_ManUnfold( p, f, nFramesAdd );
+    Gia_Man_t * pNew;
     Cnf_Dat_t * pCnf;
     Gia_Obj_t * pObj; 
     int i, iVar, * pMap;
+    if ( p->pTemp )
+        return Bmcs_ManAddTempCnf( p, f, nFramesAdd );
+    pNew = Bmcs_ManUnfold( p, f, nFramesAdd );
     p->timeUnf += Abc_Clock() - clk;
     if ( pNew == NULL )
         return NULL;
@@ -583,10 +722,9 @@ void Bmcs_ManPrintFrame( Bmcs_Man_t * p, int f, int nClauses, int Solver, abctim
         return;
     Abc_Print( 1, "%4d %s : ", f,   fUnfinished ? "-" : "+" );
 #ifndef ABC_USE_EXT_SOLVERS
-    Abc_Print( 1, "Var =%8.0f.  ",  (double)satoko_varnum(p->pSats[0]) ); 
-    Abc_Print( 1, "Cla =%9.0f.  ",  (double)satoko_clausenum(p->pSats[0]) );  
-    Abc_Print( 1, "Learn =%9.0f.  ",(double)satoko_learntnum(p->pSats[0]) );  
-    Abc_Print( 1, "Conf =%9.0f.  ", (double)satoko_conflictnum(p->pSats[0]) );  
+    Abc_Print( 1, "Var =%8.0f.  ",  (double)Bmc_SatVarNum(p->pSats[0]) ); 
+    Abc_Print( 1, "Cla =%9.0f.  ",  (double)Bmc_SatClauseNum(p->pSats[0]) );  
+    Abc_Print( 1, "Conf =%9.0f.  ", (double)Bmc_SatConflictNum(p->pSats[0]) );  
 #else
     Abc_Print( 1, "Var =%8.0f.  ",  (double)p->nSatVars ); 
     Abc_Print( 1, "Cla =%9.0f.  ",  (double)nClauses );  
@@ -612,7 +750,15 @@ void Bmcs_ManPrintTime( Bmcs_Man_t * p )
 Abc_Cex_t * Bmcs_ManGenerateCex( Bmcs_Man_t * p, int i, int f, int s )
 {
     Abc_Cex_t * pCex = Abc_CexMakeTriv( Gia_ManRegNum(p->pGia), Gia_ManPiNum(p->pGia), Gia_ManPoNum(p->pGia), f*Gia_ManPoNum(p->pGia)+i );
-    Gia_Obj_t * pObj;  int k;
+    Gia_Obj_t * pObj;  int k, iVar;
+    if ( p->pTemp )
+    {
+        // the PI variables are recorded in the order of timeframes and PIs
+        Vec_IntForEachEntryStop( &p->vTempPis, iVar, k, (f+1) * Gia_ManPiNum(p->pGia) )
+            if ( bmc_sat_solver_read_cex_varvalue(p->pSats[s], iVar) )
+                Abc_InfoSetBit( pCex->pData, Gia_ManRegNum(p->pGia) + k );
+        return pCex;
+    }
     Gia_ManForEachPi( p->pFrames, pObj, k )
     {
         int iSatVar = Vec_IntEntry( &p->vFr2Sat, Gia_ObjId(p->pFrames, pObj) );
@@ -656,17 +802,16 @@ int Bmcs_ManPerformOne( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
         Bmcs_ManAddCnf( p, p->pSats[0], pCnf );
         p->nSatVarsOld = p->nSatVars;
         Cnf_DataFree( pCnf );
-        assert( Gia_ManPoNum(p->pFrames) == (f + pPars->nFramesAdd) * Gia_ManPoNum(pGia) );
+        assert( p->pTemp || Gia_ManPoNum(p->pFrames) == (f + pPars->nFramesAdd) * Gia_ManPoNum(pGia) );
         for ( k = 0; k < pPars->nFramesAdd; k++ )
         {
             for ( i = 0; i < Gia_ManPoNum(pGia); i++ )
             {
                 abctime clk = Abc_Clock();
-                int iObj = Gia_ObjId( p->pFrames, Gia_ManCo(p->pFrames, (f+k) * Gia_ManPoNum(pGia) + i) );
-                int iLit = Abc_Var2Lit( Vec_IntEntry(&p->vFr2Sat, iObj), 0 );
+                int iLit = Bmcs_ManOutLit( p, f+k, i );
                 if ( pPars->nTimeOut && (Abc_Clock() - clkStart)/CLOCKS_PER_SEC >= pPars->nTimeOut )
                     break;
-                status = bmc_sat_solver_solve( p->pSats[0], &iLit, 1 );
+                status = Bmcs_ManSolve( p->pSats[0], &iLit, 1, pPars->nConfLimit );
                 p->timeSat += Abc_Clock() - clk;
                 if ( status == l_False ) // unsat
                 {
@@ -733,6 +878,7 @@ int Bmcs_ManPerformMulti( Gia_Man_t * pGia, Bmc_AndPar_t * pPars ) { return Bmcs
 typedef struct Par_ThData_t_
 {
     bmc_sat_solver *  pSat;
+    int         nConfLimit;
     int         iLit;
     int         iThread;
     int         fWorking;
@@ -754,7 +900,7 @@ void * Bmcs_ManWorkerThread( void * pArg )
             return NULL;
         }
 
-        pThData->status = bmc_sat_solver_solve( pThData->pSat, &pThData->iLit, 1 );
+        pThData->status = Bmcs_ManSolve( pThData->pSat, &pThData->iLit, 1, pThData->nConfLimit );
 
         //printf( "Thread %d finished with status %d\n", pThData->iThread, pThData->status );
 
@@ -815,12 +961,19 @@ int Bmcs_ManPerformMulti( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
     pthread_t WorkerThread[PAR_THR_MAX];
     Par_ThData_t ThData[PAR_THR_MAX];
     Bmcs_Man_t * p = Bmcs_ManStart( pGia, pPars );
+    Bmc_Port_t * pPort = NULL;
     int f, k = 0, i = Gia_ManPoNum(pGia), status, RetValue = -1, nClauses = 0, Solver = 0;
     Abc_CexFreeP( &pGia->pCexSeq );
+#ifndef ABC_USE_EXT_SOLVERS
+    // the solvers share clauses with at most 8 literals and LBD at most 4
+    if ( pPars->fShareClauses || pPars->fDeterm )
+        pPort = Bmc_PortStart( p->pSats, pPars->nProcs, 8, 4, pPars->fDeterm );
+#endif
     // start threads
-    for ( i = 0; i < pPars->nProcs; i++ )
+    for ( i = 0; !pPort && i < pPars->nProcs; i++ )
     {
         ThData[i].pSat     = p->pSats[i];
+        ThData[i].nConfLimit = pPars->nConfLimit;
         ThData[i].iLit     = -1;
         ThData[i].iThread  =  i;
         ThData[i].fWorking =  0;
@@ -847,16 +1000,20 @@ int Bmcs_ManPerformMulti( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
         p->nSatVarsOld = p->nSatVars;
         Cnf_DataFree( pCnf );
         // solve outputs
-        assert( Gia_ManPoNum(p->pFrames) == (f + pPars->nFramesAdd) * Gia_ManPoNum(pGia) );
+        assert( p->pTemp || Gia_ManPoNum(p->pFrames) == (f + pPars->nFramesAdd) * Gia_ManPoNum(pGia) );
         for ( k = 0; k < pPars->nFramesAdd; k++ )
         {
             for ( i = 0; i < Gia_ManPoNum(pGia); i++ )
             {
                 abctime clk = Abc_Clock();
-                int iObj = Gia_ObjId( p->pFrames, Gia_ManCo(p->pFrames, (f+k) * Gia_ManPoNum(pGia) + i) );
-                int iLit = Abc_Var2Lit( Vec_IntEntry(&p->vFr2Sat, iObj), 0 );
+                int iLit = Bmcs_ManOutLit( p, f+k, i );
                 if ( pPars->nTimeOut && (Abc_Clock() - clkStart)/CLOCKS_PER_SEC >= pPars->nTimeOut )
                     break;
+#ifndef ABC_USE_EXT_SOLVERS
+                if ( pPort )
+                    status = Bmc_PortSolve( pPort, &iLit, 1, pPars->nConfLimit, &Solver );
+                else
+#endif
                 status = Bmcs_ManPerform_Solve( p, iLit, WorkerThread, ThData, pPars->nProcs, &Solver );
                 p->timeSat += Abc_Clock() - clk;
                 if ( status == l_False ) // unsat
@@ -893,7 +1050,7 @@ int Bmcs_ManPerformMulti( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
             break;
     }
     // stop threads
-    for ( i = 0; i < pPars->nProcs; i++ )
+    for ( i = 0; !pPort && i < pPars->nProcs; i++ )
     {
         assert( !ThData[i].fWorking );
         ThData[i].pSat = NULL;
@@ -904,6 +1061,12 @@ int Bmcs_ManPerformMulti( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
         printf( "No output failed in %d frames.  ", f + (k < pPars->nFramesAdd ? k+1 : 0) );
     Abc_PrintTime( 1, "Time", Abc_Clock() - clkStart );
     Bmcs_ManPrintTime( p );
+#ifndef ABC_USE_EXT_SOLVERS
+    if ( pPort && pPars->fVerbose )
+        Bmc_PortPrintStats( pPort );
+    if ( pPort )
+        Bmc_PortStop( pPort );
+#endif
     Bmcs_ManStop( p );
     return RetValue;
 }
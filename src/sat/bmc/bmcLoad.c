@@ -169,10 +169,7 @@ void Bmc_LoadTest( Gia_Man_t * pGia, int fLoadCnf, int fVerbose )
     p = Bmc_LoadStart( pGia );
     // add callback for CNF loading
     if ( fLoadCnf )
-    {
-        p->pSat->pCnfMan  = p;
-        p->pSat->pCnfFunc = Bmc_LoadAddCnf;
-    }
+        sat_solver_set_loader( p->pSat, p, Bmc_LoadAddCnf );
     // solve SAT problem for each PO
     Gia_ManForEachPo( pGia, pObj, i )
     {
@@ -0,0 +1,362 @@
+/**CFile****************************************************************
+
+  FileName    [bmcSat.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [SAT-based bounded model checking.]
+
+  Synopsis    [Unified interface to the incremental SAT solvers.]
+
+  Author      [agent]
+
+  Date        [Ver. 1.0. Started - October 16, 2026.]
+
+  Revision    [$Id: bmcSat.c,v 1.00 2026/10/16 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "bmc.h"
+#include "sat/bsat/satSolver.h"
+#include "sat/satoko/satoko.h"
+#include "sat/glucose/AbcGlucose.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Placeholders for the solvers without lazy CNF loading.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmc_SatNoSetLoader( void * s, void * pMan, int(*pFunc)(void *, int) )   { return 0;                                                                  }
+int Bmc_SatNoAddClauseLoad( void * s, int * pLits, int nLits )             { assert( 0 ); return 0;                                                     }
+
+/**Function*************************************************************
+
+  Synopsis    [Adapter for sat_solver.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void *  Bmc_SatBsatStart( void )                                  { return sat_solver_new();                                                   }
+static void    Bmc_SatBsatStop( void * s )                               { sat_solver_delete( (sat_solver *)s );                                      }
+static void    Bmc_SatBsatReset( void * s )                              { sat_solver_restart( (sat_solver *)s );                                     }
+static int     Bmc_SatBsatAddVar( void * s )                             { return sat_solver_addvar( (sat_solver *)s );                               }
+static int     Bmc_SatBsatAddClause( void * s, int * pLits, int nLits )  { return sat_solver_addclause( (sat_solver *)s, pLits, pLits + nLits );      }
+static int     Bmc_SatBsatFinal( void * s, int ** ppLits )               { return sat_solver_final( (sat_solver *)s, ppLits );                        }
+static int     Bmc_SatBsatVarValue( void * s, int iVar )                 { return sat_solver_var_value( (sat_solver *)s, iVar );                      }
+static abctime Bmc_SatBsatSetRuntimeLimit( void * s, abctime Limit )     { return sat_solver_set_runtime_limit( (sat_solver *)s, Limit );             }
+static void    Bmc_SatBsatSetStop( void * s, int * pStop )               { sat_solver_set_stop( (sat_solver *)s, pStop );                             }
+static void    Bmc_SatBsatSetExport( void * s, void * pMan, void(*pFunc)(void *, int *, int, int) ) { sat_solver_set_export( (sat_solver *)s, pMan, pFunc ); }
+static int     Bmc_SatBsatVarNum( void * s )                             { return sat_solver_nvars( (sat_solver *)s );                                }
+static int     Bmc_SatBsatClauseNum( void * s )                          { return sat_solver_nclauses( (sat_solver *)s );                             }
+static int     Bmc_SatBsatConflictNum( void * s )                        { return sat_solver_nconflicts( (sat_solver *)s );                           }
+static int     Bmc_SatBsatSolve( void * s, int * pLits, int nLits, int nConfLimit )
+{
+    int status = sat_solver_solve( (sat_solver *)s, pLits, pLits + nLits, (ABC_INT64_T)nConfLimit, 0, 0, 0 );
+    return status == l_True ? 1 : status == l_False ? -1 : 0;
+}
+static void    Bmc_SatBsatDiversify( void * s, int iSeed )
+{
+    sat_solver * pSat = (sat_solver *)s;
+    if ( iSeed == 0 )
+        return;
+    pSat->random_seed = 91648253 + 1000 * iSeed;
+    pSat->fNotUseRandom = 0;
+}
+static void    Bmc_SatBsatSetInproc( void * s, int fEnable )             {                                                                            }
+static int     Bmc_SatBsatSetLoader( void * s, void * pMan, int(*pFunc)(void *, int) ) { sat_solver_set_loader( (sat_solver *)s, pMan, pFunc ); return 1; }
+static int     Bmc_SatBsatAddClauseLoad( void * s, int * pLits, int nLits )
+{
+    sat_solver * pSat = (sat_solver *)s;
+    int i, iVarMax = 0;
+    assert( nLits > 1 );
+    for ( i = 0; i < nLits; i++ )
+        iVarMax = Abc_MaxInt( iVarMax, Abc_Lit2Var(pLits[i]) );
+    sat_solver_setnvars( pSat, iVarMax + 1 );
+    sat_solver_clause_new( pSat, pLits, pLits + nLits, 0 );
+    return 1;
+}
+static const Bmc_SatFuncs_t Bmc_SatFuncsBsat = {
+    "bsat",
+    Bmc_SatBsatStart,
+    Bmc_SatBsatStop,
+    Bmc_SatBsatReset,
+    Bmc_SatBsatAddVar,
+    Bmc_SatBsatAddClause,
+    Bmc_SatBsatSolve,
+    Bmc_SatBsatFinal,
+    Bmc_SatBsatVarValue,
+    Bmc_SatBsatSetRuntimeLimit,
+    Bmc_SatBsatSetStop,
+    Bmc_SatBsatSetExport,
+    Bmc_SatBsatDiversify,
+    Bmc_SatBsatSetInproc,
+    Bmc_SatBsatSetLoader,
+    Bmc_SatBsatAddClauseLoad,
+    Bmc_SatBsatVarNum,
+    Bmc_SatBsatClauseNum,
+    Bmc_SatBsatConflictNum
+};
+
+/**Function*************************************************************
+
+  Synopsis    [Adapter for Satoko.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void *  Bmc_SatSatokoStart( void )                                { return satoko_create();                                                    }
+static void    Bmc_SatSatokoStop( void * s )                             { satoko_destroy( (satoko_t *)s );                                           }
+static void    Bmc_SatSatokoReset( void * s )                            { satoko_reset( (satoko_t *)s );                                             }
+static int     Bmc_SatSatokoAddVar( void * s )                           { return satoko_add_variable( (satoko_t *)s, 0 );                            }
+static int     Bmc_SatSatokoAddClause( void * s, int * pLits, int nLits ){ return satoko_add_clause( (satoko_t *)s, pLits, nLits ) == SATOKO_OK;     }
+static int     Bmc_SatSatokoSolve( void * s, int * pLits, int nLits, int nConfLimit ) { return satoko_solve_assumptions_limit( (satoko_t *)s, pLits, nLits, nConfLimit ); }
+static int     Bmc_SatSatokoFinal( void * s, int ** ppLits )             { return satoko_final_conflict( (satoko_t *)s, ppLits );                     }
+static int     Bmc_SatSatokoVarValue( void * s, int iVar )               { return satoko_read_cex_varvalue( (satoko_t *)s, iVar );                    }
+static abctime Bmc_SatSatokoSetRuntimeLimit( void * s, abctime Limit )   { return satoko_set_runtime_limit( (satoko_t *)s, Limit );                   }
+static void    Bmc_SatSatokoSetStop( void * s, int * pStop )             { satoko_set_stop( (satoko_t *)s, pStop );                                   }
+static void    Bmc_SatSatokoSetExport( void * s, void * pMan, void(*pFunc)(void *, int *, int, int) ) { satoko_set_export( (satoko_t *)s, pMan, pFunc ); }
+static int     Bmc_SatSatokoVarNum( void * s )                           { return satoko_varnum( (satoko_t *)s );                                     }
+static int     Bmc_SatSatokoClauseNum( void * s )                        { return satoko_clausenum( (satoko_t *)s );                                  }
+static int     Bmc_SatSatokoConflictNum( void * s )                      { return satoko_conflictnum( (satoko_t *)s );                                }
+static void    Bmc_SatSatokoDiversify( void * s, int iSeed )
+{
+    // modify parameters to get different SAT solvers (similar to &bmcs)
+    satoko_opts_t * pOpts = satoko_options( (satoko_t *)s );
+    pOpts->f_rst = 0.8 - iSeed * 0.05;
+    pOpts->b_rst = 1.4 - iSeed * 0.05;
+    pOpts->garbage_max_ratio = (float) 0.3 + iSeed * 0.05;
+}
+static void    Bmc_SatSatokoSetInproc( void * s, int fEnable )
+{
+    // the first inprocessing is delayed to skip easy problems
+    satoko_options( (satoko_t *)s )->inproc_first = fEnable ? 5000 : 0;
+}
+static const Bmc_SatFuncs_t Bmc_SatFuncsSatoko = {
+    "satoko",
+    Bmc_SatSatokoStart,
+    Bmc_SatSatokoStop,
+    Bmc_SatSatokoReset,
+    Bmc_SatSatokoAddVar,
+    Bmc_SatSatokoAddClause,
+    Bmc_SatSatokoSolve,
+    Bmc_SatSatokoFinal,
+    Bmc_SatSatokoVarValue,
+    Bmc_SatSatokoSetRuntimeLimit,
+    Bmc_SatSatokoSetStop,
+    Bmc_SatSatokoSetExport,
+    Bmc_SatSatokoDiversify,
+    Bmc_SatSatokoSetInproc,
+    Bmc_SatNoSetLoader,
+    Bmc_SatNoAddClauseLoad,
+    Bmc_SatSatokoVarNum,
+    Bmc_SatSatokoClauseNum,
+    Bmc_SatSatokoConflictNum
+};
+
+/**Function*************************************************************
+
+  Synopsis    [Adapter for Glucose.]
+
+  Description [Glucose does not expose its heuristics through the C API,
+  so diversification is not supported.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void *  Bmc_SatGlucoseStart( void )                               { return bmcg_sat_solver_start();                                            }
+static void    Bmc_SatGlucoseStop( void * s )                            { bmcg_sat_solver_stop( (bmcg_sat_solver *)s );                              }
+static void    Bmc_SatGlucoseReset( void * s )                           { bmcg_sat_solver_reset( (bmcg_sat_solver *)s );                             }
+static int     Bmc_SatGlucoseAddVar( void * s )                          { return bmcg_sat_solver_addvar( (bmcg_sat_solver *)s );                     }
+static int     Bmc_SatGlucoseAddClause( void * s, int * pLits, int nLits ) { return bmcg_sat_solver_addclause( (bmcg_sat_solver *)s, pLits, nLits );  }
+static int     Bmc_SatGlucoseFinal( void * s, int ** ppLits )            { return bmcg_sat_solver_final( (bmcg_sat_solver *)s, ppLits );              }
+static int     Bmc_SatGlucoseVarValue( void * s, int iVar )              { return bmcg_sat_solver_read_cex_varvalue( (bmcg_sat_solver *)s, iVar );    }
+static abctime Bmc_SatGlucoseSetRuntimeLimit( void * s, abctime Limit )  { return bmcg_sat_solver_set_runtime_limit( (bmcg_sat_solver *)s, Limit );  }
+static void    Bmc_SatGlucoseSetStop( void * s, int * pStop )            { bmcg_sat_solver_set_stop( (bmcg_sat_solver *)s, pStop );                   }
+static void    Bmc_SatGlucoseSetExport( void * s, void * pMan, void(*pFunc)(void *, int *, int, int) ) { bmcg_sat_solver_set_export( (bmcg_sat_solver *)s, pMan, pFunc ); }
+static void    Bmc_SatGlucoseDiversify( void * s, int iSeed )            {                                                                            }
+static void    Bmc_SatGlucoseSetInproc( void * s, int fEnable )          {                                                                            }
+static int     Bmc_SatGlucoseVarNum( void * s )                          { return bmcg_sat_solver_varnum( (bmcg_sat_solver *)s );                     }
+static int     Bmc_SatGlucoseClauseNum( void * s )                       { return bmcg_sat_solver_clausenum( (bmcg_sat_solver *)s );                  }
+static int     Bmc_SatGlucoseConflictNum( void * s )                     { return bmcg_sat_solver_conflictnum( (bmcg_sat_solver *)s );                }
+static int     Bmc_SatGlucoseSolve( void * s, int * pLits, int nLits, int nConfLimit )
+{
+    bmcg_sat_solver_set_conflict_budget( (bmcg_sat_solver *)s, nConfLimit );
+    return bmcg_sat_solver_solve( (bmcg_sat_solver *)s, pLits, nLits );
+}
+static const Bmc_SatFuncs_t Bmc_SatFuncsGlucose = {
+    "glucose",
+    Bmc_SatGlucoseStart,
+    Bmc_SatGlucoseStop,
+    Bmc_SatGlucoseReset,
+    Bmc_SatGlucoseAddVar,
+    Bmc_SatGlucoseAddClause,
+    Bmc_SatGlucoseSolve,
+    Bmc_SatGlucoseFinal,
+    Bmc_SatGlucoseVarValue,
+    Bmc_SatGlucoseSetRuntimeLimit,
+    Bmc_SatGlucoseSetStop,
+    Bmc_SatGlucoseSetExport,
+    Bmc_SatGlucoseDiversify,
+    Bmc_SatGlucoseSetInproc,
+    Bmc_SatNoSetLoader,
+    Bmc_SatNoAddClauseLoad,
+    Bmc_SatGlucoseVarNum,
+    Bmc_SatGlucoseClauseNum,
+    Bmc_SatGlucoseConflictNum
+};
+
+/**Function*************************************************************
+
+  Synopsis    [Solver selection by type and by name.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+const Bmc_SatFuncs_t * Bmc_SatFuncs( int Type )
+{
+    if ( Type == BMC_SAT_BSAT )
+        return &Bmc_SatFuncsBsat;
+    if ( Type == BMC_SAT_BSAT3 )
+        return &Bmc_SatFuncsBsat3;
+    if ( Type == BMC_SAT_SATOKO )
+        return &Bmc_SatFuncsSatoko;
+    if ( Type == BMC_SAT_GLUCOSE )
+        return &Bmc_SatFuncsGlucose;
+    return NULL;
+}
+int Bmc_SatTypeFromName( char * pName )
+{
+    int Type;
+    for ( Type = 0; Type < BMC_SAT_NUM; Type++ )
+        if ( !strcmp(pName, Bmc_SatFuncs(Type)->pName) )
+            return Type;
+    return -1;
+}
+char * Bmc_SatTypeName( int Type )
+{
+    assert( Type >= 0 && Type < BMC_SAT_NUM );
+    return Bmc_SatFuncs(Type)->pName;
+}
+char * Bmc_SatTypeNames()
+{
+    return "bsat, bsat3, satoko, glucose";
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the solver type of the i-th parallel solver.]
+
+  Description [The list contains comma-separated solver names, which are
+  assigned to the parallel solvers in a round-robin order. Returns -1 if
+  one of the names is unknown.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmc_SatTypeFromList( char * pNames, int i )
+{
+    char Buffer[100]; 
+    int nNames = 0, Types[100], Type;
+    char * pName, * pStop;
+    for ( pName = pNames; nNames < 100; pName = pStop + 1 )
+    {
+        pStop = strchr( pName, ',' );
+        if ( pStop == NULL )
+            pStop = pName + strlen(pName);
+        if ( pStop - pName >= 100 )
+            return -1;
+        strncpy( Buffer, pName, pStop - pName );
+        Buffer[pStop - pName] = 0;
+        if ( (Type = Bmc_SatTypeFromName(Buffer)) == -1 )
+            return -1;
+        Types[nNames++] = Type;
+        if ( *pStop == 0 )
+            break;
+    }
+    return Types[i % nNames];
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the solver.]
+
+  Description [Resetting removes all variables and clauses while keeping
+  the stop flag, the clause export callback, the runtime limit, and the 
+  diversification seed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Bmc_Sat_t * Bmc_SatStart( int Type )
+{
+    Bmc_Sat_t * p = ABC_CALLOC( Bmc_Sat_t, 1 );
+    p->Type    = Type;
+    p->pFuncs  = Bmc_SatFuncs( Type );
+    assert( p->pFuncs != NULL );
+    p->pSolver = p->pFuncs->pStart();
+    return p;
+}
+void Bmc_SatStop( Bmc_Sat_t * p )
+{
+    p->pFuncs->pStop( p->pSolver );
+    ABC_FREE( p );
+}
+void Bmc_SatReset( Bmc_Sat_t * p )
+{
+    p->pFuncs->pReset( p->pSolver );
+    if ( p->pStop )
+        p->pFuncs->pSetStop( p->pSolver, p->pStop );
+    if ( p->pExportFunc )
+        p->pFuncs->pSetExport( p->pSolver, p->pExportMan, p->pExportFunc );
+    if ( p->nRuntimeLimit )
+        p->pFuncs->pSetRuntimeLimit( p->pSolver, p->nRuntimeLimit );
+    if ( p->iSeed )
+        p->pFuncs->pDiversify( p->pSolver, p->iSeed );
+    if ( p->fInproc )
+        p->pFuncs->pSetInproc( p->pSolver, p->fInproc );
+    if ( p->pLoaderFunc )
+        p->pFuncs->pSetLoader( p->pSolver, p->pLoaderMan, p->pLoaderFunc );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
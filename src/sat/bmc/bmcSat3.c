@@ -0,0 +1,108 @@
+/**CFile****************************************************************
+
+  FileName    [bmcSat3.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [SAT-based bounded model checking.]
+
+  Synopsis    [Adapter of sat_solver3 to the unified SAT solver interface.]
+
+  Author      [agent]
+
+  Date        [Ver. 1.0. Started - October 16, 2026.]
+
+  Revision    [$Id: bmcSat3.c,v 1.00 2026/10/16 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "bmc.h"
+#include "sat/bsat/satSolver3.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// satSolver3.h cannot be included together with satSolver.h,
+// so this adapter is kept separately from the others in bmcSat.c
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Adapter for sat_solver3.]
+
+  Description [This solver does not export learned clauses, but it can
+  import the clauses exported by other solvers in the portfolio.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void *  Bmc_SatBsat3Start( void )                                 { return sat_solver3_new();                                                  }
+static void    Bmc_SatBsat3Stop( void * s )                              { sat_solver3_delete( (sat_solver3 *)s );                                    }
+static void    Bmc_SatBsat3Reset( void * s )                             { sat_solver3_restart( (sat_solver3 *)s );                                   }
+static int     Bmc_SatBsat3AddClause( void * s, int * pLits, int nLits ) { return sat_solver3_addclause( (sat_solver3 *)s, pLits, pLits + nLits );    }
+static int     Bmc_SatBsat3Final( void * s, int ** ppLits )              { return sat_solver3_final( (sat_solver3 *)s, ppLits );                      }
+static int     Bmc_SatBsat3VarValue( void * s, int iVar )                { return sat_solver3_var_value( (sat_solver3 *)s, iVar );                    }
+static abctime Bmc_SatBsat3SetRuntimeLimit( void * s, abctime Limit )    { return sat_solver3_set_runtime_limit( (sat_solver3 *)s, Limit );           }
+static void    Bmc_SatBsat3SetStop( void * s, int * pStop )              { sat_solver3_set_stop( (sat_solver3 *)s, pStop );                           }
+static void    Bmc_SatBsat3SetExport( void * s, void * pMan, void(*pFunc)(void *, int *, int, int) ) {                                                }
+static void    Bmc_SatBsat3SetInproc( void * s, int fEnable )            {                                                                            }
+static int     Bmc_SatBsat3VarNum( void * s )                            { return sat_solver3_nvars( (sat_solver3 *)s );                              }
+static int     Bmc_SatBsat3ClauseNum( void * s )                         { return sat_solver3_nclauses( (sat_solver3 *)s );                           }
+static int     Bmc_SatBsat3ConflictNum( void * s )                       { return sat_solver3_nconflicts( (sat_solver3 *)s );                         }
+static int     Bmc_SatBsat3AddVar( void * s )
+{
+    int iVar = sat_solver3_nvars( (sat_solver3 *)s );
+    sat_solver3_setnvars( (sat_solver3 *)s, iVar + 1 );
+    return iVar;
+}
+static int     Bmc_SatBsat3Solve( void * s, int * pLits, int nLits, int nConfLimit )
+{
+    int status = sat_solver3_solve( (sat_solver3 *)s, pLits, pLits + nLits, (ABC_INT64_T)nConfLimit, 0, 0, 0 );
+    return status == l_True ? 1 : status == l_False ? -1 : 0;
+}
+static void    Bmc_SatBsat3Diversify( void * s, int iSeed )
+{
+    sat_solver3 * pSat = (sat_solver3 *)s;
+    if ( iSeed == 0 )
+        return;
+    pSat->random_seed = 91648253 + 1000 * iSeed;
+    pSat->fNotUseRandom = 0;
+}
+const Bmc_SatFuncs_t Bmc_SatFuncsBsat3 = {
+    "bsat3",
+    Bmc_SatBsat3Start,
+    Bmc_SatBsat3Stop,
+    Bmc_SatBsat3Reset,
+    Bmc_SatBsat3AddVar,
+    Bmc_SatBsat3AddClause,
+    Bmc_SatBsat3Solve,
+    Bmc_SatBsat3Final,
+    Bmc_SatBsat3VarValue,
+    Bmc_SatBsat3SetRuntimeLimit,
+    Bmc_SatBsat3SetStop,
+    Bmc_SatBsat3SetExport,
+    Bmc_SatBsat3Diversify,
+    Bmc_SatBsat3SetInproc,
+    Bmc_SatNoSetLoader,
+    Bmc_SatNoAddClauseLoad,
+    Bmc_SatBsat3VarNum,
+    Bmc_SatBsat3ClauseNum,
+    Bmc_SatBsat3ConflictNum
+};
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -0,0 +1,511 @@
+/**CFile****************************************************************
+
+  FileName    [bmcSatPort.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [SAT-based bounded model checking.]
+
+  Synopsis    [Portfolio of SAT solvers sharing short learned clauses.]
+
+  Author      [agent]
+
+  Date        [Ver. 1.0. Started - October 16, 2026.]
+
+  Revision    [$Id: bmcSatPort.c,v 1.00 2026/10/16 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "bmc.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
+#ifdef _MSC_VER
+#include <windows.h>
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The solvers of the portfolio work on the same problem, which is loaded
+// into each of them by the user. The portfolio solves the problem under
+// the given assumptions by running the solvers in rounds with a growing
+// conflict budget. During a round, the learned clauses, which are short
+// and have a small LBD, are exported by the solvers. Between the rounds,
+// each solver imports the clauses exported by the other solvers. Since
+// the solvers are at the decision level zero between the rounds, the
+// clauses are added as usual clauses without restarting the search.
+//
+// In the default mode, the solvers run independently and exchange the
+// clauses through a lock-free ring buffer. The first solver to decide
+// the problem sets the stop flag that terminates the others. The ring
+// buffer has fixed-size slots, each with a stamp equal to 2*Pos+1 while
+// the clause with the write position Pos is being written, and 2*Pos+2
+// after it is written. A writer claims the slot by compare-and-swap of
+// the stamp and drops its clause if another writer is using the slot.
+// A reader copies the clause and checks that the stamp did not change.
+//
+// In the deterministic mode, the solvers synchronize at the end of each
+// round. The clauses are collected by each solver separately and imported
+// in the order of the solver indexes. The winner is the solver with the
+// smallest index that decided the problem in the first round, in which
+// one of the solvers decided it. This makes the results reproducible.
+
+#ifdef _MSC_VER
+#define BMC_PORT_ADD64( p, Add )       ((word)InterlockedExchangeAdd64((volatile LONGLONG *)(p), (LONGLONG)(Add)))
+#define BMC_PORT_CAS64( p, Old, New )  (InterlockedCompareExchange64((volatile LONGLONG *)(p), (LONGLONG)(New), (LONGLONG)(Old)) == (LONGLONG)(Old))
+#define BMC_PORT_CAS32( p, Old, New )  (InterlockedCompareExchange((volatile LONG *)(p), (LONG)(New), (LONG)(Old)) == (LONG)(Old))
+#define BMC_PORT_BARRIER()             MemoryBarrier()
+#else
+#define BMC_PORT_ADD64( p, Add )       __sync_fetch_and_add( (p), (Add) )
+#define BMC_PORT_CAS64( p, Old, New )  __sync_bool_compare_and_swap( (p), (Old), (New) )
+#define BMC_PORT_CAS32( p, Old, New )  __sync_bool_compare_and_swap( (p), (Old), (New) )
+#define BMC_PORT_BARRIER()             __sync_synchronize()
+#endif
+
+#define BMC_PORT_SOL_MAX   64         // the largest number of solvers
+#define BMC_PORT_RING_LOG  14         // the log2 of the number of slots in the ring buffer
+#define BMC_PORT_ROUND     1000       // the conflict budget of the first round
+
+typedef struct Bmc_PortSol_t_ Bmc_PortSol_t;
+struct Bmc_PortSol_t_
+{
+    Bmc_Port_t *     p;               // the portfolio
+    Bmc_Sat_t *      pSat;            // the solver
+    int              iSolver;         // the solver index
+    int              status;          // the status of the last round
+    int              nConfStart;      // the number of conflicts before the call
+    int              fRootUnsat;      // the imported clauses made the solver UNSAT
+    word             iRead;           // the next position of the ring buffer to read
+    Vec_Int_t        vExport;         // the exported clauses (deterministic mode)
+    Vec_Int_t        vLits;           // the clause being imported
+    // statistics
+    word             nExported;       // the number of exported clauses
+    word             nImported;       // the number of imported clauses
+    word             nDropped;        // the number of clauses dropped by the writer
+    int              nWins;           // the number of calls decided by this solver
+};
+
+struct Bmc_Port_t_
+{
+    int              nSolvers;        // the number of solvers
+    int              nSizeMax;        // the largest size of the shared clause
+    int              nLbdMax;         // the largest LBD of the shared clause
+    int              fDeterm;         // the deterministic mode
+    Bmc_PortSol_t *  pSols;           // the solvers
+    // the ring buffer
+    int              nSlotSize;       // the number of ints in a slot (solver, size, literals)
+    word             nSlotMask;       // the number of slots minus one
+    volatile word *  pStamps;         // the slot stamps
+    int *            pSlots;          // the slots
+    volatile word    nWrite;          // the next position to write
+    // the current call
+    int *            pLits;           // the assumptions
+    int              nLits;           // the number of assumptions
+    int              nConfLimit;      // the conflict limit of each solver (0 = no limit)
+    int              nBudget;         // the conflict budget of the round
+    volatile int     fStop;           // the flag to terminate the solvers
+    volatile int     iWinner;         // the solver that decided the problem
+    // statistics
+    int              nCalls;          // the number of calls
+    int              nRounds;         // the number of rounds
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Receives a learned clause from the solver.]
+
+  Description [Called by the solver inside its search, possibly on
+  several threads at the same time.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Bmc_PortExport( void * pArg, int * pLits, int nLits, int Lbd )
+{
+    Bmc_PortSol_t * pSol = (Bmc_PortSol_t *)pArg;
+    Bmc_Port_t * p = pSol->p;
+    word Pos, Slot, Stamp; int * pSlot;
+    if ( nLits > p->nSizeMax || Lbd > p->nLbdMax )
+        return;
+    pSol->nExported++;
+    if ( p->fDeterm )
+    {
+        Vec_IntPush( &pSol->vExport, nLits );
+        Vec_IntPushArray( &pSol->vExport, pLits, nLits );
+        return;
+    }
+    Pos   = BMC_PORT_ADD64( &p->nWrite, 1 );
+    Slot  = Pos & p->nSlotMask;
+    Stamp = p->pStamps[Slot];
+    if ( (Stamp & 1) || Stamp > 2*Pos || !BMC_PORT_CAS64( &p->pStamps[Slot], Stamp, 2*Pos+1 ) )
+    {
+        pSol->nDropped++;
+        return;
+    }
+    pSlot = p->pSlots + Slot * p->nSlotSize;
+    pSlot[0] = pSol->iSolver;
+    pSlot[1] = nLits;
+    memcpy( pSlot + 2, pLits, sizeof(int) * nLits );
+    BMC_PORT_BARRIER();
+    p->pStamps[Slot] = 2*Pos+2;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds a clause exported by another solver.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Bmc_PortImportOne( Bmc_PortSol_t * pSol, int * pLits, int nLits )
+{
+    // the solvers may reorder the literals, so the clause is copied
+    Vec_IntClear( &pSol->vLits );
+    Vec_IntPushArray( &pSol->vLits, pLits, nLits );
+    if ( !pSol->fRootUnsat && !Bmc_SatAddClause(pSol->pSat, Vec_IntArray(&pSol->vLits), nLits) )
+        pSol->fRootUnsat = 1;
+    pSol->nImported++;
+}
+static void Bmc_PortImportRing( Bmc_PortSol_t * pSol )
+{
+    Bmc_Port_t * p = pSol->p;
+    word nWrite = p->nWrite, Pos, Slot, Stamp;
+    int * pSlot, nLits, k;
+    // the clauses overwritten by the writers are skipped
+    if ( nWrite - pSol->iRead > p->nSlotMask + 1 )
+        pSol->iRead = nWrite - p->nSlotMask - 1;
+    for ( Pos = pSol->iRead; Pos < nWrite; Pos++ )
+    {
+        Slot  = Pos & p->nSlotMask;
+        Stamp = p->pStamps[Slot];
+        // the clauses being written or dropped are skipped
+        if ( Stamp != 2*Pos+2 )
+            continue;
+        BMC_PORT_BARRIER();
+        pSlot = p->pSlots + Slot * p->nSlotSize;
+        nLits = pSlot[1];
+        if ( pSlot[0] == pSol->iSolver || nLits < 1 || nLits > p->nSizeMax )
+            continue;
+        Vec_IntClear( &pSol->vLits );
+        for ( k = 0; k < nLits; k++ )
+            Vec_IntPush( &pSol->vLits, pSlot[2+k] );
+        BMC_PORT_BARRIER();
+        if ( p->pStamps[Slot] != Stamp )
+            continue;
+        if ( !pSol->fRootUnsat && !Bmc_SatAddClause(pSol->pSat, Vec_IntArray(&pSol->vLits), nLits) )
+            pSol->fRootUnsat = 1;
+        pSol->nImported++;
+    }
+    pSol->iRead = nWrite;
+}
+static void Bmc_PortImportDeterm( Bmc_Port_t * p )
+{
+    Bmc_PortSol_t * pSol, * pSrc;
+    int i, j, k, nLits;
+    for ( i = 0; i < p->nSolvers; i++ )
+    {
+        pSol = p->pSols + i;
+        for ( j = 0; j < p->nSolvers; j++ )
+        {
+            pSrc = p->pSols + j;
+            if ( i == j )
+                continue;
+            for ( k = 0; k < Vec_IntSize(&pSrc->vExport); k += nLits + 1 )
+            {
+                nLits = Vec_IntEntry( &pSrc->vExport, k );
+                Bmc_PortImportOne( pSol, Vec_IntEntryP(&pSrc->vExport, k+1), nLits );
+            }
+        }
+    }
+    for ( i = 0; i < p->nSolvers; i++ )
+        Vec_IntClear( &p->pSols[i].vExport );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs one solver with the given conflict budget.]
+
+  Description [Returns 0 if the budget or the conflict limit of the
+  call is exhausted.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Bmc_PortSolveRound( Bmc_PortSol_t * pSol, int nBudget )
+{
+    Bmc_Port_t * p = pSol->p;
+    int nUsed = Bmc_SatConflictNum(pSol->pSat) - pSol->nConfStart;
+    if ( pSol->fRootUnsat )
+        return -1;
+    if ( p->nConfLimit )
+    {
+        if ( nUsed >= p->nConfLimit )
+            return 0;
+        nBudget = Abc_MinInt( nBudget, p->nConfLimit - nUsed );
+    }
+    return Bmc_SatSolve( pSol->pSat, p->pLits, p->nLits, nBudget );
+}
+static int Bmc_PortIsExhausted( Bmc_PortSol_t * pSol )
+{
+    Bmc_Port_t * p = pSol->p;
+    return p->nConfLimit && Bmc_SatConflictNum(pSol->pSat) - pSol->nConfStart >= p->nConfLimit;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [The work of one solver.]
+
+  Description [In the default mode, the solver runs rounds until it or
+  another solver decides the problem. In the deterministic mode, it runs
+  one round.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Bmc_PortRace( Bmc_PortSol_t * pSol )
+{
+    Bmc_Port_t * p = pSol->p;
+    int nBudget = BMC_PORT_ROUND;
+    pSol->status = 0;
+    while ( !p->fStop && !Bmc_PortIsExhausted(pSol) )
+    {
+        pSol->status = Bmc_PortSolveRound( pSol, nBudget );
+        if ( pSol->status != 0 )
+        {
+            if ( BMC_PORT_CAS32( &p->iWinner, -1, pSol->iSolver ) )
+                p->fStop = 1;
+            break;
+        }
+        Bmc_PortImportRing( pSol );
+        nBudget += nBudget / 2;
+    }
+}
+static void * Bmc_PortWorker( void * pArg )
+{
+    Bmc_PortSol_t * pSol = (Bmc_PortSol_t *)pArg;
+    if ( pSol->p->fDeterm )
+        pSol->status = Bmc_PortSolveRound( pSol, pSol->p->nBudget );
+    else
+        Bmc_PortRace( pSol );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs all solvers.]
+
+  Description [Solver 0 runs on the calling thread. Without pthreads,
+  the solvers are run one after another.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Bmc_PortRunAll( Bmc_Port_t * p )
+{
+    int i;
+#ifdef ABC_USE_PTHREADS
+    pthread_t WorkerThread[BMC_PORT_SOL_MAX];
+    int status;
+    for ( i = 1; i < p->nSolvers; i++ )
+    {
+        status = pthread_create( WorkerThread + i, NULL, Bmc_PortWorker, (void *)(p->pSols + i) );
+        assert( status == 0 );
+    }
+    Bmc_PortWorker( (void *)p->pSols );
+    for ( i = 1; i < p->nSolvers; i++ )
+        pthread_join( WorkerThread[i], NULL );
+#else
+    for ( i = 0; i < p->nSolvers; i++ )
+        Bmc_PortWorker( (void *)(p->pSols + i) );
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the portfolio.]
+
+  Description [The solvers are owned by the user, who loads the problem
+  into them and diversifies them. The portfolio installs the stop flag
+  and the clause export callback into the solvers. The clauses with more
+  than nSizeMax literals or with LBD larger than nLbdMax are not shared.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Bmc_Port_t * Bmc_PortStart( Bmc_Sat_t ** pSats, int nSats, int nSizeMax, int nLbdMax, int fDeterm )
+{
+    Bmc_Port_t * p;
+    int i, nSlots = 1 << BMC_PORT_RING_LOG;
+    assert( nSats >= 1 && nSats <= BMC_PORT_SOL_MAX );
+    p = ABC_CALLOC( Bmc_Port_t, 1 );
+    p->nSolvers  = nSats;
+    p->nSizeMax  = nSizeMax;
+    p->nLbdMax   = nLbdMax;
+    p->fDeterm   = fDeterm;
+    p->iWinner   = -1;
+    p->nSlotSize = nSizeMax + 2;
+    p->nSlotMask = nSlots - 1;
+    p->pStamps   = ABC_CALLOC( word, nSlots );
+    p->pSlots    = ABC_CALLOC( int, nSlots * p->nSlotSize );
+    p->pSols     = ABC_CALLOC( Bmc_PortSol_t, nSats );
+    for ( i = 0; i < nSats; i++ )
+    {
+        p->pSols[i].p       = p;
+        p->pSols[i].pSat    = pSats[i];
+        p->pSols[i].iSolver = i;
+        Bmc_SatSetStop( pSats[i], (int *)&p->fStop );
+        Bmc_SatSetExport( pSats[i], (void *)(p->pSols + i), Bmc_PortExport );
+    }
+    return p;
+}
+void Bmc_PortStop( Bmc_Port_t * p )
+{
+    int i;
+    for ( i = 0; i < p->nSolvers; i++ )
+    {
+        Bmc_SatSetStop( p->pSols[i].pSat, NULL );
+        Bmc_SatSetExport( p->pSols[i].pSat, NULL, NULL );
+        Vec_IntErase( &p->pSols[i].vExport );
+        Vec_IntErase( &p->pSols[i].vLits );
+    }
+    ABC_FREE( p->pSols );
+    ABC_FREE( p->pSlots );
+    ABC_FREE( p->pStamps );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the problem under assumptions.]
+
+  Description [Returns 1 (SAT), -1 (UNSAT), or 0 (undecided). The conflict
+  limit (0 = no limit) applies to each solver separately. The satisfying
+  assignment and the final conflict should be taken from the solver whose
+  index is returned in piWinner. If the solver became UNSAT while adding
+  the imported clauses, its final conflict is empty.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmc_PortSolve( Bmc_Port_t * p, int * pLits, int nLits, int nConfLimit, int * piWinner )
+{
+    int i, status = 0;
+    p->pLits      = pLits;
+    p->nLits      = nLits;
+    p->nConfLimit = nConfLimit;
+    p->fStop      = 0;
+    p->iWinner    = -1;
+    p->nCalls++;
+    for ( i = 0; i < p->nSolvers; i++ )
+    {
+        p->pSols[i].status = 0;
+        p->pSols[i].nConfStart = Bmc_SatConflictNum( p->pSols[i].pSat );
+    }
+    if ( !p->fDeterm )
+    {
+        Bmc_PortRunAll( p );
+        p->fStop = 0;
+        if ( p->iWinner >= 0 )
+            status = p->pSols[p->iWinner].status;
+    }
+    else
+    {
+        for ( p->nBudget = BMC_PORT_ROUND; ; p->nBudget += p->nBudget / 2 )
+        {
+            Bmc_PortRunAll( p );
+            Bmc_PortImportDeterm( p );
+            p->nRounds++;
+            for ( i = 0; i < p->nSolvers; i++ )
+                if ( p->pSols[i].status != 0 )
+                    break;
+            if ( i < p->nSolvers )
+            {
+                p->iWinner = i;
+                status = p->pSols[i].status;
+                break;
+            }
+            for ( i = 0; i < p->nSolvers; i++ )
+                if ( !Bmc_PortIsExhausted(p->pSols + i) )
+                    break;
+            if ( i == p->nSolvers )
+                break;
+        }
+    }
+    if ( p->iWinner >= 0 )
+        p->pSols[p->iWinner].nWins++;
+    if ( piWinner )
+        *piWinner = p->iWinner;
+    return status;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prints statistics of clause sharing.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmc_PortPrintStats( Bmc_Port_t * p )
+{
+    int i;
+    printf( "Portfolio of %d solvers (%s): Calls = %d.", p->nSolvers, p->fDeterm ? "deterministic" : "racing", p->nCalls );
+    if ( p->fDeterm )
+        printf( " Rounds = %d.", p->nRounds );
+    printf( " Sharing clauses with size <= %d and LBD <= %d.\n", p->nSizeMax, p->nLbdMax );
+    for ( i = 0; i < p->nSolvers; i++ )
+    {
+        Bmc_PortSol_t * pSol = p->pSols + i;
+        printf( "Solver %2d (%-7s) : ", i, Bmc_SatName(pSol->pSat) );
+        printf( "Wins = %6d.  ",     pSol->nWins );
+        printf( "Exported = %9.0f.  ", (double)pSol->nExported );
+        printf( "Imported = %9.0f.  ", (double)pSol->nImported );
+        if ( !p->fDeterm )
+            printf( "Dropped = %7.0f.  ", (double)pSol->nDropped );
+        printf( "\n" );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
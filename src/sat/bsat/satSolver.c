@@ -132,6 +132,29 @@ int sat_solver_get_var_value(sat_solver* s, int v)
 static inline int      sat_solver_dl(sat_solver* s)                { return veci_size(&s->trail_lim); }
 static inline veci*    sat_solver_read_wlist(sat_solver* s, lit l) { return &s->wlists[l];            }
 
+// the watch lists contain 2-lit clauses as one entry (the other literal, see clause_from_lit)
+// and larger clauses as two entries (the clause handle followed by the blocker literal);
+// the clause is skipped without reading its memory when the blocker literal is true
+static inline void     sat_solver_push_watch(sat_solver* s, lit l, cla h, lit blocker) 
+{ 
+    veci* ws = sat_solver_read_wlist(s,l);
+    veci_push(ws, h);
+    veci_push(ws, blocker);
+}
+// copies the watches in [*pi, end) to *pj and returns their number
+static inline int      sat_solver_copy_watches(int** pi, int** pj, int* end)
+{
+    int* i = *pi, * j = *pj, Count = 0;
+    for ( ; i < end; Count++ )
+    {
+        if ( !clause_is_lit(*i) )
+            *j++ = *i++;
+        *j++ = *i++;
+    }
+    *pi = i; *pj = j;
+    return Count;
+}
+
 //=================================================================================================
 // Variable order functions:
 
@@ -569,8 +592,14 @@ int sat_solver_clause_new(sat_solver* s, lit* begin, lit* end, int learnt)
 
     //veci_push(sat_solver_read_wlist(s,lit_neg(begin[0])),c);
     //veci_push(sat_solver_read_wlist(s,lit_neg(begin[1])),c);
-    veci_push(sat_solver_read_wlist(s,lit_neg(begin[0])),(size > 2 ? h : clause_from_lit(begin[1])));
-    veci_push(sat_solver_read_wlist(s,lit_neg(begin[1])),(size > 2 ? h : clause_from_lit(begin[0])));
+    if ( size > 2 )
+    {
+        sat_solver_push_watch(s, lit_neg(begin[0]), h, begin[1]);
+        sat_solver_push_watch(s, lit_neg(begin[1]), h, begin[0]);
+        return h;
+    }
+    veci_push(sat_solver_read_wlist(s,lit_neg(begin[0])),clause_from_lit(begin[1]));
+    veci_push(sat_solver_read_wlist(s,lit_neg(begin[1])),clause_from_lit(begin[0]));
 
     return h;
 }
@@ -704,6 +733,8 @@ static void sat_solver_record(sat_solver* s, veci* cls)
     assert(veci_size(cls) > 0);
     if ( h == 0 )
         veci_push( &s->unit_lits, *begin );
+    if ( s->pShareFunc )
+        s->pShareFunc( s->pShareMan, begin, veci_size(cls), h ? (int)clause_read(s, h)->lbd : 1 );
 
     ///////////////////////////////////
     // add clause to internal storage
@@ -996,46 +1027,30 @@ static void sat_solver_analyze(sat_solver* s, int h, veci* learnt)
 #endif
 }
 
-//#define TEST_CNF_LOAD
-
 int sat_solver_propagate(sat_solver* s)
 {
     int     hConfl = 0;
     lit*    lits;
     lit false_lit;
+    int     fCnfLoad = s->fCnfLoad;
 
     //printf("sat_solver_propagate\n");
     while (hConfl == 0 && s->qtail - s->qhead > 0){
         lit p = s->trail[s->qhead++];
 
-#ifdef TEST_CNF_LOAD
-        int v = lit_var(p);
-        if ( s->pCnfFunc )
+        // load the clauses of the literal assigned for the first time
+        if ( fCnfLoad && (s->loads[lit_var(p)] & (1 << lit_sign(p))) == 0 )
         {
-            if ( lit_sign(p) )
-            {
-                if ( (s->loads[v] & 1) == 0 )
-                {
-                    s->loads[v] ^= 1;
-                    s->pCnfFunc( s->pCnfMan, p );
-                }
-            }
-            else
-            {
-                if ( (s->loads[v] & 2) == 0 )
-                {
-                    s->loads[v] ^= 2;
-                    s->pCnfFunc( s->pCnfMan, p );
-                }
-            }
+            s->loads[lit_var(p)] |= (char)(1 << lit_sign(p));
+            s->pCnfFunc( s->pCnfMan, p );
         }
         {
-#endif
 
         veci* ws    = sat_solver_read_wlist(s,p);
         int*  begin = veci_begin(ws);
         int*  end   = begin + veci_size(ws);
         int*i, *j;
+        int nKept = 0; // the number of watches kept in the list
 
         s->stats.propagations++;
 //        s->simpdb_props--;
@@ -1047,21 +1062,34 @@ int sat_solver_propagate(sat_solver* s)
                 int Lit = clause_read_lit(*i);
                 if (var_value(s, lit_var(Lit)) == lit_sign(Lit)){
                     *j++ = *i++;
+                    nKept++;
                     continue;
                 }
 
                 *j++ = *i;
+                nKept++;
                 if (!sat_solver_enqueue(s,clause_read_lit(*i),clause_from_lit(p))){
                     hConfl = s->hBinary;
                     (clause_begin(s->binary))[1] = lit_neg(p);
                     (clause_begin(s->binary))[0] = clause_read_lit(*i++);
                     // Copy the remaining watches:
-                    while (i < end)
-                        *j++ = *i++;
+                    nKept += sat_solver_copy_watches(&i, &j, end);
+                    break;
                 }
+                i++;
             }else{
 
-                clause* c = clause_read(s,*i);
+                clause* c;
+                // If the blocker is true, then clause is already satisfied.
+                lit blocker = i[1];
+                if (var_value(s, lit_var(blocker)) == lit_sign(blocker)){
+                    *j++ = *i++;
+                    *j++ = *i++;
+                    nKept++;
+                    continue;
+                }
+
+                c = clause_read(s,*i);
                 lits = clause_begin(c);
 
                 // Make sure the false literal is data[1]:
@@ -1073,8 +1101,11 @@ int sat_solver_propagate(sat_solver* s)
                 assert(lits[1] == false_lit);
 
                 // If 0th watch is true, then clause is already satisfied.
-                if (var_value(s, lit_var(lits[0])) == lit_sign(lits[0]))
+                if (var_value(s, lit_var(lits[0])) == lit_sign(lits[0])){
                     *j++ = *i;
+                    *j++ = lits[0];
+                    nKept++;
+                }
                 else{
                     // Look for new watch:
                     lit* stop = lits + clause_size(c);
@@ -1083,31 +1114,32 @@ int sat_solver_propagate(sat_solver* s)
                         if (var_value(s, lit_var(*k)) != !lit_sign(*k)){
                             lits[1] = *k;
                             *k = false_lit;
-                            veci_push(sat_solver_read_wlist(s,lit_neg(lits[1])),*i);
+                            sat_solver_push_watch(s,lit_neg(lits[1]),*i,lits[0]);
                             goto next; }
                     }
 
                     *j++ = *i;
+                    *j++ = lits[0];
+                    nKept++;
                     // Clause is unit under assignment:
                     if ( c->lrn )
                         c->lbd = sat_clause_compute_lbd(s, c);
                     if (!sat_solver_enqueue(s,lits[0], *i)){
-                        hConfl = *i++;
+                        hConfl = *i;
+                        i += 2;
                         // Copy the remaining watches:
-                        while (i < end)
-                            *j++ = *i++;
+                        nKept += sat_solver_copy_watches(&i, &j, end);
+                        break;
                     }
                 }
+            next:
+                i += 2;
             }
-        next:
-            i++;
         }
 
-        s->stats.inspects += j - veci_begin(ws);
+        s->stats.inspects += nKept;
         veci_resize(ws,j - veci_begin(ws));
-#ifdef TEST_CNF_LOAD
         }
-#endif
     }
 
     return hConfl;
@@ -1595,12 +1627,18 @@ void sat_solver_reducedb(sat_solver* s)
             if ( clause_is_lit(pArray[k]) ) // 2-lit clause
                 pArray[j++] = pArray[k];
             else if ( !clause_learnt_h(pMem, pArray[k]) ) // problem clause
+            {
                 pArray[j++] = pArray[k];
+                pArray[j++] = pArray[++k]; // blocker
+            }
             else 
             {
-                c = clause_read(s, pArray[k]);
+                c = clause_read(s, pArray[k++]);
                 if ( !c->mark ) // useful learned clause
+                {
                    pArray[j++] = clause_id(c); // updating handle here!!!
+                   pArray[j++] = pArray[k]; // blocker
+                }
             }
         }
         veci_resize(&s->wlists[i],j);
@@ -1661,8 +1699,11 @@ void sat_solver_rollback( sat_solver* s )
                 if ( clause_read_lit(pArray[k]) < s->iVarPivot*2 )
                     pArray[j++] = pArray[k];
             }
-            else if ( Sat_MemClauseUsed(pMem, pArray[k]) )
-                pArray[j++] = pArray[k];
+            else if ( Sat_MemClauseUsed(pMem, pArray[k++]) )
+            {
+                pArray[j++] = pArray[k-1];
+                pArray[j++] = pArray[k]; // blocker
+            }
         }
         veci_resize(&s->wlists[i],j);
     }
@@ -1862,7 +1903,7 @@ static lbool sat_solver_search(sat_solver* s, ABC_INT64_T nof_conflicts)
             int next;
 
             // Reached bound on number of conflicts:
-            if ( (!s->fNoRestarts && nof_conflicts >= 0 && conflictC >= nof_conflicts) || (s->nRuntimeLimit && (s->stats.conflicts & 63) == 0 && Abc_Clock() > s->nRuntimeLimit)){
+            if ( (!s->fNoRestarts && nof_conflicts >= 0 && conflictC >= nof_conflicts) || (s->nRuntimeLimit && (s->stats.conflicts & 63) == 0 && Abc_Clock() > s->nRuntimeLimit) || (s->pStop && *s->pStop)){
                 s->progress_estimate = sat_solver_progress(s);
                 sat_solver_canceluntil(s,s->root_level);
                 veci_delete(&learnt_clause);
@@ -1965,6 +2006,8 @@ int sat_solver_solve_internal(sat_solver* s)
             break;
         if ( s->pFuncStop && s->pFuncStop(s->RunId) )
             break;
+        if ( s->pStop && *s->pStop )
+            break;
     }
     if (s->verbosity >= 1)
         printf("==============================================================================\n");
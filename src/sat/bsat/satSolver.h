@@ -201,11 +201,17 @@ struct sat_solver_t
 
     // CNF loading
     void *      pCnfMan;           // external CNF manager
-    int(*pCnfFunc)(void * p, int); // external callback
+    int(*pCnfFunc)(void * p, int); // external callback (called when a literal is propagated for the first time)
+    int         fCnfLoad;          // the callback is set (read once per call to propagate)
 
     // termination callback
     int         RunId;          // SAT id in this run
     int(*pFuncStop)(int);       // callback to terminate
+    int *       pStop;          // external flag to terminate
+
+    // clause sharing
+    void *      pShareMan;      // external manager receiving learned clauses
+    void(*pShareFunc)(void *, int *, int, int); // callback (manager, literals, size, LBD)
 };
 
 static inline clause * clause_read( sat_solver * s, cla h )          
@@ -343,6 +349,22 @@ static inline void sat_solver_set_stop_func( sat_solver *s, int (*fnct)(int) )
 { 
     s->pFuncStop = fnct; 
 }
+static inline void sat_solver_set_stop( sat_solver *s, int * pStop ) 
+{ 
+    s->pStop = pStop; 
+}
+static inline void sat_solver_set_export( sat_solver *s, void * pMan, void(*pFunc)(void *, int *, int, int) ) 
+{ 
+    s->pShareMan  = pMan; 
+    s->pShareFunc = pFunc; 
+}
+
+static inline void sat_solver_set_loader( sat_solver *s, void * pMan, int(*pFunc)(void *, int) ) 
+{ 
+    s->pCnfMan  = pMan; 
+    s->pCnfFunc = pFunc; 
+    s->fCnfLoad = (pFunc != NULL);
+}
 
 static inline int sat_solver_add_const( sat_solver * pSat, int iVar, int fCompl )
 {
@@ -1834,7 +1834,7 @@ static lbool sat_solver3_search(sat_solver3* s, ABC_INT64_T nof_conflicts)
             int next;
 
             // Reached bound on number of conflicts:
-            if ( (!s->fNoRestarts && nof_conflicts >= 0 && conflictC >= nof_conflicts) || (s->nRuntimeLimit && (s->stats.conflicts & 63) == 0 && Abc_Clock() > s->nRuntimeLimit)){
+            if ( (!s->fNoRestarts && nof_conflicts >= 0 && conflictC >= nof_conflicts) || (s->nRuntimeLimit && (s->stats.conflicts & 63) == 0 && Abc_Clock() > s->nRuntimeLimit) || (s->pStop && *s->pStop)){
                 s->progress_estimate = sat_solver3_progress(s);
                 sat_solver3_canceluntil(s,s->root_level);
                 veci_delete(&learnt_clause);
@@ -1935,6 +1935,8 @@ int sat_solver3_solve_internal(sat_solver3* s)
             break;
         if ( s->nRuntimeLimit && Abc_Clock() > s->nRuntimeLimit )
             break;
+        if ( s->pStop && *s->pStop )
+            break;
     }
     if (s->verbosity >= 1)
         printf("==============================================================================\n");
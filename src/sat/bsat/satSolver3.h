@@ -196,6 +196,9 @@ struct sat_solver3_t
     // CNF loading
     void *      pCnfMan;           // external CNF manager
     int(*pCnfFunc)(void * p, int); // external callback
+
+    // termination flag
+    int *       pStop;          // external flag to terminate
 };
 
 static inline clause * clause_read( sat_solver3 * s, cla h )          
@@ -284,6 +287,10 @@ static abctime sat_solver3_set_runtime_limit(sat_solver3* s, abctime Limit)
     s->nRuntimeLimit = Limit;
     return nRuntimeLimit;
 }
+static inline void sat_solver3_set_stop( sat_solver3 *s, int * pStop ) 
+{ 
+    s->pStop = pStop; 
+}
 
 static int sat_solver3_set_random(sat_solver3* s, int fNotUseRandom)
 {
@@ -164,6 +164,7 @@ extern void *          Cnf_DataWriteIntoSolver( Cnf_Dat_t * p, int nFrames, int
 extern void *          Cnf_DataWriteIntoSolverInt( void * pSat, Cnf_Dat_t * p, int nFrames, int fInit );
 extern int             Cnf_DataWriteOrClause( void * pSat, Cnf_Dat_t * pCnf );
 extern int             Cnf_DataWriteAndClauses( void * p, Cnf_Dat_t * pCnf );
+extern int *           Cnf_DataCollectVarPolarity( Aig_Man_t * pAig, int * pVarNums, int nVars, int fTransformPos );
 extern void            Cnf_DataTranformPolarity( Cnf_Dat_t * pCnf, int fTransformPos );
 extern int             Cnf_DataAddXorClause( void * pSat, int iVarA, int iVarB, int iVarC );
 /*=== cnfMap.c ========================================================*/
@@ -173,6 +174,9 @@ extern int             Cnf_ManMapForCnf( Cnf_Man_t * p );
 extern void            Cnf_ManTransferCuts( Cnf_Man_t * p );
 extern void            Cnf_ManFreeCuts( Cnf_Man_t * p );
 extern void            Cnf_ManPostprocess( Cnf_Man_t * p );
+/*=== cnfStream.c ======================================================*/
+extern int             Cnf_DeriveWriteIntoFile( Aig_Man_t * pAig, int nOutputs, char * pFileName, int fChangePol, int fBinary, int fVerbose );
+extern int             Cnf_DataReadStream( char * pFileName, void * pUser, void (*pFuncStart)(void *, int, int), int (*pFuncClause)(void *, int *, int) );
 /*=== cnfUtil.c ========================================================*/
 extern Vec_Ptr_t *     Aig_ManScanMapping( Cnf_Man_t * p, int fCollect );
 extern Vec_Ptr_t *     Cnf_ManScanMapping( Cnf_Man_t * p, int fCollect, int fPreorder );
@@ -183,6 +187,10 @@ extern Cnf_Dat_t *     Cnf_DataReadFromFile( char * pFileName );
 /*=== cnfWrite.c ========================================================*/
 extern Vec_Int_t *     Cnf_ManWriteCnfMapping( Cnf_Man_t * p, Vec_Ptr_t * vMapped );
 extern void            Cnf_SopConvertToVector( char * pSop, int nCubes, Vec_Int_t * vCover );
+extern int             Cnf_IsopWriteCube( int Cube, int nVars, int * pVars, int * pLiterals );
+extern int             Cnf_ManCountClauses( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs, int * pnLiterals );
+extern int             Cnf_ManAssignVarNums( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs, int * pVarNums );
+extern void            Cnf_ManDeriveClauses( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs, int * pVarNums, void * pUser, void (*pFuncClause)(void *, int *, int) );
 extern Cnf_Dat_t *     Cnf_ManWriteCnf( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs );
 extern Cnf_Dat_t *     Cnf_ManWriteCnfOther( Cnf_Man_t * p, Vec_Ptr_t * vMapped );
 extern Cnf_Dat_t *     Cnf_DeriveSimple( Aig_Man_t * p, int nOutputs );
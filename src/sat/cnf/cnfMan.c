@@ -640,29 +640,49 @@ int Cnf_DataWriteAndClauses( void * p, Cnf_Dat_t * pCnf )
 
 /**Function*************************************************************
 
-  Synopsis    [Transforms polarity of the internal veriables.]
+  Synopsis    [Collects polarity of the variables.]
 
-  Description []
+  Description [Returns the map of the variable numbers into the phases
+  of the corresponding objects. The COs get 0 unless fTransformPos is set.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-void Cnf_DataTranformPolarity( Cnf_Dat_t * pCnf, int fTransformPos )
+int * Cnf_DataCollectVarPolarity( Aig_Man_t * pAig, int * pVarNums, int nVars, int fTransformPos )
 {
     Aig_Obj_t * pObj;
     int * pVarToPol;
-    int i, iVar;
-    // create map from the variable number to its polarity
-    pVarToPol = ABC_CALLOC( int, pCnf->nVars );
-    Aig_ManForEachObj( pCnf->pMan, pObj, i )
+    int i;
+    pVarToPol = ABC_CALLOC( int, nVars );
+    Aig_ManForEachObj( pAig, pObj, i )
     {
         if ( !fTransformPos && Aig_ObjIsCo(pObj) )
             continue;
-        if ( pCnf->pVarNums[pObj->Id] >= 0 )
-            pVarToPol[ pCnf->pVarNums[pObj->Id] ] = pObj->fPhase;
+        if ( pVarNums[pObj->Id] >= 0 )
+            pVarToPol[ pVarNums[pObj->Id] ] = pObj->fPhase;
     }
+    return pVarToPol;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Transforms polarity of the internal veriables.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cnf_DataTranformPolarity( Cnf_Dat_t * pCnf, int fTransformPos )
+{
+    int * pVarToPol;
+    int i, iVar;
+    // create map from the variable number to its polarity
+    pVarToPol = Cnf_DataCollectVarPolarity( pCnf->pMan, pCnf->pVarNums, pCnf->nVars, fTransformPos );
     // transform literals
     for ( i = 0; i < pCnf->nLiterals; i++ )
     {
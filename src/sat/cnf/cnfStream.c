@@ -0,0 +1,453 @@
+/**CFile****************************************************************
+
+  FileName    [cnfStream.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [AIG-to-CNF conversion.]
+
+  Synopsis    [Streaming CNF writer and DIMACS reader.]
+
+  Author      [agent]
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: cnfStream.c,v 1.00 2026/10/17 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "cnf.h"
+#include "misc/zlib/zlib.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The clauses are written as soon as they are generated and read as soon
+// as they are parsed, so that the memory does not depend on the CNF size.
+// Besides the text DIMACS, the binary format is supported, which has the
+// header line "p bcnf <vars> <clauses>" followed by the clauses, each
+// being a sequence of literals 2*var+sign (var > 0) written using the
+// 7-bit encoding and terminated by zero.
+
+#define CNF_STREAM_BUF (1 << 16)
+
+typedef struct Cnf_Stream_t_ Cnf_Stream_t;
+struct Cnf_Stream_t_
+{
+    FILE *       pFile;      // the uncompressed file
+    gzFile       pGzFile;    // the compressed file
+    int          fBinary;    // binary format
+    int *        pPolar;     // polarity of the variables (writing)
+    int          nBuffer;    // the number of bytes in the buffer
+    int          iBuffer;    // the current position in the buffer (reading)
+    char         pBuffer[CNF_STREAM_BUF];
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Buffered output.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Cnf_Stream_t * Cnf_StreamOpenWrite( char * pFileName, int fBinary )
+{
+    Cnf_Stream_t * p = ABC_CALLOC( Cnf_Stream_t, 1 );
+    int nLength = strlen(pFileName);
+    if ( nLength > 3 && !strcmp(pFileName + nLength - 3, ".gz") )
+        p->pGzFile = gzopen( pFileName, "wb" );
+    else
+        p->pFile = fopen( pFileName, "wb" );
+    if ( p->pFile == NULL && p->pGzFile == NULL )
+    {
+        ABC_FREE( p );
+        return NULL;
+    }
+    p->fBinary = fBinary;
+    return p;
+}
+static void Cnf_StreamFlush( Cnf_Stream_t * p )
+{
+    if ( p->pGzFile )
+        gzwrite( p->pGzFile, p->pBuffer, (unsigned)p->nBuffer );
+    else
+        fwrite( p->pBuffer, 1, (size_t)p->nBuffer, p->pFile );
+    p->nBuffer = 0;
+}
+static void Cnf_StreamCloseWrite( Cnf_Stream_t * p )
+{
+    Cnf_StreamFlush( p );
+    if ( p->pGzFile )
+        gzclose( p->pGzFile );
+    else
+        fclose( p->pFile );
+    ABC_FREE( p );
+}
+static inline void Cnf_StreamPutStr( Cnf_Stream_t * p, char * pStr )
+{
+    int nLength = strlen(pStr);
+    if ( p->nBuffer + nLength > CNF_STREAM_BUF )
+        Cnf_StreamFlush( p );
+    memcpy( p->pBuffer + p->nBuffer, pStr, (size_t)nLength );
+    p->nBuffer += nLength;
+}
+static inline void Cnf_StreamPutNum( Cnf_Stream_t * p, int Num )
+{
+    char pDigits[16];
+    int nDigits = 0;
+    unsigned x = Num < 0 ? -Num : Num;
+    if ( p->nBuffer + 16 > CNF_STREAM_BUF )
+        Cnf_StreamFlush( p );
+    if ( Num < 0 )
+        p->pBuffer[p->nBuffer++] = '-';
+    do pDigits[nDigits++] = '0' + x % 10; while ( (x /= 10) );
+    while ( nDigits )
+        p->pBuffer[p->nBuffer++] = pDigits[--nDigits];
+}
+static inline void Cnf_StreamPutVarint( Cnf_Stream_t * p, unsigned x )
+{
+    if ( p->nBuffer + 8 > CNF_STREAM_BUF )
+        Cnf_StreamFlush( p );
+    while ( x & ~0x7f )
+    {
+        p->pBuffer[p->nBuffer++] = (char)((x & 0x7f) | 0x80);
+        x >>= 7;
+    }
+    p->pBuffer[p->nBuffer++] = (char)x;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes one clause.]
+
+  Description [The literals are 2*var+sign, with var starting from 0.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cnf_StreamPutClause( Cnf_Stream_t * p, int * pLits, int nLits )
+{
+    int i;
+    if ( p->fBinary )
+    {
+        for ( i = 0; i < nLits; i++ )
+            Cnf_StreamPutVarint( p, (unsigned)pLits[i] + 2 );
+        Cnf_StreamPutVarint( p, 0 );
+        return;
+    }
+    for ( i = 0; i < nLits; i++ )
+    {
+        Cnf_StreamPutNum( p, Abc_LitIsCompl(pLits[i]) ? -Abc_Lit2Var(pLits[i])-1 : Abc_Lit2Var(pLits[i])+1 );
+        p->pBuffer[p->nBuffer++] = ' ';
+    }
+    Cnf_StreamPutStr( p, "0\n" );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes one clause after changing polarity.]
+
+  Description [Called by Cnf_ManDeriveClauses() for each clause.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cnf_StreamPutClausePol( void * pUser, int * pLits, int nLits )
+{
+    Cnf_Stream_t * p = (Cnf_Stream_t *)pUser;
+    int i;
+    if ( p->pPolar )
+        for ( i = 0; i < nLits; i++ )
+            pLits[i] ^= p->pPolar[Abc_Lit2Var(pLits[i])];
+    Cnf_StreamPutClause( p, pLits, nLits );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives CNF and writes it into a file.]
+
+  Description [Produces the same CNF as Cnf_Derive() followed by optional
+  Cnf_DataTranformPolarity() and Cnf_DataWriteIntoFile(), but writes the
+  clauses while walking the mapping, without storing them. Returns the
+  number of clauses or -1 if the file cannot be opened.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cnf_DeriveWriteIntoFile( Aig_Man_t * pAig, int nOutputs, char * pFileName, int fChangePol, int fBinary, int fVerbose )
+{
+    Cnf_Man_t * p;
+    Cnf_Stream_t * pStream;
+    Aig_MmFixed_t * pMemCuts;
+    Vec_Ptr_t * vMapped;
+    char pHeader[100];
+    int * pVarNums, nVars, nClauses, nLiterals;
+    abctime clk = Abc_Clock();
+    pStream = Cnf_StreamOpenWrite( pFileName, fBinary );
+    if ( pStream == NULL )
+    {
+        printf( "Cnf_DeriveWriteIntoFile(): Output file cannot be opened.\n" );
+        return -1;
+    }
+    // compute the mapping
+    Cnf_ManPrepare();
+    p = Cnf_ManRead();
+    p->pManAig = pAig;
+    pMemCuts = Dar_ManComputeCuts( pAig, 10, 0, 0 );
+    Cnf_DeriveMapping( p );
+    Cnf_ManTransferCuts( p );
+    vMapped = Cnf_ManScanMapping( p, 1, 1 );
+    nClauses = Cnf_ManCountClauses( p, vMapped, nOutputs, &nLiterals );
+    // assign variables in the same order as Cnf_ManWriteCnf()
+    pVarNums = ABC_ALLOC( int, Aig_ManObjNumMax(pAig) );
+    nVars = Cnf_ManAssignVarNums( p, vMapped, nOutputs, pVarNums );
+    // collect polarity of the variables (the POs are not transformed)
+    if ( fChangePol )
+        pStream->pPolar = Cnf_DataCollectVarPolarity( pAig, pVarNums, nVars, 0 );
+    // write the header
+    if ( !fBinary )
+        Cnf_StreamPutStr( pStream, "c Result of efficient AIG-to-CNF conversion using package CNF\n" );
+    sprintf( pHeader, "p %s %d %d\n", fBinary ? "bcnf" : "cnf", nVars, nClauses );
+    Cnf_StreamPutStr( pStream, pHeader );
+    // write the clauses
+    Cnf_ManDeriveClauses( p, vMapped, nOutputs, pVarNums, pStream, Cnf_StreamPutClausePol );
+    if ( !fBinary )
+        Cnf_StreamPutStr( pStream, "\n" );
+    ABC_FREE( pStream->pPolar );
+    Cnf_StreamCloseWrite( pStream );
+    // clean up
+    ABC_FREE( pVarNums );
+    Vec_PtrFree( vMapped );
+    Aig_MmFixedStop( pMemCuts, 0 );
+    Aig_ManResetRefs( pAig );
+    if ( fVerbose )
+    {
+        printf( "CNF stats: Vars = %6d. Clauses = %7d. Literals = %8d.   ", nVars, nClauses, nLiterals );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    return nClauses;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Buffered input.]
+
+  Description [The compressed and uncompressed files are both read using
+  zlib, which reads the uncompressed files transparently.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Cnf_StreamGetc( Cnf_Stream_t * p )
+{
+    if ( p->iBuffer == p->nBuffer )
+    {
+        p->nBuffer = gzread( p->pGzFile, p->pBuffer, CNF_STREAM_BUF );
+        p->iBuffer = 0;
+        if ( p->nBuffer <= 0 )
+        {
+            p->nBuffer = 0;
+            return EOF;
+        }
+    }
+    return (unsigned char)p->pBuffer[p->iBuffer++];
+}
+static inline int Cnf_StreamSkipSpaces( Cnf_Stream_t * p )
+{
+    int c;
+    while ( (c = Cnf_StreamGetc(p)) == ' ' || c == '\t' || c == '\r' || c == '\n' );
+    return c;
+}
+static inline void Cnf_StreamSkipLine( Cnf_Stream_t * p )
+{
+    int c;
+    while ( (c = Cnf_StreamGetc(p)) != '\n' && c != EOF );
+}
+// reads the number starting with the character c; returns 0 if there is no number
+// (the character following the number is not consumed)
+static inline int Cnf_StreamGetNum( Cnf_Stream_t * p, int c, int * pNum )
+{
+    int fNeg = 0, Num = 0;
+    if ( c == '-' || c == '+' )
+        fNeg = (c == '-'), c = Cnf_StreamGetc(p);
+    if ( c < '0' || c > '9' )
+        return 0;
+    for ( ; c >= '0' && c <= '9'; c = Cnf_StreamGetc(p) )
+        Num = 10 * Num + (c - '0');
+    if ( c != EOF ) // return the delimiter to the buffer
+        p->iBuffer--;
+    *pNum = fNeg ? -Num : Num;
+    return 1;
+}
+// reads the variable-length number; returns 0 at the end of the file
+// and -1 if the number is truncated or does not fit into 32 bits
+static inline int Cnf_StreamGetVarint( Cnf_Stream_t * p, unsigned * pNum )
+{
+    unsigned Num = 0;
+    int c, Shift = 0;
+    do {
+        if ( (c = Cnf_StreamGetc(p)) == EOF )
+            return Shift ? -1 : 0;
+        if ( Shift > 28 || (Shift == 28 && (c & 0x70)) )
+            return -1;
+        Num |= (unsigned)(c & 0x7f) << Shift;
+        Shift += 7;
+    } while ( c & 0x80 );
+    *pNum = Num;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the DIMACS file while passing the clauses to the user.]
+
+  Description [Reads text DIMACS, binary DIMACS (see above), and their
+  gzipped versions. Calls pFuncStart() after reading the header and
+  pFuncClause() for each clause, whose literals are 2*var+sign, with var
+  starting from 0. The literal array is reused for the next clause.
+  Returns 1 if the file was read, 0 if pFuncClause() returned 0 (for
+  example, the solver found a conflict), and -1 if the file is wrong.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cnf_DataReadStream( char * pFileName, void * pUser, void (*pFuncStart)(void *, int, int), int (*pFuncClause)(void *, int *, int) )
+{
+    Cnf_Stream_t * p;
+    Vec_Int_t * vLits;
+    unsigned uLit;
+    int c, Num, Status, nVars = -1, nClauses = -1, nClausesRead = 0, RetValue = -1;
+    char pFormat[8];
+    p = ABC_CALLOC( Cnf_Stream_t, 1 );
+    p->pGzFile = gzopen( pFileName, "rb" );
+    if ( p->pGzFile == NULL )
+    {
+        printf( "Cannot open file \"%s\" for reading.\n", pFileName );
+        ABC_FREE( p );
+        return -1;
+    }
+    vLits = Vec_IntAlloc( 100 );
+    // read the comments and the header
+    while ( (c = Cnf_StreamSkipSpaces(p)) == 'c' )
+        Cnf_StreamSkipLine( p );
+    if ( c != 'p' )
+    {
+        printf( "There is no parameter line.\n" );
+        goto finish;
+    }
+    c = Cnf_StreamSkipSpaces( p );
+    for ( Num = 0; c != EOF && c != ' ' && c != '\t' && Num < 7; c = Cnf_StreamGetc(p) )
+        pFormat[Num++] = (char)c;
+    pFormat[Num] = 0;
+    p->fBinary = !strcmp( pFormat, "bcnf" );
+    if ( (!p->fBinary && strcmp(pFormat, "cnf")) ||
+         !Cnf_StreamGetNum(p, Cnf_StreamSkipSpaces(p), &nVars) ||
+         !Cnf_StreamGetNum(p, Cnf_StreamSkipSpaces(p), &nClauses) || nVars < 0 || nClauses < 0 )
+    {
+        printf( "Incorrect parameter line.\n" );
+        goto finish;
+    }
+    Cnf_StreamSkipLine( p );
+    if ( pFuncStart )
+        pFuncStart( pUser, nVars, nClauses );
+    // read the clauses
+    while ( 1 )
+    {
+        if ( p->fBinary )
+        {
+            if ( (Status = Cnf_StreamGetVarint(p, &uLit)) == 0 )
+                break;
+            if ( Status == -1 )
+            {
+                printf( "Incorrect literal encoding after %d clauses.\n", nClausesRead );
+                goto finish;
+            }
+            if ( uLit != 0 )
+            {
+                if ( uLit == 1 || (uLit - 2) / 2 >= (unsigned)nVars )
+                {
+                    printf( "Literal %u is out-of-bound for %d variables.\n", uLit, nVars );
+                    goto finish;
+                }
+                Vec_IntPush( vLits, (int)uLit - 2 );
+                continue;
+            }
+        }
+        else
+        {
+            if ( (c = Cnf_StreamSkipSpaces(p)) == EOF )
+                break;
+            if ( c == 'c' )
+            {
+                Cnf_StreamSkipLine( p );
+                continue;
+            }
+            if ( !Cnf_StreamGetNum(p, c, &Num) )
+            {
+                printf( "Unexpected character '%c' after %d clauses.\n", c, nClausesRead );
+                goto finish;
+            }
+            if ( Num != 0 )
+            {
+                Vec_IntPush( vLits, Abc_Var2Lit(Abc_AbsInt(Num)-1, Num < 0) );
+                if ( Abc_AbsInt(Num) > nVars )
+                {
+                    printf( "Variable %d is out-of-bound for %d variables.\n", Abc_AbsInt(Num), nVars );
+                    goto finish;
+                }
+                continue;
+            }
+        }
+        // the clause is complete
+        nClausesRead++;
+        if ( !pFuncClause(pUser, Vec_IntArray(vLits), Vec_IntSize(vLits)) )
+        {
+            RetValue = 0;
+            goto finish;
+        }
+        Vec_IntClear( vLits );
+    }
+    if ( Vec_IntSize(vLits) > 0 )
+    {
+        printf( "The last clause is not terminated by zero.\n" );
+        goto finish;
+    }
+    if ( nClausesRead != nClauses )
+        printf( "Warning! The number of clauses (%d) is different from declaration (%d).\n", nClausesRead, nClauses );
+    RetValue = 1;
+finish:
+    Vec_IntFree( vLits );
+    gzclose( p->pGzFile );
+    ABC_FREE( p );
+    return RetValue;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -185,28 +185,21 @@ int Cnf_IsopWriteCube( int Cube, int nVars, int * pVars, int * pLiterals )
 
 /**Function*************************************************************
 
-  Synopsis    [Derives CNF for the mapping.]
+  Synopsis    [Counts the number of clauses and literals in the CNF.]
 
-  Description [The last argument shows the number of last outputs
-  of the manager, which will not be converted into clauses but the
-  new variables for which will be introduced.]
+  Description []
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-Cnf_Dat_t * Cnf_ManWriteCnf( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs )
+int Cnf_ManCountClauses( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs, int * pnLiterals )
 {
-    int fChangeVariableOrder = 0; // should be set to 0 to improve performance
     Aig_Obj_t * pObj;
-    Cnf_Dat_t * pCnf;
     Cnf_Cut_t * pCut;
-    Vec_Int_t * vCover, * vSopTemp;
-    int OutVar, PoVar, pVars[32], * pLits, ** pClas;
     unsigned uTruth;
-    int i, k, nLiterals, nClauses, Cube, Number;
-
+    int i, nLiterals, nClauses;
     // count the number of literals and clauses
     nLiterals = 1 + Aig_ManCoNum( p->pManAig ) + 3 * nOutputs;
     nClauses = 1 + Aig_ManCoNum( p->pManAig ) + nOutputs;
@@ -244,20 +237,30 @@ Cnf_Dat_t * Cnf_ManWriteCnf( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs )
 //printf( "%d ", nClauses-(1 + Aig_ManCoNum( p->pManAig )) );
     }
 //printf( "\n" );
+    *pnLiterals = nLiterals;
+    return nClauses;
+}
 
-    // allocate CNF
-    pCnf = ABC_CALLOC( Cnf_Dat_t, 1 );
-    pCnf->pMan = p->pManAig;
-    pCnf->nLiterals = nLiterals;
-    pCnf->nClauses = nClauses;
-    pCnf->pClauses = ABC_ALLOC( int *, nClauses + 1 );
-    pCnf->pClauses[0] = ABC_ALLOC( int, nLiterals );
-    pCnf->pClauses[nClauses] = pCnf->pClauses[0] + nLiterals;
-    // create room for variable numbers
-    pCnf->pVarNums = ABC_ALLOC( int, Aig_ManObjNumMax(p->pManAig) );
-//    memset( pCnf->pVarNums, 0xff, sizeof(int) * Aig_ManObjNumMax(p->pManAig) );
+/**Function*************************************************************
+
+  Synopsis    [Assigns CNF variables to the objects of the mapping.]
+
+  Description [The array pVarNums should have Aig_ManObjNumMax() entries.
+  The objects without variables get -1. Returns the number of variables.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cnf_ManAssignVarNums( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs, int * pVarNums )
+{
+    int fChangeVariableOrder = 0; // should be set to 0 to improve performance
+    Aig_Obj_t * pObj;
+    int i, Number, nVars;
+//    memset( pVarNums, 0xff, sizeof(int) * Aig_ManObjNumMax(p->pManAig) );
     for ( i = 0; i < Aig_ManObjNumMax(p->pManAig); i++ )
-        pCnf->pVarNums[i] = -1;
+        pVarNums[i] = -1;
 
     if ( !fChangeVariableOrder )
     {
@@ -269,67 +272,89 @@ Cnf_Dat_t * Cnf_ManWriteCnf( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs )
             {
                 assert( nOutputs == Aig_ManCoNum(p->pManAig) );
                 Aig_ManForEachCo( p->pManAig, pObj, i )
-                    pCnf->pVarNums[pObj->Id] = Number++;
+                    pVarNums[pObj->Id] = Number++;
             }
             else
             {
                 assert( nOutputs == Aig_ManRegNum(p->pManAig) );
                 Aig_ManForEachLiSeq( p->pManAig, pObj, i )
-                    pCnf->pVarNums[pObj->Id] = Number++;
+                    pVarNums[pObj->Id] = Number++;
             }
         }
         // assign variables to the internal nodes
         Vec_PtrForEachEntry( Aig_Obj_t *, vMapped, pObj, i )
-            pCnf->pVarNums[pObj->Id] = Number++;
+            pVarNums[pObj->Id] = Number++;
         // assign variables to the PIs and constant node
         Aig_ManForEachCi( p->pManAig, pObj, i )
-            pCnf->pVarNums[pObj->Id] = Number++;
-        pCnf->pVarNums[Aig_ManConst1(p->pManAig)->Id] = Number++;
-        pCnf->nVars = Number;
+            pVarNums[pObj->Id] = Number++;
+        pVarNums[Aig_ManConst1(p->pManAig)->Id] = Number++;
+        nVars = Number;
     }
     else
     {
         // assign variables to the last (nOutputs) POs
         Number = Aig_ManObjNumMax(p->pManAig) + 1;
-        pCnf->nVars = Number + 1;
+        nVars = Number + 1;
         if ( nOutputs )
         {
             if ( Aig_ManRegNum(p->pManAig) == 0 )
             {
                 assert( nOutputs == Aig_ManCoNum(p->pManAig) );
                 Aig_ManForEachCo( p->pManAig, pObj, i )
-                    pCnf->pVarNums[pObj->Id] = Number--;
+                    pVarNums[pObj->Id] = Number--;
             }
             else
             {
                 assert( nOutputs == Aig_ManRegNum(p->pManAig) );
                 Aig_ManForEachLiSeq( p->pManAig, pObj, i )
-                    pCnf->pVarNums[pObj->Id] = Number--;
+                    pVarNums[pObj->Id] = Number--;
             }
         }
         // assign variables to the internal nodes
         Vec_PtrForEachEntry( Aig_Obj_t *, vMapped, pObj, i )
-            pCnf->pVarNums[pObj->Id] = Number--;
+            pVarNums[pObj->Id] = Number--;
         // assign variables to the PIs and constant node
         Aig_ManForEachCi( p->pManAig, pObj, i )
-            pCnf->pVarNums[pObj->Id] = Number--;
-        pCnf->pVarNums[Aig_ManConst1(p->pManAig)->Id] = Number--;
+            pVarNums[pObj->Id] = Number--;
+        pVarNums[Aig_ManConst1(p->pManAig)->Id] = Number--;
         assert( Number >= 0 );
     }
+    return nVars;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives clauses for the mapping.]
+
+  Description [Calls pFuncClause() for each clause. The literals are
+  2*var+sign, where the variables come from pVarNums computed by
+  Cnf_ManAssignVarNums(). The literal array is reused for the next clause.
+  The last argument of Cnf_ManWriteCnf() has the same meaning here.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cnf_ManDeriveClauses( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs, int * pVarNums, void * pUser, void (*pFuncClause)(void *, int *, int) )
+{
+    Aig_Obj_t * pObj;
+    Cnf_Cut_t * pCut;
+    Vec_Int_t * vCover, * vSopTemp;
+    int OutVar, PoVar, pVars[32], pLits[33];
+    unsigned uTruth;
+    int i, k, nLits, Cube;
 
-    // assign the clauses
     vSopTemp = Vec_IntAlloc( 1 << 16 );
-    pLits = pCnf->pClauses[0];
-    pClas = pCnf->pClauses;
     Vec_PtrForEachEntry( Aig_Obj_t *, vMapped, pObj, i )
     {
         pCut = Cnf_ObjBestCut( pObj );
 
         // save variables of this cut
-        OutVar = pCnf->pVarNums[ pObj->Id ];
+        OutVar = pVarNums[ pObj->Id ];
         for ( k = 0; k < (int)pCut->nFanins; k++ )
         {
-            pVars[k] = pCnf->pVarNums[ pCut->pFanins[k] ];
+            pVars[k] = pVarNums[ pCut->pFanins[k] ];
             assert( pVars[k] <= Aig_ManObjNumMax(p->pManAig) );
         }
 
@@ -344,9 +369,9 @@ Cnf_Dat_t * Cnf_ManWriteCnf( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs )
             vCover = pCut->vIsop[1];
         Vec_IntForEachEntry( vCover, Cube, k )
         {
-            *pClas++ = pLits;
-            *pLits++ = 2 * OutVar; 
-            pLits += Cnf_IsopWriteCube( Cube, pCut->nFanins, pVars, pLits );
+            pLits[0] = 2 * OutVar; 
+            nLits = 1 + Cnf_IsopWriteCube( Cube, pCut->nFanins, pVars, pLits + 1 );
+            pFuncClause( pUser, pLits, nLits );
         }
 
         // negative polarity of the cut
@@ -360,45 +385,100 @@ Cnf_Dat_t * Cnf_ManWriteCnf( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs )
             vCover = pCut->vIsop[0];
         Vec_IntForEachEntry( vCover, Cube, k )
         {
-            *pClas++ = pLits;
-            *pLits++ = 2 * OutVar + 1; 
-            pLits += Cnf_IsopWriteCube( Cube, pCut->nFanins, pVars, pLits );
+            pLits[0] = 2 * OutVar + 1; 
+            nLits = 1 + Cnf_IsopWriteCube( Cube, pCut->nFanins, pVars, pLits + 1 );
+            pFuncClause( pUser, pLits, nLits );
         }
     }
     Vec_IntFree( vSopTemp );
  
     // write the constant literal
-    OutVar = pCnf->pVarNums[ Aig_ManConst1(p->pManAig)->Id ];
+    OutVar = pVarNums[ Aig_ManConst1(p->pManAig)->Id ];
     assert( OutVar <= Aig_ManObjNumMax(p->pManAig) );
-    *pClas++ = pLits;
-    *pLits++ = 2 * OutVar; 
+    pLits[0] = 2 * OutVar; 
+    pFuncClause( pUser, pLits, 1 );
 
     // write the output literals
     Aig_ManForEachCo( p->pManAig, pObj, i )
     {
-        OutVar = pCnf->pVarNums[ Aig_ObjFanin0(pObj)->Id ];
+        OutVar = pVarNums[ Aig_ObjFanin0(pObj)->Id ];
         if ( i < Aig_ManCoNum(p->pManAig) - nOutputs )
         {
-            *pClas++ = pLits;
-            *pLits++ = 2 * OutVar + Aig_ObjFaninC0(pObj); 
+            pLits[0] = 2 * OutVar + Aig_ObjFaninC0(pObj); 
+            pFuncClause( pUser, pLits, 1 );
         }
         else
         {
-            PoVar = pCnf->pVarNums[ pObj->Id ];
+            PoVar = pVarNums[ pObj->Id ];
             // first clause
-            *pClas++ = pLits;
-            *pLits++ = 2 * PoVar; 
-            *pLits++ = 2 * OutVar + !Aig_ObjFaninC0(pObj); 
+            pLits[0] = 2 * PoVar; 
+            pLits[1] = 2 * OutVar + !Aig_ObjFaninC0(pObj); 
+            pFuncClause( pUser, pLits, 2 );
             // second clause
-            *pClas++ = pLits;
-            *pLits++ = 2 * PoVar + 1; 
-            *pLits++ = 2 * OutVar + Aig_ObjFaninC0(pObj); 
+            pLits[0] = 2 * PoVar + 1; 
+            pLits[1] = 2 * OutVar + Aig_ObjFaninC0(pObj); 
+            pFuncClause( pUser, pLits, 2 );
         }
     }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Saves one clause in the CNF.]
+
+  Description [The clauses are stored one after another, so the beginning
+  of the next clause is the end of the previous one.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cnf_ManStoreClause( void * pUser, int * pLits, int nLits )
+{
+    Cnf_Dat_t * pCnf = (Cnf_Dat_t *)pUser;
+    int * pStart = pCnf->pClauses[pCnf->nClauses];
+    memcpy( pStart, pLits, sizeof(int) * nLits );
+    pCnf->pClauses[++pCnf->nClauses] = pStart + nLits;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives CNF for the mapping.]
+
+  Description [The last argument shows the number of last outputs
+  of the manager, which will not be converted into clauses but the
+  new variables for which will be introduced.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Cnf_Dat_t * Cnf_ManWriteCnf( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs )
+{
+    Cnf_Dat_t * pCnf;
+    int nLiterals, nClauses;
+
+    // count the number of literals and clauses
+    nClauses = Cnf_ManCountClauses( p, vMapped, nOutputs, &nLiterals );
+
+    // allocate CNF
+    pCnf = ABC_CALLOC( Cnf_Dat_t, 1 );
+    pCnf->pMan = p->pManAig;
+    pCnf->nLiterals = nLiterals;
+    pCnf->pClauses = ABC_ALLOC( int *, nClauses + 1 );
+    pCnf->pClauses[0] = ABC_ALLOC( int, nLiterals );
+    // create room for variable numbers
+    pCnf->pVarNums = ABC_ALLOC( int, Aig_ManObjNumMax(p->pManAig) );
+    pCnf->nVars = Cnf_ManAssignVarNums( p, vMapped, nOutputs, pCnf->pVarNums );
+
+    // assign the clauses (nClauses is incremented as they are saved)
+    Cnf_ManDeriveClauses( p, vMapped, nOutputs, pCnf->pVarNums, pCnf, Cnf_ManStoreClause );
 
     // verify that the correct number of literals and clauses was written
-    assert( pLits - pCnf->pClauses[0] == nLiterals );
-    assert( pClas - pCnf->pClauses == nClauses );
+    assert( pCnf->pClauses[pCnf->nClauses] - pCnf->pClauses[0] == nLiterals );
+    assert( pCnf->nClauses == nClauses );
 //Cnf_DataPrint( pCnf, 1 );
     return pCnf;
 }
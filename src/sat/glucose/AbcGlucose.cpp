@@ -126,6 +126,12 @@ void glucose_solver_setstop(Gluco::SimpSolver* S, int * pstop)
     S->pstop = pstop;
 }
 
+void glucose_solver_setexport(Gluco::SimpSolver* S, void * pman, void(*pfunc)(void *, int *, int, int))
+{
+    S->pShareMan = pman;
+    S->pShareFunc = pfunc;
+}
+
 
 /**Function*************************************************************
 
@@ -218,6 +224,11 @@ void bmcg_sat_solver_set_stop(bmcg_sat_solver* s, int * pstop)
     glucose_solver_setstop((Gluco::SimpSolver*)s, pstop);
 }
 
+void bmcg_sat_solver_set_export(bmcg_sat_solver* s, void * pman, void(*pfunc)(void *, int *, int, int))
+{
+    glucose_solver_setexport((Gluco::SimpSolver*)s, pman, pfunc);
+}
+
 abctime bmcg_sat_solver_set_runtime_limit(bmcg_sat_solver* s, abctime Limit)
 {
     abctime nRuntimeLimit = ((Gluco::SimpSolver*)s)->nRuntimeLimit;
@@ -393,6 +404,12 @@ void glucose_solver_setstop(Gluco::Solver* S, int * pstop)
     S->pstop = pstop;
 }
 
+void glucose_solver_setexport(Gluco::Solver* S, void * pman, void(*pfunc)(void *, int *, int, int))
+{
+    S->pShareMan = pman;
+    S->pShareFunc = pfunc;
+}
+
 
 /**Function*************************************************************
 
@@ -480,6 +497,11 @@ void bmcg_sat_solver_set_stop(bmcg_sat_solver* s, int * pstop)
     glucose_solver_setstop((Gluco::Solver*)s, pstop);
 }
 
+void bmcg_sat_solver_set_export(bmcg_sat_solver* s, void * pman, void(*pfunc)(void *, int *, int, int))
+{
+    glucose_solver_setexport((Gluco::Solver*)s, pman, pfunc);
+}
+
 abctime bmcg_sat_solver_set_runtime_limit(bmcg_sat_solver* s, abctime Limit)
 {
     abctime nRuntimeLimit = ((Gluco::Solver*)s)->nRuntimeLimit;
@@ -602,43 +624,31 @@ void glucose_print_stats(SimpSolver& s, abctime clk)
   SeeAlso     []
 
 ***********************************************************************/
-void Glucose_ReadDimacs( char * pFileName, SimpSolver& s )
+static void Glucose_ReadDimacsStart( void * pUser, int nVars, int nClauses )
 {
-    vec<Lit> * lits = &s.user_lits;
-    char * pBuffer = Extra_FileReadContents( pFileName );
-    char * pTemp; int fComp, Var, VarMax = 0;
+    SimpSolver * s = (SimpSolver *)pUser;
+    if ( nVars > 0 )
+        s->addVar( nVars - 1 );
+}
+static int Glucose_ReadDimacsClause( void * pUser, int * pLits, int nLits )
+{
+    SimpSolver * s = (SimpSolver *)pUser;
+    vec<Lit> * lits = &s->user_lits;
+    int i, VarMax = 0;
+    if ( nLits == 0 )
+        return 1;
     lits->clear();
-    for ( pTemp = pBuffer; *pTemp; pTemp++ )
+    for ( i = 0; i < nLits; i++ )
     {
-        if ( *pTemp == 'c' || *pTemp == 'p' ) {
-            while ( *pTemp != '\n' )
-                pTemp++;
-            continue;
-        }
-        while ( *pTemp == ' ' || *pTemp == '\t' || *pTemp == '\r' || *pTemp == '\n' )
-            pTemp++;
-        fComp = 0;
-        if ( *pTemp == '-' )
-            fComp = 1, pTemp++;
-        if ( *pTemp == '+' )
-            pTemp++;
-        Var = atoi( pTemp );
-        if ( Var == 0 ) {
-            if ( lits->size() > 0 ) {
-                s.addVar( VarMax );
-                s.addClause(*lits);
-                lits->clear();
-            }
-        }
-        else {
-            Var--;
-            VarMax = Abc_MaxInt( VarMax, Var );
-            lits->push( toLit(Abc_Var2Lit(Var, fComp)) );
-        }
-        while ( *pTemp >= '0' && *pTemp <= '9' )
-            pTemp++;
+        VarMax = Abc_MaxInt( VarMax, Abc_Lit2Var(pLits[i]) );
+        lits->push( toLit(pLits[i]) );
     }
-    ABC_FREE( pBuffer );
+    s->addVar( VarMax );
+    return s->addClause(*lits);
+}
+int Glucose_ReadDimacs( char * pFileName, SimpSolver& s )
+{
+    return Cnf_DataReadStream( pFileName, &s, Glucose_ReadDimacsStart, Glucose_ReadDimacsClause );
 }
 
 /**Function*************************************************************
@@ -663,7 +673,11 @@ void Glucose_SolveCnf( char * pFileName, Glucose_Pars * pPars )
 //    gzFile in = gzopen(pFilename, "rb");
 //    parse_DIMACS(in, S);
 //    gzclose(in);
-    Glucose_ReadDimacs( pFileName, S );
+    if ( Glucose_ReadDimacs( pFileName, S ) == -1 )
+    {
+        printf( "Reading CNF from file \"%s\" has failed.\n", pFileName );
+        return;
+    }
 
     if ( pPars->verb )
     {
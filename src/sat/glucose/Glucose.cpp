@@ -96,6 +96,8 @@ Solver::Solver() :
     , nCallConfl(1000)
     , terminate_search_early(false)
     , pstop(NULL)
+    , pShareMan(NULL)
+    , pShareFunc(NULL)
     , nRuntimeLimit(0)
 
     , verbosity      (0)
@@ -1101,6 +1103,8 @@ lbool Solver::search(int nof_conflicts)
                 claBumpActivity(ca[cr]);
                 uncheckedEnqueue(learnt_clause[0], cr);
             }
+            if (pShareFunc)
+                pShareFunc(pShareMan, (int *)(Lit *)learnt_clause, learnt_clause.size(), nblevels);
             varDecayActivity();
             claDecayActivity();
 
@@ -60,6 +60,8 @@ public:
     int nCallConfl;                      // callback will be called every this number of conflicts
     bool terminate_search_early;         // used to stop the solver early if it as instructed by an external caller
     int * pstop;                         // another callback
+    void * pShareMan;                    // external manager receiving learned clauses
+    void(*pShareFunc)(void *, int *, int, int); // callback (manager, literals, size, LBD)
     uint64_t nRuntimeLimit;              // runtime limit
     vec<int> user_vec;
     vec<Lit> user_lits;
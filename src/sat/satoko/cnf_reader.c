@@ -6,99 +6,35 @@
 // See LICENSE for details.
 //
 //===------------------------------------------------------------------------===
-#include <assert.h>
-#include <ctype.h>
 #include <stdlib.h>
 #include <stdio.h>
-#include <string.h>
 
 #include "satoko.h"
 #include "solver.h"
-#include "utils/mem.h"
-#include "utils/vec/vec_uint.h"
 
 #include "misc/util/abc_global.h"
 ABC_NAMESPACE_IMPL_START
 
-/** Read the file into an internal buffer.
+extern int Cnf_DataReadStream(char *, void *, void (*)(void *, int, int), int (*)(void *, int *, int));
+
+/** Callbacks of the streaming DIMACS reader.
  *
- * This function will receive a file name. The return data is a string ended
- * with '\0'.
+ * The reader passes the literals as 2*var+sign, which is the literal
+ * encoding of the solver, so the clauses are added without conversion.
  *
  */
-static char * file_open(const char *fname)
-{
-    FILE *file = fopen(fname, "rb");
-    char *buffer;
-    int sz_file;
-    int ret;
-
-    if (file == NULL) {
-        printf("Couldn't open file: %s\n", fname);
-        return NULL;
-    }
-    fseek(file, 0, SEEK_END);
-    sz_file = ftell(file);
-    rewind(file);
-    buffer = satoko_alloc(char, sz_file + 3);
-    ret = fread(buffer, sz_file, 1, file);
-    buffer[sz_file + 0] = '\n';
-    buffer[sz_file + 1] = '\0';
-    return buffer;
-}
-
-static void skip_spaces(char **pos)
-{
-    assert(pos != NULL);
-    for (; isspace(**pos); (*pos)++);
-}
-
-static void skip_line(char **pos)
-{
-    assert(pos != NULL);
-    for(; **pos != '\n' && **pos != '\r' && **pos != EOF; (*pos)++);
-    if (**pos != EOF)
-        (*pos)++;
-    return;
-}
-
-static int read_int(char **token)
+static void read_start(void *user, int n_var, int n_clause)
 {
-    int value = 0;
-    int neg = 0;
-
-    skip_spaces(token);
-    if (**token == '-') {
-        neg = 1;
-        (*token)++;
-    } else if (**token == '+')
-        (*token)++;
-
-    if (!isdigit(**token)) {
-        printf("Parsing error. Unexpected char: %c.\n", **token);
-        exit(EXIT_FAILURE);
-    }
-    while (isdigit(**token)) {
-        value = (value * 10) + (**token - '0');
-        (*token)++;
-    }
-    return neg ? -value : value;
+    satoko_t **solver = (satoko_t **)user;
+    *solver = satoko_create();
 }
 
-static void read_clause(char **token, vec_uint_t *lits)
+static int read_clause(void *user, int *lits, int n_lits)
 {
-    int var;
-    unsigned sign;
-
-    vec_uint_clear(lits);
-    while (1) {
-        var = read_int(token);
-        if (var == 0)
-            break;
-        sign = (var > 0);
-        var = abs(var) - 1;
-        vec_uint_push_back(lits, var2lit((unsigned) var, (char)!sign));
-    }
+    satoko_t **solver = (satoko_t **)user;
+    if (n_lits == 0 || !satoko_add_clause(*solver, lits, n_lits))
+        return 0;
+    return 1;
 }
 
 /** Start the solver and reads the DIMAC file.
@@ -107,51 +43,16 @@ static void read_clause(char **token, vec_uint_t *lits)
  */
 int satoko_parse_dimacs(char *fname, satoko_t **solver)
 {
-    satoko_t *p = NULL;
-    vec_uint_t *lits = NULL;
-    int n_var;
-    int n_clause;
-    char *buffer = file_open(fname);
-    char *token;
+    int ret;
 
-    if (buffer == NULL)
+    *solver = NULL;
+    ret = Cnf_DataReadStream(fname, (void *)solver, read_start, read_clause);
+    if (ret == -1) {
+        if (*solver == NULL)
+            *solver = satoko_create();
         return -1;
-
-    token = buffer;
-    while (1) {
-        skip_spaces(&token);
-        if (*token == 0)
-            break;
-        else if (*token == 'c')
-            skip_line(&token);
-        else if (*token == 'p') {
-            token++;
-            skip_spaces(&token);
-            for(; !isspace(*token); token++); /* skip 'cnf' */
-
-            n_var = read_int(&token);
-            n_clause = read_int(&token);
-            skip_line(&token);
-            lits = vec_uint_alloc((unsigned) n_var);
-            p = satoko_create();
-        } else {
-            if (lits == NULL) {
-                printf("There is no parameter line.\n");
-                satoko_free(buffer);
-                return -1;
-            }
-            read_clause(&token, lits);
-            if (!satoko_add_clause(p, (int*)vec_uint_data(lits), vec_uint_size(lits))) {
-                printf("Unable to add clause: ");
-                vec_uint_print(lits);
-                return SATOKO_ERR;
-            }
-            }
     }
-    vec_uint_free(lits);
-    satoko_free(buffer);
-    *solver = p;
-    return SATOKO_OK;
+    return ret == 1 ? SATOKO_OK : SATOKO_ERR;
 }
 
 ABC_NAMESPACE_IMPL_END
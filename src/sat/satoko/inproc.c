@@ -0,0 +1,738 @@
+//===--- inproc.c -----------------------------------------------------------===
+//
+//                     satoko: Satisfiability solver
+//
+// This file is distributed under the BSD 2-Clause License.
+// See LICENSE for details.
+//
+//===------------------------------------------------------------------------===
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <string.h>
+
+#include "solver.h"
+#include "utils/mem.h"
+
+#include "misc/util/abc_global.h"
+ABC_NAMESPACE_IMPL_START
+
+/**
+ *  Inprocessing is performed between restarts at decision level 0:
+ *
+ *  - Backward subsumption: short original clauses remove the clauses they
+ *    subsume and strengthen the clauses they subsume after negating one
+ *    literal (self-subsuming resolution).
+ *
+ *  - Bounded variable elimination: a variable is eliminated if the number
+ *    of non-tautological resolvents of its original clauses does not exceed
+ *    the number of these clauses. The removed clauses are kept to extend the
+ *    model and to restore the variable when it is used again. The frozen
+ *    variables and the variables of the current assumptions are kept.
+ *
+ *  - Vivification of learnt clauses: the literals of the clause are assumed
+ *    false one by one and the clause is shortened when the propagation leads
+ *    to a conflict or implies the remaining literals.
+ *
+ *  The first two techniques work on occurrence lists with the watches
+ *  detached. The units derived in the process are propagated using the
+ *  occurrence lists. The watches are attached before vivification.
+ */
+typedef struct inproc_t_ inproc_t;
+struct inproc_t_ {
+    solver_t *s;
+    vec_wl_t *occs;         /* Occurrence lists of all clauses */
+    vec_char_t *frozen;     /* Variables that cannot be eliminated */
+    vec_uint_t *clauses;    /* Candidate clauses */
+    vec_uint_t *pos;        /* Clauses with the positive literal of the pivot */
+    vec_uint_t *neg;        /* Clauses with the negative literal of the pivot */
+    vec_uint_t *resolvents; /* Resolvents (size followed by literals) */
+    vec_uint_t *lits;       /* Temporary literals */
+    unsigned head;          /* Next trail entry to propagate using occurrence lists */
+    long steps;             /* Remaining effort of the current technique */
+};
+
+struct inproc_cand {
+    unsigned cost;
+    unsigned var;
+};
+
+//===------------------------------------------------------------------------===
+// Clause functions
+//===------------------------------------------------------------------------===
+static inline unsigned *clause_lits(struct clause *clause)
+{
+    return &(clause->data[0].lit);
+}
+
+static inline int clause_has_lit(struct clause *clause, unsigned lit)
+{
+    unsigned i;
+    for (i = 0; i < clause->size; i++)
+        if (clause->data[i].lit == lit)
+            return 1;
+    return 0;
+}
+
+static inline void inproc_clause_delete(solver_t *s, unsigned cref)
+{
+    struct clause *clause = clause_fetch(s, cref);
+
+    assert(clause->f_mark == 0);
+    if (clause->f_learnt)
+        s->stats.n_learnt_lits -= clause->size;
+    else
+        s->stats.n_original_lits -= clause->size;
+    clause->f_mark = 1;
+    cdb_remove(s->all_clauses, clause);
+}
+
+/* The first 'size' literals of the clause are kept. The activity of a learnt
+ * clause, which follows the literals, is moved. */
+static inline void inproc_clause_shrink(solver_t *s, struct clause *clause, unsigned size)
+{
+    unsigned n_removed = clause->size - size;
+
+    assert(size > 1 && size <= clause->size);
+    if (clause->f_learnt) {
+        clause->data[size].act = clause->data[clause->size].act;
+        if (clause->lbd > size)
+            clause->lbd = size;
+        s->stats.n_learnt_lits -= n_removed;
+    } else
+        s->stats.n_original_lits -= n_removed;
+    clause->size = size;
+    s->all_clauses->wasted += n_removed;
+}
+
+//===------------------------------------------------------------------------===
+// Occurrence lists and propagation at the decision level 0
+//===------------------------------------------------------------------------===
+static inline void inproc_occs_add(inproc_t *p, unsigned cref)
+{
+    struct clause *clause = clause_fetch(p->s, cref);
+    struct watcher w;
+    unsigned i;
+
+    w.cref = cref;
+    w.blocker = UNDEF;
+    for (i = 0; i < clause->size; i++)
+        watch_list_push(vec_wl_at(p->occs, clause->data[i].lit), w, 0);
+}
+
+/* Removes the false literals of the clause and deletes it if it is satisfied
+ * or unit. Returns 0 if all literals are false. */
+static int inproc_clause_simplify(inproc_t *p, unsigned cref)
+{
+    solver_t *s = p->s;
+    struct clause *clause = clause_fetch(s, cref);
+    unsigned *lits = clause_lits(clause);
+    unsigned i, j;
+
+    if (clause->f_mark)
+        return SATOKO_OK;
+    for (i = 0; i < clause->size; i++)
+        if (var_value(s, lit2var(lits[i])) != SATOKO_VAR_UNASSING &&
+            lit_value(s, lits[i]) == SATOKO_LIT_TRUE) {
+            inproc_clause_delete(s, cref);
+            return SATOKO_OK;
+        }
+    for (i = j = 0; i < clause->size; i++)
+        if (var_value(s, lit2var(lits[i])) == SATOKO_VAR_UNASSING)
+            lits[j++] = lits[i];
+    if (j == clause->size)
+        return SATOKO_OK;
+    if (j == 0)
+        return SATOKO_ERR;
+    if (j == 1) {
+        solver_enqueue(s, lits[0], UNDEF);
+        inproc_clause_delete(s, cref);
+        return SATOKO_OK;
+    }
+    inproc_clause_shrink(s, clause, j);
+    return SATOKO_OK;
+}
+
+static int inproc_propagate(inproc_t *p)
+{
+    solver_t *s = p->s;
+    struct watcher *w;
+
+    while (p->head < vec_uint_size(s->trail)) {
+        unsigned lit = vec_uint_at(s->trail, p->head++);
+        watch_list_foreach(p->occs, w, lit)
+            if (!inproc_clause_simplify(p, w->cref))
+                return SATOKO_ERR;
+        watch_list_foreach(p->occs, w, lit_compl(lit))
+            if (!inproc_clause_simplify(p, w->cref))
+                return SATOKO_ERR;
+    }
+    return SATOKO_OK;
+}
+
+/* Removes the literal from the clause, which may become unit */
+static int inproc_strengthen(inproc_t *p, unsigned cref, unsigned lit)
+{
+    solver_t *s = p->s;
+    struct clause *clause = clause_fetch(s, cref);
+    unsigned *lits = clause_lits(clause);
+    unsigned i, j;
+
+    for (i = j = 0; i < clause->size; i++)
+        if (lits[i] != lit)
+            lits[j++] = lits[i];
+    assert(j + 1 == clause->size);
+    s->stats.n_strengthened++;
+    if (j > 1) {
+        inproc_clause_shrink(s, clause, j);
+        return SATOKO_OK;
+    }
+    if (var_value(s, lit2var(lits[0])) == SATOKO_VAR_UNASSING)
+        solver_enqueue(s, lits[0], UNDEF);
+    else if (lit_value(s, lits[0]) == SATOKO_LIT_FALSE)
+        return SATOKO_ERR;
+    inproc_clause_delete(s, cref);
+    return SATOKO_OK;
+}
+
+//===------------------------------------------------------------------------===
+// Backward subsumption and self-subsuming resolution
+//===------------------------------------------------------------------------===
+static int inproc_subsume(inproc_t *p)
+{
+    solver_t *s = p->s;
+    unsigned max_size = s->opts.bve_max_resolvent;
+    unsigned *counts = satoko_calloc(unsigned, max_size + 2);
+    unsigned i, k, cref, size, n_cands = 0;
+
+    /* Short original clauses are sorted by size */
+    vec_uint_foreach(s->originals, cref, i) {
+        struct clause *clause = clause_fetch(s, cref);
+        if (!clause->f_mark && clause->size <= max_size)
+            counts[clause->size + 1]++, n_cands++;
+    }
+    for (size = 1; size <= max_size + 1; size++)
+        counts[size] += counts[size - 1];
+    vec_uint_resize(p->clauses, n_cands);
+    vec_uint_foreach(s->originals, cref, i) {
+        struct clause *clause = clause_fetch(s, cref);
+        if (!clause->f_mark && clause->size <= max_size)
+            vec_uint_assign(p->clauses, counts[clause->size]++, cref);
+    }
+    satoko_free(counts);
+
+    for (k = 0; k < n_cands && p->steps > 0; k++) {
+        struct clause *clause;
+        unsigned *lits, lit, best_lit = UNDEF, best_occs = UNDEF, side;
+        int status = SATOKO_OK;
+
+        cref = vec_uint_at(p->clauses, k);
+        clause = clause_fetch(s, cref);
+        if (clause->f_mark)
+            continue;
+        lits = clause_lits(clause);
+        for (i = 0; i < clause->size; i++) {
+            unsigned n_occs = watch_list_size(vec_wl_at(p->occs, lits[i])) +
+                              watch_list_size(vec_wl_at(p->occs, lit_compl(lits[i])));
+            if (n_occs < best_occs) {
+                best_occs = n_occs;
+                best_lit = lits[i];
+            }
+            vec_char_assign(s->seen, lit2var(lits[i]), 1 + lit_polarity(lits[i]));
+        }
+        /* The clauses subsumed or strengthened by the candidate contain
+         * either the literal with the fewest occurrences or its negation */
+        for (side = 0; side < 2 && status == SATOKO_OK; side++) {
+            struct watcher *w;
+            lit = side ? lit_compl(best_lit) : best_lit;
+            watch_list_foreach(p->occs, w, lit) {
+                struct clause *other = clause_fetch(s, w->cref);
+                unsigned *other_lits = clause_lits(other);
+                unsigned n_match = 0, n_flip = 0, flip_lit = UNDEF;
+
+                if (w->cref == cref || other->f_mark || other->size < clause->size)
+                    continue;
+                p->steps -= other->size;
+                for (i = 0; i < other->size; i++) {
+                    char mark = vec_char_at(s->seen, lit2var(other_lits[i]));
+                    if (mark == 0)
+                        continue;
+                    if (mark == 1 + lit_polarity(other_lits[i]))
+                        n_match++;
+                    else {
+                        n_flip++;
+                        flip_lit = other_lits[i];
+                    }
+                }
+                if (n_match == clause->size) {
+                    inproc_clause_delete(s, w->cref);
+                    s->stats.n_subsumed++;
+                } else if (n_match + 1 == clause->size && n_flip == 1) {
+                    if ((status = inproc_strengthen(p, w->cref, flip_lit)) == SATOKO_ERR)
+                        break;
+                }
+            }
+        }
+        clause = clause_fetch(s, cref);
+        lits = clause_lits(clause);
+        for (i = 0; i < clause->size; i++)
+            vec_char_assign(s->seen, lit2var(lits[i]), 0);
+        if (status == SATOKO_ERR || !inproc_propagate(p))
+            return SATOKO_ERR;
+    }
+    return SATOKO_OK;
+}
+
+//===------------------------------------------------------------------------===
+// Bounded variable elimination
+//===------------------------------------------------------------------------===
+static int inproc_cand_compare(const void *p1, const void *p2)
+{
+    const struct inproc_cand *c1 = (const struct inproc_cand *)p1;
+    const struct inproc_cand *c2 = (const struct inproc_cand *)p2;
+
+    if (c1->cost != c2->cost)
+        return c1->cost < c2->cost ? -1 : 1;
+    return c1->var < c2->var ? -1 : c1->var > c2->var;
+}
+
+/* Collects the live original clauses containing the literal */
+static void inproc_collect(inproc_t *p, unsigned lit, vec_uint_t *clauses)
+{
+    struct watcher *w;
+
+    vec_uint_clear(clauses);
+    watch_list_foreach(p->occs, w, lit) {
+        struct clause *clause = clause_fetch(p->s, w->cref);
+        if (!clause->f_mark && !clause->f_learnt && clause_has_lit(clause, lit))
+            vec_uint_push_back(clauses, w->cref);
+    }
+}
+
+/* Computes the resolvents of the clauses on the pivot variable. If 'fAdd' is
+ * 0, returns 0 when the resolvents are too many or too long; otherwise, saves
+ * the resolvents. */
+static int inproc_resolve(inproc_t *p, unsigned var, int fAdd)
+{
+    solver_t *s = p->s;
+    unsigned i, j, k, n_resolvents = 0;
+    unsigned n_limit = vec_uint_size(p->pos) + vec_uint_size(p->neg);
+    unsigned pivot = var2lit(var, 0);
+
+    vec_uint_clear(p->resolvents);
+    for (i = 0; i < vec_uint_size(p->pos); i++) {
+        struct clause *clause = clause_fetch(s, vec_uint_at(p->pos, i));
+        unsigned *lits = clause_lits(clause);
+        int fOk = 1;
+
+        for (k = 0; k < clause->size; k++)
+            vec_char_assign(s->seen, lit2var(lits[k]), 1 + lit_polarity(lits[k]));
+        for (j = 0; j < vec_uint_size(p->neg) && fOk; j++) {
+            struct clause *other = clause_fetch(s, vec_uint_at(p->neg, j));
+            unsigned *other_lits = clause_lits(other);
+            unsigned size = clause->size - 1, start = vec_uint_size(p->resolvents);
+            int fTaut = 0;
+
+            p->steps -= other->size;
+            if (fAdd) {
+                vec_uint_push_back(p->resolvents, 0);
+                for (k = 0; k < clause->size; k++)
+                    if (lits[k] != pivot)
+                        vec_uint_push_back(p->resolvents, lits[k]);
+            }
+            for (k = 0; k < other->size && !fTaut; k++) {
+                char mark = vec_char_at(s->seen, lit2var(other_lits[k]));
+                if (lit2var(other_lits[k]) == var || mark == 1 + lit_polarity(other_lits[k]))
+                    continue;
+                if (mark != 0)
+                    fTaut = 1;
+                else {
+                    size++;
+                    if (fAdd)
+                        vec_uint_push_back(p->resolvents, other_lits[k]);
+                }
+            }
+            if (fTaut) {
+                if (fAdd)
+                    vec_uint_shrink(p->resolvents, start);
+                continue;
+            }
+            if (fAdd)
+                vec_uint_assign(p->resolvents, start, size);
+            else if (++n_resolvents > n_limit || size > s->opts.bve_max_resolvent)
+                fOk = 0;
+        }
+        for (k = 0; k < clause->size; k++)
+            vec_char_assign(s->seen, lit2var(lits[k]), 0);
+        if (!fOk)
+            return 0;
+    }
+    return 1;
+}
+
+/* Saves the clause for model extension and restoration with the pivot first */
+static void inproc_elim_push(solver_t *s, unsigned cref, unsigned pivot)
+{
+    struct clause *clause = clause_fetch(s, cref);
+    unsigned i;
+
+    vec_uint_push_back(s->elim_clauses, clause->size);
+    vec_uint_push_back(s->elim_clauses, pivot);
+    for (i = 0; i < clause->size; i++)
+        if (clause->data[i].lit != pivot)
+            vec_uint_push_back(s->elim_clauses, clause->data[i].lit);
+    inproc_clause_delete(s, cref);
+}
+
+/* Adds the resolvent as an original clause */
+static int inproc_add_resolvent(inproc_t *p, unsigned *lits, unsigned size)
+{
+    solver_t *s = p->s;
+    unsigned i, cref;
+
+    vec_uint_clear(p->lits);
+    for (i = 0; i < size; i++) {
+        if (var_value(s, lit2var(lits[i])) == SATOKO_VAR_UNASSING)
+            vec_uint_push_back(p->lits, lits[i]);
+        else if (lit_value(s, lits[i]) == SATOKO_LIT_TRUE)
+            return SATOKO_OK;
+    }
+    if (vec_uint_size(p->lits) == 0)
+        return SATOKO_ERR;
+    if (vec_uint_size(p->lits) == 1) {
+        solver_enqueue(s, vec_uint_at(p->lits, 0), UNDEF);
+        return SATOKO_OK;
+    }
+    cref = solver_clause_create(s, p->lits, 0);
+    inproc_occs_add(p, cref);
+    return SATOKO_OK;
+}
+
+static int inproc_eliminate_var(inproc_t *p, unsigned var)
+{
+    solver_t *s = p->s;
+    unsigned i, side, size, pos_lit = var2lit(var, 0);
+    struct watcher *w;
+
+    inproc_collect(p, pos_lit, p->pos);
+    inproc_collect(p, lit_compl(pos_lit), p->neg);
+    if (vec_uint_size(p->pos) + vec_uint_size(p->neg) == 0 ||
+        vec_uint_size(p->pos) > s->opts.bve_max_occ ||
+        vec_uint_size(p->neg) > s->opts.bve_max_occ)
+        return SATOKO_OK;
+    if (!inproc_resolve(p, var, 0))
+        return SATOKO_OK;
+    inproc_resolve(p, var, 1);
+    /* The original clauses are saved, the learnt clauses are deleted */
+    for (i = 0; i < vec_uint_size(p->pos); i++)
+        inproc_elim_push(s, vec_uint_at(p->pos, i), pos_lit);
+    for (i = 0; i < vec_uint_size(p->neg); i++)
+        inproc_elim_push(s, vec_uint_at(p->neg, i), lit_compl(pos_lit));
+    for (side = 0; side < 2; side++) {
+        unsigned lit = side ? lit_compl(pos_lit) : pos_lit;
+        watch_list_foreach(p->occs, w, lit) {
+            struct clause *clause = clause_fetch(s, w->cref);
+            if (!clause->f_mark && clause_has_lit(clause, lit))
+                inproc_clause_delete(s, w->cref);
+        }
+    }
+    vec_char_assign(s->eliminated, var, 1);
+    s->n_eliminated++;
+    s->stats.n_eliminated++;
+    for (i = 0; i < vec_uint_size(p->resolvents); i += size + 1) {
+        size = vec_uint_at(p->resolvents, i);
+        if (!inproc_add_resolvent(p, vec_uint_at_ptr(p->resolvents, i + 1), size))
+            return SATOKO_ERR;
+    }
+    return inproc_propagate(p);
+}
+
+static int inproc_eliminate(inproc_t *p)
+{
+    solver_t *s = p->s;
+    unsigned var, n_vars = vec_char_size(s->assigns), n_cands = 0;
+    struct inproc_cand *cands = satoko_alloc(struct inproc_cand, n_vars);
+    int status = SATOKO_OK;
+    unsigned i;
+
+    for (var = 0; var < n_vars; var++) {
+        unsigned n_pos, n_neg;
+        if (var_value(s, var) != SATOKO_VAR_UNASSING || var_is_eliminated(s, var) || vec_char_at(p->frozen, var))
+            continue;
+        n_pos = watch_list_size(vec_wl_at(p->occs, var2lit(var, 0)));
+        n_neg = watch_list_size(vec_wl_at(p->occs, var2lit(var, 1)));
+        if (n_pos + n_neg == 0)
+            continue;
+        cands[n_cands].cost = n_pos * n_neg;
+        cands[n_cands].var = var;
+        n_cands++;
+    }
+    qsort((void *)cands, (size_t)n_cands, sizeof(struct inproc_cand), inproc_cand_compare);
+    for (i = 0; i < n_cands && p->steps > 0; i++) {
+        var = cands[i].var;
+        if (var_value(s, var) != SATOKO_VAR_UNASSING)
+            continue;
+        if ((status = inproc_eliminate_var(p, var)) == SATOKO_ERR)
+            break;
+    }
+    satoko_free(cands);
+    return status;
+}
+
+//===------------------------------------------------------------------------===
+// Vivification of learnt clauses
+//===------------------------------------------------------------------------===
+static int inproc_vivify(inproc_t *p)
+{
+    solver_t *s = p->s;
+    unsigned i, k, cref;
+
+    vec_uint_clear(p->clauses);
+    vec_uint_foreach(s->learnts, cref, i) {
+        struct clause *clause = clause_fetch(s, cref);
+        if (!clause->f_mark && clause->size > 2 && clause->lbd <= s->opts.vivify_max_lbd)
+            vec_uint_push_back(p->clauses, cref);
+    }
+    /* The most recent clauses are tried first */
+    for (k = vec_uint_size(p->clauses); k-- > 0 && p->steps > 0;) {
+        struct clause *clause;
+        unsigned *lits, size = 0;
+        long n_props = s->stats.n_propagations;
+
+        cref = vec_uint_at(p->clauses, k);
+        clause = clause_fetch(s, cref);
+        lits = clause_lits(clause);
+        if (clause->f_mark)
+            continue;
+        for (i = 0; i < clause->size; i++)
+            if (var_value(s, lit2var(lits[i])) != SATOKO_VAR_UNASSING &&
+                lit_value(s, lits[i]) == SATOKO_LIT_TRUE)
+                break;
+        clause_unwatch(s, cref);
+        if (i < clause->size) {
+            inproc_clause_delete(s, cref);
+            continue;
+        }
+        for (i = 0; i < clause->size; i++) {
+            unsigned lit = lits[i];
+            if (var_value(s, lit2var(lit)) == SATOKO_VAR_UNASSING) {
+                lits[size++] = lit;
+                vec_uint_push_back(s->trail_lim, vec_uint_size(s->trail));
+                solver_enqueue(s, lit_compl(lit), UNDEF);
+                if (solver_propagate(s) != UNDEF)
+                    break;
+            } else if (lit_value(s, lit) == SATOKO_LIT_TRUE) {
+                lits[size++] = lit;
+                break;
+            }
+        }
+        solver_cancel_until(s, 0);
+        p->steps -= s->stats.n_propagations - n_props + clause->size;
+        if (size == clause->size) {
+            clause_watch(s, cref);
+            continue;
+        }
+        s->stats.n_vivified += clause->size - size;
+        if (size > 1) {
+            inproc_clause_shrink(s, clause, size);
+            clause_watch(s, cref);
+            continue;
+        }
+        /* The clause is a unit or is false at the decision level 0 */
+        inproc_clause_delete(s, cref);
+        if (size == 0)
+            return SATOKO_ERR;
+        solver_enqueue(s, lits[0], UNDEF);
+        if (solver_propagate(s) != UNDEF)
+            return SATOKO_ERR;
+    }
+    return SATOKO_OK;
+}
+
+//===------------------------------------------------------------------------===
+// Inprocessing
+//===------------------------------------------------------------------------===
+static void inproc_detach_all(solver_t *s)
+{
+    unsigned i;
+
+    for (i = 0; i < 2 * vec_char_size(s->assigns); i++) {
+        vec_wl_at(s->watches, i)->size = 0;
+        vec_wl_at(s->watches, i)->n_bin = 0;
+    }
+}
+
+/* Removes the deleted clauses from the lists and optionally watches the others */
+static void inproc_compact(solver_t *s, int f_watch)
+{
+    vec_uint_t *vecs[2];
+    unsigned i, j, k, cref;
+
+    vecs[0] = s->originals;
+    vecs[1] = s->learnts;
+    for (k = 0; k < 2; k++) {
+        j = 0;
+        vec_uint_foreach(vecs[k], cref, i) {
+            if (clause_fetch(s, cref)->f_mark)
+                continue;
+            if (f_watch)
+                clause_watch(s, cref);
+            vec_uint_assign(vecs[k], j++, cref);
+        }
+        vec_uint_shrink(vecs[k], j);
+    }
+}
+
+/* The clauses are removed from the watches (which the reasons at the level
+ * 0 do not need) and added to the occurrence lists */
+static int inproc_start(inproc_t *p)
+{
+    solver_t *s = p->s;
+    unsigned i, lit, cref, n_vars = vec_char_size(s->assigns);
+
+    inproc_detach_all(s);
+    vec_uint_foreach(s->trail, lit, i)
+        vec_uint_assign(s->reasons, lit2var(lit), UNDEF);
+    p->occs = vec_wl_alloc(2 * n_vars);
+    for (i = 0; i < 2 * n_vars; i++)
+        vec_wl_push(p->occs);
+    p->frozen = vec_char_alloc(n_vars);
+    vec_char_duplicate(p->frozen, s->frozen);
+    vec_uint_foreach(s->assumptions, lit, i)
+        vec_char_assign(p->frozen, lit2var(lit), 1);
+    p->clauses = vec_uint_alloc(0);
+    p->pos = vec_uint_alloc(0);
+    p->neg = vec_uint_alloc(0);
+    p->resolvents = vec_uint_alloc(0);
+    p->lits = vec_uint_alloc(0);
+    p->head = vec_uint_size(s->trail);
+    vec_uint_foreach(s->originals, cref, i)
+        if (!clause_fetch(s, cref)->f_mark)
+            inproc_occs_add(p, cref);
+    vec_uint_foreach(s->learnts, cref, i)
+        if (!clause_fetch(s, cref)->f_mark)
+            inproc_occs_add(p, cref);
+    return SATOKO_OK;
+}
+
+static void inproc_stop(inproc_t *p)
+{
+    vec_wl_free(p->occs);
+    vec_char_free(p->frozen);
+    vec_uint_free(p->clauses);
+    vec_uint_free(p->pos);
+    vec_uint_free(p->neg);
+    vec_uint_free(p->resolvents);
+    vec_uint_free(p->lits);
+}
+
+int solver_inprocess(solver_t *s)
+{
+    inproc_t inproc, *p = &inproc;
+    int status = SATOKO_OK;
+    unsigned i, lit;
+
+    assert(solver_dlevel(s) == 0);
+    s->stats.n_inprocess++;
+    s->inproc_interval = (long)(stk_uint_max(s->inproc_interval, s->opts.inproc_first) * s->opts.inproc_inc);
+    s->n_confl_bfr_inproc = s->stats.n_conflicts_all + s->inproc_interval;
+    if (solver_propagate(s) != UNDEF)
+        return SATOKO_ERR;
+
+    memset(p, 0, sizeof(inproc_t));
+    p->s = s;
+    inproc_start(p);
+    p->steps = s->opts.inproc_steps;
+    status = inproc_subsume(p);
+    p->steps = s->opts.inproc_steps;
+    if (status == SATOKO_OK)
+        status = inproc_eliminate(p);
+    /* The units derived with the occurrence lists were propagated */
+    inproc_compact(s, 1);
+    s->i_qhead = vec_uint_size(s->trail);
+    p->steps = s->opts.inproc_steps;
+    if (status == SATOKO_OK)
+        status = inproc_vivify(p);
+    inproc_stop(p);
+    vec_uint_foreach(s->trail, lit, i)
+        vec_uint_assign(s->reasons, lit2var(lit), UNDEF);
+    inproc_compact(s, 0);
+
+    solver_rebuild_order(s);
+    s->n_assigns_simplify = vec_uint_size(s->trail);
+    s->n_props_simplify = s->stats.n_original_lits + s->stats.n_learnt_lits;
+    if (cdb_wasted(s->all_clauses) > cdb_size(s->all_clauses) * s->opts.garbage_max_ratio)
+        solver_garbage_collect(s);
+    return status;
+}
+
+//===------------------------------------------------------------------------===
+// Model extension and restoration of eliminated variables
+//===------------------------------------------------------------------------===
+/* The saved clauses are visited in the reverse order. The pivot literal of a
+ * clause that is not satisfied is made true. */
+void solver_extend_model(solver_t *s)
+{
+    vec_uint_t *starts = vec_uint_alloc(0);
+    unsigned i, k, size;
+
+    for (i = 0; i < vec_uint_size(s->elim_clauses); i += size + 1) {
+        size = vec_uint_at(s->elim_clauses, i);
+        vec_uint_push_back(starts, i + 1);
+    }
+    for (i = vec_uint_size(starts); i-- > 0;) {
+        unsigned *lits = vec_uint_at_ptr(s->elim_clauses, vec_uint_at(starts, i));
+        size = lits[-1];
+        for (k = 0; k < size; k++)
+            if (vec_char_at(s->polarity, lit2var(lits[k])) == lit_polarity(lits[k]))
+                break;
+        if (k == size)
+            vec_char_assign(s->polarity, lit2var(lits[0]), lit_polarity(lits[0]));
+    }
+    vec_uint_free(starts);
+}
+
+/* The saved clauses of the variable are added back, which may restore other
+ * variables eliminated after this one */
+void solver_restore_var(solver_t *s, unsigned var)
+{
+    vec_uint_t *restored;
+    unsigned *data = vec_uint_data(s->elim_clauses);
+    unsigned i, j, size;
+
+    if (!var_is_eliminated(s, var))
+        return;
+    assert(solver_dlevel(s) == 0);
+    vec_char_assign(s->eliminated, var, 0);
+    s->n_eliminated--;
+    if (!heap_in_heap(s->var_order, var) && var_value(s, var) == SATOKO_VAR_UNASSING)
+        heap_insert(s->var_order, var);
+    restored = vec_uint_alloc(0);
+    for (i = j = 0; i < vec_uint_size(s->elim_clauses); i += size + 1) {
+        size = data[i];
+        if (lit2var(data[i + 1]) == var) {
+            vec_uint_push_back(restored, size);
+            for (size = 0; size < data[i]; size++)
+                vec_uint_push_back(restored, data[i + 1 + size]);
+        } else {
+            memmove(data + j, data + i, sizeof(unsigned) * (size + 1));
+            j += size + 1;
+        }
+    }
+    vec_uint_shrink(s->elim_clauses, j);
+    for (i = 0; i < vec_uint_size(restored); i += size + 1) {
+        size = vec_uint_at(restored, i);
+        satoko_add_clause(s, (int *)vec_uint_at_ptr(restored, i + 1), (int)size);
+    }
+    vec_uint_free(restored);
+}
+
+void solver_restore_all(solver_t *s)
+{
+    unsigned var;
+
+    for (var = 0; s->n_eliminated && var < vec_char_size(s->eliminated); var++)
+        solver_restore_var(s, var);
+}
+
+ABC_NAMESPACE_IMPL_END
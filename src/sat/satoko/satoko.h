@@ -65,6 +65,14 @@ struct satoko_opts {
     unsigned clause_max_sz_bin_resol;
     unsigned clause_min_lbd_bin_resol;
     float garbage_max_ratio;
+
+    /* Inprocessing */
+    unsigned inproc_first;      /* N.of conflicts before the first inprocessing (0 = no inprocessing) */
+    float inproc_inc;           /* Growth factor of the n.of conflicts between inprocessings */
+    long inproc_steps;          /* Effort limit of each inprocessing technique */
+    unsigned bve_max_occ;       /* Max n.of clauses with a literal of an eliminated variable */
+    unsigned bve_max_resolvent; /* Max size of a resolvent (and of a subsuming clause) */
+    unsigned vivify_max_lbd;    /* Max LBD of a vivified learnt clause */
     char verbose;
     char no_simplify;
 };
@@ -83,6 +91,12 @@ struct satoko_stats {
 
     long n_original_lits;
     long n_learnt_lits;
+
+    unsigned n_inprocess;
+    long n_eliminated;
+    long n_subsumed;
+    long n_strengthened;
+    long n_vivified;
 };
 
 
@@ -106,6 +120,10 @@ extern int  satoko_solve_assumptions_limit(satoko_t *s, int * plits, int nlits,
 extern int  satoko_minimize_assumptions(satoko_t *s, int * plits, int nlits, int nconflim);
 extern void satoko_mark_cone(satoko_t *, int *, int);
 extern void satoko_unmark_cone(satoko_t *, int *, int);
+/* Frozen variables are not eliminated by inprocessing. The variables used
+ * in assumptions are frozen while solving. An eliminated variable is
+ * restored when it appears in a new clause or in an assumption. */
+extern void satoko_set_frozen(satoko_t *, int, int);
 
 extern void satoko_rollback(satoko_t *);
 extern void satoko_bookmark(satoko_t *);
@@ -138,6 +156,7 @@ extern int satoko_learntnum(satoko_t *);
 extern int satoko_conflictnum(satoko_t *);
 extern void satoko_set_stop(satoko_t *, int *);
 extern void satoko_set_stop_func(satoko_t *s, int (*fnct)(int));
+extern void satoko_set_export(satoko_t *s, void *pman, void (*fnct)(void *, int *, int, int));
 extern void satoko_set_runid(satoko_t *, int);
 extern int satoko_read_cex_varvalue(satoko_t *, int);
 extern abctime satoko_set_runtime_limit(satoko_t *, abctime);
@@ -356,6 +356,8 @@ static inline void solver_handle_conflict(solver_t *s, unsigned confl_cref)
         clause_watch(s, cref);
     }
     solver_enqueue(s, vec_uint_at(s->temp_lits, 0), cref);
+    if (s->pShareFunc)
+        s->pShareFunc(s->pShareMan, (int *)vec_uint_data(s->temp_lits), vec_uint_size(s->temp_lits), lbd);
     var_act_decay(s);
     clause_act_decay(s);
 }
@@ -394,7 +396,7 @@ static inline void solver_analyze_final(solver_t *s, unsigned lit)
     // solver_debug_check_unsat(s);
 }
 
-static inline void solver_garbage_collect(solver_t *s)
+void solver_garbage_collect(solver_t *s)
 {
     unsigned i;
     unsigned *array;
@@ -106,6 +106,18 @@ struct solver_t_ {
     int     RunId;           
     int   (*pFuncStop)(int);  
 
+    /* Inprocessing */
+    vec_char_t *frozen;       /* Variables that cannot be eliminated */
+    vec_char_t *eliminated;   /* Eliminated variables */
+    vec_uint_t *elim_clauses; /* Clauses removed by elimination (size, pivot literal, other literals) */
+    unsigned n_eliminated;    /* Number of eliminated variables */
+    long n_confl_bfr_inproc;  /* Number of conflicts before the next inprocessing */
+    long inproc_interval;     /* Number of conflicts between inprocessings */
+
+    /* Callback receiving learned clauses (manager, literals, size, LBD) */
+    void   *pShareMan;
+    void  (*pShareFunc)(void *, int *, int, int);
+
     struct satoko_stats stats;
     struct satoko_opts opts;
 };
@@ -115,6 +127,13 @@ extern unsigned solver_clause_create(solver_t *, vec_uint_t *, unsigned);
 extern char solver_search(solver_t *);
 extern void solver_cancel_until(solver_t *, unsigned);
 extern unsigned solver_propagate(solver_t *);
+extern void solver_garbage_collect(solver_t *);
+
+/* Inprocessing */
+extern int solver_inprocess(solver_t *);
+extern void solver_restore_var(solver_t *, unsigned);
+extern void solver_restore_all(solver_t *);
+extern void solver_extend_model(solver_t *);
 
 /* Debuging */
 extern void solver_debug_check(solver_t *, int);
@@ -150,6 +169,10 @@ static inline unsigned var_reason(solver_t *s, unsigned var)
 {
     return vec_uint_at(s->reasons, var);
 }
+static inline int var_is_eliminated(solver_t *s, unsigned var)
+{
+    return (int)vec_char_at(s->eliminated, var);
+}
 static inline int var_mark(solver_t *s, unsigned var)
 {
     return (int)vec_char_at(s->marks, var);
@@ -221,11 +244,28 @@ static inline int solver_has_marks(satoko_t *s)
     return (int)(s->marks != NULL);
 }
 
+static inline int solver_has_bookmark(satoko_t *s)
+{
+    return (int)(s->book_cl_orig || s->book_cl_lrnt || s->book_cdb || s->book_vars || s->book_trail);
+}
+
 static inline int solver_stop(satoko_t *s)
 {
     return s->pstop && *s->pstop;
 }
 
+static inline void solver_rebuild_order(solver_t *s)
+{
+    unsigned var;
+    vec_uint_t *vars = vec_uint_alloc(vec_char_size(s->assigns));
+
+    for (var = 0; var < vec_char_size(s->assigns); var++)
+        if (var_value(s, var) == SATOKO_VAR_UNASSING && !var_is_eliminated(s, var))
+            vec_uint_push_back(vars, var);
+    heap_build(s->var_order, vars);
+    vec_uint_free(vars);
+}
+
 //===------------------------------------------------------------------------===
 // Inline clause functions
 //===------------------------------------------------------------------------===
@@ -21,18 +21,6 @@ ABC_NAMESPACE_IMPL_START
 //===------------------------------------------------------------------------===
 // Satoko internal functions
 //===------------------------------------------------------------------------===
-static inline void solver_rebuild_order(solver_t *s)
-{
-    unsigned var;
-    vec_uint_t *vars = vec_uint_alloc(vec_char_size(s->assigns));
-
-    for (var = 0; var < vec_char_size(s->assigns); var++)
-        if (var_value(s, var) == SATOKO_VAR_UNASSING)
-            vec_uint_push_back(vars, var);
-    heap_build(s->var_order, vars);
-    vec_uint_free(vars);
-}
-
 static inline int clause_is_satisfied(solver_t *s, struct clause *clause)
 {
     unsigned i;
@@ -80,6 +68,23 @@ static inline void print_stats(solver_t *s)
     printf("conflicts     : %10ld\n", s->stats.n_conflicts);
     printf("decisions     : %10ld\n", s->stats.n_decisions);
     printf("propagations  : %10ld\n", s->stats.n_propagations);
+    if (s->stats.n_inprocess == 0)
+        return;
+    printf("inprocessings : %10d\n", s->stats.n_inprocess);
+    printf("eliminated    : %10ld\n", s->stats.n_eliminated);
+    printf("subsumed      : %10ld\n", s->stats.n_subsumed);
+    printf("strengthened  : %10ld\n", s->stats.n_strengthened);
+    printf("vivified lits : %10ld\n", s->stats.n_vivified);
+}
+
+static inline int solver_inproc_is_due(solver_t *s)
+{
+    /* Compaction would invalidate the bookmarked clause references */
+    if (s->opts.inproc_first == 0 || s->opts.no_simplify || solver_has_marks(s) || solver_has_bookmark(s))
+        return 0;
+    if (s->n_confl_bfr_inproc == 0)
+        s->n_confl_bfr_inproc = s->stats.n_conflicts_all + s->opts.inproc_first;
+    return s->stats.n_conflicts_all >= s->n_confl_bfr_inproc;
 }
 
 //===------------------------------------------------------------------------===
@@ -126,6 +131,10 @@ solver_t * satoko_create()
     s->last_dlevel = vec_uint_alloc(0);
     /* Misc temporary */
     s->stamps = vec_uint_alloc(0);
+    /* Inprocessing */
+    s->frozen = vec_char_alloc(0);
+    s->eliminated = vec_char_alloc(0);
+    s->elim_clauses = vec_uint_alloc(0);
     return s;
 }
 
@@ -153,6 +162,9 @@ void satoko_destroy(solver_t *s)
     vec_uint_free(s->stack);
     vec_uint_free(s->last_dlevel);
     vec_uint_free(s->stamps);
+    vec_char_free(s->frozen);
+    vec_char_free(s->eliminated);
+    vec_uint_free(s->elim_clauses);
     if (s->marks)
         vec_char_free(s->marks);
     satoko_free(s);
@@ -188,6 +200,13 @@ void satoko_default_opts(satoko_opts_t *opts)
     opts->clause_min_lbd_bin_resol = 6;
 
     opts->garbage_max_ratio = (float) 0.3;
+    /* Inprocessing */
+    opts->inproc_first = 0;
+    opts->inproc_inc = (float) 1.5;
+    opts->inproc_steps = 10000000;
+    opts->bve_max_occ = 16;
+    opts->bve_max_resolvent = 20;
+    opts->vivify_max_lbd = 8;
 }
 
 /**
@@ -246,6 +265,8 @@ int satoko_add_variable(solver_t *s, char sign)
     vec_uint_push_back(s->reasons, UNDEF);
     vec_uint_push_back(s->stamps, 0);
     vec_char_push_back(s->seen, 0);
+    vec_char_push_back(s->frozen, 0);
+    vec_char_push_back(s->eliminated, 0);
     heap_insert(s->var_order, var);
     if (s->marks)
         vec_char_push_back(s->marks, 0);
@@ -263,6 +284,9 @@ int satoko_add_clause(solver_t *s, int *lits, int size)
     max_var = lit2var(lits[size - 1]);
     while (max_var >= vec_act_size(s->activity))
         satoko_add_variable(s, SATOKO_LIT_FALSE);
+    if (s->n_eliminated)
+        for (i = 0; i < (unsigned)size; i++)
+            solver_restore_var(s, lit2var(lits[i]));
 
     vec_uint_clear(s->temp_lits);
     j = 0;
@@ -314,6 +338,7 @@ void satoko_assump_pop(solver_t *s)
 int satoko_solve(solver_t *s)
 {
     int status = SATOKO_UNDEC;
+    unsigned i, lit;
 
     assert(s);
     solver_clean_stats(s);
@@ -323,6 +348,13 @@ int satoko_solve(solver_t *s)
         printf("Satoko in inconsistent state\n");
         return SATOKO_UNDEC;
     }
+    /* Eliminated variables used in the assumptions are restored */
+    if (s->n_eliminated)
+        vec_uint_foreach(s->assumptions, lit, i)
+            if (var_is_eliminated(s, lit2var(lit))) {
+                solver_cancel_until(s, 0);
+                solver_restore_var(s, lit2var(lit));
+            }
 
     if (!s->opts.no_simplify)
         if (satoko_simplify(s) != SATOKO_OK)
@@ -336,7 +368,15 @@ int satoko_solve(solver_t *s)
             break;
         if (s->pFuncStop && s->pFuncStop(s->RunId))
             break;
+        /* Inprocessing between restarts */
+        if (status == SATOKO_UNDEC && solver_inproc_is_due(s) && solver_inprocess(s) == SATOKO_ERR) {
+            s->status = SATOKO_ERR;
+            vec_uint_clear(s->final_conflict);
+            status = SATOKO_UNSAT;
+        }
     }
+    if (status == SATOKO_SAT && s->n_eliminated)
+        solver_extend_model(s);
     if (s->opts.verbose)
         print_stats(s);
     
@@ -445,6 +485,8 @@ void satoko_bookmark(satoko_t *s)
     // printf("[Satoko] Bookmark.\n");
     assert(s->status == SATOKO_OK);
     assert(solver_dlevel(s) == 0);
+    /* Rolling back could drop the restored clauses of eliminated variables */
+    solver_restore_all(s);
     s->book_cl_orig = vec_uint_size(s->originals);
     s->book_cl_lrnt = vec_uint_size(s->learnts);
     s->book_vars = vec_char_size(s->assigns);
@@ -491,6 +533,12 @@ void satoko_reset(satoko_t *s)
     vec_uint_clear(s->stack);
     vec_uint_clear(s->last_dlevel);
     vec_uint_clear(s->stamps);
+    vec_char_clear(s->frozen);
+    vec_char_clear(s->eliminated);
+    vec_uint_clear(s->elim_clauses);
+    s->n_eliminated = 0;
+    s->n_confl_bfr_inproc = 0;
+    s->inproc_interval = 0;
     s->status = SATOKO_OK;
     s->var_act_inc = VAR_ACT_INIT_INC;
     s->clause_act_inc = CLAUSE_ACT_INIT_INC;
@@ -546,6 +594,8 @@ void satoko_rollback(satoko_t *s)
     vec_char_shrink(s->assigns, s->book_vars);
     vec_char_shrink(s->seen, s->book_vars);
     vec_char_shrink(s->polarity, s->book_vars);
+    vec_char_shrink(s->frozen, s->book_vars);
+    vec_char_shrink(s->eliminated, s->book_vars);
     solver_rebuild_order(s);
     /* Rewind solver and cancel level 0 assignments to the trail */
     solver_cancel_until(s, 0);
@@ -580,6 +630,14 @@ void satoko_unmark_cone(satoko_t *s, int *pvars, int n_vars)
         var_clean_mark(s, pvars[i]);
 }
 
+void satoko_set_frozen(satoko_t *s, int var, int frozen)
+{
+    assert(var < satoko_varnum(s));
+    vec_char_assign(s->frozen, var, (char)(frozen != 0));
+    if (frozen && s->n_eliminated)
+        solver_restore_var(s, var);
+}
+
 void satoko_write_dimacs(satoko_t *s, char *fname, int wrt_lrnt, int zero_var)
 {
     FILE *file;
@@ -652,6 +710,12 @@ void satoko_set_stop_func(satoko_t *s, int (*fnct)(int))
     s->pFuncStop = fnct;
 }
 
+void satoko_set_export(satoko_t *s, void *pman, void (*fnct)(void *, int *, int, int))
+{
+    s->pShareMan = pman;
+    s->pShareFunc = fnct;
+}
+
 void satoko_set_runid(satoko_t *s, int id)
 {
     s->RunId = id;